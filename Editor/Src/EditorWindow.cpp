@@ -194,7 +194,7 @@ namespace Editor {
     void EditorWindow::RenderPendingUi()
     {
         ImDrawData* drawData = TakeDrawData();
-        Runtime::EngineHolder::Get().GetRenderModule().GetRenderThread().EmplaceTask([this, drawData]() -> void {
+        Runtime::EngineHolder::Get().GetRenderModule().GetRenderThread().Spawn([this, drawData]() -> void {
             uiFrameFence->Wait();
             AcquireBackTexture();
             uiFrameFence->Reset();
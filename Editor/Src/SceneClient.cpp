@@ -4,6 +4,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 #include <GLFW/glfw3.h>
 #include <Editor/EditorWindow.h>
@@ -54,20 +55,29 @@ namespace Editor::Internal {
             {{ { -h, -h, -h }, { h, -h, -h }, { h, -h, h }, { -h, -h, h } }} // -y
         }};
 
-        Runtime::StaticMeshVertices result;
+        std::vector<Common::FVec3> positions;
+        std::vector<Common::FVec3> tangents;
+        std::vector<Common::FVec2> uv0;
+        std::vector<uint32_t> indices;
         for (const auto& face : facePositions) {
-            const auto baseVertex = static_cast<uint32_t>(result.positions.size());
+            const auto baseVertex = static_cast<uint32_t>(positions.size());
             for (size_t corner = 0; corner < 4; corner++) {
-                result.positions.emplace_back(face[corner]);
-                result.tangents.emplace_back(0.0f, 0.0f, 1.0f);
-                result.uv0.emplace_back(corner == 1 || corner == 2 ? 1.0f : 0.0f, corner >= 2 ? 1.0f : 0.0f);
+                positions.emplace_back(face[corner]);
+                tangents.emplace_back(0.0f, 0.0f, 1.0f);
+                uv0.emplace_back(corner == 1 || corner == 2 ? 1.0f : 0.0f, corner >= 2 ? 1.0f : 0.0f);
             }
             for (const uint32_t index : { 0u, 1u, 2u, 0u, 2u, 3u }) {
-                result.indices.emplace_back(baseVertex + index);
+                indices.emplace_back(baseVertex + index);
             }
         }
-        result.vertexCount = static_cast<uint32_t>(result.positions.size());
-        result.indexCount = static_cast<uint32_t>(result.indices.size());
+
+        Runtime::StaticMeshVertices result;
+        result.vertexCount = static_cast<uint32_t>(positions.size());
+        result.indexCount = static_cast<uint32_t>(indices.size());
+        result.positions = std::move(positions);
+        result.tangents = std::move(tangents);
+        result.uv0 = std::move(uv0);
+        result.indices = std::move(indices);
         return result;
     }
 
@@ -0,0 +1,246 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Common/Concurrent.h>
+
+// every case gets its own pool of state.range(0) threads, compare the rows of one case against each other to read the
+// thread scaling, the time spent creating and joining the pool is excluded
+namespace {
+    constexpr int64_t taskCount = 1 << 14;
+    constexpr int64_t parallelForSize = 1 << 20;
+    constexpr int64_t frameTaskCount = 10000;
+
+    // the WorkerThread before it moved to a lock-free ring, one mutex, a packaged_task and a std::function per task, kept
+    // here as the baseline of the WorkerThread cases
+    class MutexWorkerThread {
+    public:
+        explicit MutexWorkerThread(const std::string& name)
+            : stop(false)
+        {
+            thread = Common::NamedThread(name, [this]() -> void {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock lock(mutex);
+                        condition.wait(lock, [this]() -> bool { return stop || !tasks.empty(); });
+                        if (stop && tasks.empty()) {
+                            return;
+                        }
+                        task = std::move(tasks.front());
+                        tasks.pop();
+                    }
+                    task();
+                }
+            });
+        }
+
+        ~MutexWorkerThread()
+        {
+            {
+                std::unique_lock lock(mutex);
+                stop = true;
+            }
+            condition.notify_all();
+            thread.Join();
+        }
+
+        template <typename F>
+        auto EmplaceTask(F&& task)
+        {
+            using RetType = std::invoke_result_t<F>;
+            auto packagedTask = Common::MakeShared<std::packaged_task<RetType()>>(std::forward<F>(task));
+            auto result = packagedTask->get_future();
+            {
+                std::unique_lock lock(mutex);
+                tasks.emplace([packagedTask]() -> void { (*packagedTask)(); });
+            }
+            condition.notify_one();
+            return result;
+        }
+
+    private:
+        bool stop;
+        std::mutex mutex;
+        std::condition_variable condition;
+        Common::NamedThread thread;
+        std::queue<std::function<void()>> tasks;
+    };
+
+    // what SceneSystem sends per dirty entity, a pointer, an id and a transform
+    struct FrameTaskPayload {
+        void* target;
+        uint64_t entity;
+        float transform[10];
+    };
+
+    // submits frameTaskCount small tasks as one frame would and then waits for the consumer to drain them, the time is
+    // what the producer spends plus the drain latency
+    template <typename Thread, typename Submit>
+    void SubmitFrame(benchmark::State& state, Thread& thread, Submit&& submit)
+    {
+        std::atomic<int64_t> executed = 0;
+        FrameTaskPayload payload {};
+
+        for (auto _ : state) {
+            executed.store(0, std::memory_order_relaxed);
+            for (int64_t i = 0; i < frameTaskCount; i++) {
+                payload.entity = static_cast<uint64_t>(i);
+                submit(thread, [&executed, payload]() -> void {
+                    benchmark::DoNotOptimize(payload);
+                    executed.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+            thread.EmplaceTask([]() -> void {}).wait();
+            benchmark::DoNotOptimize(executed.load());
+        }
+
+        state.SetItemsProcessed(state.iterations() * frameTaskCount);
+    }
+
+    void MutexWorkerThreadEmplaceTask(benchmark::State& state)
+    {
+        MutexWorkerThread thread("ConcurrentBenchmark");
+        SubmitFrame(state, thread, [](auto& inThread, auto&& inTask) -> void { inThread.EmplaceTask(std::move(inTask)); });
+    }
+
+    void WorkerThreadEmplaceTask(benchmark::State& state)
+    {
+        Common::WorkerThread thread("ConcurrentBenchmark");
+        SubmitFrame(state, thread, [](auto& inThread, auto&& inTask) -> void { inThread.EmplaceTask(std::move(inTask)); });
+    }
+
+    void WorkerThreadSpawn(benchmark::State& state)
+    {
+        Common::WorkerThread thread("ConcurrentBenchmark");
+        SubmitFrame(state, thread, [](auto& inThread, auto&& inTask) -> void { inThread.Spawn(std::move(inTask)); });
+    }
+
+    // fire-and-forget tasks, measures the cost of queueing, stealing and running tasks that do nothing
+    void SpawnComplete(benchmark::State& state)
+    {
+        Common::ThreadPool pool("ConcurrentBenchmark", static_cast<uint8_t>(state.range(0)));
+        std::atomic<int64_t> completed = 0;
+
+        for (auto _ : state) {
+            completed.store(0, std::memory_order_relaxed);
+            for (int64_t i = 0; i < taskCount; i++) {
+                pool.Spawn([&completed]() -> void { completed.fetch_add(1, std::memory_order_relaxed); });
+            }
+            while (completed.load(std::memory_order_acquire) != taskCount) {
+                std::this_thread::yield();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * taskCount);
+    }
+
+    // the same as SpawnComplete but every task hands back a future, which costs one shared state allocation per task
+    void EmplaceTaskComplete(benchmark::State& state)
+    {
+        Common::ThreadPool pool("ConcurrentBenchmark", static_cast<uint8_t>(state.range(0)));
+        std::vector<std::future<void>> futures;
+        futures.reserve(taskCount);
+
+        for (auto _ : state) {
+            for (int64_t i = 0; i < taskCount; i++) {
+                futures.emplace_back(pool.EmplaceTask([]() -> void {}));
+            }
+            for (auto& future : futures) {
+                pool.Wait(future);
+            }
+            futures.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * taskCount);
+    }
+
+    // one index per task, the shape most engine code calls ExecuteTasks() with
+    void ExecuteTasks(benchmark::State& state)
+    {
+        Common::ThreadPool pool("ConcurrentBenchmark", static_cast<uint8_t>(state.range(0)));
+        std::atomic<int64_t> sum = 0;
+
+        for (auto _ : state) {
+            pool.ExecuteTasks(taskCount, [&sum](size_t inIndex) -> void {
+                sum.fetch_add(static_cast<int64_t>(inIndex), std::memory_order_relaxed);
+            });
+        }
+
+        benchmark::DoNotOptimize(sum.load());
+        state.SetItemsProcessed(state.iterations() * taskCount);
+    }
+
+    // a cheap per-element body over a large range, state.range(1) is the grain size, so the overhead of splitting shows
+    // up against the serial loop in ParallelForSerialBaseline
+    void ParallelFor(benchmark::State& state)
+    {
+        Common::ThreadPool pool("ConcurrentBenchmark", static_cast<uint8_t>(state.range(0)));
+        const auto grainSize = static_cast<size_t>(state.range(1));
+        std::vector<float> values(parallelForSize, 1.0f);
+
+        for (auto _ : state) {
+            pool.ParallelFor(0, values.size(), grainSize, [&values](size_t inBegin, size_t inEnd) -> void {
+                for (size_t i = inBegin; i < inEnd; i++) {
+                    values[i] = values[i] * 0.5f + 1.0f;
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * parallelForSize);
+    }
+
+    void ParallelForSerialBaseline(benchmark::State& state)
+    {
+        std::vector<float> values(parallelForSize, 1.0f);
+
+        for (auto _ : state) {
+            for (auto& value : values) {
+                value = value * 0.5f + 1.0f;
+            }
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * parallelForSize);
+    }
+
+    void ThreadNumArgs(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t threadNum = 1; threadNum <= 8; threadNum *= 2) {
+            benchmark->Arg(threadNum);
+        }
+        benchmark->UseRealTime();
+    }
+
+    void ParallelForArgs(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t threadNum = 1; threadNum <= 8; threadNum *= 2) {
+            for (const int64_t grainSize : { 256, 4096, 65536 }) {
+                benchmark->Args({ threadNum, grainSize });
+            }
+        }
+        benchmark->UseRealTime();
+    }
+}
+
+BENCHMARK(SpawnComplete)->Apply(ThreadNumArgs);
+BENCHMARK(EmplaceTaskComplete)->Apply(ThreadNumArgs);
+BENCHMARK(ExecuteTasks)->Apply(ThreadNumArgs);
+BENCHMARK(ParallelFor)->Apply(ParallelForArgs);
+BENCHMARK(ParallelForSerialBaseline);
+BENCHMARK(MutexWorkerThreadEmplaceTask)->UseRealTime();
+BENCHMARK(WorkerThreadEmplaceTask)->UseRealTime();
+BENCHMARK(WorkerThreadSpawn)->UseRealTime();
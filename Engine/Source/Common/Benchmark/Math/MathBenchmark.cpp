@@ -11,6 +11,8 @@
 #include <Common/Math/Matrix.h>
 #include <Common/Math/Quaternion.h>
 #include <Common/Math/Sphere.h>
+#include <Common/Math/Frustum.h>
+#include <Common/Math/Projection.h>
 #include <Common/Math/Transform.h>
 #include <Common/Math/View.h>
 
@@ -113,6 +115,27 @@ namespace {
         }
         return result;
     }
+
+    // parents keep a uniform scale so the parent * child matrix product stays decomposable, the worlds are the TRS
+    // products, the inputs of the transform system converting an edited world transform back into a local one
+    struct TransformHierarchyBatch {
+        std::vector<FTransform> parents;
+        std::vector<FTransform> children;
+        std::vector<FTransform> worlds;
+    };
+
+    TransformHierarchyBatch MakeRandomTransformHierarchy(const size_t count)
+    {
+        TransformHierarchyBatch result;
+        result.parents = MakeRandomTransforms(count);
+        result.children = MakeRandomTransforms(count);
+        result.worlds.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            result.parents[i].scale = FVec3(result.parents[i].scale.x);
+            result.worlds[i] = result.parents[i] * result.children[i];
+        }
+        return result;
+    }
 }
 
 template <MathBackend B>
@@ -308,6 +331,72 @@ static void TransformMatrixDirectBatch(benchmark::State& state)
 }
 BENCHMARK(TransformMatrixDirectBatch);
 
+static void TransformComposeMatrixBatch(benchmark::State& state)
+{
+    const auto input = MakeRandomTransformHierarchy(batchSize);
+    std::vector<FTransform> output(batchSize);
+    for (auto _ : state) {
+        for (int i = 0; i < batchSize; i++) {
+            output[i] = FTransform(input.parents[i].GetTransformMatrix() * input.children[i].GetTransformMatrix());
+        }
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(TransformComposeMatrixBatch);
+
+template <MathBackend B>
+static void TransformComposeDirectBatch(benchmark::State& state)
+{
+    const auto input = MakeRandomTransformHierarchy(batchSize);
+    std::vector<FTransform> output(batchSize);
+    for (auto _ : state) {
+        for (int i = 0; i < batchSize; i++) {
+            output[i] = Internal::TransformOps<float, B>::Compose(input.parents[i], input.children[i]);
+        }
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(TransformComposeDirectBatch<MathBackend::scalar>);
+BENCHMARK(TransformComposeDirectBatch<MathBackend::simd>);
+
+// the world -> local conversion as the transform system did it before, inverse parent matrix times world matrix and a
+// decomposition back into TRS
+static void TransformInverseComposeMatrixBatch(benchmark::State& state)
+{
+    const auto input = MakeRandomTransformHierarchy(batchSize);
+    std::vector<FTransform> output(batchSize);
+    for (auto _ : state) {
+        for (int i = 0; i < batchSize; i++) {
+            output[i] = FTransform(input.parents[i].GetTransformMatrix().Inverse() * input.worlds[i].GetTransformMatrix());
+        }
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(TransformInverseComposeMatrixBatch);
+
+template <MathBackend B>
+static void TransformInverseComposeDirectBatch(benchmark::State& state)
+{
+    const auto input = MakeRandomTransformHierarchy(batchSize);
+    std::vector<FTransform> output(batchSize);
+    for (auto _ : state) {
+        for (int i = 0; i < batchSize; i++) {
+            output[i] = Internal::TransformOps<float, B>::Relative(input.worlds[i], input.parents[i]);
+        }
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(TransformInverseComposeDirectBatch<MathBackend::scalar>);
+BENCHMARK(TransformInverseComposeDirectBatch<MathBackend::simd>);
+
 static void TransformPositionMatrixBatch(benchmark::State& state)
 {
     const auto transforms = MakeRandomTransforms(batchSize);
@@ -395,6 +484,67 @@ static void SphereInsideBatch(benchmark::State& state)
 }
 BENCHMARK(SphereInsideBatch);
 
+// scene sized culling, bounds scattered in a cube around a camera looking down +x so roughly a fifth survive
+namespace {
+    constexpr size_t cullBoundNum = 100000;
+
+    struct CullScene {
+        FFrustum frustum;
+        std::vector<FBox> boxes;
+        std::vector<FSphere> spheres;
+    };
+
+    CullScene MakeCullScene()
+    {
+        std::mt19937 rng(0x1234u);
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> extent(0.5f, 4.0f);
+
+        CullScene result;
+        const FReversedZPerspectiveProjection projection(90.0f, 1920.0f, 1080.0f, 0.1f, 1000.0f);
+        result.frustum = FFrustum::FromWorldToClip(projection.GetProjectionMatrix() * FViewTransform::LookAt(FVec3Consts::zero, FVec3(1, 0, 0)).GetViewMatrix());
+        result.boxes.reserve(cullBoundNum);
+        result.spheres.reserve(cullBoundNum);
+        for (size_t i = 0; i < cullBoundNum; i++) {
+            const FVec3 center(position(rng), position(rng), position(rng));
+            const float halfExtent = extent(rng);
+            result.boxes.emplace_back(center - FVec3(halfExtent), center + FVec3(halfExtent));
+            result.spheres.emplace_back(center, halfExtent);
+        }
+        return result;
+    }
+}
+
+template <MathBackend B>
+static void FrustumCullBoxes(benchmark::State& state)
+{
+    const auto scene = MakeCullScene();
+    std::vector<uint8_t> visibilities(cullBoundNum);
+    for (auto _ : state) {
+        Internal::FrustumOps<float, B>::IntersectBoxes(scene.frustum, scene.boxes.data(), cullBoundNum, visibilities.data());
+        benchmark::DoNotOptimize(visibilities.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * cullBoundNum);
+}
+BENCHMARK(FrustumCullBoxes<MathBackend::scalar>);
+BENCHMARK(FrustumCullBoxes<MathBackend::simd>);
+
+template <MathBackend B>
+static void FrustumCullSpheres(benchmark::State& state)
+{
+    const auto scene = MakeCullScene();
+    std::vector<uint8_t> visibilities(cullBoundNum);
+    for (auto _ : state) {
+        Internal::FrustumOps<float, B>::IntersectSpheres(scene.frustum, scene.spheres.data(), cullBoundNum, visibilities.data());
+        benchmark::DoNotOptimize(visibilities.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * cullBoundNum);
+}
+BENCHMARK(FrustumCullSpheres<MathBackend::scalar>);
+BENCHMARK(FrustumCullSpheres<MathBackend::simd>);
+
 static void HalfConvertBatch(benchmark::State& state)
 {
     const auto input = MakeRandomFloats(batchSize);
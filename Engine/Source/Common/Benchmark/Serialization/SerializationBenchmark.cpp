@@ -0,0 +1,223 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#if PLATFORM_LINUX
+#include <unistd.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <Common/Blob.h>
+#include <Common/Math/Adapters.h>
+#include <Common/Serialization.h>
+
+using namespace Common;
+
+// state.range(0) mesh positions through a memory stream, the element variants replay the per element path containers
+// used before the bulk path, so both write the same bytes, the big endian variants measure the swapping path on little
+// endian hosts, the record variants save and load asset like files made of many small back-patched fields, the
+// payload variants load a state.range(0) MB pixel payload as a vector from a file read (the path used before blobs)
+// or as a blob from a mapped file, optionally reading every byte as an upload would
+namespace {
+    using Record = std::pair<std::string, std::vector<uint32_t>>;
+
+    const std::string recordFile = "../Test/Generated/Common/SerializationBenchmark.bin";
+    const std::string payloadFile = "../Test/Generated/Common/SerializationBenchmark.Payload.bin";
+
+    // resident memory of the process, page cache pages of a mapped file included once touched, 0 where not supported
+    size_t ResidentBytes()
+    {
+#if PLATFORM_LINUX
+        std::ifstream statm("/proc/self/statm");
+        size_t totalPages = 0;
+        size_t residentPages = 0;
+        statm >> totalPages >> residentPages;
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+        return 0;
+#endif
+    }
+
+    std::vector<Record> MakeRecords(size_t inCount)
+    {
+        std::vector<Record> records(inCount);
+        for (auto i = 0; i < inCount; i++) {
+            records[i].first = "record" + std::to_string(i);
+            records[i].second.resize(16, i);
+        }
+        return records;
+    }
+
+    std::vector<FVec3> MakePositions(size_t inCount)
+    {
+        std::mt19937 rng(0x1234u);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        std::vector<FVec3> positions(inCount);
+        for (auto& position : positions) {
+            position = FVec3(dist(rng), dist(rng), dist(rng));
+        }
+        return positions;
+    }
+
+    size_t SerializeElements(BinarySerializeStream& inStream, const std::vector<FVec3>& inPositions)
+    {
+        size_t serialized = Serializer<uint64_t>::Serialize(inStream, inPositions.size());
+        for (const auto& position : inPositions) {
+            serialized += Serializer<FVec3>::Serialize(inStream, position);
+        }
+        return serialized;
+    }
+
+    size_t DeserializeElements(BinaryDeserializeStream& inStream, std::vector<FVec3>& outPositions)
+    {
+        uint64_t size;
+        size_t deserialized = Serializer<uint64_t>::Deserialize(inStream, size);
+        outPositions.clear();
+        outPositions.reserve(size);
+        for (auto i = 0; i < size; i++) {
+            FVec3 position;
+            deserialized += Serializer<FVec3>::Deserialize(inStream, position);
+            outPositions.emplace_back(position);
+        }
+        return deserialized;
+    }
+}
+
+template <std::endian E, bool Bulk>
+static void SerializePositions(benchmark::State& state)
+{
+    const auto positions = MakePositions(state.range(0));
+    std::vector<uint8_t> bytes;
+    bytes.reserve(sizeof(uint64_t) + positions.size() * sizeof(FVec3));
+
+    for (auto _ : state) {
+        bytes.clear();
+        MemorySerializeStream<E> stream(bytes);
+        if constexpr (Bulk) {
+            benchmark::DoNotOptimize(Serializer<std::vector<FVec3>>::Serialize(stream, positions));
+        } else {
+            benchmark::DoNotOptimize(SerializeElements(stream, positions));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(positions.size() * sizeof(FVec3)));
+}
+
+template <std::endian E, bool Bulk>
+static void DeserializePositions(benchmark::State& state)
+{
+    const auto positions = MakePositions(state.range(0));
+    std::vector<uint8_t> bytes;
+    {
+        MemorySerializeStream<E> stream(bytes);
+        Serializer<std::vector<FVec3>>::Serialize(stream, positions);
+    }
+
+    std::vector<FVec3> result;
+    for (auto _ : state) {
+        MemoryDeserializeStream<E> stream(bytes);
+        if constexpr (Bulk) {
+            benchmark::DoNotOptimize(Serializer<std::vector<FVec3>>::Deserialize(stream, result));
+        } else {
+            benchmark::DoNotOptimize(DeserializeElements(stream, result));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(positions.size() * sizeof(FVec3)));
+}
+
+BENCHMARK(SerializePositions<std::endian::little, false>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(SerializePositions<std::endian::little, true>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(SerializePositions<std::endian::big, false>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(SerializePositions<std::endian::big, true>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(DeserializePositions<std::endian::little, false>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(DeserializePositions<std::endian::little, true>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(DeserializePositions<std::endian::big, false>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+BENCHMARK(DeserializePositions<std::endian::big, true>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024);
+
+static void SaveRecordsToFile(benchmark::State& state)
+{
+    const auto records = MakeRecords(state.range(0));
+    for (auto _ : state) {
+        BinaryFileSerializeStream stream(recordFile);
+        for (const auto& record : records) {
+            benchmark::DoNotOptimize(Serialize(stream, record));
+        }
+        stream.Close();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+static void LoadRecordsFromFile(benchmark::State& state)
+{
+    const auto records = MakeRecords(state.range(0));
+    {
+        BinaryFileSerializeStream stream(recordFile);
+        for (const auto& record : records) {
+            Serialize(stream, record);
+        }
+    }
+
+    Record record;
+    for (auto _ : state) {
+        BinaryFileDeserializeStream stream(recordFile);
+        for (auto i = 0; i < records.size(); i++) {
+            benchmark::DoNotOptimize(Deserialize(stream, record));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+BENCHMARK(SaveRecordsToFile)->RangeMultiplier(8)->Range(1024, 64 * 1024);
+BENCHMARK(LoadRecordsFromFile)->RangeMultiplier(8)->Range(1024, 64 * 1024);
+
+template <bool Mapped, bool Touch>
+static void LoadPayloadFromFile(benchmark::State& state)
+{
+    const size_t payloadSize = state.range(0) * 1024 * 1024;
+    {
+        std::vector<uint8_t> payload(payloadSize);
+        std::iota(payload.begin(), payload.end(), static_cast<uint8_t>(0));
+        BinaryFileSerializeStream stream(payloadFile);
+        if constexpr (Mapped) {
+            Serialize(stream, Blob<uint8_t>(std::move(payload)));
+        } else {
+            Serialize(stream, payload);
+        }
+    }
+
+    size_t residentGrowth = 0;
+    for (auto _ : state) {
+        const size_t residentBefore = ResidentBytes();
+        if constexpr (Mapped) {
+            Blob<uint8_t> payload;
+            BinaryMappedFileDeserializeStream stream(payloadFile);
+            benchmark::DoNotOptimize(Deserialize(stream, payload));
+            if constexpr (Touch) {
+                benchmark::DoNotOptimize(std::accumulate(payload.begin(), payload.end(), static_cast<size_t>(0)));
+            }
+            residentGrowth = ResidentBytes() - residentBefore;
+        } else {
+            std::vector<uint8_t> payload;
+            BinaryFileDeserializeStream stream(payloadFile);
+            benchmark::DoNotOptimize(Deserialize(stream, payload));
+            if constexpr (Touch) {
+                benchmark::DoNotOptimize(std::accumulate(payload.begin(), payload.end(), static_cast<size_t>(0)));
+            }
+            residentGrowth = ResidentBytes() - residentBefore;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(payloadSize));
+    state.counters["residentGrowthMB"] = static_cast<double>(residentGrowth) / (1024.0 * 1024.0);
+}
+
+BENCHMARK(LoadPayloadFromFile<false, false>)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadPayloadFromFile<true, false>)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadPayloadFromFile<false, true>)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadPayloadFromFile<true, true>)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMillisecond);
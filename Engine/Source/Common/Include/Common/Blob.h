@@ -0,0 +1,294 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <span>
+#include <sstream>
+#include <vector>
+
+#include <Common/Memory.h>
+#include <Common/Serialization.h>
+#include <Common/String.h>
+
+namespace Common::Internal {
+    // blob data starts at a multiple of this file offset, enough for any element and for upload copies straight
+    // from the mapping
+    constexpr size_t blobAlignment = 64;
+}
+
+namespace Common {
+    // contiguous array of bulk serializable elements for large asset payloads (pixels, vertices), deserialized from a
+    // mapped file stream it is a view into the mapping and costs no copy, the first mutable access copies the view
+    // into an owned array, so views are never written through
+    template <BulkSerializable T>
+    class Blob {
+    public:
+        Blob();
+        Blob(std::vector<T> inValues); // NOLINT
+        Blob(SharedPtr<MappedFile> inMappedFile, const T* inData, size_t inSize);
+
+        size_t Size() const;
+        bool Empty() const;
+        const T* Data() const;
+        T* MutableData();
+        std::span<const T> Span() const;
+        bool IsView() const;
+        void Resize(size_t inSize);
+        void Clear();
+        const T* begin() const;
+        const T* end() const;
+        const T& operator[](size_t inIndex) const;
+        T& operator[](size_t inIndex);
+        bool operator==(const Blob& inRhs) const;
+
+    private:
+        void MakeOwned();
+
+        std::vector<T> owned;
+        // valid only for views, the offset follows the bytes of the mapping should they be materialized
+        SharedPtr<MappedFile> mappedFile;
+        size_t viewOffset;
+        size_t viewSize;
+    };
+
+    // [size][padding size][padding][data], the padding puts the data at a file offset aligned to blobAlignment,
+    // deserializing from a mapped file stream of native endian keeps a view instead of a copy, blobs replaced
+    // std::vector fields of existing assets, so fields written as a std::vector<T> ([size][data]) are read too
+    template <BulkSerializable T>
+    struct Serializer<Blob<T>> {
+        static constexpr size_t typeId
+            = HashUtils::StrCrc32("Common::Blob")
+            + Serializer<T>::typeId;
+        static constexpr size_t legacyTypeId = Serializer<std::vector<T>>::typeId;
+
+        static size_t Serialize(BinarySerializeStream& stream, const Blob<T>& value)
+        {
+            size_t serialized = 0;
+
+            const uint64_t size = value.Size();
+            serialized += Serializer<uint64_t>::Serialize(stream, size);
+
+            const auto padding = static_cast<uint8_t>((Internal::blobAlignment - (stream.Loc() + sizeof(uint8_t)) % Internal::blobAlignment) % Internal::blobAlignment);
+            serialized += Serializer<uint8_t>::Serialize(stream, padding);
+            for (auto i = 0; i < padding; i++) {
+                stream.Write<uint8_t>(0);
+            }
+            serialized += padding;
+
+            serialized += Internal::SerializeBulk(stream, value.Data(), value.Size());
+            return serialized;
+        }
+
+        static size_t Deserialize(BinaryDeserializeStream& stream, Blob<T>& value)
+        {
+            size_t deserialized = 0;
+
+            uint64_t size;
+            deserialized += Serializer<uint64_t>::Deserialize(stream, size);
+            uint8_t padding;
+            deserialized += Serializer<uint8_t>::Deserialize(stream, padding);
+            stream.Seek(padding);
+            deserialized += padding;
+            return deserialized + DeserializeData(stream, value, size);
+        }
+
+        static size_t DeserializeLegacy(BinaryDeserializeStream& stream, Blob<T>& value)
+        {
+            uint64_t size;
+            const size_t deserialized = Serializer<uint64_t>::Deserialize(stream, size);
+            return deserialized + DeserializeData(stream, value, size);
+        }
+
+        // the data of a legacy field is only aligned by chance, it is copied otherwise
+        static size_t DeserializeData(BinaryDeserializeStream& stream, Blob<T>& value, uint64_t size)
+        {
+            if (auto mappedFile = stream.GetMappedFile();
+                mappedFile != nullptr && stream.Endian() == std::endian::native) {
+                if (const auto* data = stream.ReadInPlace(size * sizeof(T));
+                    data != nullptr && reinterpret_cast<uintptr_t>(data) % alignof(T) == 0) {
+                    value = Blob<T>(std::move(mappedFile), reinterpret_cast<const T*>(data), size);
+                    return size * sizeof(T);
+                } else if (data != nullptr) {
+                    stream.Seek(-static_cast<int64_t>(size * sizeof(T)));
+                }
+            }
+
+            value.Clear();
+            value.Resize(size);
+            return Internal::DeserializeBulk(stream, value.MutableData(), size);
+        }
+    };
+
+    template <BulkSerializable T>
+    requires JsonSerializable<T>
+    struct JsonSerializer<Blob<T>> {
+        static void JsonSerialize(rapidjson::Value& outJsonValue, rapidjson::Document::AllocatorType& inAllocator, const Blob<T>& inValue)
+        {
+            outJsonValue.SetArray();
+            outJsonValue.Reserve(inValue.Size(), inAllocator);
+            for (const auto& element : inValue) {
+                rapidjson::Value jsonElement;
+                JsonSerializer<T>::JsonSerialize(jsonElement, inAllocator, element);
+                outJsonValue.PushBack(jsonElement, inAllocator);
+            }
+        }
+
+        static void JsonDeserialize(const rapidjson::Value& inJsonValue, Blob<T>& outValue)
+        {
+            outValue.Clear();
+
+            if (!inJsonValue.IsArray()) {
+                return;
+            }
+            outValue.Resize(inJsonValue.Size());
+            T* data = outValue.MutableData();
+            for (auto i = 0; i < inJsonValue.Size(); i++) {
+                JsonSerializer<T>::JsonDeserialize(inJsonValue[i], data[i]);
+            }
+        }
+    };
+
+    template <BulkSerializable T>
+    requires StringConvertible<T>
+    struct StringConverter<Blob<T>> {
+        static std::string ToString(const Blob<T>& inValue)
+        {
+            std::stringstream stream;
+            stream << "(";
+            for (auto i = 0; i < inValue.Size(); i++) {
+                stream << StringConverter<T>::ToString(inValue[i]);
+                if (i != inValue.Size() - 1) {
+                    stream << ", ";
+                }
+            }
+            stream << ")";
+            return stream.str();
+        }
+    };
+}
+
+namespace Common {
+    template <BulkSerializable T>
+    Blob<T>::Blob()
+        : viewOffset(0)
+        , viewSize(0)
+    {
+    }
+
+    template <BulkSerializable T>
+    Blob<T>::Blob(std::vector<T> inValues)
+        : owned(std::move(inValues))
+        , viewOffset(0)
+        , viewSize(0)
+    {
+    }
+
+    template <BulkSerializable T>
+    Blob<T>::Blob(SharedPtr<MappedFile> inMappedFile, const T* inData, size_t inSize)
+        : mappedFile(std::move(inMappedFile))
+        , viewOffset(0)
+        , viewSize(inSize)
+    {
+        Assert(mappedFile != nullptr);
+        viewOffset = reinterpret_cast<const uint8_t*>(inData) - mappedFile->Data();
+    }
+
+    template <BulkSerializable T>
+    size_t Blob<T>::Size() const
+    {
+        return IsView() ? viewSize : owned.size();
+    }
+
+    template <BulkSerializable T>
+    bool Blob<T>::Empty() const
+    {
+        return Size() == 0;
+    }
+
+    template <BulkSerializable T>
+    const T* Blob<T>::Data() const
+    {
+        return IsView() ? reinterpret_cast<const T*>(mappedFile->Data() + viewOffset) : owned.data();
+    }
+
+    template <BulkSerializable T>
+    T* Blob<T>::MutableData()
+    {
+        MakeOwned();
+        return owned.data();
+    }
+
+    template <BulkSerializable T>
+    std::span<const T> Blob<T>::Span() const
+    {
+        return { Data(), Size() };
+    }
+
+    template <BulkSerializable T>
+    bool Blob<T>::IsView() const
+    {
+        return mappedFile != nullptr;
+    }
+
+    template <BulkSerializable T>
+    void Blob<T>::Resize(size_t inSize)
+    {
+        MakeOwned();
+        owned.resize(inSize);
+    }
+
+    template <BulkSerializable T>
+    void Blob<T>::Clear()
+    {
+        mappedFile.Reset();
+        viewOffset = 0;
+        viewSize = 0;
+        owned.clear();
+    }
+
+    template <BulkSerializable T>
+    const T* Blob<T>::begin() const
+    {
+        return Data();
+    }
+
+    template <BulkSerializable T>
+    const T* Blob<T>::end() const
+    {
+        return Data() + Size();
+    }
+
+    template <BulkSerializable T>
+    const T& Blob<T>::operator[](size_t inIndex) const
+    {
+        Assert(inIndex < Size());
+        return Data()[inIndex];
+    }
+
+    template <BulkSerializable T>
+    T& Blob<T>::operator[](size_t inIndex)
+    {
+        Assert(inIndex < Size());
+        return MutableData()[inIndex];
+    }
+
+    template <BulkSerializable T>
+    bool Blob<T>::operator==(const Blob& inRhs) const
+    {
+        return Size() == inRhs.Size() && std::equal(begin(), end(), inRhs.begin());
+    }
+
+    template <BulkSerializable T>
+    void Blob<T>::MakeOwned()
+    {
+        if (!IsView()) {
+            return;
+        }
+        owned.assign(Data(), Data() + viewSize);
+        mappedFile.Reset();
+        viewOffset = 0;
+        viewSize = 0;
+    }
+}
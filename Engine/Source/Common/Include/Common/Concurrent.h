@@ -5,11 +5,18 @@
 #pragma once
 
 #include <string>
+#include <algorithm>
+#include <condition_variable>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <mutex>
 #include <thread>
 #include <future>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <new>
 #include <functional>
 #include <type_traits>
 
@@ -34,41 +41,148 @@ namespace Common {
         std::thread thread;
     };
 
+    // move-only void() callable, callables up to inplaceSize bytes live inside the object itself so that queueing a task
+    // never touches the heap, bigger ones fall back to one allocation
+    class TaskFunction {
+    public:
+        // large enough for the scene proxy updates sent to the render thread (a pointer, an entity and a transform),
+        // a ring slot holding the object and its sequence number is then exactly two cache lines
+        static constexpr size_t inplaceSize = 104;
+
+        NonCopyable(TaskFunction)
+        TaskFunction();
+        template <typename F> requires (!std::is_same_v<std::decay_t<F>, TaskFunction>) TaskFunction(F&& inFunc); // NOLINT
+        TaskFunction(TaskFunction&& inOther) noexcept;
+        TaskFunction& operator=(TaskFunction&& inOther) noexcept;
+        ~TaskFunction();
+
+        void operator()();
+        explicit operator bool() const;
+
+    private:
+        struct Ops {
+            void(*invoke)(void*);
+            void(*moveTo)(void*, void*);
+            void(*destroy)(void*);
+        };
+
+        template <typename F> static constexpr bool storedInplace = sizeof(F) <= inplaceSize && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+        template <typename F> static const Ops& GetOps();
+
+        alignas(std::max_align_t) std::byte storage[inplaceSize];
+        const Ops* ops;
+    };
+
+    // work-stealing pool, every worker owns a deque, it pushes and pops its own tasks at the back and steals from the front
+    // of the others when it runs dry, tasks queued from outside the pool are spread over the workers round-robin. threads
+    // waiting in ExecuteTasks()/ParallelFor() run queued tasks instead of blocking
     class ThreadPool {
     public:
+        NonCopyable(ThreadPool)
+        NonMovable(ThreadPool)
         ThreadPool(const std::string& name, uint8_t threadNum);
         ~ThreadPool();
 
+        uint8_t ThreadNum() const;
         template <typename F> auto EmplaceTask(F&& task);
+        // like EmplaceTask() but without a future, so nothing is allocated when the task fits a TaskFunction
+        template <typename F> void Spawn(F&& task);
         template <typename F> void ExecuteTasks(size_t taskNum, F&& task);
+        // calls task(rangeBegin, rangeEnd) over [begin, end), splitting the range in halves until it is no longer than
+        // grainSize, the calling thread takes part and returns once the whole range is done
+        template <typename F> void ParallelFor(size_t begin, size_t end, size_t grainSize, F&& task);
+        // waits for a future of this pool, running queued tasks meanwhile, so a task waiting on another never idles a worker
+        template <typename T> void Wait(const std::future<T>& future);
 
     private:
-        template <typename Ret> auto EmplaceTaskInternal(Common::SharedPtr<std::packaged_task<Ret()>> packedTask);
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<TaskFunction> tasks;
+        };
 
-        bool stop;
-        std::mutex mutex;
-        std::condition_variable condition;
+        template <typename F> void SplitRange(size_t begin, size_t end, size_t grainSize, F& task, std::atomic<size_t>& remaining);
+        void Push(TaskFunction&& task);
+        bool TryPop(TaskFunction& outTask);
+        bool RunOne();
+        void HelpUntilDone(const std::atomic<size_t>& remaining);
+        void WorkerLoop(size_t queueIndex);
+
+        std::atomic<bool> stop;
+        std::atomic<size_t> pendingTaskNum;
+        std::atomic<size_t> sleepingThreadNum;
+        std::atomic<size_t> nextQueueIndex;
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+        std::vector<Common::UniquePtr<WorkQueue>> queues;
         std::vector<NamedThread> threads;
-        std::queue<std::function<void()>> tasks;
     };
 
+    // bounded lock-free multi-producer single-consumer queue, every slot carries a sequence number that tells producers
+    // and the consumer whose turn it is (Vyukov's bounded queue with the consumer side reduced to plain stores)
+    template <typename T>
+    class MpscRingBuffer {
+    public:
+        NonCopyable(MpscRingBuffer)
+        NonMovable(MpscRingBuffer)
+        explicit MpscRingBuffer(size_t inCapacity);
+        ~MpscRingBuffer();
+
+        size_t Capacity() const;
+        // any thread, returns false when the ring is full
+        bool TryPush(T&& inValue);
+        // consumer thread only, returns false when the ring is empty
+        bool TryPop(T& outValue);
+        // consumer thread only
+        bool Empty() const;
+
+    private:
+        struct alignas(64) Slot {
+            std::atomic<size_t> sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        T* ValueAt(Slot& inSlot);
+
+        size_t mask;
+        Slot* slots;
+        alignas(64) std::atomic<size_t> pushPos;
+        alignas(64) size_t popPos;
+    };
+
+    // single consumer thread fed by a MpscRingBuffer of TaskFunction, so queueing a small task neither locks nor
+    // allocates. tasks run in the order they were queued by each producer
     class WorkerThread {
     public:
-        explicit WorkerThread(const std::string& name);
+        // 512 KiB of slots, a producer that finds the ring full waits for the consumer, except the consumer itself, whose
+        // tasks go to an overflow list that is moved back to the ring in order
+        static constexpr size_t defaultCapacity = 1 << 12;
+
+        NonCopyable(WorkerThread)
+        NonMovable(WorkerThread)
+        explicit WorkerThread(const std::string& name, size_t capacity = defaultCapacity);
         ~WorkerThread();
 
+        // waits until every task queued before the call has run
         void Flush();
 
         template <typename F> auto EmplaceTask(F&& task);
+        // like EmplaceTask() but without a future, so nothing is allocated when the task fits a TaskFunction
+        template <typename F> void Spawn(F&& task);
 
     private:
-        bool stop;
-        bool flush;
-        std::mutex mutex;
-        std::condition_variable taskCondition;
-        std::condition_variable flushCondition;
+        void Push(TaskFunction&& task);
+        void WakeUp();
+        void ThreadLoop();
+        void RefillFromOverflow();
+
+        std::atomic<bool> stop;
+        std::atomic<bool> sleeping;
+        std::atomic<uint32_t> wakeSignal;
+        std::atomic<std::thread::id> threadId;
+        MpscRingBuffer<TaskFunction> tasks;
+        // consumer thread only
+        std::deque<TaskFunction> overflow;
         NamedThread thread;
-        std::queue<std::function<void()>> tasks;
     };
 }
 
@@ -82,54 +196,194 @@ namespace Common {
         });
     }
 
+    template <typename F> requires (!std::is_same_v<std::decay_t<F>, TaskFunction>)
+    TaskFunction::TaskFunction(F&& inFunc)
+        : ops(&GetOps<std::decay_t<F>>())
+    {
+        using Func = std::decay_t<F>;
+        if constexpr (storedInplace<Func>) {
+            new (storage) Func(std::forward<F>(inFunc));
+        } else {
+            new (storage) Func*(new Func(std::forward<F>(inFunc)));
+        }
+    }
+
+    template <typename F>
+    const TaskFunction::Ops& TaskFunction::GetOps()
+    {
+        if constexpr (storedInplace<F>) {
+            static constexpr Ops ops = {
+                [](void* inStorage) -> void { (*static_cast<F*>(inStorage))(); },
+                [](void* inDst, void* inSrc) -> void {
+                    new (inDst) F(std::move(*static_cast<F*>(inSrc)));
+                    static_cast<F*>(inSrc)->~F();
+                },
+                [](void* inStorage) -> void { static_cast<F*>(inStorage)->~F(); }
+            };
+            return ops;
+        } else {
+            static constexpr Ops ops = {
+                [](void* inStorage) -> void { (**static_cast<F**>(inStorage))(); },
+                [](void* inDst, void* inSrc) -> void { new (inDst) F*(*static_cast<F**>(inSrc)); },
+                [](void* inStorage) -> void { delete *static_cast<F**>(inStorage); }
+            };
+            return ops;
+        }
+    }
+
     template <typename F>
     auto ThreadPool::EmplaceTask(F&& task)
     {
         using RetType = std::invoke_result_t<F>;
-        return EmplaceTaskInternal<RetType>(Common::MakeShared<std::packaged_task<RetType()>>(task));
+        std::packaged_task<RetType()> packagedTask(std::forward<F>(task));
+        auto result = packagedTask.get_future();
+        Push(TaskFunction(std::move(packagedTask)));
+        return result;
+    }
+
+    template <typename F>
+    void ThreadPool::Spawn(F&& task)
+    {
+        Push(TaskFunction(std::forward<F>(task)));
     }
 
     template <typename F>
     void ThreadPool::ExecuteTasks(size_t taskNum, F&& task)
     {
-        using RetType = std::invoke_result_t<F, size_t>;
+        ParallelFor(0, taskNum, 1, [&task](size_t rangeBegin, size_t rangeEnd) -> void {
+            for (size_t i = rangeBegin; i < rangeEnd; i++) {
+                task(i);
+            }
+        });
+    }
 
-        std::vector<std::future<RetType>> futures;
-        futures.reserve(taskNum);
-        for (size_t i = 0; i < taskNum; i++) {
-            futures.emplace_back(EmplaceTaskInternal<RetType>(Common::MakeShared<std::packaged_task<RetType()>>(std::bind(std::forward<F>(task), i))));
+    template <typename F>
+    void ThreadPool::ParallelFor(size_t begin, size_t end, size_t grainSize, F&& task)
+    {
+        if (begin >= end) {
+            return;
         }
+        std::atomic<size_t> remaining = end - begin;
+        SplitRange(begin, end, std::max(grainSize, static_cast<size_t>(1)), task, remaining);
+        HelpUntilDone(remaining);
+    }
 
-        for (const auto& future : futures) {
-            future.wait();
+    template <typename T>
+    void ThreadPool::Wait(const std::future<T>& future)
+    {
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!RunOne()) {
+                std::this_thread::yield();
+            }
         }
     }
 
-    template <typename Ret>
-    auto ThreadPool::EmplaceTaskInternal(Common::SharedPtr<std::packaged_task<Ret()>> packedTask)
+    template <typename F>
+    void ThreadPool::SplitRange(size_t begin, size_t end, size_t grainSize, F& task, std::atomic<size_t>& remaining)
     {
-        auto result = packedTask->get_future();
-        {
-            std::unique_lock lock(mutex);
-            Assert(!stop);
-            tasks.emplace([packedTask]() -> void { (*packedTask)(); });
+        // keeps the left half and hands the right one out, so idle workers steal the biggest pieces first
+        while (end - begin > grainSize) {
+            const size_t middle = begin + (end - begin) / 2;
+            Push(TaskFunction([this, middle, end, grainSize, &task, &remaining]() -> void {
+                SplitRange(middle, end, grainSize, task, remaining);
+            }));
+            end = middle;
+        }
+        task(begin, end);
+        remaining.fetch_sub(end - begin, std::memory_order_release);
+    }
+
+    template <typename T>
+    MpscRingBuffer<T>::MpscRingBuffer(size_t inCapacity)
+        : mask(0)
+        , slots(nullptr)
+        , pushPos(0)
+        , popPos(0)
+    {
+        Assert(inCapacity >= 2 && (inCapacity & (inCapacity - 1)) == 0);
+        mask = inCapacity - 1;
+        slots = new Slot[inCapacity];
+        for (size_t i = 0; i < inCapacity; i++) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
         }
-        condition.notify_one();
-        return result;
+    }
+
+    template <typename T>
+    MpscRingBuffer<T>::~MpscRingBuffer()
+    {
+        T value;
+        while (TryPop(value)) {}
+        delete[] slots;
+    }
+
+    template <typename T>
+    size_t MpscRingBuffer<T>::Capacity() const
+    {
+        return mask + 1;
+    }
+
+    template <typename T>
+    bool MpscRingBuffer<T>::TryPush(T&& inValue)
+    {
+        size_t pos = pushPos.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[pos & mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    new (slot.storage) T(std::move(inValue));
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = pushPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template <typename T>
+    bool MpscRingBuffer<T>::TryPop(T& outValue)
+    {
+        Slot& slot = slots[popPos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != popPos + 1) {
+            return false;
+        }
+        T* value = ValueAt(slot);
+        outValue = std::move(*value);
+        value->~T();
+        slot.sequence.store(popPos + mask + 1, std::memory_order_release);
+        popPos++;
+        return true;
+    }
+
+    template <typename T>
+    bool MpscRingBuffer<T>::Empty() const
+    {
+        return slots[popPos & mask].sequence.load(std::memory_order_acquire) != popPos + 1;
+    }
+
+    template <typename T>
+    T* MpscRingBuffer<T>::ValueAt(Slot& inSlot)
+    {
+        return std::launder(reinterpret_cast<T*>(inSlot.storage));
     }
 
     template <typename F>
     auto WorkerThread::EmplaceTask(F&& task)
     {
         using RetType = std::invoke_result_t<F>;
-        auto packagedTask = Common::MakeShared<std::packaged_task<RetType()>>(task);
-        auto result = packagedTask->get_future();
-        {
-            std::unique_lock lock(mutex);
-            Assert(!stop);
-            tasks.emplace([packagedTask]() -> void { (*packagedTask)(); });
-        }
-        taskCondition.notify_one();
+        std::packaged_task<RetType()> packagedTask(std::forward<F>(task));
+        auto result = packagedTask.get_future();
+        Push(TaskFunction(std::move(packagedTask)));
         return result;
     }
+
+    template <typename F>
+    void WorkerThread::Spawn(F&& task)
+    {
+        Push(TaskFunction(std::forward<F>(task)));
+    }
 }
@@ -0,0 +1,299 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <type_traits>
+
+#include <Common/Debug.h>
+#include <Common/Utility.h>
+
+namespace Common {
+    template <typename T = void> class Task;
+}
+
+namespace Common::Internal {
+    struct TaskPromiseBase {
+        struct FinalAwaiter {
+            bool await_ready() const noexcept;
+            template <typename P> std::coroutine_handle<> await_suspend(std::coroutine_handle<P> inHandle) const noexcept;
+            void await_resume() const noexcept;
+        };
+
+        std::suspend_always initial_suspend() const noexcept;
+        FinalAwaiter final_suspend() const noexcept;
+        void unhandled_exception() const;
+
+        std::coroutine_handle<> continuation;
+    };
+
+    template <typename T>
+    struct TaskPromise : TaskPromiseBase {
+        Task<T> get_return_object();
+        template <typename V> void return_value(V&& inValue);
+        T TakeResult();
+
+        std::optional<T> result;
+    };
+
+    template <>
+    struct TaskPromise<void> : TaskPromiseBase {
+        Task<void> get_return_object();
+        void return_void() const;
+        void TakeResult() const;
+    };
+
+    // eagerly started coroutine that owns nothing and frees its own frame, the root of Detach() and SyncWait()
+    struct DetachedTask {
+        struct promise_type {
+            DetachedTask get_return_object() const;
+            std::suspend_never initial_suspend() const noexcept;
+            std::suspend_never final_suspend() const noexcept;
+            void return_void() const;
+            void unhandled_exception() const;
+        };
+    };
+
+    // done is set and notified under the lock, so the waiter can not return and destroy the state while the finishing
+    // thread still touches it
+    struct SyncWaitSignal {
+        void Set();
+        void Wait();
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool done = false;
+    };
+
+    template <typename T>
+    struct SyncWaitState {
+        SyncWaitSignal signal;
+        std::optional<T> result;
+    };
+
+    template <>
+    struct SyncWaitState<void> {
+        SyncWaitSignal signal;
+    };
+
+    template <typename E>
+    struct ScheduleOnAwaiter {
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> inHandle) const;
+        void await_resume() const noexcept;
+
+        E& executor;
+    };
+
+    template <typename T> DetachedTask RunSyncWait(Task<T>& inTask, SyncWaitState<T>& outState);
+    template <typename T> DetachedTask RunDetached(Task<T> inTask);
+}
+
+namespace Common {
+    // lazily started coroutine, nothing runs until the task is awaited, detached or sync waited, and the awaiting
+    // coroutine resumes right where the task finishes, so a pipeline hops threads only where it says so with
+    // ScheduleOn() (or Core::ResumeOn() for engine threads), a discarded task never runs, so it is nodiscard
+    template <typename T>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = Internal::TaskPromise<T>;
+
+        struct Awaiter {
+            bool await_ready() const noexcept;
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> inContinuation) const noexcept;
+            T await_resume() const;
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        NonCopyable(Task)
+        Task();
+        explicit Task(std::coroutine_handle<promise_type> inHandle);
+        Task(Task&& inOther) noexcept;
+        Task& operator=(Task&& inOther) noexcept;
+        ~Task();
+
+        bool Valid() const;
+        bool Done() const;
+        Awaiter operator co_await() && noexcept;
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    // suspends the awaiting coroutine and resumes it from a task of inExecutor, anything with Spawn(F) works, e.g.
+    // ThreadPool or WorkerThread
+    template <typename E> Internal::ScheduleOnAwaiter<E> ScheduleOn(E& inExecutor);
+
+    // starts inTask without waiting for it, its frame is freed when it finishes and its result is dropped
+    template <typename T> void Detach(Task<T> inTask);
+
+    // starts inTask and blocks the calling thread until it finishes, meant for tests and for code that has to hand the
+    // result to a synchronous api, never call it from a thread the task needs to resume on
+    template <typename T> T SyncWait(Task<T> inTask);
+}
+
+namespace Common::Internal {
+    template <typename P>
+    std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<P> inHandle) const noexcept
+    {
+        const auto continuation = inHandle.promise().continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object()
+    {
+        return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    template <typename T>
+    template <typename V>
+    void TaskPromise<T>::return_value(V&& inValue)
+    {
+        result.emplace(std::forward<V>(inValue));
+    }
+
+    template <typename T>
+    T TaskPromise<T>::TakeResult()
+    {
+        Assert(result.has_value());
+        return std::move(result.value());
+    }
+
+    template <typename E>
+    bool ScheduleOnAwaiter<E>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename E>
+    void ScheduleOnAwaiter<E>::await_suspend(std::coroutine_handle<> inHandle) const
+    {
+        executor.Spawn([inHandle]() -> void { inHandle.resume(); });
+    }
+
+    template <typename E>
+    void ScheduleOnAwaiter<E>::await_resume() const noexcept {}
+
+    template <typename T>
+    DetachedTask RunSyncWait(Task<T>& inTask, SyncWaitState<T>& outState)
+    {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(inTask);
+        } else {
+            outState.result.emplace(co_await std::move(inTask));
+        }
+        outState.signal.Set();
+    }
+
+    template <typename T>
+    DetachedTask RunDetached(Task<T> inTask)
+    {
+        co_await std::move(inTask);
+    }
+}
+
+namespace Common {
+    template <typename T>
+    bool Task<T>::Awaiter::await_ready() const noexcept
+    {
+        return !handle || handle.done();
+    }
+
+    template <typename T>
+    std::coroutine_handle<> Task<T>::Awaiter::await_suspend(std::coroutine_handle<> inContinuation) const noexcept
+    {
+        handle.promise().continuation = inContinuation;
+        return handle;
+    }
+
+    template <typename T>
+    T Task<T>::Awaiter::await_resume() const
+    {
+        Assert(static_cast<bool>(handle));
+        return handle.promise().TakeResult();
+    }
+
+    template <typename T>
+    Task<T>::Task() = default;
+
+    template <typename T>
+    Task<T>::Task(std::coroutine_handle<promise_type> inHandle)
+        : handle(inHandle)
+    {
+    }
+
+    template <typename T>
+    Task<T>::Task(Task&& inOther) noexcept
+        : handle(std::exchange(inOther.handle, nullptr))
+    {
+    }
+
+    template <typename T>
+    Task<T>& Task<T>::operator=(Task&& inOther) noexcept
+    {
+        if (this != &inOther) {
+            if (handle) {
+                handle.destroy();
+            }
+            handle = std::exchange(inOther.handle, nullptr);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    Task<T>::~Task()
+    {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    template <typename T>
+    bool Task<T>::Valid() const
+    {
+        return static_cast<bool>(handle);
+    }
+
+    template <typename T>
+    bool Task<T>::Done() const
+    {
+        return handle && handle.done();
+    }
+
+    template <typename T>
+    typename Task<T>::Awaiter Task<T>::operator co_await() && noexcept
+    {
+        return Awaiter { handle };
+    }
+
+    template <typename E>
+    Internal::ScheduleOnAwaiter<E> ScheduleOn(E& inExecutor)
+    {
+        return { inExecutor };
+    }
+
+    template <typename T>
+    void Detach(Task<T> inTask)
+    {
+        Internal::RunDetached(std::move(inTask));
+    }
+
+    template <typename T>
+    T SyncWait(Task<T> inTask)
+    {
+        Internal::SyncWaitState<T> state;
+        Internal::RunSyncWait(inTask, state);
+        state.signal.Wait();
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(state.result.value());
+        }
+    }
+}
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include <rapidjson/document.h>
 
 #include <Common/Result.h>
+#include <Common/Utility.h>
 
 namespace Common {
     class FileUtils {
@@ -18,4 +20,39 @@ namespace Common {
         static Result<rapidjson::Document, std::string> ReadJsonFile(const std::string& inFileName);
         static Result<void, std::string> WriteJsonFile(const std::string& inFileName, const rapidjson::Document& inJsonDocument, bool inPretty = true);
     };
+
+    // read only mapping of a whole file, pages are faulted in on first touch and shared with the os page cache, so
+    // bytes never read cost no memory, the file must not be truncated while mapped
+    class MappedFile {
+    public:
+        // copies the bytes of every live mapping of the file into owned memory and releases the file, so it can be
+        // replaced, windows refuses to replace a mapped file, elsewhere mappings never block it and this does nothing,
+        // Data() moves to the copy, views must hold offsets from Data() instead of pointers, and no reader of the
+        // mappings may run meanwhile, the caller has to stop or flush the threads reading them
+        static void MaterializeAll(const std::string& inFileName);
+
+        explicit MappedFile(const std::string& inFileName);
+        ~MappedFile();
+
+        NonCopyable(MappedFile)
+        NonMovable(MappedFile)
+
+        bool IsValid() const;
+        const uint8_t* Data() const;
+        size_t Size() const;
+
+    private:
+        void Materialize();
+
+        bool valid;
+        const uint8_t* data;
+        size_t size;
+        std::string canonicalName;
+        // data is owned memory instead of a view of the file
+        bool materialized;
+#if PLATFORM_WINDOWS
+        void* fileHandle;
+        void* mappingHandle;
+#endif
+    };
 }
@@ -38,6 +38,11 @@ namespace Common {
         size_t Traverse(const TraverseFunc& inFunc) const;
         size_t TraverseRecurse(const TraverseFunc& inFunc) const;
         void CopyTo(const Path& inPath) const;
+        // replaces inPath if it exists, readers still holding the replaced file open keep seeing its old content,
+        // returns false if the file system refuses, e.g. windows does not replace a file which is still mapped
+        bool RenameTo(const Path& inPath) const;
+        // returns false if nothing was removed
+        bool Remove() const;
         void MakeDir() const;
         void Fixup();
 
@@ -76,6 +76,12 @@ namespace Common {
         }
     };
 
+    template <CppArithmeticNonBool T, uint8_t L, MathBackend B>
+    struct BulkSerializeTraits<Vec<T, L, B>> {
+        static constexpr bool bulk = sizeof(Vec<T, L, B>) == L * sizeof(T);
+        using Component = T;
+    };
+
     template <StringConvertible T, uint8_t L, MathBackend B>
     struct StringConverter<Vec<T, L, B>> {
         static std::string ToString(const Vec<T, L, B>& inValue)
@@ -140,6 +146,12 @@ namespace Common {
         }
     };
 
+    template <CppArithmeticNonBool T, uint8_t R, uint8_t C, MathBackend B>
+    struct BulkSerializeTraits<Mat<T, R, C, B>> {
+        static constexpr bool bulk = sizeof(Mat<T, R, C, B>) == R * C * sizeof(T);
+        using Component = T;
+    };
+
     template <StringConvertible T, uint8_t R, uint8_t C, MathBackend B>
     struct StringConverter<Mat<T, R, C, B>> {
         static std::string ToString(const Mat<T, R, C, B>& inValue)
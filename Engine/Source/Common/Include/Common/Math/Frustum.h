@@ -0,0 +1,286 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include <Common/Math/Vector.h>
+#include <Common/Math/Matrix.h>
+#include <Common/Math/Box.h>
+#include <Common/Math/Sphere.h>
+#include <Common/Math/Simd.h>
+
+namespace Common {
+    template <FloatingPoint T>
+    struct FrustumBase {
+        // left, right, bottom, top, near, far (named for reversed-z), xyz is the inward unit normal, a point p is inside when dot(xyz, p) + w >= 0
+        Vec<T, 4> planes[6];
+    };
+
+    template <typename T>
+    struct Frustum : FrustumBase<T> {
+        // world to clip is projection * view, the planes bound -w <= x, y <= w and 0 <= z <= w, which covers the
+        // reversed-z projections (near at z = w) as well as a conventional [0, 1] depth range
+        static Frustum FromWorldToClip(const Mat<T, 4, 4>& inWorldToClip);
+
+        Frustum();
+        Frustum(const Frustum& inOther);
+        Frustum(Frustum&& inOther) noexcept;
+        Frustum& operator=(const Frustum& inOther);
+
+        bool Inside(const Vec<T, 3>& inPoint) const;
+        // conservative, a bound that straddles two planes outside the frustum corner still counts as intersecting
+        bool Intersect(const Sphere<T>& inSphere) const;
+        bool Intersect(const Box<T>& inBox) const;
+        // batched Intersect(), writes 1 to outVisibilities[i] when the i-th bound intersects the frustum and 0 otherwise
+        void IntersectSpheres(const Sphere<T>* inSpheres, size_t inNum, uint8_t* outVisibilities) const;
+        void IntersectBoxes(const Box<T>* inBoxes, size_t inNum, uint8_t* outVisibilities) const;
+    };
+
+    using HFrustum = Frustum<HFloat>;
+    using FFrustum = Frustum<float>;
+    using DFrustum = Frustum<double>;
+}
+
+namespace Common::Internal {
+    // Per-backend dispatch for the batched culling, the primary template tests one bound at a time, the SIMD
+    // specialization transposes four bounds into lanes and tests them against each plane at once.
+    template <typename T, MathBackend B>
+    struct FrustumOps {
+        static void IntersectSpheres(const Frustum<T>& inFrustum, const Sphere<T>* inSpheres, size_t inNum, uint8_t* outVisibilities)
+        {
+            for (size_t i = 0; i < inNum; i++) {
+                outVisibilities[i] = inFrustum.Intersect(inSpheres[i]) ? 1 : 0;
+            }
+        }
+
+        static void IntersectBoxes(const Frustum<T>& inFrustum, const Box<T>* inBoxes, size_t inNum, uint8_t* outVisibilities)
+        {
+            for (size_t i = 0; i < inNum; i++) {
+                outVisibilities[i] = inFrustum.Intersect(inBoxes[i]) ? 1 : 0;
+            }
+        }
+    };
+
+    template <>
+    struct FrustumOps<float, MathBackend::simd> {
+        static_assert(sizeof(Sphere<float>) == sizeof(float) * 4);
+        static_assert(sizeof(Box<float>) == sizeof(float) * 6);
+
+        // plane components splatted once per batch, abs normals are for the box projected radius
+        struct SplatPlanes {
+            explicit SplatPlanes(const Frustum<float>& inFrustum)
+            {
+                for (uint8_t i = 0; i < 6; i++) {
+                    const Vec<float, 4>& plane = inFrustum.planes[i];
+                    x[i] = Simd::Set1(plane.x);
+                    y[i] = Simd::Set1(plane.y);
+                    z[i] = Simd::Set1(plane.z);
+                    w[i] = Simd::Set1(plane.w);
+                    absX[i] = Simd::Abs(x[i]);
+                    absY[i] = Simd::Abs(y[i]);
+                    absZ[i] = Simd::Abs(z[i]);
+                }
+            }
+
+            Simd::F32x4 x[6];
+            Simd::F32x4 y[6];
+            Simd::F32x4 z[6];
+            Simd::F32x4 w[6];
+            Simd::F32x4 absX[6];
+            Simd::F32x4 absY[6];
+            Simd::F32x4 absZ[6];
+        };
+
+        static Simd::F32x4 Distance(const SplatPlanes& inPlanes, uint8_t inIndex, Simd::F32x4 inX, Simd::F32x4 inY, Simd::F32x4 inZ)
+        {
+            return Simd::Add(
+                Simd::Add(Simd::Mul(inPlanes.x[inIndex], inX), Simd::Mul(inPlanes.y[inIndex], inY)),
+                Simd::Add(Simd::Mul(inPlanes.z[inIndex], inZ), inPlanes.w[inIndex]));
+        }
+
+        static void StoreVisibilities(int inOutsideMask, uint8_t* outVisibilities)
+        {
+            for (int i = 0; i < 4; i++) {
+                outVisibilities[i] = (inOutsideMask >> i & 1) == 0 ? 1 : 0;
+            }
+        }
+
+        static void IntersectSpheres(const Frustum<float>& inFrustum, const Sphere<float>* inSpheres, size_t inNum, uint8_t* outVisibilities)
+        {
+            const SplatPlanes planes(inFrustum);
+            const Simd::F32x4 zero = Simd::Set1(0.0f);
+
+            size_t i = 0;
+            for (; i + 4 <= inNum; i += 4) {
+                // a sphere is four tight floats, so the transpose yields center x, y, z and radius lanes
+                Simd::F32x4 centerX = Simd::LoadU(inSpheres[i].center.data);
+                Simd::F32x4 centerY = Simd::LoadU(inSpheres[i + 1].center.data);
+                Simd::F32x4 centerZ = Simd::LoadU(inSpheres[i + 2].center.data);
+                Simd::F32x4 radius = Simd::LoadU(inSpheres[i + 3].center.data);
+                Simd::Transpose4(centerX, centerY, centerZ, radius);
+
+                int outsideMask = 0;
+                for (uint8_t p = 0; p < 6; p++) {
+                    outsideMask |= Simd::LessMask(Simd::Add(Distance(planes, p, centerX, centerY, centerZ), radius), zero);
+                }
+                StoreVisibilities(outsideMask, outVisibilities + i);
+            }
+            for (; i < inNum; i++) {
+                outVisibilities[i] = inFrustum.Intersect(inSpheres[i]) ? 1 : 0;
+            }
+        }
+
+        static void IntersectBoxes(const Frustum<float>& inFrustum, const Box<float>* inBoxes, size_t inNum, uint8_t* outVisibilities)
+        {
+            const SplatPlanes planes(inFrustum);
+            const Simd::F32x4 zero = Simd::Set1(0.0f);
+            const Simd::F32x4 half = Simd::Set1(0.5f);
+
+            size_t i = 0;
+            for (; i + 4 <= inNum; i += 4) {
+                // loading min reads max.x into lane 3, the transpose moves it into minW which is never used, max is
+                // loaded three floats at a time so the last box never reads past the array
+                Simd::F32x4 minX = Simd::LoadU(inBoxes[i].min.data);
+                Simd::F32x4 minY = Simd::LoadU(inBoxes[i + 1].min.data);
+                Simd::F32x4 minZ = Simd::LoadU(inBoxes[i + 2].min.data);
+                Simd::F32x4 minW = Simd::LoadU(inBoxes[i + 3].min.data);
+                Simd::Transpose4(minX, minY, minZ, minW);
+                Simd::F32x4 maxX = Simd::Load3(inBoxes[i].max.data);
+                Simd::F32x4 maxY = Simd::Load3(inBoxes[i + 1].max.data);
+                Simd::F32x4 maxZ = Simd::Load3(inBoxes[i + 2].max.data);
+                Simd::F32x4 maxW = Simd::Load3(inBoxes[i + 3].max.data);
+                Simd::Transpose4(maxX, maxY, maxZ, maxW);
+
+                const Simd::F32x4 centerX = Simd::Mul(Simd::Add(minX, maxX), half);
+                const Simd::F32x4 centerY = Simd::Mul(Simd::Add(minY, maxY), half);
+                const Simd::F32x4 centerZ = Simd::Mul(Simd::Add(minZ, maxZ), half);
+                const Simd::F32x4 extentX = Simd::Mul(Simd::Sub(maxX, minX), half);
+                const Simd::F32x4 extentY = Simd::Mul(Simd::Sub(maxY, minY), half);
+                const Simd::F32x4 extentZ = Simd::Mul(Simd::Sub(maxZ, minZ), half);
+
+                int outsideMask = 0;
+                for (uint8_t p = 0; p < 6; p++) {
+                    const Simd::F32x4 radius = Simd::Add(
+                        Simd::Add(Simd::Mul(planes.absX[p], extentX), Simd::Mul(planes.absY[p], extentY)),
+                        Simd::Mul(planes.absZ[p], extentZ));
+                    outsideMask |= Simd::LessMask(Simd::Add(Distance(planes, p, centerX, centerY, centerZ), radius), zero);
+                }
+                StoreVisibilities(outsideMask, outVisibilities + i);
+            }
+            for (; i < inNum; i++) {
+                outVisibilities[i] = inFrustum.Intersect(inBoxes[i]) ? 1 : 0;
+            }
+        }
+    };
+}
+
+namespace Common {
+    template <typename T>
+    Frustum<T> Frustum<T>::FromWorldToClip(const Mat<T, 4, 4>& inWorldToClip)
+    {
+        const Vec<T, 4> row0 = inWorldToClip.Row(0);
+        const Vec<T, 4> row1 = inWorldToClip.Row(1);
+        const Vec<T, 4> row2 = inWorldToClip.Row(2);
+        const Vec<T, 4> row3 = inWorldToClip.Row(3);
+
+        Frustum result;
+        result.planes[0] = row3 + row0;
+        result.planes[1] = row3 - row0;
+        result.planes[2] = row3 + row1;
+        result.planes[3] = row3 - row1;
+        result.planes[4] = row3 - row2;
+        result.planes[5] = row2;
+
+        for (auto& plane : result.planes) {
+            const T length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            // an infinite far plane degenerates to (0, 0, 0, near), which every point passes
+            plane = length > DefaultTolerance<T>() ? plane / length : Vec<T, 4>(0, 0, 0, 1);
+        }
+        return result;
+    }
+
+    template <typename T>
+    Frustum<T>::Frustum()
+    {
+        for (auto& plane : this->planes) {
+            plane = Vec<T, 4>(0, 0, 0, 1);
+        }
+    }
+
+    template <typename T>
+    Frustum<T>::Frustum(const Frustum& inOther)
+    {
+        for (uint8_t i = 0; i < 6; i++) {
+            this->planes[i] = inOther.planes[i];
+        }
+    }
+
+    template <typename T>
+    Frustum<T>::Frustum(Frustum&& inOther) noexcept
+    {
+        for (uint8_t i = 0; i < 6; i++) {
+            this->planes[i] = std::move(inOther.planes[i]);
+        }
+    }
+
+    template <typename T>
+    Frustum<T>& Frustum<T>::operator=(const Frustum& inOther)
+    {
+        for (uint8_t i = 0; i < 6; i++) {
+            this->planes[i] = inOther.planes[i];
+        }
+        return *this;
+    }
+
+    template <typename T>
+    bool Frustum<T>::Inside(const Vec<T, 3>& inPoint) const
+    {
+        for (const auto& plane : this->planes) {
+            if (plane.x * inPoint.x + plane.y * inPoint.y + plane.z * inPoint.z + plane.w < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool Frustum<T>::Intersect(const Sphere<T>& inSphere) const
+    {
+        for (const auto& plane : this->planes) {
+            if (plane.x * inSphere.center.x + plane.y * inSphere.center.y + plane.z * inSphere.center.z + plane.w + inSphere.radius < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool Frustum<T>::Intersect(const Box<T>& inBox) const
+    {
+        const Vec<T, 3> center = inBox.Center();
+        const Vec<T, 3> halfExtent = inBox.Extent() / static_cast<T>(2);
+        for (const auto& plane : this->planes) {
+            const T distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            const T radius = std::abs(plane.x) * halfExtent.x + std::abs(plane.y) * halfExtent.y + std::abs(plane.z) * halfExtent.z;
+            if (distance + radius < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    void Frustum<T>::IntersectSpheres(const Sphere<T>* inSpheres, size_t inNum, uint8_t* outVisibilities) const
+    {
+        Internal::FrustumOps<T, MathBackend::defaultBackend>::IntersectSpheres(*this, inSpheres, inNum, outVisibilities);
+    }
+
+    template <typename T>
+    void Frustum<T>::IntersectBoxes(const Box<T>* inBoxes, size_t inNum, uint8_t* outVisibilities) const
+    {
+        Internal::FrustumOps<T, MathBackend::defaultBackend>::IntersectBoxes(*this, inBoxes, inNum, outVisibilities);
+    }
+}
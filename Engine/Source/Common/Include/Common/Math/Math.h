@@ -12,6 +12,7 @@
 #include <Common/Math/Rect.h>
 #include <Common/Math/Box.h>
 #include <Common/Math/Sphere.h>
+#include <Common/Math/Frustum.h>
 #include <Common/Math/Color.h>
 #include <Common/Math/Transform.h>
 #include <Common/Math/View.h>
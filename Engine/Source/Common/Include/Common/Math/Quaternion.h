@@ -219,9 +219,14 @@ namespace Common::Internal {
         // The accumulation order matches the scalar reference above, so both backends produce identical results.
         static Q Mul(const Q& a, const Q& b)
         {
-            const Simd::F32x4 av = Simd::LoadU(&a.x);
-            const Simd::F32x4 bv = Simd::LoadU(&b.x);
+            Q result;
+            Simd::StoreU(&result.x, Mul(Simd::LoadU(&a.x), Simd::LoadU(&b.x)));
+            return result;
+        }
 
+        // register form of Mul, for callers that keep quaternions in registers across several ops
+        static Simd::F32x4 Mul(Simd::F32x4 av, Simd::F32x4 bv)
+        {
             const Simd::F32x4 sign0 = Simd::Set(1.0f, -1.0f, 1.0f, -1.0f);
             const Simd::F32x4 sign1 = Simd::Set(1.0f, 1.0f, -1.0f, -1.0f);
             const Simd::F32x4 sign2 = Simd::Set(-1.0f, 1.0f, 1.0f, -1.0f);
@@ -230,10 +235,7 @@ namespace Common::Internal {
             acc = Simd::Add(acc, Simd::Mul(Simd::Splat<0>(av), Simd::Mul(Simd::Shuffle<3, 2, 1, 0>(bv), sign0)));
             acc = Simd::Add(acc, Simd::Mul(Simd::Splat<1>(av), Simd::Mul(Simd::Shuffle<2, 3, 0, 1>(bv), sign1)));
             acc = Simd::Add(acc, Simd::Mul(Simd::Splat<2>(av), Simd::Mul(Simd::Shuffle<1, 0, 3, 2>(bv), sign2)));
-
-            Q result;
-            Simd::StoreU(&result.x, acc);
-            return result;
+            return acc;
         }
 
         static float Dot(const Q& a, const Q& b)
@@ -54,6 +54,12 @@ namespace Common::Simd {
     inline float Sum(F32x4 v) { return v.lanes[0] + v.lanes[1] + v.lanes[2] + v.lanes[3]; }
     inline float MaxValue(F32x4 v) { return std::max(std::max(v.lanes[0], v.lanes[1]), std::max(v.lanes[2], v.lanes[3])); }
     inline F32x4 Set(float x, float y, float z, float w) { return { x, y, z, w }; }
+    inline int LessMask(F32x4 a, F32x4 b)
+    {
+        int mask = 0;
+        for (int i = 0; i < 4; i++) { mask |= a.lanes[i] < b.lanes[i] ? 1 << i : 0; }
+        return mask;
+    }
 
     template <int L>
     inline F32x4 Splat(F32x4 v) { return Set1(v.lanes[L]); }
@@ -99,6 +105,9 @@ namespace Common::Simd {
 
     inline F32x4 Set(float x, float y, float z, float w) { return _mm_set_ps(w, z, y, x); }
 
+    // Bit i set when lane i of a is less than lane i of b.
+    inline int LessMask(F32x4 a, F32x4 b) { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+
     template <int L>
     inline F32x4 Splat(F32x4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(L, L, L, L)); }
 
@@ -131,6 +140,13 @@ namespace Common::Simd {
         return vld1q_f32(values);
     }
 
+    // Bit i set when lane i of a is less than lane i of b.
+    inline int LessMask(F32x4 a, F32x4 b)
+    {
+        static constexpr uint32_t bits[4] = { 1, 2, 4, 8 };
+        return static_cast<int>(vaddvq_u32(vandq_u32(vcltq_f32(a, b), vld1q_u32(bits))));
+    }
+
     template <int L>
     inline F32x4 Splat(F32x4 v) { return vdupq_n_f32(vgetq_lane_f32(v, L)); }
 
@@ -173,6 +189,15 @@ namespace Common::Simd {
         p[2] = tmp[2];
     }
 
+    // Cross product of two 3-vectors held in lanes 0..2, lane 3 of the result is 0 whenever lane 3 of both inputs is
+    // finite: a x b = a.yzx * b.zxy - a.zxy * b.yzx.
+    inline F32x4 Cross3(F32x4 a, F32x4 b)
+    {
+        return Sub(
+            Mul(Shuffle<1, 2, 0, 3>(a), Shuffle<2, 0, 1, 3>(b)),
+            Mul(Shuffle<2, 0, 1, 3>(a), Shuffle<1, 2, 0, 3>(b)));
+    }
+
     // Element-wise binary ops as functors so a single Map* template can drive every Vec/Mat/Quaternion kernel. Each
     // carries both a 4-wide register overload (the SIMD body) and a scalar overload (the <4 tail), so the same functor
     // covers the full chunks and the remainder without the caller spelling out two lambdas.
@@ -7,6 +7,7 @@
 #include <Common/Math/Vector.h>
 #include <Common/Math/Matrix.h>
 #include <Common/Math/Quaternion.h>
+#include <Common/Math/Simd.h>
 
 namespace Common {
     template <FloatingPoint T>
@@ -40,6 +41,16 @@ namespace Common {
         Transform& operator|=(const Quaternion<T>& inRotation);
         Transform& operator*=(const Vec<T, 3>& inScale);
 
+        // works on the TRS form directly and matches the matrix product, i.e. (a * b).GetTransformMatrix() equals
+        // a.GetTransformMatrix() * b.GetTransformMatrix() as long as a has a uniform scale or b has no rotation, a
+        // parent world transform times a child local transform gives the child world transform
+        Transform operator*(const Transform& rhs) const;
+        // exact for uniform scale, this->Inverse() * (*this) is the identity
+        Transform Inverse() const;
+        // the transform relative to inParent, i.e. inParent * result == *this, cheaper and more precise than
+        // inParent.Inverse() * (*this) or decomposing the inverse matrix product
+        Transform GetRelativeTransform(const Transform& inParent) const;
+
         Transform& Translate(const Vec<T, 3>& inTranslation);
         Transform& Rotate(const Quaternion<T>& inRotation);
         Transform& Scale(const Vec<T, 3>& inScale);
@@ -71,6 +82,109 @@ namespace Common {
     using DTransform = Transform<double>;
 }
 
+namespace Common::Internal {
+    // Per-backend dispatch for the TRS algebra, the primary template is the generic implementation over Vec and
+    // Quaternion, the SIMD specialization keeps the whole chain in registers. Engine quaternions rotate as the conjugate
+    // of the textbook rotation (see Quaternion::RotateVector), so applying rotation a then b is the product a * b.
+    template <typename T, MathBackend B>
+    struct TransformOps {
+        using Tr = Transform<T>;
+
+        static Tr Compose(const Tr& inParent, const Tr& inChild)
+        {
+            Tr result;
+            result.scale = inParent.scale * inChild.scale;
+            result.rotation = inChild.rotation * inParent.rotation;
+            result.translation = inParent.rotation.RotateVector(inParent.scale * inChild.translation) + inParent.translation;
+            return result;
+        }
+
+        static Tr Inverse(const Tr& inTransform)
+        {
+            Tr result;
+            result.scale = VecConsts<T, 3>::unit / inTransform.scale;
+            result.rotation = inTransform.rotation.Conjugated();
+            result.translation = result.rotation.RotateVector(result.scale * (VecConsts<T, 3>::zero - inTransform.translation));
+            return result;
+        }
+
+        static Tr Relative(const Tr& inTransform, const Tr& inParent)
+        {
+            const Quaternion<T> parentInverseRotation = inParent.rotation.Conjugated();
+            Tr result;
+            result.scale = inTransform.scale / inParent.scale;
+            result.rotation = inTransform.rotation * parentInverseRotation;
+            result.translation = parentInverseRotation.RotateVector(inTransform.translation - inParent.translation) / inParent.scale;
+            return result;
+        }
+    };
+
+    // Vec<float, 3> is three tight floats and only takes the scalar tail of the Vec kernels, so the specialization loads
+    // each 3-vector once (lane 3 zeroed, or one for divisors) and does the products, rotations and crosses 4-wide.
+    template <>
+    struct TransformOps<float, MathBackend::simd> {
+        using Tr = Transform<float>;
+
+        static Simd::F32x4 LoadDivisor(const Vec<float, 3>& inValue)
+        {
+            return Simd::Set(inValue.x, inValue.y, inValue.z, 1.0f);
+        }
+
+        static Simd::F32x4 Conjugate(Simd::F32x4 inQuat)
+        {
+            return Simd::Mul(inQuat, Simd::Set(-1.0f, -1.0f, -1.0f, 1.0f));
+        }
+
+        // same expansion as Quaternion::RotateVector: v + 2 * w * (v x u) + (2 * (v x u)) x u, u the imaginary part
+        static Simd::F32x4 Rotate(Simd::F32x4 inQuat, Simd::F32x4 inVector)
+        {
+            const Simd::F32x4 imaginary = Simd::Mul(inQuat, Simd::Set(1.0f, 1.0f, 1.0f, 0.0f));
+            const Simd::F32x4 twiceCross = Simd::Mul(Simd::Cross3(inVector, imaginary), Simd::Set1(2.0f));
+            return Simd::Add(Simd::Add(inVector, Simd::Mul(twiceCross, Simd::Splat<3>(inQuat))), Simd::Cross3(twiceCross, imaginary));
+        }
+
+        static Tr Compose(const Tr& inParent, const Tr& inChild)
+        {
+            const Simd::F32x4 parentScale = Simd::Load3(inParent.scale.data);
+            const Simd::F32x4 parentRotation = Simd::LoadU(&inParent.rotation.x);
+
+            Tr result;
+            Simd::StoreU(&result.rotation.x, QuatOps<float, MathBackend::simd>::Mul(Simd::LoadU(&inChild.rotation.x), parentRotation));
+            Simd::Store3(result.scale.data, Simd::Mul(parentScale, Simd::Load3(inChild.scale.data)));
+            Simd::Store3(result.translation.data, Simd::Add(
+                Rotate(parentRotation, Simd::Mul(parentScale, Simd::Load3(inChild.translation.data))),
+                Simd::Load3(inParent.translation.data)));
+            return result;
+        }
+
+        static Tr Inverse(const Tr& inTransform)
+        {
+            const Simd::F32x4 inverseScale = Simd::Div(Simd::Set1(1.0f), LoadDivisor(inTransform.scale));
+            const Simd::F32x4 inverseRotation = Conjugate(Simd::LoadU(&inTransform.rotation.x));
+            const Simd::F32x4 negativeTranslation = Simd::Sub(Simd::Set1(0.0f), Simd::Load3(inTransform.translation.data));
+
+            Tr result;
+            Simd::Store3(result.scale.data, inverseScale);
+            Simd::StoreU(&result.rotation.x, inverseRotation);
+            Simd::Store3(result.translation.data, Rotate(inverseRotation, Simd::Mul(inverseScale, negativeTranslation)));
+            return result;
+        }
+
+        static Tr Relative(const Tr& inTransform, const Tr& inParent)
+        {
+            const Simd::F32x4 parentScale = LoadDivisor(inParent.scale);
+            const Simd::F32x4 parentInverseRotation = Conjugate(Simd::LoadU(&inParent.rotation.x));
+            const Simd::F32x4 offset = Simd::Sub(Simd::Load3(inTransform.translation.data), Simd::Load3(inParent.translation.data));
+
+            Tr result;
+            Simd::Store3(result.scale.data, Simd::Div(Simd::Load3(inTransform.scale.data), parentScale));
+            Simd::StoreU(&result.rotation.x, QuatOps<float, MathBackend::simd>::Mul(Simd::LoadU(&inTransform.rotation.x), parentInverseRotation));
+            Simd::Store3(result.translation.data, Simd::Div(Rotate(parentInverseRotation, offset), parentScale));
+            return result;
+        }
+    };
+}
+
 namespace Common {
     template <typename T>
     Transform<T> Transform<T>::LookAt(const Vec<T, 3>& inPosition, const Vec<T, 3>& inTargetPosition, const Vec<T, 3>& inUpDirection)
@@ -176,6 +290,24 @@ namespace Common {
         return result;
     }
 
+    template <typename T>
+    Transform<T> Transform<T>::operator*(const Transform& rhs) const
+    {
+        return Internal::TransformOps<T, MathBackend::defaultBackend>::Compose(*this, rhs);
+    }
+
+    template <typename T>
+    Transform<T> Transform<T>::Inverse() const
+    {
+        return Internal::TransformOps<T, MathBackend::defaultBackend>::Inverse(*this);
+    }
+
+    template <typename T>
+    Transform<T> Transform<T>::GetRelativeTransform(const Transform& inParent) const
+    {
+        return Internal::TransformOps<T, MathBackend::defaultBackend>::Relative(*this, inParent);
+    }
+
     template <typename T>
     Transform<T>& Transform<T>::operator+=(const Vec<T, 3>& inTranslation)
     {
@@ -4,8 +4,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <Common/Utility.h>
 
@@ -107,6 +112,116 @@ namespace Common {
         std::weak_ptr<T> ptr;
     };
 
+    // bump allocator over a chain of blocks, Reset() rewinds it and keeps the blocks for reuse, objects placed in it
+    // are never destructed, so only put trivially destructible data in it
+    class LinearAllocator {
+    public:
+        static constexpr size_t defaultBlockSize = 64 * 1024;
+
+        explicit LinearAllocator(size_t inBlockSize = defaultBlockSize);
+        ~LinearAllocator();
+
+        NonCopyable(LinearAllocator)
+        NonMovable(LinearAllocator)
+
+        void* Allocate(size_t inSize, size_t inAlignment = alignof(std::max_align_t));
+        template <typename T> T* AllocateArray(size_t inCount);
+        void Reset();
+        // counters below restart at every Reset()
+        size_t AllocationNum() const;
+        size_t AllocatedBytes() const;
+        size_t HeapAllocationNum() const;
+        size_t ReservedBytes() const;
+
+    private:
+        struct Block {
+            uint8_t* data;
+            size_t size;
+        };
+
+        size_t blockSize;
+        std::vector<Block> blocks;
+        size_t blockIndex;
+        size_t blockOffset;
+        size_t allocationNum;
+        size_t allocatedBytes;
+        size_t heapAllocationNum;
+    };
+
+    struct FrameArenaStats {
+        size_t threadNum = 0;
+        size_t allocationNum = 0;
+        size_t allocatedBytes = 0;
+        // blocks the arena had to take from the heap since the last reset, stays at zero once a frame is warmed up
+        size_t heapAllocationNum = 0;
+        size_t reservedBytes = 0;
+    };
+
+    // one LinearAllocator per thread allocating from it, so allocation takes no lock, Reset() rewinds all of them at
+    // the frame boundary, the caller guarantees no thread allocates from or still uses memory of the arena by then
+    class FrameArena {
+    public:
+        explicit FrameArena(size_t inBlockSize = LinearAllocator::defaultBlockSize);
+        ~FrameArena();
+
+        NonCopyable(FrameArena)
+        NonMovable(FrameArena)
+
+        void* Allocate(size_t inSize, size_t inAlignment = alignof(std::max_align_t));
+        template <typename T> T* AllocateArray(size_t inCount);
+        void Reset();
+        FrameArenaStats Stats() const;
+
+    private:
+        LinearAllocator& ThreadAllocator();
+
+        uint64_t uid;
+        size_t blockSize;
+        mutable std::mutex mutex;
+        std::vector<UniquePtr<LinearAllocator>> allocators;
+    };
+
+    // stl allocator over a FrameArena, deallocate() is a no-op as the arena frees everything at once, a null arena
+    // falls back to the heap, so code paths shared with threads that have no frame arena keep working
+    template <typename T>
+    class FrameAllocator {
+    public:
+        using value_type = T;
+
+        FrameAllocator(FrameArena* inArena = nullptr) noexcept; // NOLINT
+        template <typename T2> FrameAllocator(const FrameAllocator<T2>& inOther) noexcept; // NOLINT
+
+        T* allocate(size_t inCount);
+        void deallocate(T* inPtr, size_t inCount) noexcept;
+        FrameArena* Arena() const noexcept;
+
+        template <typename T2> bool operator==(const FrameAllocator<T2>& inRhs) const noexcept;
+
+    private:
+        static constexpr bool heapOnly = alignof(T) > alignof(std::max_align_t);
+
+        FrameArena* arena;
+    };
+
+    // destructs objects placed in a frame arena without freeing them, and deletes them when there was no arena
+    template <typename T>
+    class FrameDeleter {
+    public:
+        FrameDeleter(FrameArena* inArena = nullptr) noexcept; // NOLINT
+        template <typename T2> requires std::is_convertible_v<T2*, T*> FrameDeleter(const FrameDeleter<T2>& inOther) noexcept; // NOLINT
+
+        void operator()(T* inPtr) const noexcept;
+        FrameArena* Arena() const noexcept;
+
+    private:
+        FrameArena* arena;
+    };
+
+    template <typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+    template <typename K, typename V, typename H = std::hash<K>> using FrameUnorderedMap = std::unordered_map<K, V, H, std::equal_to<K>, FrameAllocator<std::pair<const K, V>>>;
+    template <typename K, typename H = std::hash<K>> using FrameUnorderedSet = std::unordered_set<K, H, std::equal_to<K>, FrameAllocator<K>>;
+    template <typename T> using FrameUniquePtr = std::unique_ptr<T, FrameDeleter<T>>;
+
     template <typename T, typename... Args> UniquePtr<T> MakeUnique(Args&&... args);
     template <typename T, typename... Args> SharedPtr<T> MakeShared(Args&&... args);
 }
@@ -512,4 +627,90 @@ namespace Common {
     {
         return Common::SharedPtr<T>(new T(std::forward<Args>(args)...));
     }
+
+    template <typename T>
+    T* LinearAllocator::AllocateArray(size_t inCount)
+    {
+        static_assert(std::is_trivially_destructible_v<T>);
+        return static_cast<T*>(Allocate(sizeof(T) * inCount, alignof(T)));
+    }
+
+    template <typename T>
+    T* FrameArena::AllocateArray(size_t inCount)
+    {
+        static_assert(std::is_trivially_destructible_v<T>);
+        return static_cast<T*>(Allocate(sizeof(T) * inCount, alignof(T)));
+    }
+
+    template <typename T>
+    FrameAllocator<T>::FrameAllocator(FrameArena* inArena) noexcept
+        : arena(inArena)
+    {
+    }
+
+    template <typename T>
+    template <typename T2>
+    FrameAllocator<T>::FrameAllocator(const FrameAllocator<T2>& inOther) noexcept
+        : arena(inOther.Arena())
+    {
+    }
+
+    template <typename T>
+    T* FrameAllocator<T>::allocate(size_t inCount)
+    {
+        if (heapOnly || arena == nullptr) {
+            return std::allocator<T>().allocate(inCount);
+        }
+        return static_cast<T*>(arena->Allocate(sizeof(T) * inCount, alignof(T)));
+    }
+
+    template <typename T>
+    void FrameAllocator<T>::deallocate(T* inPtr, size_t inCount) noexcept
+    {
+        if (heapOnly || arena == nullptr) {
+            std::allocator<T>().deallocate(inPtr, inCount);
+        }
+    }
+
+    template <typename T>
+    FrameArena* FrameAllocator<T>::Arena() const noexcept
+    {
+        return arena;
+    }
+
+    template <typename T>
+    template <typename T2>
+    bool FrameAllocator<T>::operator==(const FrameAllocator<T2>& inRhs) const noexcept
+    {
+        return arena == inRhs.Arena();
+    }
+
+    template <typename T>
+    FrameDeleter<T>::FrameDeleter(FrameArena* inArena) noexcept
+        : arena(inArena)
+    {
+    }
+
+    template <typename T>
+    template <typename T2> requires std::is_convertible_v<T2*, T*>
+    FrameDeleter<T>::FrameDeleter(const FrameDeleter<T2>& inOther) noexcept
+        : arena(inOther.Arena())
+    {
+    }
+
+    template <typename T>
+    void FrameDeleter<T>::operator()(T* inPtr) const noexcept
+    {
+        if (arena == nullptr) {
+            delete inPtr;
+        } else {
+            inPtr->~T();
+        }
+    }
+
+    template <typename T>
+    FrameArena* FrameDeleter<T>::Arena() const noexcept
+    {
+        return arena;
+    }
 }
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <cmath>
 #include <fstream>
 #include <string>
@@ -21,6 +23,7 @@
 #include <rapidjson/document.h>
 
 #include <Common/Utility.h>
+#include <Common/Memory.h>
 #include <Common/Debug.h>
 #include <Common/Hash.h>
 #include <Common/String.h>
@@ -28,20 +31,38 @@
 #include <Common/File.h>
 
 namespace Common {
+    // state the serializers of one stream share across calls, e.g. the class schema table of Mirror, owned by the
+    // code attaching it to the stream
+    class SerializeContext {
+    public:
+        virtual ~SerializeContext();
+    };
+
     class BinarySerializeStream {
     public:
         NonCopyable(BinarySerializeStream)
         virtual ~BinarySerializeStream();
 
         template <CppArithmetic T> void Write(const T& value);
+        // writes inCount values as one block, swapped in chunks when the stream endian differs from the native one
+        template <CppArithmetic T> void WriteArray(const T* inValues, size_t inCount);
         virtual void Seek(int64_t offset) = 0;
         virtual size_t Loc() = 0;
         virtual std::endian Endian() = 0;
+        void SetContext(SerializeContext* inContext);
+        SerializeContext* GetContext() const;
 
     protected:
-        BinarySerializeStream();
+        explicit BinarySerializeStream(std::endian inEndian);
 
+        // called for writes not fitting into the window
         virtual void WriteInternal(const void* data, size_t size) = 0;
+
+        SerializeContext* context;
+        bool swapEndian;
+        // buffer range buffered streams let Write() fill inline, skipping the virtual WriteInternal(), null when closed
+        uint8_t* writeCursor;
+        uint8_t* writeEnd;
     };
 
     class BinaryDeserializeStream {
@@ -50,16 +71,33 @@ namespace Common {
         virtual ~BinaryDeserializeStream();
 
         template <CppArithmetic T> void Read(T& value);
+        template <CppArithmetic T> void ReadArray(T* outValues, size_t inCount);
+        // address of the next inSize bytes, skipped by the call, when the stream holds them in memory, null otherwise
+        const uint8_t* ReadInPlace(size_t inSize);
         virtual void Seek(int64_t offset) = 0;
         virtual size_t Loc() = 0;
         virtual std::endian Endian() = 0;
+        // mapping the stream reads from, deserializers may keep pointers returned by ReadInPlace() as long as they keep
+        // the mapping, null for streams whose bytes die with them
+        virtual SharedPtr<MappedFile> GetMappedFile() const;
+        void SetContext(SerializeContext* inContext);
+        SerializeContext* GetContext() const;
 
     protected:
-        BinaryDeserializeStream();
+        explicit BinaryDeserializeStream(std::endian inEndian);
 
+        // called for reads not fitting into the window
         virtual void ReadInternal(void* data, size_t size) = 0;
+
+        SerializeContext* context;
+        bool swapEndian;
+        // bytes streams holding their whole content in memory let Read() copy inline, skipping the virtual ReadInternal()
+        const uint8_t* readCursor;
+        const uint8_t* readEnd;
     };
 
+    // writes go through a user space buffer, seeking back into it (header back-patching) costs no file seek, only
+    // patches of bytes already flushed and writes larger than the buffer touch the file directly
     template <std::endian E = std::endian::little>
     class BinaryFileSerializeStream final : public BinarySerializeStream {
     public:
@@ -76,9 +114,21 @@ namespace Common {
         void WriteInternal(const void* data, size_t size) override;
 
     private:
+        void CloseWindow();
+        void OpenWindow();
+        void FlushBuffer();
+        void WriteFile(size_t inOffset, const uint8_t* inData, size_t inSize);
+
         std::ofstream file;
+        // holds bytes [bufferBase, bufferBase + bufferUsed), the file holds everything before
+        std::vector<uint8_t> buffer;
+        size_t bufferBase;
+        size_t bufferUsed;
+        // only valid while the window is closed
+        size_t pointer;
     };
 
+    // the whole file is read by one call on construction, reads and seeks are plain memory operations afterward
     template <std::endian E = std::endian::little>
     class BinaryFileDeserializeStream final : public BinaryDeserializeStream {
     public:
@@ -95,8 +145,30 @@ namespace Common {
         void ReadInternal(void* data, size_t size) override;
 
     private:
-        std::ifstream file;
-        size_t fileSize;
+        std::vector<uint8_t> bytes;
+    };
+
+    // reads straight from a mapping of the file, nothing is copied up front and untouched bytes are never loaded, blobs
+    // deserialized from it point into the mapping instead of owning a copy
+    template <std::endian E = std::endian::little>
+    class BinaryMappedFileDeserializeStream final : public BinaryDeserializeStream {
+    public:
+        NonCopyable(BinaryMappedFileDeserializeStream)
+        explicit BinaryMappedFileDeserializeStream(const std::string& inFileName);
+        ~BinaryMappedFileDeserializeStream() override;
+
+        void Seek(int64_t offset) override;
+        size_t Loc() override;
+        std::endian Endian() override;
+        SharedPtr<MappedFile> GetMappedFile() const override;
+        bool IsValid() const;
+        void Close();
+
+    protected:
+        void ReadInternal(void* data, size_t size) override;
+
+    private:
+        SharedPtr<MappedFile> mappedFile;
     };
 
     template <std::endian E = std::endian::little>
@@ -133,11 +205,24 @@ namespace Common {
         void ReadInternal(void* data, size_t size) override;
 
     private:
-        size_t pointer;
         const std::vector<uint8_t>& bytes;
     };
 
     template <typename T> struct Serializer {};
+
+    // element types whose serialized bytes are exactly their memory bytes, contiguous containers of them are serialized
+    // as one block instead of element by element, Component is the arithmetic type endian swapping works on
+    template <typename T> struct BulkSerializeTraits {
+        static constexpr bool bulk = false;
+    };
+
+    template <CppArithmeticNonBool T> struct BulkSerializeTraits<T> {
+        static constexpr bool bulk = true;
+        using Component = T;
+    };
+
+    template <typename T> concept BulkSerializable = BulkSerializeTraits<T>::bulk;
+
     template <typename T> concept Serializable = requires(T inValue, BinarySerializeStream& serializeStream, BinaryDeserializeStream& deserializeStream)
     {
         { Serializer<T>::typeId } -> std::convertible_to<uint32_t>;
@@ -145,6 +230,13 @@ namespace Common {
         { Serializer<T>::Deserialize(deserializeStream, inValue) } -> std::convertible_to<size_t>;
     };
 
+    // serializers of types which replaced another one in existing files also read the fields written by the old type
+    template <typename T> concept LegacyDeserializable = requires(T outValue, BinaryDeserializeStream& deserializeStream)
+    {
+        { Serializer<T>::legacyTypeId } -> std::convertible_to<uint32_t>;
+        { Serializer<T>::DeserializeLegacy(deserializeStream, outValue) } -> std::convertible_to<size_t>;
+    };
+
     template <Serializable T> struct FieldSerializer;
 
     template <typename T> size_t Serialize(BinarySerializeStream& inStream, const T& inValue);
@@ -187,56 +279,159 @@ namespace Common {
     }; \
 
 namespace Common::Internal {
-    inline std::vector<uint8_t> SwapEndian(const void* data, const size_t size)
+    inline void SwapEndianInplace(void* data, size_t size)
+    {
+        auto* bytes = static_cast<uint8_t*>(data);
+        for (auto i = 0; i < size / 2; i++) {
+            std::swap(bytes[i], bytes[size - 1 - i]);
+        }
+    }
+
+    // plain shifts are recognized as bswap by compilers and the loops below are vectorized into byte shuffles
+    inline uint16_t ByteSwap(uint16_t inValue)
     {
-        std::vector<uint8_t> result;
-        result.resize(size);
+        return static_cast<uint16_t>((inValue >> 8) | (inValue << 8));
+    }
 
-        const auto* bytes = static_cast<const uint8_t*>(data);
-        for (auto i = 0; i < size; i++) {
-            result[i] = bytes[size - 1 - i];
+    inline uint32_t ByteSwap(uint32_t inValue)
+    {
+        return (inValue >> 24) | ((inValue >> 8) & 0x0000ff00u) | ((inValue << 8) & 0x00ff0000u) | (inValue << 24);
+    }
+
+    inline uint64_t ByteSwap(uint64_t inValue)
+    {
+        return (static_cast<uint64_t>(ByteSwap(static_cast<uint32_t>(inValue))) << 32) | ByteSwap(static_cast<uint32_t>(inValue >> 32));
+    }
+
+    template <typename U>
+    void SwapEndianArrayOf(void* outDst, const void* inSrc, size_t inCount)
+    {
+        auto* dst = static_cast<uint8_t*>(outDst);
+        const auto* src = static_cast<const uint8_t*>(inSrc);
+        for (size_t i = 0; i < inCount; i++) {
+            U value;
+            memcpy(&value, src + i * sizeof(U), sizeof(U));
+            value = ByteSwap(value);
+            memcpy(dst + i * sizeof(U), &value, sizeof(U));
         }
-        return result;
     }
 
-    inline void SwapEndianInplace(void* data, size_t size)
+    // outDst may equal inSrc
+    template <size_t S>
+    void SwapEndianArray(void* outDst, const void* inSrc, size_t inCount)
     {
-        auto* bytes = static_cast<uint8_t*>(data);
-        for (auto i = 0; i < size / 2; i++) {
-            std::swap(bytes[i], bytes[size - 1 - i]);
+        if constexpr (S == 1) {
+            if (outDst != inSrc) {
+                memcpy(outDst, inSrc, inCount);
+            }
+        } else if constexpr (S == 2) {
+            SwapEndianArrayOf<uint16_t>(outDst, inSrc, inCount);
+        } else if constexpr (S == 4) {
+            SwapEndianArrayOf<uint32_t>(outDst, inSrc, inCount);
+        } else if constexpr (S == 8) {
+            SwapEndianArrayOf<uint64_t>(outDst, inSrc, inCount);
+        } else {
+            if (outDst != inSrc) {
+                memcpy(outDst, inSrc, inCount * S);
+            }
+            for (size_t i = 0; i < inCount; i++) {
+                SwapEndianInplace(static_cast<uint8_t*>(outDst) + i * S, S);
+            }
         }
     }
+
+    constexpr size_t swapEndianChunkSize = 16 * 1024;
+    constexpr size_t fileSerializeStreamInitialBufferSize = 4 * 1024;
+    constexpr size_t fileSerializeStreamBufferSize = 1024 * 1024;
+
+    template <BulkSerializable T>
+    size_t SerializeBulk(BinarySerializeStream& inStream, const T* inValues, size_t inCount)
+    {
+        using Component = typename BulkSerializeTraits<T>::Component;
+        static_assert(sizeof(T) % sizeof(Component) == 0);
+        inStream.WriteArray(reinterpret_cast<const Component*>(inValues), inCount * (sizeof(T) / sizeof(Component)));
+        return inCount * sizeof(T);
+    }
+
+    template <BulkSerializable T>
+    size_t DeserializeBulk(BinaryDeserializeStream& inStream, T* outValues, size_t inCount)
+    {
+        using Component = typename BulkSerializeTraits<T>::Component;
+        static_assert(sizeof(T) % sizeof(Component) == 0);
+        inStream.ReadArray(reinterpret_cast<Component*>(outValues), inCount * (sizeof(T) / sizeof(Component)));
+        return inCount * sizeof(T);
+    }
 }
 
 namespace Common {
     template <CppArithmetic T>
     void BinarySerializeStream::Write(const T& value)
     {
-        if (std::endian::native == Endian()) {
-            WriteInternal(&value, sizeof(T));
+        T swapped = value;
+        if (swapEndian) {
+            Internal::SwapEndianInplace(&swapped, sizeof(T));
+        }
+        if (static_cast<size_t>(writeEnd - writeCursor) >= sizeof(T)) {
+            memcpy(writeCursor, &swapped, sizeof(T));
+            writeCursor += sizeof(T);
         } else {
-            const auto swapped = Internal::SwapEndian(&value, sizeof(T));
-            WriteInternal(reinterpret_cast<const char*>(swapped.data()), static_cast<std::streamsize>(swapped.size()));
+            WriteInternal(&swapped, sizeof(T));
         }
     }
 
     template <CppArithmetic T>
     void BinaryDeserializeStream::Read(T& value)
     {
-        ReadInternal(&value, sizeof(T));
-        if (std::endian::native != Endian()) {
+        if (static_cast<size_t>(readEnd - readCursor) >= sizeof(T)) {
+            memcpy(&value, readCursor, sizeof(T));
+            readCursor += sizeof(T);
+        } else {
+            ReadInternal(&value, sizeof(T));
+        }
+        if (swapEndian) {
             Internal::SwapEndianInplace(&value, sizeof(T));
         }
     }
 
+    template <CppArithmetic T>
+    void BinarySerializeStream::WriteArray(const T* inValues, size_t inCount)
+    {
+        if (!swapEndian) {
+            WriteInternal(inValues, inCount * sizeof(T));
+            return;
+        }
+
+        std::array<uint8_t, Internal::swapEndianChunkSize> chunk; // NOLINT
+        constexpr size_t valuesPerChunk = Internal::swapEndianChunkSize / sizeof(T);
+        for (size_t begin = 0; begin < inCount; begin += valuesPerChunk) {
+            const size_t count = std::min(valuesPerChunk, inCount - begin);
+            Internal::SwapEndianArray<sizeof(T)>(chunk.data(), inValues + begin, count);
+            WriteInternal(chunk.data(), count * sizeof(T));
+        }
+    }
+
+    template <CppArithmetic T>
+    void BinaryDeserializeStream::ReadArray(T* outValues, size_t inCount)
+    {
+        ReadInternal(outValues, inCount * sizeof(T));
+        if (swapEndian) {
+            Internal::SwapEndianArray<sizeof(T)>(outValues, outValues, inCount);
+        }
+    }
+
     template <std::endian E>
     BinaryFileSerializeStream<E>::BinaryFileSerializeStream(const std::string& inFileName)
+        : BinarySerializeStream(E)
+        , bufferBase(0)
+        , bufferUsed(0)
+        , pointer(0)
     {
         if (const auto parentPath = Common::Path(inFileName).Parent();
             !parentPath.Exists()) {
             parentPath.MakeDir();
         }
         file = std::ofstream(inFileName, std::ios::binary);
+        OpenWindow();
     }
 
     template <std::endian E>
@@ -246,21 +441,69 @@ namespace Common {
     }
 
     template <std::endian E>
-    void BinaryFileSerializeStream<E>::WriteInternal(const void* data, const size_t size)
+    void BinaryFileSerializeStream<E>::WriteInternal(const void* data, size_t size)
     {
-        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        CloseWindow();
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (pointer < bufferBase) {
+            const size_t flushedSize = std::min(size, bufferBase - pointer);
+            WriteFile(pointer, bytes, flushedSize);
+            pointer += flushedSize;
+            bytes += flushedSize;
+            size -= flushedSize;
+        }
+
+        if (size > 0) {
+            // small files never pay for the whole buffer
+            if (const size_t required = pointer - bufferBase + size;
+                required > buffer.size() && buffer.size() < Internal::fileSerializeStreamBufferSize) {
+                buffer.resize(std::min(Internal::fileSerializeStreamBufferSize, std::max({ required, buffer.size() * 2, Internal::fileSerializeStreamInitialBufferSize })));
+            }
+            if (const size_t offset = pointer - bufferBase;
+                offset + size > buffer.size()) {
+                // the prefix landing inside the buffer goes there first, so the flush never moves bufferBase past pointer
+                if (offset < buffer.size()) {
+                    const size_t bufferedSize = buffer.size() - offset;
+                    if (offset > bufferUsed) {
+                        memset(buffer.data() + bufferUsed, 0, offset - bufferUsed);
+                    }
+                    memcpy(buffer.data() + offset, bytes, bufferedSize);
+                    bufferUsed = buffer.size();
+                    pointer += bufferedSize;
+                    bytes += bufferedSize;
+                    size -= bufferedSize;
+                }
+                FlushBuffer();
+            }
+            if (const size_t offset = pointer - bufferBase;
+                offset + size > buffer.size()) {
+                WriteFile(pointer, bytes, size);
+                bufferBase = pointer + size;
+            } else {
+                if (offset > bufferUsed) {
+                    memset(buffer.data() + bufferUsed, 0, offset - bufferUsed);
+                }
+                memcpy(buffer.data() + offset, bytes, size);
+                bufferUsed = std::max(bufferUsed, offset + size);
+            }
+            pointer += size;
+        }
+        OpenWindow();
     }
 
     template <std::endian E>
     void BinaryFileSerializeStream<E>::Seek(int64_t offset)
     {
-        file.seekp(offset, std::ios::cur);
+        CloseWindow();
+        pointer += offset;
+        OpenWindow();
     }
 
     template <std::endian E>
     size_t BinaryFileSerializeStream<E>::Loc()
     {
-        return file.tellp();
+        return writeCursor != nullptr ? bufferBase + (writeCursor - buffer.data()) : pointer;
     }
 
     template <std::endian E>
@@ -275,6 +518,8 @@ namespace Common {
         if (!file.is_open()) {
             return;
         }
+        CloseWindow();
+        FlushBuffer();
         try {
             file.close();
         } catch (const std::exception&) {
@@ -282,13 +527,64 @@ namespace Common {
         }
     }
 
+    template <std::endian E>
+    void BinaryFileSerializeStream<E>::CloseWindow()
+    {
+        if (writeCursor == nullptr) {
+            return;
+        }
+        const size_t offset = writeCursor - buffer.data();
+        pointer = bufferBase + offset;
+        bufferUsed = std::max(bufferUsed, offset);
+        writeCursor = nullptr;
+        writeEnd = nullptr;
+    }
+
+    template <std::endian E>
+    void BinaryFileSerializeStream<E>::OpenWindow()
+    {
+        if (pointer < bufferBase || pointer - bufferBase > buffer.size()) {
+            return;
+        }
+        // a seek past the written bytes leaves a gap, zero it as the file would
+        const size_t offset = pointer - bufferBase;
+        if (offset > bufferUsed) {
+            memset(buffer.data() + bufferUsed, 0, offset - bufferUsed);
+        }
+        writeCursor = buffer.data() + offset;
+        writeEnd = buffer.data() + buffer.size();
+    }
+
+    template <std::endian E>
+    void BinaryFileSerializeStream<E>::FlushBuffer()
+    {
+        if (bufferUsed == 0) {
+            return;
+        }
+        WriteFile(bufferBase, buffer.data(), bufferUsed);
+        bufferBase += bufferUsed;
+        bufferUsed = 0;
+    }
+
+    template <std::endian E>
+    void BinaryFileSerializeStream<E>::WriteFile(size_t inOffset, const uint8_t* inData, size_t inSize)
+    {
+        file.seekp(static_cast<std::streamoff>(inOffset), std::ios::beg);
+        file.write(reinterpret_cast<const char*>(inData), static_cast<std::streamsize>(inSize));
+    }
+
     template <std::endian E>
     BinaryFileDeserializeStream<E>::BinaryFileDeserializeStream(const std::string& inFileName)
-        : file(inFileName, std::ios::binary)
+        : BinaryDeserializeStream(E)
     {
-        file.seekg(0, std::ios::end);
-        fileSize = file.tellg();
-        file.seekg(0, std::ios::beg);
+        std::ifstream file(inFileName, std::ios::binary | std::ios::ate);
+        if (file.is_open()) {
+            bytes.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0, std::ios::beg);
+            file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        }
+        readCursor = bytes.data();
+        readEnd = bytes.data() + bytes.size();
     }
 
     template <std::endian E>
@@ -300,20 +596,21 @@ namespace Common {
     template <std::endian E>
     void BinaryFileDeserializeStream<E>::ReadInternal(void* data, const size_t size)
     {
-        Assert(static_cast<size_t>(file.tellg()) + size <= fileSize);
-        file.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        Assert(static_cast<size_t>(readEnd - readCursor) >= size);
+        memcpy(data, readCursor, size);
+        readCursor += size;
     }
 
     template <std::endian E>
     void BinaryFileDeserializeStream<E>::Seek(int64_t offset)
     {
-        file.seekg(offset, std::ios::cur);
+        readCursor += offset;
     }
 
     template <std::endian E>
     size_t BinaryFileDeserializeStream<E>::Loc()
     {
-        return file.tellg();
+        return readCursor - bytes.data();
     }
 
     template <std::endian E>
@@ -325,19 +622,77 @@ namespace Common {
     template <std::endian E>
     void BinaryFileDeserializeStream<E>::Close()
     {
-        if (!file.is_open()) {
-            return;
-        }
-        try {
-            file.close();
-        } catch (const std::exception&) {
-            QuickFail();
-        }
+        bytes = {};
+        readCursor = nullptr;
+        readEnd = nullptr;
+    }
+
+    template <std::endian E>
+    BinaryMappedFileDeserializeStream<E>::BinaryMappedFileDeserializeStream(const std::string& inFileName)
+        : BinaryDeserializeStream(E)
+        , mappedFile(MakeShared<MappedFile>(inFileName))
+    {
+        readCursor = mappedFile->Data();
+        readEnd = mappedFile->Data() + mappedFile->Size();
+    }
+
+    template <std::endian E>
+    BinaryMappedFileDeserializeStream<E>::~BinaryMappedFileDeserializeStream()
+    {
+        Close();
+    }
+
+    template <std::endian E>
+    void BinaryMappedFileDeserializeStream<E>::ReadInternal(void* data, const size_t size)
+    {
+        Assert(static_cast<size_t>(readEnd - readCursor) >= size);
+        memcpy(data, readCursor, size);
+        readCursor += size;
+    }
+
+    template <std::endian E>
+    void BinaryMappedFileDeserializeStream<E>::Seek(int64_t offset)
+    {
+        readCursor += offset;
+    }
+
+    template <std::endian E>
+    size_t BinaryMappedFileDeserializeStream<E>::Loc()
+    {
+        return readCursor - mappedFile->Data();
+    }
+
+    template <std::endian E>
+    std::endian BinaryMappedFileDeserializeStream<E>::Endian()
+    {
+        return E;
+    }
+
+    template <std::endian E>
+    SharedPtr<MappedFile> BinaryMappedFileDeserializeStream<E>::GetMappedFile() const
+    {
+        return mappedFile;
+    }
+
+    template <std::endian E>
+    bool BinaryMappedFileDeserializeStream<E>::IsValid() const
+    {
+        return mappedFile != nullptr && mappedFile->IsValid();
+    }
+
+    template <std::endian E>
+    void BinaryMappedFileDeserializeStream<E>::Close()
+    {
+        // blobs still pointing into the mapping keep it alive
+        mappedFile.Reset();
+        readCursor = nullptr;
+        readEnd = nullptr;
     }
 
     template <std::endian E>
     MemorySerializeStream<E>::MemorySerializeStream(std::vector<uint8_t>& inBytes, const size_t pointerBegin)
-        : pointer(pointerBegin)
+        : BinarySerializeStream(E)
+        , pointer(pointerBegin)
         , bytes(inBytes)
     {
         Assert(pointer <= bytes.size());
@@ -380,10 +735,12 @@ namespace Common {
 
     template <std::endian E>
     MemoryDeserializeStream<E>::MemoryDeserializeStream(const std::vector<uint8_t>& inBytes, const size_t pointerBegin)
-        : pointer(pointerBegin)
+        : BinaryDeserializeStream(E)
         , bytes(inBytes)
     {
-        Assert(pointer <= bytes.size());
+        Assert(pointerBegin <= bytes.size());
+        readCursor = bytes.data() + pointerBegin;
+        readEnd = bytes.data() + bytes.size();
     }
 
     template <std::endian E>
@@ -392,22 +749,21 @@ namespace Common {
     template <std::endian E>
     void MemoryDeserializeStream<E>::ReadInternal(void* data, const size_t size)
     {
-        const auto newPointer = pointer + size;
-        Assert(newPointer <= bytes.size());
-        memcpy(data, bytes.data() + pointer, size);
-        pointer = newPointer;
+        Assert(static_cast<size_t>(readEnd - readCursor) >= size);
+        memcpy(data, readCursor, size);
+        readCursor += size;
     }
 
     template <std::endian E>
     void MemoryDeserializeStream<E>::Seek(int64_t offset)
     {
-        pointer += offset;
+        readCursor += offset;
     }
 
     template <std::endian E>
     size_t MemoryDeserializeStream<E>::Loc()
     {
-        return pointer;
+        return readCursor - bytes.data();
     }
 
     template <std::endian E>
@@ -528,12 +884,21 @@ namespace Common {
             Header header {};
             header.Deserialize(stream);
 
-            if (header.typeId != Serializer<T>::typeId) {
+            bool legacy = false;
+            if constexpr (LegacyDeserializable<T>) {
+                legacy = header.typeId == Serializer<T>::legacyTypeId;
+            }
+            if (header.typeId != Serializer<T>::typeId && !legacy) {
                 stream.Seek(header.contentSize);
                 return { false, sizeof(Header) };
             }
 
-            size_t deserializedSize = Serializer<T>::Deserialize(stream, value);
+            size_t deserializedSize;
+            if constexpr (LegacyDeserializable<T>) {
+                deserializedSize = legacy ? Serializer<T>::DeserializeLegacy(stream, value) : Serializer<T>::Deserialize(stream, value);
+            } else {
+                deserializedSize = Serializer<T>::Deserialize(stream, value);
+            }
             if (deserializedSize != header.contentSize) {
                 stream.Seek(header.contentSize - deserializedSize);
                 return { false, sizeof(Header) + deserializedSize };
@@ -708,8 +1073,12 @@ namespace Common {
             const uint64_t size = value.size();
             serialized += Serializer<uint64_t>::Serialize(stream, size);
 
-            for (const auto& element : value) {
-                serialized += Serializer<T>::Serialize(stream, element);
+            if constexpr (BulkSerializable<T>) {
+                serialized += Internal::SerializeBulk(stream, value.data(), N);
+            } else {
+                for (const auto& element : value) {
+                    serialized += Serializer<T>::Serialize(stream, element);
+                }
             }
             return serialized;
         }
@@ -728,6 +1097,10 @@ namespace Common {
                 return deserialized;
             }
 
+            if constexpr (BulkSerializable<T>) {
+                deserialized += Internal::DeserializeBulk(stream, value.data(), N);
+                return deserialized;
+            }
             for (auto i = 0; i < size; i++) {
                 T element;
                 deserialized += Serializer<T>::Deserialize(stream, element);
@@ -750,8 +1123,12 @@ namespace Common {
             const uint64_t size = value.size();
             serialized += Serializer<uint64_t>::Serialize(stream, size);
 
-            for (auto i = 0; i < size; i++) {
-                serialized += Serializer<T>::Serialize(stream, value[i]);
+            if constexpr (BulkSerializable<T>) {
+                serialized += Internal::SerializeBulk(stream, value.data(), value.size());
+            } else {
+                for (auto i = 0; i < size; i++) {
+                    serialized += Serializer<T>::Serialize(stream, value[i]);
+                }
             }
             return serialized;
         }
@@ -764,6 +1141,11 @@ namespace Common {
             uint64_t size;
             deserialized += Serializer<uint64_t>::Deserialize(stream, size);
 
+            if constexpr (BulkSerializable<T>) {
+                value.resize(size);
+                deserialized += Internal::DeserializeBulk(stream, value.data(), value.size());
+                return deserialized;
+            }
             value.reserve(size);
             for (auto i = 0; i < size; i++) {
                 T element;
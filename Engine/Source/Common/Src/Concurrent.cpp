@@ -33,26 +33,80 @@ namespace Common {
 #endif
     }
 
+    TaskFunction::TaskFunction()
+        : storage()
+        , ops(nullptr)
+    {
+    }
+
+    TaskFunction::TaskFunction(TaskFunction&& inOther) noexcept
+        : ops(inOther.ops)
+    {
+        if (ops != nullptr) {
+            ops->moveTo(storage, inOther.storage);
+            inOther.ops = nullptr;
+        }
+    }
+
+    TaskFunction& TaskFunction::operator=(TaskFunction&& inOther) noexcept
+    {
+        if (this == &inOther) {
+            return *this;
+        }
+        if (ops != nullptr) {
+            ops->destroy(storage);
+        }
+        ops = inOther.ops;
+        if (ops != nullptr) {
+            ops->moveTo(storage, inOther.storage);
+            inOther.ops = nullptr;
+        }
+        return *this;
+    }
+
+    TaskFunction::~TaskFunction()
+    {
+        if (ops != nullptr) {
+            ops->destroy(storage);
+        }
+    }
+
+    void TaskFunction::operator()()
+    {
+        Assert(ops != nullptr);
+        ops->invoke(storage);
+    }
+
+    TaskFunction::operator bool() const
+    {
+        return ops != nullptr;
+    }
+
+    // the pool and queue the current thread works for, lets a worker push to and pop from its own deque
+    struct ThreadPoolWorkerContext {
+        const ThreadPool* pool;
+        size_t queueIndex;
+    };
+
+    static thread_local ThreadPoolWorkerContext threadPoolWorkerContext = { nullptr, 0 };
+
     ThreadPool::ThreadPool(const std::string& name, uint8_t threadNum)
         : stop(false)
+        , pendingTaskNum(0)
+        , sleepingThreadNum(0)
+        , nextQueueIndex(0)
     {
+        Assert(threadNum > 0);
+        queues.reserve(threadNum);
+        for (auto i = 0; i < threadNum; i++) {
+            queues.emplace_back(Common::MakeUnique<WorkQueue>());
+        }
+
         threads.reserve(threadNum);
         for (auto i = 0; i < threadNum; i++) {
             std::string fullName = name + "-" + std::to_string(i);
-            threads.emplace_back(fullName, [this]() -> void {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock lock(mutex);
-                        condition.wait(lock, [this]() -> bool { return stop || !tasks.empty(); });
-                        if (stop && tasks.empty()) {
-                            return;
-                        }
-                        task = std::move(tasks.front());
-                        tasks.pop();
-                    }
-                    task();
-                }
+            threads.emplace_back(fullName, [this, i]() -> void {
+                WorkerLoop(i);
             });
         }
     }
@@ -60,72 +114,202 @@ namespace Common {
     ThreadPool::~ThreadPool()
     {
         {
-            std::unique_lock lock(mutex);
+            std::unique_lock lock(sleepMutex);
             stop = true;
         }
-        condition.notify_all();
+        sleepCondition.notify_all();
         for (auto& thread : threads) {
             thread.Join();
         }
     }
 
-    WorkerThread::WorkerThread(const std::string& name)
-        : stop(false)
-        , flush(false)
-    {
-        thread = NamedThread(name, [this]() -> void {
-            while (true) {
-                bool needNotifyMainThread = false;
-                std::vector<std::function<void()>> tasksToExecute;
-                {
-                    std::unique_lock lock(mutex);
-                    taskCondition.wait(lock, [this]() -> bool { return stop || flush || !tasks.empty(); });
-                    if (stop && tasks.empty()) {
-                        return;
-                    }
-                    if (flush) {
-                        tasksToExecute.reserve(tasks.size());
-                        while (!tasks.empty()) {
-                            tasksToExecute.emplace_back(std::move(tasks.front()));
-                            tasks.pop();
-                        }
-                        flush = false;
-                        needNotifyMainThread = true;
-                    } else {
-                        tasksToExecute.emplace_back(std::move(tasks.front()));
-                        tasks.pop();
-                    }
-                }
-                for (auto& task : tasksToExecute) {
-                    task();
-                }
-                if (needNotifyMainThread) {
-                    flushCondition.notify_one();
-                }
-            }
-        });
+    uint8_t ThreadPool::ThreadNum() const
+    {
+        return static_cast<uint8_t>(threads.size());
     }
 
-    WorkerThread::~WorkerThread()
+    void ThreadPool::Push(TaskFunction&& task)
     {
+        // workers may still queue sub tasks while the pool drains in the destructor
+        const bool fromWorker = threadPoolWorkerContext.pool == this;
+        Assert(fromWorker || !stop);
+
+        // pairs with the sleepingThreadNum increment in WorkerLoop(), either the worker sees the new task before
+        // sleeping or we see the sleeping worker and wake it up
+        pendingTaskNum.fetch_add(1);
+        const size_t queueIndex = fromWorker ? threadPoolWorkerContext.queueIndex : nextQueueIndex.fetch_add(1, std::memory_order_relaxed) % queues.size();
         {
-            std::unique_lock lock(mutex);
-            stop = true;
+            auto& queue = *queues[queueIndex];
+            std::unique_lock lock(queue.mutex);
+            queue.tasks.emplace_back(std::move(task));
+        }
+        if (sleepingThreadNum.load() > 0) {
+            {
+                std::unique_lock lock(sleepMutex);
+            }
+            sleepCondition.notify_one();
+        }
+    }
+
+    bool ThreadPool::TryPop(TaskFunction& outTask)
+    {
+        if (pendingTaskNum.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+
+        const bool fromWorker = threadPoolWorkerContext.pool == this;
+        if (fromWorker) {
+            auto& queue = *queues[threadPoolWorkerContext.queueIndex];
+            std::unique_lock lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                outTask = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                pendingTaskNum.fetch_sub(1);
+                return true;
+            }
+        }
+
+        const size_t firstVictim = fromWorker ? threadPoolWorkerContext.queueIndex + 1 : 0;
+        for (size_t i = 0; i < queues.size(); i++) {
+            auto& queue = *queues[(firstVictim + i) % queues.size()];
+            std::unique_lock lock(queue.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || queue.tasks.empty()) {
+                continue;
+            }
+            outTask = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            pendingTaskNum.fetch_sub(1);
+            return true;
         }
-        taskCondition.notify_all();
+        return false;
+    }
+
+    bool ThreadPool::RunOne()
+    {
+        TaskFunction task;
+        if (!TryPop(task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    void ThreadPool::HelpUntilDone(const std::atomic<size_t>& remaining)
+    {
+        while (remaining.load(std::memory_order_acquire) != 0) {
+            if (!RunOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void ThreadPool::WorkerLoop(size_t queueIndex)
+    {
+        threadPoolWorkerContext = { this, queueIndex };
+
+        while (true) {
+            if (RunOne()) {
+                continue;
+            }
+
+            std::unique_lock lock(sleepMutex);
+            sleepingThreadNum.fetch_add(1);
+            sleepCondition.wait(lock, [this]() -> bool { return stop || pendingTaskNum.load() > 0; });
+            sleepingThreadNum.fetch_sub(1);
+            // tasks queued before the pool stops are still drained
+            if (stop && pendingTaskNum.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    WorkerThread::WorkerThread(const std::string& name, size_t capacity)
+        : stop(false)
+        , sleeping(false)
+        , wakeSignal(0)
+        , tasks(capacity)
+    {
+        thread = NamedThread(name, [this]() -> void { ThreadLoop(); });
+    }
+
+    WorkerThread::~WorkerThread()
+    {
+        stop = true;
+        WakeUp();
         thread.Join();
     }
 
     void WorkerThread::Flush()
     {
-        {
-            std::unique_lock lock(mutex);
-            flush = true;
+        std::atomic<bool> done = false;
+        Spawn([&done]() -> void {
+            done.store(true, std::memory_order_release);
+            done.notify_one();
+        });
+        done.wait(false, std::memory_order_acquire);
+    }
+
+    void WorkerThread::Push(TaskFunction&& task)
+    {
+        // tasks running on the thread may still queue more while it drains in the destructor
+        const bool fromThread = threadId.load(std::memory_order_relaxed) == std::this_thread::get_id();
+        Assert(fromThread || !stop);
+        if (fromThread) {
+            // nobody else drains a full ring, and once a task overflowed later ones queue behind it to keep the order
+            if (!overflow.empty() || !tasks.TryPush(std::move(task))) {
+                overflow.emplace_back(std::move(task));
+            }
+            return;
         }
-        taskCondition.notify_one();
-        {
-            std::unique_lock lock(mutex);
-            flushCondition.wait(lock);
+        while (!tasks.TryPush(std::move(task))) {
+            WakeUp();
+            std::this_thread::yield();
+        }
+        // pairs with the fence in ThreadLoop(), either the consumer sees the task before sleeping or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_relaxed)) {
+            WakeUp();
+        }
+    }
+
+    void WorkerThread::WakeUp()
+    {
+        wakeSignal.fetch_add(1, std::memory_order_release);
+        wakeSignal.notify_one();
+    }
+
+    void WorkerThread::ThreadLoop()
+    {
+        threadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+        TaskFunction task;
+        while (true) {
+            RefillFromOverflow();
+            if (tasks.TryPop(task)) {
+                task();
+                task = TaskFunction();
+                continue;
+            }
+
+            const uint32_t signal = wakeSignal.load(std::memory_order_acquire);
+            sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (tasks.Empty()) {
+                // tasks queued before the thread stops are still drained
+                if (stop.load()) {
+                    sleeping.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                wakeSignal.wait(signal, std::memory_order_acquire);
+            }
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void WorkerThread::RefillFromOverflow()
+    {
+        while (!overflow.empty() && tasks.TryPush(std::move(overflow.front()))) {
+            overflow.pop_front();
         }
     }
 }
@@ -0,0 +1,73 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <Common/Coroutine.h>
+
+namespace Common::Internal {
+    bool TaskPromiseBase::FinalAwaiter::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void TaskPromiseBase::FinalAwaiter::await_resume() const noexcept {}
+
+    std::suspend_always TaskPromiseBase::initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    TaskPromiseBase::FinalAwaiter TaskPromiseBase::final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void TaskPromiseBase::unhandled_exception() const
+    {
+        QuickFailWithReason("exception escaped from a coroutine task");
+    }
+
+    Task<void> TaskPromise<void>::get_return_object()
+    {
+        return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    void TaskPromise<void>::return_void() const {}
+
+    void TaskPromise<void>::TakeResult() const {}
+
+    DetachedTask DetachedTask::promise_type::get_return_object() const
+    {
+        return {};
+    }
+
+    std::suspend_never DetachedTask::promise_type::initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    std::suspend_never DetachedTask::promise_type::final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void DetachedTask::promise_type::return_void() const {}
+
+    void DetachedTask::promise_type::unhandled_exception() const
+    {
+        QuickFailWithReason("exception escaped from a detached coroutine task");
+    }
+
+    void SyncWaitSignal::Set()
+    {
+        std::unique_lock lock(mutex);
+        done = true;
+        condition.notify_one();
+    }
+
+    void SyncWaitSignal::Wait()
+    {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, [this]() -> bool { return done; });
+    }
+}
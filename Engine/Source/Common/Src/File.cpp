@@ -2,9 +2,22 @@
 // Created by johnk on 2024/4/14.
 //
 
+#include <algorithm>
 #include <fstream>
 #include <cstdio>
+#include <cstring>
 #include <format>
+#include <mutex>
+#include <unordered_map>
+
+#if PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include <rapidjson/filereadstream.h>
 #include <rapidjson/filewritestream.h>
@@ -12,8 +25,23 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/error/error.h>
 
+#include <Common/Debug.h>
 #include <Common/File.h>
 #include <Common/FileSystem.h>
+#include <Common/String.h>
+
+namespace Common::Internal {
+    struct MappedFileRegistry {
+        std::mutex mutex;
+        std::unordered_multimap<std::string, MappedFile*> mappedFiles;
+    };
+
+    static MappedFileRegistry& GetMappedFileRegistry()
+    {
+        static MappedFileRegistry registry;
+        return registry;
+    }
+}
 
 namespace Common {
     Result<std::string, std::string> FileUtils::ReadTextFile(const std::string& inFileName)
@@ -93,4 +121,146 @@ namespace Common {
         (void) fclose(file);
         return Ok();
     }
+
+    void MappedFile::MaterializeAll(const std::string& inFileName)
+    {
+        const Path path(inFileName);
+        if (!path.Exists()) {
+            return;
+        }
+
+        auto& [mutex, mappedFiles] = Internal::GetMappedFileRegistry();
+        std::unique_lock lock(mutex);
+        const auto [begin, end] = mappedFiles.equal_range(path.Canonical().String());
+        for (auto iter = begin; iter != end; ++iter) {
+            iter->second->Materialize();
+        }
+    }
+
+    MappedFile::MappedFile(const std::string& inFileName)
+        : valid(false)
+        , data(nullptr)
+        , size(0)
+        , materialized(false)
+#if PLATFORM_WINDOWS
+        , fileHandle(INVALID_HANDLE_VALUE)
+        , mappingHandle(nullptr)
+#endif
+    {
+#if PLATFORM_WINDOWS
+        // share delete lets savers replace the file by renaming over it while this mapping is alive
+        fileHandle = CreateFileW(
+            StringUtils::ToWideString(inFileName).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize)) {
+            return;
+        }
+        size = static_cast<size_t>(fileSize.QuadPart);
+        valid = true;
+        // an empty file can not be mapped, it is still a valid mapping of nothing
+        if (size == 0) {
+            return;
+        }
+        mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr) {
+            data = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+        valid = data != nullptr;
+#else
+        const int fd = open(inFileName.c_str(), O_RDONLY); // NOLINT
+        if (fd < 0) {
+            return;
+        }
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) == 0) {
+            size = static_cast<size_t>(fileStat.st_size);
+            valid = true;
+            if (size > 0) {
+                void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                data = mapped != MAP_FAILED ? static_cast<const uint8_t*>(mapped) : nullptr;
+                valid = data != nullptr;
+            }
+        }
+        // the mapping keeps its own reference to the file
+        (void) close(fd);
+#endif
+        if (!valid) {
+            size = 0;
+        }
+        if (data != nullptr) {
+            canonicalName = Path(inFileName).Canonical().String();
+            auto& [mutex, mappedFiles] = Internal::GetMappedFileRegistry();
+            std::unique_lock lock(mutex);
+            mappedFiles.emplace(canonicalName, this);
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (data != nullptr) {
+            auto& [mutex, mappedFiles] = Internal::GetMappedFileRegistry();
+            std::unique_lock lock(mutex);
+            const auto [begin, end] = mappedFiles.equal_range(canonicalName);
+            mappedFiles.erase(std::find_if(begin, end, [this](const auto& pair) -> bool { return pair.second == this; }));
+        }
+
+#if PLATFORM_WINDOWS
+        if (materialized) {
+            VirtualFree(const_cast<uint8_t*>(data), 0, MEM_RELEASE);
+        } else if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mappingHandle != nullptr) {
+            CloseHandle(mappingHandle);
+        }
+        if (fileHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle);
+        }
+#else
+        if (data != nullptr) {
+            munmap(const_cast<uint8_t*>(data), size);
+        }
+#endif
+    }
+
+    bool MappedFile::IsValid() const
+    {
+        return valid;
+    }
+
+    const uint8_t* MappedFile::Data() const
+    {
+        return data;
+    }
+
+    size_t MappedFile::Size() const
+    {
+        return size;
+    }
+
+    void MappedFile::Materialize()
+    {
+#if PLATFORM_WINDOWS
+        if (materialized) {
+            return;
+        }
+
+        // page aligned like the view, so the alignment of blob data inside is kept
+        auto* owned = static_cast<uint8_t*>(VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+        Assert(owned != nullptr);
+        memcpy(owned, data, size);
+
+        UnmapViewOfFile(data);
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+        data = owned;
+        materialized = true;
+#endif
+    }
 }
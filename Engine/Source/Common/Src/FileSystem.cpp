@@ -190,6 +190,19 @@ namespace Common {
         std::filesystem::copy(path, inPath.path, std::filesystem::copy_options::update_existing | std::filesystem::copy_options::recursive);
     }
 
+    bool Path::RenameTo(const Path& inPath) const
+    {
+        std::error_code errorCode;
+        std::filesystem::rename(path, inPath.path, errorCode);
+        return !errorCode;
+    }
+
+    bool Path::Remove() const
+    {
+        std::error_code errorCode;
+        return std::filesystem::remove(path, errorCode);
+    }
+
     void Path::MakeDir() const
     {
         std::filesystem::create_directories(path);
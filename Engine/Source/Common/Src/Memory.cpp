@@ -0,0 +1,155 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include <Common/Memory.h>
+#include <Common/Debug.h>
+
+namespace Common::Internal {
+    static uint64_t AllocateFrameArenaUid()
+    {
+        static std::atomic<uint64_t> counter = 0;
+        return ++counter;
+    }
+}
+
+namespace Common {
+    LinearAllocator::LinearAllocator(size_t inBlockSize)
+        : blockSize(inBlockSize)
+        , blockIndex(0)
+        , blockOffset(0)
+        , allocationNum(0)
+        , allocatedBytes(0)
+        , heapAllocationNum(0)
+    {
+        Assert(blockSize > 0);
+    }
+
+    LinearAllocator::~LinearAllocator()
+    {
+        for (const auto& block : blocks) {
+            ::operator delete(block.data, std::align_val_t(alignof(std::max_align_t)));
+        }
+    }
+
+    void* LinearAllocator::Allocate(size_t inSize, size_t inAlignment)
+    {
+        Assert(inAlignment > 0 && (inAlignment & (inAlignment - 1)) == 0 && inAlignment <= alignof(std::max_align_t));
+        if (inSize == 0) {
+            inSize = 1;
+        }
+
+        while (blockIndex < blocks.size()) {
+            auto& block = blocks[blockIndex];
+            const size_t alignedOffset = (blockOffset + inAlignment - 1) & ~(inAlignment - 1);
+            if (alignedOffset + inSize <= block.size) {
+                blockOffset = alignedOffset + inSize;
+                allocationNum++;
+                allocatedBytes += inSize;
+                return block.data + alignedOffset;
+            }
+            blockIndex++;
+            blockOffset = 0;
+        }
+
+        // oversized requests get a block of their own, it is kept and reused after Reset() like any other block
+        const size_t newBlockSize = std::max(blockSize, inSize);
+        auto* data = static_cast<uint8_t*>(::operator new(newBlockSize, std::align_val_t(alignof(std::max_align_t))));
+        blocks.emplace_back(Block { data, newBlockSize });
+        blockIndex = blocks.size() - 1;
+        blockOffset = inSize;
+        allocationNum++;
+        allocatedBytes += inSize;
+        heapAllocationNum++;
+        return data;
+    }
+
+    void LinearAllocator::Reset()
+    {
+        blockIndex = 0;
+        blockOffset = 0;
+        allocationNum = 0;
+        allocatedBytes = 0;
+        heapAllocationNum = 0;
+    }
+
+    size_t LinearAllocator::AllocationNum() const
+    {
+        return allocationNum;
+    }
+
+    size_t LinearAllocator::AllocatedBytes() const
+    {
+        return allocatedBytes;
+    }
+
+    size_t LinearAllocator::HeapAllocationNum() const
+    {
+        return heapAllocationNum;
+    }
+
+    size_t LinearAllocator::ReservedBytes() const
+    {
+        size_t result = 0;
+        for (const auto& block : blocks) {
+            result += block.size;
+        }
+        return result;
+    }
+
+    FrameArena::FrameArena(size_t inBlockSize)
+        : uid(Internal::AllocateFrameArenaUid())
+        , blockSize(inBlockSize)
+    {
+    }
+
+    FrameArena::~FrameArena() = default;
+
+    void* FrameArena::Allocate(size_t inSize, size_t inAlignment)
+    {
+        return ThreadAllocator().Allocate(inSize, inAlignment);
+    }
+
+    void FrameArena::Reset()
+    {
+        std::unique_lock lock(mutex);
+        for (const auto& allocator : allocators) {
+            allocator->Reset();
+        }
+    }
+
+    FrameArenaStats FrameArena::Stats() const
+    {
+        std::unique_lock lock(mutex);
+        FrameArenaStats result;
+        result.threadNum = allocators.size();
+        for (const auto& allocator : allocators) {
+            result.allocationNum += allocator->AllocationNum();
+            result.allocatedBytes += allocator->AllocatedBytes();
+            result.heapAllocationNum += allocator->HeapAllocationNum();
+            result.reservedBytes += allocator->ReservedBytes();
+        }
+        return result;
+    }
+
+    LinearAllocator& FrameArena::ThreadAllocator()
+    {
+        // uids are never reused, so entries of destroyed arenas just stay unmatched
+        thread_local std::vector<std::pair<uint64_t, LinearAllocator*>> cache;
+        for (const auto& [arenaUid, allocator] : cache) {
+            if (arenaUid == uid) {
+                return *allocator;
+            }
+        }
+
+        std::unique_lock lock(mutex);
+        auto* allocator = allocators.emplace_back(new LinearAllocator(blockSize)).Get();
+        cache.emplace_back(uid, allocator);
+        return *allocator;
+    }
+}
@@ -5,11 +5,60 @@
 #include <Common/Serialization.h>
 
 namespace Common {
-    BinarySerializeStream::BinarySerializeStream() = default;
+    SerializeContext::~SerializeContext() = default;
+
+    BinarySerializeStream::BinarySerializeStream(std::endian inEndian)
+        : context(nullptr)
+        , swapEndian(inEndian != std::endian::native)
+        , writeCursor(nullptr)
+        , writeEnd(nullptr)
+    {
+    }
 
     BinarySerializeStream::~BinarySerializeStream() = default;
 
-    BinaryDeserializeStream::BinaryDeserializeStream() = default;
+    void BinarySerializeStream::SetContext(SerializeContext* inContext)
+    {
+        context = inContext;
+    }
+
+    SerializeContext* BinarySerializeStream::GetContext() const
+    {
+        return context;
+    }
+
+    BinaryDeserializeStream::BinaryDeserializeStream(std::endian inEndian)
+        : context(nullptr)
+        , swapEndian(inEndian != std::endian::native)
+        , readCursor(nullptr)
+        , readEnd(nullptr)
+    {
+    }
 
     BinaryDeserializeStream::~BinaryDeserializeStream() = default;
+
+    const uint8_t* BinaryDeserializeStream::ReadInPlace(size_t inSize)
+    {
+        if (static_cast<size_t>(readEnd - readCursor) < inSize) {
+            return nullptr;
+        }
+        const uint8_t* result = readCursor;
+        readCursor += inSize;
+        return result;
+    }
+
+    SharedPtr<MappedFile> BinaryDeserializeStream::GetMappedFile() const
+    {
+        return nullptr;
+    }
+
+    void BinaryDeserializeStream::SetContext(SerializeContext* inContext)
+    {
+        context = inContext;
+    }
+
+    SerializeContext* BinaryDeserializeStream::GetContext() const
+    {
+        return context;
+    }
 }
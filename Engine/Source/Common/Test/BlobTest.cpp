@@ -0,0 +1,135 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <Common/Blob.h>
+#include <Common/Math/Adapters.h>
+#include <Test/Test.h>
+
+using namespace Common;
+
+namespace {
+    const std::string blobFile = "../Test/Generated/Common/BlobTest.bin";
+
+    // a leading string shifts the blob to an unaligned offset
+    template <std::endian E>
+    void SaveBlob(const Blob<FVec3>& inBlob)
+    {
+        BinaryFileSerializeStream<E> stream(blobFile);
+        Serialize(stream, std::string("header"));
+        Serialize(stream, inBlob);
+    }
+
+    void LoadBlob(BinaryDeserializeStream& inStream, Blob<FVec3>& outBlob)
+    {
+        std::string header;
+        ASSERT_TRUE(Deserialize(inStream, header).first);
+        ASSERT_EQ(header, "header");
+        ASSERT_TRUE(Deserialize(inStream, outBlob).first);
+    }
+
+    Blob<FVec3> MakeBlob()
+    {
+        std::vector<FVec3> values;
+        for (auto i = 0; i < 100; i++) {
+            values.emplace_back(static_cast<float>(i), 1.0f, 2.0f);
+        }
+        return values;
+    }
+}
+
+TEST(BlobTest, OwnedBlobTest)
+{
+    Blob<uint32_t> blob;
+    ASSERT_TRUE(blob.Empty());
+    ASSERT_FALSE(blob.IsView());
+
+    blob.Resize(3);
+    blob[1] = 5;
+    ASSERT_EQ(blob.Size(), 3);
+    ASSERT_EQ(blob[1], 5);
+    ASSERT_EQ(blob, Blob<uint32_t>(std::vector<uint32_t> { 0, 5, 0 }));
+
+    blob.Clear();
+    ASSERT_TRUE(blob.Empty());
+}
+
+TEST(BlobTest, MappedFileBlobIsAlignedViewTest)
+{
+    const auto expected = MakeBlob();
+    SaveBlob<std::endian::native>(expected);
+
+    Blob<FVec3> blob;
+    {
+        BinaryMappedFileDeserializeStream<std::endian::native> stream(blobFile);
+        LoadBlob(stream, blob);
+    }
+
+    // the blob keeps the mapping alive after the stream is gone
+    ASSERT_TRUE(blob.IsView());
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(blob.Data()) % Internal::blobAlignment, 0);
+    ASSERT_EQ(blob, expected);
+
+    // copies share the mapping, writes copy the view first and leave the mapping untouched
+    const Blob<FVec3> view = blob;
+    ASSERT_TRUE(view.IsView());
+    ASSERT_EQ(view.Data(), blob.Data());
+    blob[0] = FVec3(-1.0f, -1.0f, -1.0f);
+    ASSERT_FALSE(blob.IsView());
+    ASSERT_NE(blob.Data(), view.Data());
+    ASSERT_EQ(blob[0], FVec3(-1.0f, -1.0f, -1.0f));
+    ASSERT_EQ(blob[1], expected[1]);
+    ASSERT_EQ(view[0], expected[0]);
+}
+
+TEST(BlobTest, NonMappedOrSwappedBlobIsCopiedTest)
+{
+    const auto expected = MakeBlob();
+
+    SaveBlob<std::endian::native>(expected);
+    {
+        Blob<FVec3> blob;
+        BinaryFileDeserializeStream<std::endian::native> stream(blobFile);
+        LoadBlob(stream, blob);
+        ASSERT_FALSE(blob.IsView());
+        ASSERT_EQ(blob, expected);
+    }
+
+    constexpr auto foreignEndian = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+    SaveBlob<foreignEndian>(expected);
+    {
+        Blob<FVec3> blob;
+        BinaryMappedFileDeserializeStream<foreignEndian> stream(blobFile);
+        LoadBlob(stream, blob);
+        ASSERT_FALSE(blob.IsView());
+        ASSERT_EQ(blob, expected);
+    }
+}
+
+TEST(BlobTest, VectorFieldIsLoadedAsBlobTest)
+{
+    // files written before blobs replaced the vector fields of assets
+    const auto expected = MakeBlob();
+    {
+        BinaryFileSerializeStream stream(blobFile);
+        Serialize(stream, std::string("header"));
+        Serialize(stream, std::vector<FVec3>(expected.begin(), expected.end()));
+        Serialize(stream, std::string("footer"));
+    }
+
+    for (const bool mapped : { false, true }) {
+        Blob<FVec3> blob;
+        std::string footer;
+        if (mapped) {
+            BinaryMappedFileDeserializeStream stream(blobFile);
+            LoadBlob(stream, blob);
+            ASSERT_TRUE(Deserialize(stream, footer).first);
+        } else {
+            BinaryFileDeserializeStream stream(blobFile);
+            LoadBlob(stream, blob);
+            ASSERT_TRUE(Deserialize(stream, footer).first);
+        }
+        ASSERT_EQ(blob, expected);
+        ASSERT_EQ(footer, "footer");
+    }
+}
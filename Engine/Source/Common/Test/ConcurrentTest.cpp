@@ -6,6 +6,11 @@
 
 #include <Common/Concurrent.h>
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
 TEST(ConcurrentTest, NamedThreadTest)
 {
     std::atomic<uint32_t> value = 0;
@@ -73,6 +78,77 @@ TEST(ConcurrentTest, ThreadPoolExecuteTasksTest)
     ASSERT_EQ(count, 64);
 }
 
+TEST(ConcurrentTest, TaskFunctionTest)
+{
+    uint32_t value = 0;
+    Common::TaskFunction small([&value]() -> void { ++value; });
+    std::array<uint64_t, 16> bigCapture {};
+    bigCapture[15] = 2;
+    Common::TaskFunction big([&value, bigCapture]() -> void { value += static_cast<uint32_t>(bigCapture[15]); });
+
+    Common::TaskFunction moved = std::move(small);
+    ASSERT_FALSE(small);
+    ASSERT_TRUE(moved);
+    moved();
+    big();
+    ASSERT_EQ(value, 3);
+
+    auto counter = std::make_shared<uint32_t>(0);
+    {
+        Common::TaskFunction holder([counter]() -> void { ++*counter; });
+        ASSERT_EQ(counter.use_count(), 2);
+        big = std::move(holder);
+        big();
+    }
+    ASSERT_EQ(*counter, 1);
+    big = Common::TaskFunction();
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentTest, ThreadPoolSpawnTest)
+{
+    std::atomic<uint32_t> count = 0;
+    {
+        Common::ThreadPool threadPool("TestThreadPool", 4);
+        for (auto i = 0; i < 1000; i++) {
+            threadPool.Spawn([&count]() -> void { ++count; });
+        }
+    }
+    ASSERT_EQ(count, 1000);
+}
+
+TEST(ConcurrentTest, ThreadPoolParallelForTest)
+{
+    Common::ThreadPool threadPool("TestThreadPool", 4);
+    std::vector<uint32_t> values(10000, 0);
+    threadPool.ParallelFor(0, values.size(), 64, [&values](size_t rangeBegin, size_t rangeEnd) -> void {
+        ASSERT_LE(rangeEnd - rangeBegin, 64);
+        for (size_t i = rangeBegin; i < rangeEnd; i++) {
+            values[i]++;
+        }
+    });
+    for (const auto value : values) {
+        ASSERT_EQ(value, 1);
+    }
+
+    // nested loops run on workers that help instead of blocking, so this must not deadlock with few threads
+    std::atomic<size_t> count = 0;
+    threadPool.ParallelFor(0, 16, 1, [&](size_t, size_t) -> void {
+        threadPool.ParallelFor(0, 100, 10, [&count](size_t rangeBegin, size_t rangeEnd) -> void {
+            count += rangeEnd - rangeBegin;
+        });
+    });
+    ASSERT_EQ(count, 1600);
+
+    auto future = threadPool.EmplaceTask([&threadPool]() -> uint32_t {
+        auto inner = threadPool.EmplaceTask([]() -> uint32_t { return 42; });
+        threadPool.Wait(inner);
+        return inner.get();
+    });
+    threadPool.Wait(future);
+    ASSERT_EQ(future.get(), 42);
+}
+
 TEST(ConcurrentTest, WorkerThread0)
 {
     uint32_t value = 0;
@@ -123,3 +199,78 @@ TEST(ConcurrentTest, WorkerThread3)
     syncSignal.wait();
     ASSERT_EQ(value, 10);
 }
+
+TEST(ConcurrentTest, MpscRingBufferTest)
+{
+    Common::MpscRingBuffer<uint32_t> ring(4);
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.TryPush(std::move(i)));
+    }
+    ASSERT_FALSE(ring.TryPush(4));
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.TryPop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(ring.TryPop(value));
+    ASSERT_TRUE(ring.Empty());
+
+    // every producer pushes an increasing sequence, the consumer must see each sequence in order
+    constexpr uint32_t producerNum = 4;
+    constexpr uint32_t valueNum = 10000;
+    Common::MpscRingBuffer<uint32_t> sharedRing(64);
+    std::vector<Common::NamedThread> producers;
+    for (uint32_t producer = 0; producer < producerNum; producer++) {
+        producers.emplace_back("TestProducer", [&sharedRing, producer]() -> void {
+            for (uint32_t i = 0; i < valueNum; i++) {
+                while (!sharedRing.TryPush(producer * valueNum + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::array<uint32_t, producerNum> nextValues {};
+    for (uint32_t received = 0; received < producerNum * valueNum;) {
+        if (!sharedRing.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto producer = value / valueNum;
+        ASSERT_EQ(value % valueNum, nextValues[producer]);
+        nextValues[producer]++;
+        received++;
+    }
+    for (auto& producer : producers) {
+        producer.Join();
+    }
+}
+
+TEST(ConcurrentTest, WorkerThreadSpawnTest)
+{
+    // a ring far smaller than the task count makes producers wait for the consumer
+    std::vector<uint32_t> values;
+    {
+        Common::WorkerThread workerThread("TestWorkerThread", 16);
+        for (uint32_t i = 0; i < 1000; i++) {
+            workerThread.Spawn([&values, i]() -> void { values.emplace_back(i); });
+        }
+        workerThread.Flush();
+        ASSERT_EQ(values.size(), 1000);
+        for (uint32_t i = 0; i < 1000; i++) {
+            ASSERT_EQ(values[i], i);
+        }
+
+        // tasks queued by the consumer overflow the ring but still run after it, in order
+        workerThread.Spawn([&workerThread, &values]() -> void {
+            for (uint32_t i = 0; i < 100; i++) {
+                workerThread.Spawn([&values, i]() -> void { values.emplace_back(1000 + i); });
+            }
+            values.emplace_back(999);
+        });
+    }
+    ASSERT_EQ(values.size(), 1101);
+    ASSERT_EQ(values[1000], 999);
+    for (uint32_t i = 0; i < 100; i++) {
+        ASSERT_EQ(values[1001 + i], 1000 + i);
+    }
+}
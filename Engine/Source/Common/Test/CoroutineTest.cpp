@@ -0,0 +1,87 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <Test/Test.h>
+
+#include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace {
+    Common::Task<int> AddOne(int inValue)
+    {
+        co_return inValue + 1;
+    }
+
+    Common::Task<int> AddTwo(int inValue)
+    {
+        const int value = co_await AddOne(inValue);
+        co_return co_await AddOne(value);
+    }
+
+    Common::Task<std::thread::id> ThreadIdOn(Common::ThreadPool& inPool)
+    {
+        co_await Common::ScheduleOn(inPool);
+        co_return std::this_thread::get_id();
+    }
+
+    Common::Task<std::string> Pipeline(Common::ThreadPool& inPool, Common::WorkerThread& inWorker, std::thread::id& outWorkerThreadId)
+    {
+        co_await Common::ScheduleOn(inPool);
+        std::string result = "loaded";
+
+        co_await Common::ScheduleOn(inWorker);
+        outWorkerThreadId = std::this_thread::get_id();
+        result += "+uploaded";
+        co_return result;
+    }
+
+    Common::Task<void> Increase(Common::ThreadPool& inPool, std::atomic<uint32_t>& outCount)
+    {
+        co_await Common::ScheduleOn(inPool);
+        ++outCount;
+    }
+
+    Common::Task<uint32_t> IncreaseAndGet(Common::ThreadPool& inPool, std::atomic<uint32_t>& outCount)
+    {
+        co_await Common::ScheduleOn(inPool);
+        co_return ++outCount;
+    }
+}
+
+TEST(CoroutineTest, TaskTest)
+{
+    ASSERT_EQ(Common::SyncWait(AddTwo(1)), 3);
+
+    Common::Task<int> task = AddOne(5);
+    ASSERT_TRUE(task.Valid());
+    ASSERT_FALSE(task.Done());
+    Common::Task<int> moved = std::move(task);
+    ASSERT_FALSE(task.Valid());
+    ASSERT_EQ(Common::SyncWait(std::move(moved)), 6);
+}
+
+TEST(CoroutineTest, ScheduleOnTest)
+{
+    Common::ThreadPool pool("TestThreadPool", 2);
+    Common::WorkerThread worker("TestWorkerThread");
+
+    ASSERT_NE(Common::SyncWait(ThreadIdOn(pool)), std::this_thread::get_id());
+
+    std::thread::id workerThreadId;
+    ASSERT_EQ(Common::SyncWait(Pipeline(pool, worker, workerThreadId)), "loaded+uploaded");
+    ASSERT_EQ(worker.EmplaceTask([]() -> std::thread::id { return std::this_thread::get_id(); }).get(), workerThreadId);
+
+    std::atomic<uint32_t> count = 0;
+    for (auto i = 0; i < 100; i++) {
+        Common::Detach(Increase(pool, count));
+        Common::Detach(IncreaseAndGet(pool, count));
+    }
+    while (count != 200) {
+        std::this_thread::yield();
+    }
+}
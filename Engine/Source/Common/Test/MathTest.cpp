@@ -14,6 +14,7 @@
 #include <Common/Math/Rect.h>
 #include <Common/Math/Box.h>
 #include <Common/Math/Sphere.h>
+#include <Common/Math/Frustum.h>
 #include <Common/Math/Color.h>
 #include <Common/Math/View.h>
 #include <Common/Math/Half.h>
@@ -1043,6 +1044,77 @@ TEST(MathTest, TransformMatrixTest)
     EXPECT_NEAR(directPosition.z, matrixPosition.z, 1.0e-5f);
 }
 
+TEST(MathTest, TransformComposeTest)
+{
+    const FTransform parent(FVec3(2, 2, 2), FQuat::FromEulerZYX(20, -35, 70), FVec3(5, -6, 7));
+    const FTransform child(FVec3(1, 3, 0.5f), FQuat::FromEulerZYX(-40, 15, 110), FVec3(-1, 2, 4));
+
+    const FMat4x4 matrixProduct = parent.GetTransformMatrix() * child.GetTransformMatrix();
+    const FMat4x4 composed = (parent * child).GetTransformMatrix();
+    for (auto i = 0; i < 16; i++) {
+        EXPECT_NEAR(composed[i], matrixProduct[i], 1.0e-4f);
+    }
+
+    // a non-uniform parent scale is still exact when the child does not rotate
+    const FTransform stretched(FVec3(1, 2, 3), FQuat::FromEulerZYX(10, 20, 30), FVec3(1, 2, 3));
+    const FTransform unrotated(FVec3(2, 1, 1), FQuatConsts::identity, FVec3(3, 2, 1));
+    const FMat4x4 stretchedProduct = stretched.GetTransformMatrix() * unrotated.GetTransformMatrix();
+    const FMat4x4 stretchedComposed = (stretched * unrotated).GetTransformMatrix();
+    for (auto i = 0; i < 16; i++) {
+        EXPECT_NEAR(stretchedComposed[i], stretchedProduct[i], 1.0e-4f);
+    }
+
+    const FVec3 input(3, -2, 1);
+    const FVec3 chained = parent.TransformPosition(child.TransformPosition(input));
+    ASSERT_TRUE(AlmostEqual((parent * child).TransformPosition(input), chained, 1.0e-4f));
+}
+
+TEST(MathTest, TransformInverseTest)
+{
+    const FTransform v0(FVec3(2, 2, 2), FQuat::FromEulerZYX(20, -35, 70), FVec3(5, -6, 7));
+    const FTransform identity = v0.Inverse() * v0;
+    ASSERT_TRUE(AlmostEqual(identity.scale, FVec3Consts::unit, 1.0e-5f));
+    ASSERT_TRUE(AlmostEqual(identity.translation, FVec3Consts::zero, 1.0e-5f));
+    ASSERT_TRUE(AlmostEqual(identity.rotation.GetRotationMatrix(), FMat4x4Consts::identity, 1.0e-5f));
+
+    const FMat4x4 inverseMatrix = v0.GetTransformMatrix().Inverse();
+    const FMat4x4 inverse = v0.Inverse().GetTransformMatrix();
+    for (auto i = 0; i < 16; i++) {
+        EXPECT_NEAR(inverse[i], inverseMatrix[i], 1.0e-5f);
+    }
+}
+
+TEST(MathTest, TransformRelativeTest)
+{
+    const FTransform parent(FVec3(2, 2, 2), FQuat::FromEulerZYX(20, -35, 70), FVec3(5, -6, 7));
+    const FTransform local(FVec3(1, 3, 0.5f), FQuat::FromEulerZYX(-40, 15, 110), FVec3(-1, 2, 4));
+    const FTransform world = parent * local;
+
+    const FTransform relative = world.GetRelativeTransform(parent);
+    ASSERT_TRUE(AlmostEqual(relative.scale, local.scale, 1.0e-4f));
+    ASSERT_TRUE(AlmostEqual(relative.translation, local.translation, 1.0e-4f));
+    ASSERT_TRUE(AlmostEqual(relative.rotation.GetRotationMatrix(), local.rotation.GetRotationMatrix(), 1.0e-4f));
+
+    // same matrix as the inverse matrix product
+    const FMat4x4 matrixRelative = parent.GetTransformMatrix().Inverse() * world.GetTransformMatrix();
+    const FMat4x4 relativeMatrix = relative.GetTransformMatrix();
+    for (auto i = 0; i < 16; i++) {
+        EXPECT_NEAR(relativeMatrix[i], matrixRelative[i], 1.0e-4f);
+    }
+}
+
+TEST(MathTest, TransformOpsBackendTest)
+{
+    using SimdOps = Internal::TransformOps<float, MathBackend::simd>;
+    using ScalarOps = Internal::TransformOps<float, MathBackend::scalar>;
+
+    const FTransform parent(FVec3(2, 3, 4), FQuat::FromEulerZYX(20, -35, 70), FVec3(5, -6, 7));
+    const FTransform child(FVec3(0.5f, 1, 2), FQuat::FromEulerZYX(-40, 15, 110), FVec3(-1, 2, 4));
+    ASSERT_TRUE(AlmostEqual(SimdOps::Compose(parent, child), ScalarOps::Compose(parent, child), 1.0e-5f));
+    ASSERT_TRUE(AlmostEqual(SimdOps::Inverse(parent), ScalarOps::Inverse(parent), 1.0e-5f));
+    ASSERT_TRUE(AlmostEqual(SimdOps::Relative(child, parent), ScalarOps::Relative(child, parent), 1.0e-5f));
+}
+
 TEST(MathTest, TransformPositionVec4Test)
 {
     const FTransform v0(FVec3(2, 2, 2), FQuatConsts::identity, FVec3(1, 1, 1));
@@ -1210,6 +1282,80 @@ TEST(MathTest, SphereGeometryTest)
     ASSERT_TRUE(CompareNumber(v3.radius, 1.0));
 }
 
+// ==================================== Frustum ====================================
+
+TEST(MathTest, FrustumFromWorldToClipTest)
+{
+    // looking down +x from the origin, 90 degrees wide, depth range [1, 11]
+    const FReversedZPerspectiveProjection projection(90.0f, 2.0f, 2.0f, 1.0f, 11.0f);
+    const FViewTransform view = FViewTransform::LookAt(FVec3Consts::zero, FVec3(1, 0, 0));
+    const FFrustum frustum = FFrustum::FromWorldToClip(projection.GetProjectionMatrix() * view.GetViewMatrix());
+
+    ASSERT_TRUE(frustum.Inside(FVec3(5, 0, 0)));
+    ASSERT_TRUE(frustum.Inside(FVec3(5, 4.9f, 0)));
+    ASSERT_FALSE(frustum.Inside(FVec3(5, 5.1f, 0)));
+    ASSERT_FALSE(frustum.Inside(FVec3(0.5f, 0, 0)));
+    ASSERT_FALSE(frustum.Inside(FVec3(12, 0, 0)));
+    ASSERT_FALSE(frustum.Inside(FVec3(-5, 0, 0)));
+
+    // an infinite far plane must not reject anything behind the far distance
+    const FReversedZPerspectiveProjection infiniteProjection(90.0f, 2.0f, 2.0f, 1.0f, std::nullopt);
+    const FFrustum infiniteFrustum = FFrustum::FromWorldToClip(infiniteProjection.GetProjectionMatrix() * view.GetViewMatrix());
+    ASSERT_TRUE(infiniteFrustum.Inside(FVec3(1.0e5f, 0, 0)));
+    ASSERT_FALSE(infiniteFrustum.Inside(FVec3(0.5f, 0, 0)));
+}
+
+TEST(MathTest, FrustumIntersectTest)
+{
+    const FReversedZPerspectiveProjection projection(90.0f, 2.0f, 2.0f, 1.0f, 11.0f);
+    const FViewTransform view = FViewTransform::LookAt(FVec3Consts::zero, FVec3(1, 0, 0));
+    const FFrustum frustum = FFrustum::FromWorldToClip(projection.GetProjectionMatrix() * view.GetViewMatrix());
+
+    ASSERT_TRUE(frustum.Intersect(FSphere(FVec3(5, 0, 0), 1.0f)));
+    ASSERT_TRUE(frustum.Intersect(FSphere(FVec3(12, 0, 0), 1.5f)));
+    ASSERT_FALSE(frustum.Intersect(FSphere(FVec3(12, 0, 0), 0.5f)));
+    ASSERT_FALSE(frustum.Intersect(FSphere(FVec3(5, 8, 0), 1.0f)));
+
+    ASSERT_TRUE(frustum.Intersect(FBox(4, -1, -1, 6, 1, 1)));
+    ASSERT_TRUE(frustum.Intersect(FBox(4, 4, -1, 6, 8, 1)));
+    ASSERT_FALSE(frustum.Intersect(FBox(4, 7, -1, 6, 8, 1)));
+    ASSERT_FALSE(frustum.Intersect(FBox(-6, -1, -1, -4, 1, 1)));
+}
+
+TEST(MathTest, FrustumOpsBackendTest)
+{
+    const FReversedZPerspectiveProjection projection(60.0f, 16.0f, 9.0f, 0.1f, 100.0f);
+    const FViewTransform view = FViewTransform::LookAt(FVec3(-3, 2, 1), FVec3(10, -4, 2));
+    const FFrustum frustum = FFrustum::FromWorldToClip(projection.GetProjectionMatrix() * view.GetViewMatrix());
+
+    // an odd count covers the scalar tail of the 4-wide kernel
+    constexpr size_t num = 1023;
+    std::vector<FSphere> spheres;
+    std::vector<FBox> boxes;
+    spheres.reserve(num);
+    boxes.reserve(num);
+    for (size_t i = 0; i < num; i++) {
+        const FVec3 center(static_cast<float>(i % 13) * 10.0f - 60.0f, static_cast<float>(i % 7) * 20.0f - 60.0f, static_cast<float>(i % 5) * 15.0f - 30.0f);
+        const float extent = static_cast<float>(i % 4) + 0.5f;
+        spheres.emplace_back(center, extent);
+        boxes.emplace_back(center - FVec3(extent), center + FVec3(extent));
+    }
+
+    std::vector<uint8_t> scalarVisibilities(num);
+    std::vector<uint8_t> simdVisibilities(num);
+    Internal::FrustumOps<float, MathBackend::scalar>::IntersectSpheres(frustum, spheres.data(), num, scalarVisibilities.data());
+    Internal::FrustumOps<float, MathBackend::simd>::IntersectSpheres(frustum, spheres.data(), num, simdVisibilities.data());
+    ASSERT_EQ(scalarVisibilities, simdVisibilities);
+
+    Internal::FrustumOps<float, MathBackend::scalar>::IntersectBoxes(frustum, boxes.data(), num, scalarVisibilities.data());
+    Internal::FrustumOps<float, MathBackend::simd>::IntersectBoxes(frustum, boxes.data(), num, simdVisibilities.data());
+    ASSERT_EQ(scalarVisibilities, simdVisibilities);
+
+    const auto visibleNum = std::count(simdVisibilities.begin(), simdVisibilities.end(), 1);
+    ASSERT_GT(visibleNum, 0);
+    ASSERT_LT(visibleNum, static_cast<std::ptrdiff_t>(num));
+}
+
 // ==================================== Color ====================================
 
 TEST(MathTest, ColorConversionTest)
@@ -1325,6 +1471,11 @@ TEST(MathTest, SerializationTest)
     PerformTypedSerializationTest(IMat3x4(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12));
     PerformTypedSerializationTest(FMat4x4(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f));
 
+    // contiguous containers of vec/mat go through the bulk path
+    PerformTypedSerializationTest(std::vector<FVec3> { FVec3(1.0f, 2.0f, 3.0f), FVec3(4.0f, 5.0f, 6.0f) });
+    PerformTypedSerializationTest(std::array<UVec2, 2> { UVec2(1, 2), UVec2(3, 4) });
+    PerformTypedSerializationTest(std::vector<FMat4x4> { FMat4x4Consts::identity, FMat4x4(2.0f) });
+
     // angle/radian
     PerformTypedSerializationTest(FAngle(67.0f));
     PerformTypedSerializationTest(FRadian(1.5f * pi));
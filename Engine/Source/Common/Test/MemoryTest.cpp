@@ -2,6 +2,8 @@
 // Created by johnk on 2023/4/14.
 //
 
+#include <thread>
+
 #include <Test/Test.h>
 
 #include <Common/Memory.h>
@@ -134,3 +136,80 @@ TEST(MemoryTest, WeakRefDeriveTest) // NOLINT
     ASSERT_EQ(live, false);
     ASSERT_EQ(weakRef.Expired(), true);
 }
+
+TEST(MemoryTest, LinearAllocatorTest) // NOLINT
+{
+    LinearAllocator allocator(256);
+    ASSERT_EQ(allocator.AllocatedBytes(), 0);
+    ASSERT_EQ(allocator.ReservedBytes(), 0);
+
+    auto* a = allocator.AllocateArray<uint8_t>(3);
+    auto* b = allocator.AllocateArray<uint64_t>(4);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % alignof(uint64_t), 0);
+    ASSERT_GE(reinterpret_cast<uint8_t*>(b), a + 3);
+    ASSERT_EQ(allocator.AllocatedBytes(), 3 + sizeof(uint64_t) * 4);
+    ASSERT_EQ(allocator.ReservedBytes(), 256);
+
+    auto* big = allocator.AllocateArray<uint32_t>(1024);
+    big[1023] = 1;
+    ASSERT_EQ(allocator.ReservedBytes(), 256 + sizeof(uint32_t) * 1024);
+
+    allocator.Reset();
+    ASSERT_EQ(allocator.AllocatedBytes(), 0);
+    ASSERT_EQ(allocator.AllocateArray<uint8_t>(3), a);
+    ASSERT_EQ(allocator.ReservedBytes(), 256 + sizeof(uint32_t) * 1024);
+}
+
+TEST(MemoryTest, FrameArenaTest) // NOLINT
+{
+    FrameArena arena(1024);
+    for (auto frame = 0; frame < 3; frame++) {
+        arena.Reset();
+
+        FrameVector<uint32_t> values(&arena);
+        values.reserve(64);
+        for (auto i = 0; i < 64; i++) {
+            values.emplace_back(i);
+        }
+        FrameUnorderedMap<uint32_t, uint32_t> map(&arena);
+        for (auto i = 0; i < 16; i++) {
+            map.emplace(i, i * 2);
+        }
+        ASSERT_EQ(map.at(15), 30);
+
+        const auto stats = arena.Stats();
+        ASSERT_EQ(stats.threadNum, 1);
+        ASSERT_GT(stats.allocationNum, 0);
+        if (frame > 0) {
+            // the blocks of the first frame are reused, so a warmed up frame takes nothing from the heap
+            ASSERT_EQ(stats.heapAllocationNum, 0);
+        }
+    }
+
+    std::thread thread([&arena]() -> void {
+        FrameVector<uint64_t> threadValues(&arena);
+        threadValues.resize(32, 1);
+    });
+    thread.join();
+    ASSERT_EQ(arena.Stats().threadNum, 2);
+
+    FrameVector<uint32_t> heapValues;
+    heapValues.emplace_back(1);
+    ASSERT_EQ(heapValues.get_allocator().Arena(), nullptr);
+}
+
+TEST(MemoryTest, FrameUniquePtrTest) // NOLINT
+{
+    bool live = false;
+    FrameArena arena;
+    {
+        FrameUniquePtr<ChildTestStruct> ptr(new (arena.Allocate(sizeof(ChildTestStruct), alignof(ChildTestStruct))) ChildTestStruct(1, 2, live), FrameDeleter<ChildTestStruct>(&arena));
+        ASSERT_TRUE(live);
+    }
+    ASSERT_FALSE(live);
+    {
+        FrameUniquePtr<TestStruct> ptr(new TestStruct(1, live));
+        ASSERT_TRUE(live);
+    }
+    ASSERT_FALSE(live);
+}
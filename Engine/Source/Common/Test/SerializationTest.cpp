@@ -28,6 +28,31 @@ TEST(SerializationTest, FileStreamTest)
     }
 }
 
+TEST(SerializationTest, MappedFileStreamTest)
+{
+    static Common::Path fileName = "../Test/Generated/Common/SerializationTest.MappedFileStreamTest.bin";
+    {
+        BinaryFileSerializeStream stream(fileName.String());
+        stream.Seek(3);
+        stream.Write<uint32_t>(5);
+    }
+
+    {
+        uint32_t value;
+
+        BinaryMappedFileDeserializeStream stream(fileName.String());
+        ASSERT_TRUE(stream.IsValid());
+        ASSERT_NE(stream.GetMappedFile(), nullptr);
+        stream.Seek(3);
+        stream.Read<uint32_t>(value);
+        ASSERT_EQ(value, 5);
+        ASSERT_EQ(stream.Loc(), 7);
+    }
+
+    BinaryMappedFileDeserializeStream missingStream("../Test/Generated/Common/DoesNotExist.bin");
+    ASSERT_FALSE(missingStream.IsValid());
+}
+
 TEST(SerializationTest, ByteStreamTest)
 {
     std::vector<uint8_t> memory;
@@ -47,6 +72,95 @@ TEST(SerializationTest, ByteStreamTest)
     }
 }
 
+TEST(SerializationTest, BufferedFileStreamBackPatchTest)
+{
+    static Common::Path fileName = "../Test/Generated/Common/SerializationTest.BufferedFileStreamBackPatchTest.bin";
+
+    // the same seeks and writes on a memory stream and on a file stream, with payloads around the file stream buffer size
+    // so back-patches land both inside its buffer and in already flushed bytes
+    std::vector<uint8_t> expected;
+    {
+        BinaryFileSerializeStream fileStream(fileName.String());
+        MemorySerializeStream memoryStream(expected);
+
+        uint32_t seed = 11;
+        const auto next = [&]() -> uint32_t {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 8;
+        };
+        const std::array<size_t, 4> payloadSizes = { 3, 1000, 700 * 1024, 2 * 1024 * 1024 + 5 };
+        for (auto i = 0; i < 200; i++) {
+            // reserve a header, write a payload, patch the header, seek back to the end
+            const auto headerLoc = memoryStream.Loc();
+            fileStream.Seek(sizeof(uint64_t));
+            memoryStream.Seek(sizeof(uint64_t));
+
+            std::vector<uint8_t> payload(payloadSizes[next() % (i % 20 == 0 ? 4 : 2)]);
+            for (auto& byte : payload) {
+                byte = static_cast<uint8_t>(next());
+            }
+            for (const auto byte : payload) {
+                fileStream.Write<uint8_t>(byte);
+                memoryStream.Write<uint8_t>(byte);
+            }
+
+            const auto back = -static_cast<int64_t>(payload.size() + sizeof(uint64_t));
+            fileStream.Seek(back);
+            memoryStream.Seek(back);
+            fileStream.Write<uint64_t>(headerLoc);
+            memoryStream.Write<uint64_t>(headerLoc);
+            fileStream.Seek(static_cast<int64_t>(payload.size()));
+            memoryStream.Seek(static_cast<int64_t>(payload.size()));
+            ASSERT_EQ(fileStream.Loc(), memoryStream.Loc());
+        }
+    }
+
+    std::vector<uint8_t> actual(expected.size());
+    BinaryFileDeserializeStream stream(fileName.String());
+    stream.ReadArray(actual.data(), actual.size());
+    ASSERT_EQ(stream.Loc(), expected.size());
+    ASSERT_EQ(actual, expected);
+}
+
+TEST(SerializationTest, BufferedFileStreamStraddleTest)
+{
+    static Common::Path fileName = "../Test/Generated/Common/SerializationTest.BufferedFileStreamStraddleTest.bin";
+
+    // the file stream buffer is filled up to its cap, then writes overwrite its last bytes and run past its end, and
+    // overwrite flushed and buffered bytes at once
+    std::vector<uint8_t> expected;
+    {
+        BinaryFileSerializeStream fileStream(fileName.String());
+        MemorySerializeStream memoryStream(expected);
+
+        for (size_t i = 0; i < Internal::fileSerializeStreamBufferSize; i++) {
+            fileStream.Write<uint8_t>(static_cast<uint8_t>(i * 7));
+            memoryStream.Write<uint8_t>(static_cast<uint8_t>(i * 7));
+        }
+        fileStream.Seek(-4);
+        memoryStream.Seek(-4);
+        fileStream.Write<uint64_t>(0x0123456789abcdefull);
+        memoryStream.Write<uint64_t>(0x0123456789abcdefull);
+        ASSERT_EQ(fileStream.Loc(), memoryStream.Loc());
+
+        fileStream.Seek(-6);
+        memoryStream.Seek(-6);
+        fileStream.Write<uint32_t>(0xfedcba98u);
+        memoryStream.Write<uint32_t>(0xfedcba98u);
+        fileStream.Seek(6);
+        memoryStream.Seek(6);
+        fileStream.Write<uint32_t>(0x13579bdfu);
+        memoryStream.Write<uint32_t>(0x13579bdfu);
+        ASSERT_EQ(fileStream.Loc(), memoryStream.Loc());
+    }
+
+    std::vector<uint8_t> actual(expected.size());
+    BinaryFileDeserializeStream stream(fileName.String());
+    stream.ReadArray(actual.data(), actual.size());
+    ASSERT_EQ(stream.Loc(), expected.size());
+    ASSERT_EQ(actual, expected);
+}
+
 TEST(SerializationTest, TypedSerializationTest)
 {
     PerformTypedSerializationTest<bool>(false);
@@ -75,6 +189,46 @@ TEST(SerializationTest, TypedSerializationTest)
     PerformTypedSerializationTest<std::map<int, bool>>({ { 1, false }, { 2, true } });
     PerformTypedSerializationTest<std::tuple<int, bool, int>>({ 1, true, 2 });
     PerformTypedSerializationTest<std::variant<int, bool, float>>({ true });
+    PerformTypedSerializationTest<std::array<uint16_t, 3>>({ 1, 2, 3 });
+    PerformTypedSerializationTest<std::vector<double>>({ 1.0, 2.0, 3.0 });
+    PerformTypedSerializationTest<std::vector<bool>>({ true, false, true });
+}
+
+template <std::endian E>
+void PerformBulkSerializationLayoutTest()
+{
+    // larger than one endian swap chunk
+    std::vector<uint32_t> values(10000);
+    for (auto i = 0; i < values.size(); i++) {
+        values[i] = i * 2654435761u;
+    }
+
+    std::vector<uint8_t> bulkBytes;
+    {
+        MemorySerializeStream<E> stream(bulkBytes);
+        ASSERT_EQ(Serializer<std::vector<uint32_t>>::Serialize(stream, values), sizeof(uint64_t) + values.size() * sizeof(uint32_t));
+    }
+
+    std::vector<uint8_t> elementBytes;
+    {
+        MemorySerializeStream<E> stream(elementBytes);
+        stream.template Write<uint64_t>(values.size());
+        for (const auto value : values) {
+            stream.template Write<uint32_t>(value);
+        }
+    }
+    ASSERT_EQ(bulkBytes, elementBytes);
+
+    std::vector<uint32_t> deserialized;
+    MemoryDeserializeStream<E> stream(bulkBytes);
+    ASSERT_EQ(Serializer<std::vector<uint32_t>>::Deserialize(stream, deserialized), bulkBytes.size());
+    ASSERT_EQ(deserialized, values);
+}
+
+TEST(SerializationTest, BulkSerializationKeepsElementLayout)
+{
+    PerformBulkSerializationLayoutTest<std::endian::little>();
+    PerformBulkSerializationLayoutTest<std::endian::big>();
 }
 
 TEST(SerializationTest, TypedSerializationWithFileTest)
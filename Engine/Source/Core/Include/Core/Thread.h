@@ -5,7 +5,10 @@
 #pragma once
 
 #include <cstdint>
+#include <coroutine>
 
+#include <Common/Concurrent.h>
+#include <Common/Memory.h>
 #include <Core/Api.h>
 
 namespace Core {
@@ -18,9 +21,18 @@ namespace Core {
         max
     };
 
+    // queues a task onto the thread(s) carrying a tag, registered by whoever owns those threads
+    using ThreadDispatcher = void(*)(Common::TaskFunction&&);
+
     class CORE_API ThreadContext {
     public:
         static void SetTag(ThreadTag inTag);
+        static void SetDispatcher(ThreadTag inTag, ThreadDispatcher inDispatcher);
+        static bool HasDispatcher(ThreadTag inTag);
+        static void Dispatch(ThreadTag inTag, Common::TaskFunction&& inTask);
+        // the arena transient per-frame data of threads carrying the tag goes to, registered by the frame owner
+        static void SetFrameArena(ThreadTag inTag, Common::FrameArena* inArena);
+        static Common::FrameArena* CurrentFrameArena();
         static void IncFrameNumber();
 
         static ThreadTag Tag();
@@ -42,4 +54,20 @@ namespace Core {
     private:
         ThreadTag tagToRestore;
     };
+
+    class CORE_API ThreadTagAwaiter {
+    public:
+        explicit ThreadTagAwaiter(ThreadTag inTag);
+
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> inHandle) const;
+        void await_resume() const noexcept;
+
+    private:
+        ThreadTag tag;
+    };
+
+    // co_await ResumeOn(ThreadTag::render) continues the coroutine on the render thread, it does not suspend when the
+    // current thread already carries the tag
+    CORE_API ThreadTagAwaiter ResumeOn(ThreadTag inTag);
 }
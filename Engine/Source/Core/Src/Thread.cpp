@@ -2,6 +2,8 @@
 // Created by johnk on 2025/1/17.
 //
 
+#include <array>
+#include <atomic>
 #include <thread>
 
 #include <Core/Thread.h>
@@ -10,12 +12,43 @@ namespace Core {
     static auto mainThreadId = std::this_thread::get_id();
     static thread_local auto currentTag = std::this_thread::get_id() == mainThreadId ? ThreadTag::game : ThreadTag::unknown;
     static thread_local uint64_t frameNumber = 0;
+    static std::array<std::atomic<ThreadDispatcher>, static_cast<size_t>(ThreadTag::max)> dispatchers = {};
+    static std::array<std::atomic<Common::FrameArena*>, static_cast<size_t>(ThreadTag::max)> frameArenas = {};
 
     void ThreadContext::SetTag(ThreadTag inTag)
     {
         currentTag = inTag;
     }
 
+    void ThreadContext::SetDispatcher(ThreadTag inTag, ThreadDispatcher inDispatcher)
+    {
+        Assert(inTag != ThreadTag::unknown && inTag != ThreadTag::max);
+        dispatchers[static_cast<size_t>(inTag)].store(inDispatcher, std::memory_order_release);
+    }
+
+    bool ThreadContext::HasDispatcher(ThreadTag inTag)
+    {
+        return dispatchers[static_cast<size_t>(inTag)].load(std::memory_order_acquire) != nullptr;
+    }
+
+    void ThreadContext::Dispatch(ThreadTag inTag, Common::TaskFunction&& inTask)
+    {
+        const ThreadDispatcher dispatcher = dispatchers[static_cast<size_t>(inTag)].load(std::memory_order_acquire);
+        AssertWithReason(dispatcher != nullptr, "no thread carrying the tag is running");
+        dispatcher(std::move(inTask));
+    }
+
+    void ThreadContext::SetFrameArena(ThreadTag inTag, Common::FrameArena* inArena)
+    {
+        Assert(inTag != ThreadTag::unknown && inTag != ThreadTag::max);
+        frameArenas[static_cast<size_t>(inTag)].store(inArena, std::memory_order_release);
+    }
+
+    Common::FrameArena* ThreadContext::CurrentFrameArena()
+    {
+        return frameArenas[static_cast<size_t>(currentTag)].load(std::memory_order_acquire);
+    }
+
     void ThreadContext::IncFrameNumber()
     {
         frameNumber++;
@@ -76,4 +109,26 @@ namespace Core {
     {
         ThreadContext::SetTag(tagToRestore);
     }
+
+    ThreadTagAwaiter::ThreadTagAwaiter(ThreadTag inTag)
+        : tag(inTag)
+    {
+    }
+
+    bool ThreadTagAwaiter::await_ready() const noexcept
+    {
+        return ThreadContext::Tag() == tag;
+    }
+
+    void ThreadTagAwaiter::await_suspend(std::coroutine_handle<> inHandle) const
+    {
+        ThreadContext::Dispatch(tag, [inHandle]() -> void { inHandle.resume(); });
+    }
+
+    void ThreadTagAwaiter::await_resume() const noexcept {}
+
+    ThreadTagAwaiter ResumeOn(ThreadTag inTag)
+    {
+        return ThreadTagAwaiter(inTag);
+    }
 }
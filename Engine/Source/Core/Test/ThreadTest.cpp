@@ -0,0 +1,40 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <Test/Test.h>
+
+#include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
+#include <Core/Thread.h>
+
+namespace {
+    Common::WorkerThread* testRenderWorker = nullptr;
+
+    void DispatchToTestRenderWorker(Common::TaskFunction&& inTask)
+    {
+        testRenderWorker->Spawn(std::move(inTask));
+    }
+
+    Common::Task<Core::ThreadTag> TagAfterResumeOn(Core::ThreadTag inTag)
+    {
+        co_await Core::ResumeOn(inTag);
+        co_return Core::ThreadContext::Tag();
+    }
+}
+
+TEST(ThreadTest, ResumeOnTest)
+{
+    Common::WorkerThread worker("TestRenderWorker");
+    worker.Spawn([]() -> void { Core::ThreadContext::SetTag(Core::ThreadTag::renderWorker); });
+    testRenderWorker = &worker;
+    Core::ThreadContext::SetDispatcher(Core::ThreadTag::renderWorker, &DispatchToTestRenderWorker);
+    ASSERT_TRUE(Core::ThreadContext::HasDispatcher(Core::ThreadTag::renderWorker));
+
+    ASSERT_EQ(Common::SyncWait(TagAfterResumeOn(Core::ThreadTag::renderWorker)), Core::ThreadTag::renderWorker);
+    ASSERT_EQ(Common::SyncWait(TagAfterResumeOn(Core::ThreadContext::Tag())), Core::ThreadContext::Tag());
+
+    Core::ThreadContext::SetDispatcher(Core::ThreadTag::renderWorker, nullptr);
+    ASSERT_FALSE(Core::ThreadContext::HasDispatcher(Core::ThreadTag::renderWorker));
+    testRenderWorker = nullptr;
+}
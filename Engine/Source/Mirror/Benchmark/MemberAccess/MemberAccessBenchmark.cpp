@@ -0,0 +1,91 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <MemberAccessBenchmark.h>
+#include <Mirror/Mirror.h>
+
+// every variant reads x and writes y of state.range(0) objects found by name once, the way property panels and
+// serializers walk the member variables of many objects of one class
+namespace {
+    struct Fixture {
+        explicit Fixture(size_t inObjectNum)
+            : clazz(Mirror::Class::Get<MemberAccessBenchmarkStruct>())
+            , x(clazz.GetMemberVariable("x"))
+            , y(clazz.GetMemberVariable("y"))
+            , objects(inObjectNum, MemberAccessBenchmarkStruct { 1.0f, 0.0f, 0.0f })
+        {
+        }
+
+        const Mirror::Class& clazz;
+        const Mirror::MemberVariable& x;
+        const Mirror::MemberVariable& y;
+        std::vector<MemberAccessBenchmarkStruct> objects;
+    };
+}
+
+static void NativeMemberAccess(benchmark::State& state)
+{
+    Fixture fixture(state.range(0));
+    for (auto _ : state) {
+        for (auto& object : fixture.objects) {
+            object.y = object.x + 1.0f;
+        }
+        benchmark::DoNotOptimize(fixture.objects.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void DynMemberAccess(benchmark::State& state)
+{
+    Fixture fixture(state.range(0));
+    for (auto _ : state) {
+        for (auto& object : fixture.objects) {
+            const Mirror::Any ref = std::ref(object);
+            const float value = fixture.x.GetDyn(ref).As<float>() + 1.0f;
+            fixture.y.SetDyn(ref, Mirror::ForwardAsArg(value));
+        }
+        benchmark::DoNotOptimize(fixture.objects.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void InplaceDynMemberAccess(benchmark::State& state)
+{
+    // the way dynamic ecs apis reach component members, an Any for the object from its address first
+    Fixture fixture(state.range(0));
+    for (auto _ : state) {
+        for (auto& object : fixture.objects) {
+            const Mirror::Any ref = fixture.clazz.InplaceGetObject(&object);
+            const float value = fixture.x.GetDyn(ref).As<float>() + 1.0f;
+            fixture.y.SetDyn(ref, Mirror::ForwardAsArg(value));
+        }
+        benchmark::DoNotOptimize(fixture.objects.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void TypedMemberAccess(benchmark::State& state)
+{
+    Fixture fixture(state.range(0));
+    for (auto _ : state) {
+        for (auto& object : fixture.objects) {
+            fixture.y.GetTyped<float>(&object) = fixture.x.GetTyped<float>(&object) + 1.0f;
+        }
+        benchmark::DoNotOptimize(fixture.objects.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(NativeMemberAccess)->RangeMultiplier(8)->Range(1024, 65536);
+BENCHMARK(DynMemberAccess)->RangeMultiplier(8)->Range(1024, 65536);
+BENCHMARK(InplaceDynMemberAccess)->RangeMultiplier(8)->Range(1024, 65536);
+BENCHMARK(TypedMemberAccess)->RangeMultiplier(8)->Range(1024, 65536);
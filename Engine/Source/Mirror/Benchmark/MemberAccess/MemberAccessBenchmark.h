@@ -0,0 +1,15 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <Mirror/Meta.h>
+
+struct EClass() MemberAccessBenchmarkStruct {
+    EClassBody(MemberAccessBenchmarkStruct)
+
+    EProperty() float x;
+    EProperty() float y;
+    EProperty() float z;
+};
@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <array>
+#include <deque>
 #include <unordered_map>
 #include <optional>
 #include <cstdint>
@@ -491,8 +492,8 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Setter = std::function<void(const Argument&)>;
-        using Getter = std::function<Any()>;
+        using Setter = void(*)(const Argument&);
+        using Getter = Any(*)();
 
         struct ConstructParams {
             Id id;
@@ -535,7 +536,7 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<Any(const ArgumentList&)>;
+        using Invoker = Any(*)(const ArgumentList&);
 
         struct ConstructParams {
             Id id;
@@ -586,8 +587,8 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<Any(const ArgumentList&)>;
-        using InplaceInvoker = std::function<Any(void*, const ArgumentList&)>;
+        using Invoker = Any(*)(const ArgumentList&);
+        using InplaceInvoker = Any(*)(void*, const ArgumentList&);
 
         struct ConstructParams {
             Id id;
@@ -634,7 +635,7 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<void(const Argument&)>;
+        using Invoker = void(*)(const Argument&);
 
         struct ConstructParams {
             Id owner;
@@ -667,13 +668,20 @@ namespace Mirror {
         void SetDyn(const Argument& object, const Argument& value) const;
         Any GetDyn(const Argument& object) const;
         bool IsTransient() const;
+        // object points to an instance of the owner class, reading and writing through the address builds no Any,
+        // T of the typed versions must be the exact member type
+        void* GetAddress(void* object) const;
+        const void* GetAddress(const void* object) const;
+        template <typename T> T& GetTyped(void* object) const;
+        template <typename T> const T& GetTyped(const void* object) const;
 
     private:
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Setter = std::function<void(const Argument&, const Argument&)>;
-        using Getter = std::function<Any(const Argument&)>;
+        using Setter = void(*)(const Argument&, const Argument&);
+        using Getter = Any(*)(const Argument&);
+        using AddressGetter = void*(*)(void*);
 
         struct ConstructParams {
             Id id;
@@ -683,6 +691,7 @@ namespace Mirror {
             const TypeInfo* typeInfo;
             Setter setter;
             Getter getter;
+            AddressGetter addressGetter;
         };
 
         explicit MemberVariable(ConstructParams&& params);
@@ -693,6 +702,7 @@ namespace Mirror {
         const TypeInfo* typeInfo;
         Setter setter;
         Getter getter;
+        AddressGetter addressGetter;
     };
 
     class MIRROR_API MemberFunction final : public ReflNode {
@@ -715,7 +725,7 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<Any(const Argument&, const ArgumentList&)>;
+        using Invoker = Any(*)(const Argument&, const ArgumentList&);
 
         struct ConstructParams {
             Id id;
@@ -828,6 +838,7 @@ namespace Mirror {
         const MemberVariable& GetMemberVariable(const Id& inId) const;
         bool HasMemberFunction(const Id& inId) const;
         const std::unordered_map<Id, MemberVariable, IdHashProvider>& GetMemberVariables() const;
+        std::vector<const MemberVariable*> GetSortedMemberVariables() const;
         const MemberFunction* FindMemberFunction(const Id& inId) const;
         const MemberFunction& GetMemberFunction(const Id& inId) const;
         Any GetDefaultObject() const;
@@ -845,10 +856,10 @@ namespace Mirror {
         friend class Registry;
         template <typename T> friend class ClassRegistry;
 
-        using BaseClassGetter = std::function<const Class*()>;
-        using InplaceGetter = std::function<Any(void*)>;
-        using DefaultObjectCreator = std::function<Any()>;
-        using Caster = std::function<Any(const Mirror::Argument&)>;
+        using BaseClassGetter = const Class*(*)();
+        using InplaceGetter = Any(*)(void*);
+        using DefaultObjectCreator = Any(*)();
+        using Caster = Any(*)(const Mirror::Argument&);
 
         struct ConstructParams {
             Id id;
@@ -916,10 +927,10 @@ namespace Mirror {
 
         friend class Enum;
 
-        using Getter = std::function<Any()>;
-        using IntegralGetter = std::function<IntegralValue()>;
-        using Setter = std::function<void(const Argument&)>;
-        using Comparer = std::function<bool(const Argument&)>;
+        using Getter = Any(*)();
+        using IntegralGetter = IntegralValue(*)();
+        using Setter = void(*)(const Argument&);
+        using Comparer = bool(*)(const Argument&);
 
         struct ConstructParams {
             Id id;
@@ -983,6 +994,62 @@ namespace Mirror {
         std::unordered_map<Id, EnumValue, IdHashProvider> values;
     };
 
+    // classes and member variables the objects of one schema file refer to by index, indices are handed out while
+    // serializing and the table is written once after the objects
+    class MIRROR_API ClassSchemaWriter final : public Common::SerializeContext {
+    public:
+        ClassSchemaWriter();
+        ~ClassSchemaWriter() override;
+
+        uint32_t GetOrAddClass(const Class& inClass);
+        // non transient member variables in name order, the order their values follow the class index in
+        const std::vector<const MemberVariable*>& GetMemberVariables(uint32_t inClassIndex) const;
+        size_t SerializeTable(Common::BinarySerializeStream& inStream) const;
+
+    private:
+        std::unordered_map<const Class*, uint32_t> classIndices;
+        std::vector<const Class*> classes;
+        // a deque keeps the lists in place while nested objects add classes
+        std::deque<std::vector<const MemberVariable*>> memberVariables;
+    };
+
+    // the table of a schema file resolved against the current classes once per file, objects then find their member
+    // variables by index without any name lookup
+    class MIRROR_API ClassSchemaReader final : public Common::SerializeContext {
+    public:
+        struct ClassEntry {
+            // null when the class is gone
+            const Class* clazz;
+            // one per member variable in the file, null for ones gone or transient now, their values are skipped
+            std::vector<const MemberVariable*> memberVariables;
+            // the file lists the current member variables in the current order, none of them is null then
+            bool layoutUnchanged;
+        };
+
+        ClassSchemaReader();
+        ~ClassSchemaReader() override;
+
+        size_t DeserializeTable(Common::BinaryDeserializeStream& inStream);
+        const ClassEntry* FindClass(uint32_t inClassIndex) const;
+
+    private:
+        std::vector<ClassEntry> classes;
+    };
+
+    // [magic][version][table offset][object][class schema table], reflected class objects inside refer to their class
+    // and member variables by table index instead of writing their names, files without the magic are plain
+    // serialized objects
+    class MIRROR_API SchemaFile {
+    public:
+        static constexpr uint32_t magic = 0x4843534d; // "MSCH"
+        static constexpr uint32_t version = 1;
+
+        // peeks the magic, the stream is left where it was
+        static bool Is(Common::BinaryDeserializeStream& inStream);
+        static size_t Serialize(Common::BinarySerializeStream& inStream, const Any& inObj);
+        static bool Deserialize(Common::BinaryDeserializeStream& inStream, const Any& outObj);
+    };
+
     template <typename T> concept MetaClass = requires(T inValue)
     {
         { T::GetStaticClass() } -> std::same_as<const Class&>;
@@ -1967,9 +2034,20 @@ namespace Common { // NOLINT
         //     |- std::string memberVariableName  : memberVariableNameSize
         //     |- bool sameAsDefaultObject        : sizeof(bool)
         //     |- void* memberVariableContent     : memberVariableEnd - memberVariableLastEnd
+        //
+        // struct, inside a schema file (stream context is a ClassSchemaWriter or ClassSchemaReader)
+        // uint32_t classIndex                    : sizeof(uint32_t)
+        // uint64_t baseContentSize               : sizeof(uint64_t)
+        // void* baseContent                      : baseContentSize
+        // void*[] memberVariableContent          : one field per member variable of the class in the table
 
         static size_t SerializeDyn(BinarySerializeStream& stream, const Mirror::Class& clazz, const Mirror::Argument& obj)
         {
+            if (auto* schema = dynamic_cast<Mirror::ClassSchemaWriter*>(stream.GetContext());
+                schema != nullptr) {
+                return SerializeWithSchema(stream, *schema, clazz, obj);
+            }
+
             Assert(!clazz.IsTransient());
             const auto& className = clazz.GetName();
             const auto* baseClass = clazz.GetBaseClass();
@@ -2022,6 +2100,11 @@ namespace Common { // NOLINT
 
         static size_t DeserializeDyn(BinaryDeserializeStream& stream, const Mirror::Class& clazz, const Mirror::Argument& obj)
         {
+            if (const auto* schema = dynamic_cast<const Mirror::ClassSchemaReader*>(stream.GetContext());
+                schema != nullptr) {
+                return DeserializeWithSchema(stream, *schema, clazz, obj);
+            }
+
             Assert(!clazz.IsTransient());
             const auto& className = clazz.GetName();
             const auto* baseClass = clazz.GetBaseClass();
@@ -2077,6 +2160,73 @@ namespace Common { // NOLINT
             return nameSize + aspectBaseClassContentSize + sizeof(uint64_t) * (memberVariableCount + 2) + memberVariableContentCur;
         }
 
+        static size_t SerializeWithSchema(BinarySerializeStream& stream, Mirror::ClassSchemaWriter& schema, const Mirror::Class& clazz, const Mirror::Argument& obj)
+        {
+            Assert(!clazz.IsTransient());
+            const auto* baseClass = clazz.GetBaseClass();
+            const auto begin = stream.Loc();
+
+            const auto classIndex = schema.GetOrAddClass(clazz);
+            Serializer<uint32_t>::Serialize(stream, classIndex);
+
+            uint64_t baseClassContentSize = 0;
+            stream.Seek(sizeof(uint64_t));
+            if (baseClass != nullptr) {
+                baseClassContentSize = SerializeWithSchema(stream, schema, *baseClass, obj);
+            }
+            stream.Seek(-static_cast<int64_t>(baseClassContentSize) - static_cast<int64_t>(sizeof(uint64_t)));
+            Serializer<uint64_t>::Serialize(stream, baseClassContentSize);
+            stream.Seek(static_cast<int64_t>(baseClassContentSize));
+
+            for (const auto* memberVariable : schema.GetMemberVariables(classIndex)) {
+                memberVariable->GetDyn(obj).Serialize(stream);
+            }
+            return stream.Loc() - begin;
+        }
+
+        static size_t DeserializeWithSchema(BinaryDeserializeStream& stream, const Mirror::ClassSchemaReader& schema, const Mirror::Class& clazz, const Mirror::Argument& obj)
+        {
+            const auto* baseClass = clazz.GetBaseClass();
+            const auto begin = stream.Loc();
+
+            uint32_t classIndex = 0;
+            Serializer<uint32_t>::Deserialize(stream, classIndex);
+            const auto* classEntry = schema.FindClass(classIndex);
+            if (classEntry == nullptr || classEntry->clazz != &clazz) {
+                // the field or base class content size around lets the caller skip the rest
+                return stream.Loc() - begin;
+            }
+
+            uint64_t baseClassContentSize = 0;
+            Serializer<uint64_t>::Deserialize(stream, baseClassContentSize);
+            const auto baseClassContentBegin = stream.Loc();
+            if (baseClassContentSize != 0 && baseClass != nullptr) {
+                DeserializeWithSchema(stream, schema, *baseClass, obj);
+            }
+            stream.Seek(static_cast<int64_t>(baseClassContentBegin + baseClassContentSize) - static_cast<int64_t>(stream.Loc()));
+
+            if (classEntry->layoutUnchanged) {
+                // every field of the file has its member variable, read them in a row
+                for (const auto* memberVariable : classEntry->memberVariables) {
+                    memberVariable->GetDyn(obj).Deserialize(stream);
+                }
+                return stream.Loc() - begin;
+            }
+            for (const auto* memberVariable : classEntry->memberVariables) {
+                if (memberVariable != nullptr) {
+                    memberVariable->GetDyn(obj).Deserialize(stream);
+                    continue;
+                }
+                // every value starts with the field header, skip it by its content size
+                uint64_t typeId = 0;
+                uint64_t contentSize = 0;
+                Serializer<uint64_t>::Deserialize(stream, typeId);
+                Serializer<uint64_t>::Deserialize(stream, contentSize);
+                stream.Seek(static_cast<int64_t>(contentSize));
+            }
+            return stream.Loc() - begin;
+        }
+
         static size_t Serialize(BinarySerializeStream& stream, const T& value)
         {
             return SerializeDyn(stream, Mirror::Class::Get<T>(), Mirror::ForwardAsArg(value));
@@ -3632,6 +3782,20 @@ namespace Mirror {
         return GetDyn(ForwardAsArg(std::forward<C>(object)));
     }
 
+    template <typename T>
+    T& MemberVariable::GetTyped(void* object) const
+    {
+        Assert(Mirror::GetTypeInfo<T>()->id == typeInfo->id);
+        return *static_cast<T*>(addressGetter(object));
+    }
+
+    template <typename T>
+    const T& MemberVariable::GetTyped(const void* object) const
+    {
+        Assert(Mirror::GetTypeInfo<T>()->id == typeInfo->id);
+        return *static_cast<const T*>(addressGetter(const_cast<void*>(object)));
+    }
+
     template <typename C, typename... Args>
     Any MemberFunction::Invoke(C&& object, Args&&... args) const
     {
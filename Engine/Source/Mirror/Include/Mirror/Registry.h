@@ -382,6 +382,9 @@ namespace Mirror {
             }
             return { std::ref(object.As<ClassType&>().*Ptr) };
         };
+        params.addressGetter = [](void* object) -> void* {
+            return &(static_cast<C*>(object)->*Ptr);
+        };
         return MetaDataRegistry<ClassRegistry>::SetContext(&clazz.EmplaceMemberVariable(inId, std::move(params)));
     }
 
@@ -547,6 +550,8 @@ namespace Mirror {
             params.defaultObjectCreator = []() -> Any {
                 return { C() };
             };
+        } else {
+            params.defaultObjectCreator = nullptr;
         }
         if constexpr (std::is_destructible_v<C>) {
             Destructor::ConstructParams detorParams;
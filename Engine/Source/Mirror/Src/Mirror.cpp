@@ -1005,8 +1005,8 @@ namespace Mirror {
         , access(params.access)
         , memorySize(params.memorySize)
         , typeInfo(params.typeInfo)
-        , setter(std::move(params.setter))
-        , getter(std::move(params.getter))
+        , setter(params.setter)
+        , getter(params.getter)
     {
     }
 
@@ -1060,7 +1060,7 @@ namespace Mirror {
         , argsNum(params.argsNum)
         , retTypeInfo(params.retTypeInfo)
         , argTypeInfos(std::move(params.argTypeInfos))
-        , invoker(std::move(params.invoker))
+        , invoker(params.invoker)
     {
     }
 
@@ -1120,9 +1120,9 @@ namespace Mirror {
         , argTypeInfos(std::move(params.argTypeInfos))
         , argRemoveRefTypeInfos(std::move(params.argRemoveRefTypeInfos))
         , argRemovePointerTypeInfos(std::move(params.argRemovePointerTypeInfos))
-        , stackConstructor(std::move(params.stackConstructor))
-        , heapConstructor(std::move(params.heapConstructor))
-        , inplaceConstructor(std::move(params.inplaceConstructor))
+        , stackConstructor(params.stackConstructor)
+        , heapConstructor(params.heapConstructor)
+        , inplaceConstructor(params.inplaceConstructor)
     {
     }
 
@@ -1204,8 +1204,8 @@ namespace Mirror {
         : ReflNode(std::string(IdPresets::detor.name))
         , owner(std::move(params.owner))
         , access(params.access)
-        , destructor(std::move(params.destructor))
-        , deleter(std::move(params.deleter))
+        , destructor(params.destructor)
+        , deleter(params.deleter)
     {
     }
 
@@ -1249,8 +1249,9 @@ namespace Mirror {
         , access(params.access)
         , memorySize(params.memorySize)
         , typeInfo(params.typeInfo)
-        , setter(std::move(params.setter))
-        , getter(std::move(params.getter))
+        , setter(params.setter)
+        , getter(params.getter)
+        , addressGetter(params.addressGetter)
     {
     }
 
@@ -1303,6 +1304,16 @@ namespace Mirror {
         return GetMetaBoolOr(MetaPresets::transient, false);
     }
 
+    void* MemberVariable::GetAddress(void* object) const
+    {
+        return addressGetter(object);
+    }
+
+    const void* MemberVariable::GetAddress(const void* object) const
+    {
+        return addressGetter(const_cast<void*>(object));
+    }
+
     MemberFunction::MemberFunction(ConstructParams&& params)
         : ReflNode(std::move(params.id))
         , owner(std::move(params.owner))
@@ -1310,7 +1321,7 @@ namespace Mirror {
         , argsNum(params.argsNum)
         , retTypeInfo(params.retTypeInfo)
         , argTypeInfos(std::move(params.argTypeInfos))
-        , invoker(std::move(params.invoker))
+        , invoker(params.invoker)
     {
     }
 
@@ -1435,9 +1446,9 @@ namespace Mirror {
         , typeInfo(params.typeInfo)
         , memorySize(params.memorySize)
         , memoryAlignment(params.memoryAlignment)
-        , baseClassGetter(std::move(params.baseClassGetter))
-        , inplaceGetter(std::move(params.inplaceGetter))
-        , caster(std::move(params.caster))
+        , baseClassGetter(params.baseClassGetter)
+        , inplaceGetter(params.inplaceGetter)
+        , caster(params.caster)
     {
         CreateDefaultObject(params.defaultObjectCreator);
         if (params.destructorParams.has_value()) {
@@ -1574,9 +1585,9 @@ namespace Mirror {
         }
     }
 
-    void Class::CreateDefaultObject(const std::function<Any()>& inCreator)
+    void Class::CreateDefaultObject(const DefaultObjectCreator& inCreator)
     {
-        if (inCreator) {
+        if (inCreator != nullptr) {
             defaultObject = inCreator();
         }
     }
@@ -1845,6 +1856,17 @@ namespace Mirror {
         return memberVariables;
     }
 
+    std::vector<const MemberVariable*> Class::GetSortedMemberVariables() const
+    {
+        std::vector<const MemberVariable*> result;
+        result.reserve(memberVariables.size());
+        for (const auto& memberVariable : memberVariables | std::views::values) {
+            result.emplace_back(&memberVariable);
+        }
+        std::ranges::sort(result, [](const MemberVariable* lhs, const MemberVariable* rhs) { return lhs->GetName() < rhs->GetName(); });
+        return result;
+    }
+
     const MemberFunction* Class::FindMemberFunction(const Id& inId) const
     {
         const auto iter = memberFunctions.find(inId);
@@ -1874,10 +1896,10 @@ namespace Mirror {
     EnumValue::EnumValue(ConstructParams&& inParams)
         : ReflNode(std::move(inParams.id))
         , owner(std::move(inParams.owner))
-        , getter(std::move(inParams.getter))
-        , integralGetter(std::move(inParams.integralGetter))
-        , setter(std::move(inParams.setter))
-        , comparer(std::move(inParams.comparer))
+        , getter(inParams.getter)
+        , integralGetter(inParams.integralGetter)
+        , setter(inParams.setter)
+        , comparer(inParams.comparer)
     {
     }
 
@@ -2608,4 +2630,160 @@ namespace Mirror {
     {
         return rtti->emplace(ref, inIndex, inTempObj);
     }
+
+    static std::vector<const MemberVariable*> GetSchemaMemberVariables(const Class& inClass)
+    {
+        auto result = inClass.GetSortedMemberVariables();
+        std::erase_if(result, [](const MemberVariable* memberVariable) -> bool { return memberVariable->IsTransient(); });
+        return result;
+    }
+
+    ClassSchemaWriter::ClassSchemaWriter() = default;
+
+    ClassSchemaWriter::~ClassSchemaWriter() = default;
+
+    uint32_t ClassSchemaWriter::GetOrAddClass(const Class& inClass)
+    {
+        if (const auto iter = classIndices.find(&inClass);
+            iter != classIndices.end()) {
+            return iter->second;
+        }
+        const auto classIndex = static_cast<uint32_t>(classes.size());
+        classIndices.emplace(&inClass, classIndex);
+        classes.emplace_back(&inClass);
+        memberVariables.emplace_back(GetSchemaMemberVariables(inClass));
+        return classIndex;
+    }
+
+    const std::vector<const MemberVariable*>& ClassSchemaWriter::GetMemberVariables(uint32_t inClassIndex) const
+    {
+        Assert(inClassIndex < memberVariables.size());
+        return memberVariables[inClassIndex];
+    }
+
+    size_t ClassSchemaWriter::SerializeTable(Common::BinarySerializeStream& inStream) const
+    {
+        size_t serialized = 0;
+        serialized += Common::Serializer<uint32_t>::Serialize(inStream, static_cast<uint32_t>(classes.size()));
+        for (auto i = 0; i < classes.size(); i++) {
+            serialized += Common::Serializer<std::string>::Serialize(inStream, classes[i]->GetName());
+            serialized += Common::Serializer<uint32_t>::Serialize(inStream, static_cast<uint32_t>(memberVariables[i].size()));
+            for (const auto* memberVariable : memberVariables[i]) {
+                serialized += Common::Serializer<std::string>::Serialize(inStream, memberVariable->GetName());
+            }
+        }
+        return serialized;
+    }
+
+    ClassSchemaReader::ClassSchemaReader() = default;
+
+    ClassSchemaReader::~ClassSchemaReader() = default;
+
+    size_t ClassSchemaReader::DeserializeTable(Common::BinaryDeserializeStream& inStream)
+    {
+        size_t deserialized = 0;
+        uint32_t classCount = 0;
+        deserialized += Common::Serializer<uint32_t>::Deserialize(inStream, classCount);
+
+        classes.clear();
+        classes.reserve(classCount);
+        for (auto i = 0; i < classCount; i++) {
+            std::string className;
+            deserialized += Common::Serializer<std::string>::Deserialize(inStream, className);
+            uint32_t memberVariableCount = 0;
+            deserialized += Common::Serializer<uint32_t>::Deserialize(inStream, memberVariableCount);
+            std::vector<std::string> memberVariableNames(memberVariableCount);
+            for (auto& memberVariableName : memberVariableNames) {
+                deserialized += Common::Serializer<std::string>::Deserialize(inStream, memberVariableName);
+            }
+
+            auto& entry = classes.emplace_back(ClassEntry { Class::Find(className), {}, false });
+            if (entry.clazz == nullptr) {
+                entry.memberVariables.resize(memberVariableCount, nullptr);
+                continue;
+            }
+
+            auto current = GetSchemaMemberVariables(*entry.clazz);
+            entry.layoutUnchanged = std::ranges::equal(current, memberVariableNames, [](const MemberVariable* memberVariable, const std::string& name) -> bool {
+                return memberVariable->GetName() == name;
+            });
+            if (entry.layoutUnchanged) {
+                entry.memberVariables = std::move(current);
+                continue;
+            }
+            entry.memberVariables.reserve(memberVariableCount);
+            for (const auto& memberVariableName : memberVariableNames) {
+                const auto* memberVariable = entry.clazz->FindMemberVariable(memberVariableName);
+                entry.memberVariables.emplace_back(memberVariable != nullptr && !memberVariable->IsTransient() ? memberVariable : nullptr);
+            }
+        }
+        return deserialized;
+    }
+
+    const ClassSchemaReader::ClassEntry* ClassSchemaReader::FindClass(uint32_t inClassIndex) const
+    {
+        return inClassIndex < classes.size() ? &classes[inClassIndex] : nullptr;
+    }
+
+    bool SchemaFile::Is(Common::BinaryDeserializeStream& inStream)
+    {
+        uint32_t fileMagic = 0;
+        Common::Serializer<uint32_t>::Deserialize(inStream, fileMagic);
+        inStream.Seek(-static_cast<int64_t>(sizeof(uint32_t)));
+        return fileMagic == magic;
+    }
+
+    size_t SchemaFile::Serialize(Common::BinarySerializeStream& inStream, const Any& inObj)
+    {
+        const auto begin = inStream.Loc();
+        Common::Serializer<uint32_t>::Serialize(inStream, magic);
+        Common::Serializer<uint32_t>::Serialize(inStream, version);
+        inStream.Seek(sizeof(uint64_t));
+
+        ClassSchemaWriter schema;
+        auto* lastContext = inStream.GetContext();
+        inStream.SetContext(&schema);
+        inObj.Serialize(inStream);
+        inStream.SetContext(lastContext);
+
+        // relative to the header, the file may start anywhere in the stream
+        const uint64_t tableOffset = inStream.Loc() - begin;
+        schema.SerializeTable(inStream);
+        const auto end = inStream.Loc();
+
+        inStream.Seek(static_cast<int64_t>(begin + sizeof(uint32_t) * 2) - static_cast<int64_t>(end));
+        Common::Serializer<uint64_t>::Serialize(inStream, tableOffset);
+        inStream.Seek(static_cast<int64_t>(end) - static_cast<int64_t>(inStream.Loc()));
+        return end - begin;
+    }
+
+    bool SchemaFile::Deserialize(Common::BinaryDeserializeStream& inStream, const Any& outObj)
+    {
+        const auto begin = inStream.Loc();
+        uint32_t fileMagic = 0;
+        uint32_t fileVersion = 0;
+        uint64_t tableOffset = 0;
+        Common::Serializer<uint32_t>::Deserialize(inStream, fileMagic);
+        Common::Serializer<uint32_t>::Deserialize(inStream, fileVersion);
+        if (fileMagic != magic || fileVersion > version) {
+            inStream.Seek(static_cast<int64_t>(begin) - static_cast<int64_t>(inStream.Loc()));
+            return false;
+        }
+        Common::Serializer<uint64_t>::Deserialize(inStream, tableOffset);
+
+        const auto objectBegin = inStream.Loc();
+        ClassSchemaReader schema;
+        inStream.Seek(static_cast<int64_t>(begin + tableOffset) - static_cast<int64_t>(objectBegin));
+        schema.DeserializeTable(inStream);
+        const auto end = inStream.Loc();
+        inStream.Seek(static_cast<int64_t>(objectBegin) - static_cast<int64_t>(end));
+
+        auto* lastContext = inStream.GetContext();
+        inStream.SetContext(&schema);
+        const bool succeed = outObj.Deserialize(inStream).first;
+        inStream.SetContext(lastContext);
+
+        inStream.Seek(static_cast<int64_t>(end) - static_cast<int64_t>(inStream.Loc()));
+        return succeed;
+    }
 } // namespace Mirror
@@ -583,6 +583,23 @@ TEST(RegistryTest, MemberVariableDynTest)
     ASSERT_FALSE(a.IsTransient());
 }
 
+TEST(RegistryTest, MemberVariableTypedTest)
+{
+    const auto& clazz = Mirror::Class::Get<C2>();
+    const auto& a = clazz.GetMemberVariable("a");
+    const auto& b = clazz.GetMemberVariable("b");
+
+    C2 obj(1, 2);
+    ASSERT_EQ(a.GetAddress(&obj), &obj.a);
+    ASSERT_EQ(b.GetAddress(static_cast<const void*>(&obj)), &obj.b);
+
+    a.GetTyped<int>(&obj) = 100;
+    ASSERT_EQ(obj.a, 100);
+    const C2& constObj = obj;
+    ASSERT_EQ(b.GetTyped<int>(&constObj), 2);
+    ASSERT_EQ(a.Get(obj).As<int>(), 100);
+}
+
 TEST(RegistryTest, MemberFunctionDynTest)
 {
     const auto& clazz = Mirror::Class::Get<C1>();
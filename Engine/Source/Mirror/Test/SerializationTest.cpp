@@ -49,6 +49,24 @@ void PerformSerializationTest(const Common::Path& fileName, const T& object)
     }
 }
 
+template <typename T>
+void PerformSchemaSerializationTest(const Common::Path& fileName, const T& object)
+{
+    {
+        Common::BinaryFileSerializeStream stream(fileName.String());
+        SchemaFile::Serialize(stream, std::ref(object));
+    }
+
+    {
+        Common::BinaryFileDeserializeStream stream(fileName.String());
+        ASSERT_TRUE(SchemaFile::Is(stream));
+
+        T restored;
+        ASSERT_TRUE(SchemaFile::Deserialize(stream, std::ref(restored)));
+        ASSERT_EQ(restored, object);
+    }
+}
+
 template <typename T>
 void PerformJsonSerializationTest(const T& inValue, const std::string& inExceptJson)
 {
@@ -139,6 +157,92 @@ TEST(SerializationTest, MetaObjectWithBaseClassTest)
         SerializationTestStruct2 { { 1, 2, "3.0" }, 4.0 });
 }
 
+TEST(SerializationTest, SchemaFileTest)
+{
+    PerformSchemaSerializationTest(
+        "../Test/Generated/Mirror/SerializationTest.SchemaFileTest.0.bin",
+        SerializationTestStruct0 { 1, 2, "3.0" });
+
+    SerializationTestStruct1 obj;
+    obj.a = { 1, 2 };
+    obj.b = { "3", "4" };
+    obj.c = { { 5, "6" }, { 7, "8" } };
+    obj.d = { { false, true }, { true, false } };
+    obj.e = { { 1, 2.0f, "3" }, { 4, 5.0f, "6" } };
+    PerformSchemaSerializationTest(
+        "../Test/Generated/Mirror/SerializationTest.SchemaFileTest.1.bin",
+        obj);
+
+    PerformSchemaSerializationTest(
+        "../Test/Generated/Mirror/SerializationTest.SchemaFileTest.2.bin",
+        SerializationTestStruct2 { { 1, 2, "3.0" }, 4.0 });
+}
+
+TEST(SerializationTest, SchemaFileIsSmallerTest)
+{
+    SerializationTestStruct1 obj;
+    for (auto i = 0; i < 64; i++) {
+        obj.e.emplace_back(SerializationTestStruct0 { i, 1.0f, "e" });
+    }
+
+    std::vector<uint8_t> plainBytes;
+    {
+        Common::MemorySerializeStream stream(plainBytes);
+        Common::Serialize(stream, obj);
+    }
+    std::vector<uint8_t> schemaBytes;
+    {
+        Common::MemorySerializeStream stream(schemaBytes);
+        SchemaFile::Serialize(stream, std::ref(obj));
+    }
+    ASSERT_LT(schemaBytes.size(), plainBytes.size() / 2);
+
+    // plain serialized objects are not schema files
+    Common::MemoryDeserializeStream stream(plainBytes);
+    ASSERT_FALSE(SchemaFile::Is(stream));
+    SerializationTestStruct1 restored;
+    ASSERT_FALSE(SchemaFile::Deserialize(stream, std::ref(restored)));
+    ASSERT_EQ(stream.Loc(), 0);
+}
+
+TEST(SerializationTest, SchemaFileLayoutChangedTest)
+{
+    // written by an older SerializationTestStruct0 with a member variable x since removed, c before a and no b
+    std::vector<uint8_t> content;
+    {
+        Common::MemorySerializeStream stream(content);
+        Common::Serializer<uint32_t>::Serialize(stream, 0);
+        Common::Serializer<uint64_t>::Serialize(stream, 0);
+        Common::Serialize<int>(stream, 7);
+        Common::Serialize<std::string>(stream, "3.0");
+        Common::Serialize<int>(stream, 1);
+    }
+
+    std::vector<uint8_t> bytes;
+    {
+        Common::MemorySerializeStream stream(bytes);
+        Common::Serializer<uint32_t>::Serialize(stream, SchemaFile::magic);
+        Common::Serializer<uint32_t>::Serialize(stream, SchemaFile::version);
+        Common::Serializer<uint64_t>::Serialize(stream, sizeof(uint32_t) * 2 + sizeof(uint64_t) * 3 + content.size());
+        Common::Serializer<uint64_t>::Serialize(stream, Common::Serializer<SerializationTestStruct0>::typeId);
+        Common::Serializer<uint64_t>::Serialize(stream, content.size());
+        stream.WriteArray(content.data(), content.size());
+
+        Common::Serializer<uint32_t>::Serialize(stream, 1);
+        Common::Serializer<std::string>::Serialize(stream, SerializationTestStruct0::GetStaticClass().GetName());
+        Common::Serializer<uint32_t>::Serialize(stream, 3);
+        Common::Serializer<std::string>::Serialize(stream, "x");
+        Common::Serializer<std::string>::Serialize(stream, "c");
+        Common::Serializer<std::string>::Serialize(stream, "a");
+    }
+
+    SerializationTestStruct0 restored { 0, 5.0f, "" };
+    Common::MemoryDeserializeStream stream(bytes);
+    ASSERT_TRUE(SchemaFile::Deserialize(stream, std::ref(restored)));
+    ASSERT_EQ(restored, (SerializationTestStruct0 { 1, 5.0f, "3.0" }));
+    ASSERT_EQ(stream.Loc(), bytes.size());
+}
+
 TEST(SerializationTest, EnumSerializationTest)
 {
     PerformSerializationTest<SerializationTestEnum>(
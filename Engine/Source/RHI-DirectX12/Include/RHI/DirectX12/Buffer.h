@@ -13,11 +13,15 @@ using Microsoft::WRL::ComPtr;
 
 namespace RHI::DirectX12 {
     class DX12Device;
+    class DX12Heap;
 
     class DX12Buffer final : public Buffer {
     public:
         NonCopyable(DX12Buffer)
+        static D3D12_RESOURCE_DESC GetNativeResourceDesc(const BufferCreateInfo& inCreateInfo);
+
         explicit DX12Buffer(DX12Device& device, const BufferCreateInfo& inCreateInfo);
+        DX12Buffer(DX12Device& device, DX12Heap& inHeap, uint64_t inOffset, const BufferCreateInfo& inCreateInfo);
         ~DX12Buffer() override;
 
         void* Map(MapMode inMapMode, size_t inOffset, size_t inLength) override;
@@ -30,6 +34,8 @@ namespace RHI::DirectX12 {
 
     private:
         void CreateNativeBuffer(DX12Device& inDevice, const BufferCreateInfo& inCreateInfo);
+        void CreatePlacedNativeBuffer(DX12Device& inDevice, DX12Heap& inHeap, uint64_t inOffset, const BufferCreateInfo& inCreateInfo);
+        void SetNativeObjectName(const BufferCreateInfo& inCreateInfo) const;
 
         DX12Device& device;
         MapMode mapMode;
@@ -92,11 +92,17 @@ namespace RHI::DirectX12 {
         Common::UniquePtr<Fence> CreateFence(bool inInitAsSignaled) override;
         Common::UniquePtr<Semaphore> CreateSemaphore() override;
         Common::UniquePtr<QuerySet> CreateQuerySet(const QuerySetCreateInfo& inCreateInfo) override;
+        Common::UniquePtr<Heap> CreateHeap(const HeapCreateInfo& inCreateInfo) override;
+        Common::UniquePtr<Buffer> CreatePlacedBuffer(Heap& inHeap, uint64_t inOffset, const BufferCreateInfo& inCreateInfo) override;
+        Common::UniquePtr<Texture> CreatePlacedTexture(Heap& inHeap, uint64_t inOffset, const TextureCreateInfo& inCreateInfo) override;
 
         bool CheckSwapChainFormatSupport(Surface* inSurface, PixelFormat inFormat, ColorSpace inColorSpace) override;
         TextureSubResourceCopyFootprint GetTextureSubResourceCopyFootprint(const Texture& texture, const TextureSubResourceInfo& subResourceInfo) override;
+        ResourceAllocationInfo GetResourceAllocationInfo(const BufferCreateInfo& inCreateInfo) override;
+        ResourceAllocationInfo GetResourceAllocationInfo(const TextureCreateInfo& inCreateInfo) override;
 
         ID3D12Device* GetNative() const;
+        D3D12_RESOURCE_HEAP_TIER GetResourceHeapTier() const;
         ID3D12CommandSignature* GetDrawIndirectCommandSignature() const;
         ID3D12CommandSignature* GetDrawIndexedIndirectCommandSignature() const;
         ID3D12CommandSignature* GetDispatchIndirectCommandSignature() const;
@@ -109,6 +115,7 @@ namespace RHI::DirectX12 {
         void CreateNativeDevice();
         void CreateNativeQueues(const DeviceCreateInfo& inCreateInfo);
         void QueryNativeDescriptorSize();
+        void QueryNativeResourceHeapTier();
         void CreateDescriptorPools();
         void CreateIndirectCommandSignatures();
 #if BUILD_CONFIG_DEBUG
@@ -123,6 +130,7 @@ namespace RHI::DirectX12 {
         uint32_t nativeCbvSrvUavDescriptorSize;
         uint32_t nativeSamplerDescriptorSize;
         uint32_t nativeDsvDescriptorSize;
+        D3D12_RESOURCE_HEAP_TIER nativeResourceHeapTier;
         Common::UniquePtr<DescriptorPool> rtvDescriptorPool;
         Common::UniquePtr<DescriptorPool> cbvSrvUavDescriptorPool;
         Common::UniquePtr<DescriptorPool> samplerDescriptorPool;
@@ -0,0 +1,39 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <wrl/client.h>
+#include <directx/d3d12.h>
+
+#include <RHI/Heap.h>
+
+using Microsoft::WRL::ComPtr;
+
+namespace RHI::DirectX12 {
+    class DX12Device;
+
+    // resource heap tier 1 keeps buffers, render target or depth stencil textures and other textures in separate heaps,
+    // the category of a resource is reported as its memory type bits, so the transient heaps never mix them, on tier 2
+    // every resource fits any heap and all bits are set
+    constexpr uint32_t heapCategoryBuffers = 1u << 0;
+    constexpr uint32_t heapCategoryRtDsTextures = 1u << 1;
+    constexpr uint32_t heapCategoryNonRtDsTextures = 1u << 2;
+
+    class DX12Heap final : public Heap {
+    public:
+        NonCopyable(DX12Heap)
+        DX12Heap(DX12Device& inDevice, const HeapCreateInfo& inCreateInfo);
+        ~DX12Heap() override;
+
+        ID3D12Heap* GetNative() const;
+        static uint32_t GetHeapCategoryBits(const DX12Device& inDevice, const D3D12_RESOURCE_DESC& inDesc);
+
+    private:
+        static D3D12_HEAP_FLAGS GetNativeHeapFlags(const DX12Device& inDevice, uint32_t inMemoryTypeBits);
+        void CreateNativeHeap(DX12Device& inDevice, const HeapCreateInfo& inCreateInfo);
+
+        ComPtr<ID3D12Heap> nativeHeap;
+    };
+}
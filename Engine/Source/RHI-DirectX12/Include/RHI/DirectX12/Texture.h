@@ -11,11 +11,15 @@ using Microsoft::WRL::ComPtr;
 
 namespace RHI::DirectX12 {
     class DX12Device;
+    class DX12Heap;
 
     class DX12Texture final : public Texture {
     public:
         NonCopyable(DX12Texture)
+        static D3D12_RESOURCE_DESC GetNativeResourceDesc(const TextureCreateInfo& inCreateInfo);
+
         DX12Texture(DX12Device& inDevice, const TextureCreateInfo& inCreateInfo);
+        DX12Texture(DX12Device& inDevice, DX12Heap& inHeap, uint64_t inOffset, const TextureCreateInfo& inCreateInfo);
         DX12Texture(DX12Device& inDevice, const TextureCreateInfo& inCreateInfo, ComPtr<ID3D12Resource>&& nativeResource);
         ~DX12Texture() override;
 
@@ -25,6 +29,8 @@ namespace RHI::DirectX12 {
 
     private:
         void CreateNativeTexture(const TextureCreateInfo& inCreateInfo);
+        void CreatePlacedNativeTexture(DX12Heap& inHeap, uint64_t inOffset, const TextureCreateInfo& inCreateInfo);
+        void SetNativeObjectName(const TextureCreateInfo& inCreateInfo) const;
 
         DX12Device& device;
         ComPtr<ID3D12Resource> nativeResource;
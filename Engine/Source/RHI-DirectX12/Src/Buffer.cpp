@@ -13,6 +13,7 @@
 #include <RHI/DirectX12/BufferView.h>
 #include <RHI/DirectX12/Common.h>
 #include <RHI/DirectX12/Device.h>
+#include <RHI/DirectX12/Heap.h>
 
 namespace RHI::DirectX12 {
     static D3D12_HEAP_TYPE GetDX12HeapType(const BufferUsageFlags bufferUsages)
@@ -63,6 +64,14 @@ namespace RHI::DirectX12 {
 }
 
 namespace RHI::DirectX12 {
+    D3D12_RESOURCE_DESC DX12Buffer::GetNativeResourceDesc(const BufferCreateInfo& inCreateInfo)
+    {
+        return CD3DX12_RESOURCE_DESC::Buffer(
+            inCreateInfo.usages & BufferUsageBits::uniform ? Common::AlignUp<D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT>(inCreateInfo.size) : inCreateInfo.size,
+            GetDX12ResourceFlag(inCreateInfo.usages)
+            );
+    }
+
     DX12Buffer::DX12Buffer(DX12Device& device, const BufferCreateInfo& inCreateInfo)
         : Buffer(inCreateInfo)
         , device(device)
@@ -72,6 +81,15 @@ namespace RHI::DirectX12 {
         CreateNativeBuffer(device, inCreateInfo);
     }
 
+    DX12Buffer::DX12Buffer(DX12Device& device, DX12Heap& inHeap, const uint64_t inOffset, const BufferCreateInfo& inCreateInfo)
+        : Buffer(inCreateInfo)
+        , device(device)
+        , mapMode(GetMapMode(inCreateInfo.usages))
+        , usages(inCreateInfo.usages)
+    {
+        CreatePlacedNativeBuffer(device, inHeap, inOffset, inCreateInfo);
+    }
+
     DX12Buffer::~DX12Buffer() = default;
 
     void* DX12Buffer::Map(const MapMode inMapMode, const size_t inOffset, const size_t inLength)
@@ -112,10 +130,7 @@ namespace RHI::DirectX12 {
     void DX12Buffer::CreateNativeBuffer(DX12Device& inDevice, const BufferCreateInfo& inCreateInfo)
     {
         const CD3DX12_HEAP_PROPERTIES heapProperties(GetDX12HeapType(inCreateInfo.usages));
-        const CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(
-            inCreateInfo.usages & BufferUsageBits::uniform ? Common::AlignUp<D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT>(inCreateInfo.size) : inCreateInfo.size,
-            GetDX12ResourceFlag(inCreateInfo.usages)
-            );
+        const D3D12_RESOURCE_DESC resourceDesc = GetNativeResourceDesc(inCreateInfo);
 
         const bool success = SUCCEEDED(inDevice.GetNative()->CreateCommittedResource(
             &heapProperties,
@@ -125,7 +140,27 @@ namespace RHI::DirectX12 {
             nullptr,
             IID_PPV_ARGS(&nativeResource)));
         Assert(success);
+        SetNativeObjectName(inCreateInfo);
+    }
 
+    void DX12Buffer::CreatePlacedNativeBuffer(DX12Device& inDevice, DX12Heap& inHeap, const uint64_t inOffset, const BufferCreateInfo& inCreateInfo)
+    {
+        AssertWithReason(GetDX12HeapType(inCreateInfo.usages) == D3D12_HEAP_TYPE_DEFAULT, "placed buffers live in default heaps and can not be mapped");
+        const D3D12_RESOURCE_DESC resourceDesc = GetNativeResourceDesc(inCreateInfo);
+
+        const bool success = SUCCEEDED(inDevice.GetNative()->CreatePlacedResource(
+            inHeap.GetNative(),
+            inOffset,
+            &resourceDesc,
+            EnumCast<BufferState, D3D12_RESOURCE_STATES>(inCreateInfo.initialState),
+            nullptr,
+            IID_PPV_ARGS(&nativeResource)));
+        Assert(success);
+        SetNativeObjectName(inCreateInfo);
+    }
+
+    void DX12Buffer::SetNativeObjectName(const BufferCreateInfo& inCreateInfo) const
+    {
 #if BUILD_CONFIG_DEBUG
         if (!inCreateInfo.debugName.empty()) {
             Assert(SUCCEEDED(nativeResource->SetName(Common::StringUtils::ToWideString(inCreateInfo.debugName).c_str())));
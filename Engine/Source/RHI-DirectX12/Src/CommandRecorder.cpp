@@ -450,6 +450,15 @@ namespace RHI::DirectX12 {
 
     void DX12CommandRecorder::ResourceBarrier(const Barrier& inBarrier)
     {
+        if (inBarrier.barrierType == BarrierType::aliasing) {
+            ID3D12Resource* resourceAfter = inBarrier.type == ResourceType::buffer
+                ? static_cast<DX12Buffer*>(inBarrier.buffer.pointer)->GetNative()
+                : static_cast<DX12Texture*>(inBarrier.texture.pointer)->GetNative();
+            const CD3DX12_RESOURCE_BARRIER resourceBarrier = CD3DX12_RESOURCE_BARRIER::Aliasing(nullptr, resourceAfter);
+            commandBuffer.GetNativeCmdList()->ResourceBarrier(1, &resourceBarrier);
+            return;
+        }
+
         ID3D12Resource* resource;
         D3D12_RESOURCE_STATES beforeState;
         D3D12_RESOURCE_STATES afterState;
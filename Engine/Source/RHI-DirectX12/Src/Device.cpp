@@ -26,6 +26,7 @@
 #include <RHI/DirectX12/Surface.h>
 #include <RHI/DirectX12/QuerySet.h>
 #include <RHI/DirectX12/PipelineCache.h>
+#include <RHI/DirectX12/Heap.h>
 #include <RHI/CommandRecorder.h>
 #include <Core/Log.h>
 
@@ -150,10 +151,12 @@ namespace RHI::DirectX12 {
         , nativeCbvSrvUavDescriptorSize(0)
         , nativeSamplerDescriptorSize(0)
         , nativeDsvDescriptorSize(0)
+        , nativeResourceHeapTier(D3D12_RESOURCE_HEAP_TIER_1)
     {
         CreateNativeDevice();
         CreateNativeQueues(inCreateInfo);
         QueryNativeDescriptorSize();
+        QueryNativeResourceHeapTier();
         CreateDescriptorPools();
         CreateIndirectCommandSignatures();
 #if BUILD_CONFIG_DEBUG
@@ -260,6 +263,21 @@ namespace RHI::DirectX12 {
         return { new DX12QuerySet(*this, inCreateInfo) };
     }
 
+    Common::UniquePtr<Heap> DX12Device::CreateHeap(const HeapCreateInfo& inCreateInfo)
+    {
+        return { new DX12Heap(*this, inCreateInfo) };
+    }
+
+    Common::UniquePtr<Buffer> DX12Device::CreatePlacedBuffer(Heap& inHeap, const uint64_t inOffset, const BufferCreateInfo& inCreateInfo)
+    {
+        return { new DX12Buffer(*this, static_cast<DX12Heap&>(inHeap), inOffset, inCreateInfo) };
+    }
+
+    Common::UniquePtr<Texture> DX12Device::CreatePlacedTexture(Heap& inHeap, const uint64_t inOffset, const TextureCreateInfo& inCreateInfo)
+    {
+        return { new DX12Texture(*this, static_cast<DX12Heap&>(inHeap), inOffset, inCreateInfo) };
+    }
+
     Common::UniquePtr<PipelineCache> DX12Device::CreatePipelineCache(const PipelineCacheCreateInfo& inCreateInfo)
     {
         return { new DX12PipelineCache(*this, inCreateInfo) };
@@ -296,11 +314,30 @@ namespace RHI::DirectX12 {
         return result;
     }
 
+    ResourceAllocationInfo DX12Device::GetResourceAllocationInfo(const BufferCreateInfo& inCreateInfo)
+    {
+        const D3D12_RESOURCE_DESC desc = DX12Buffer::GetNativeResourceDesc(inCreateInfo);
+        const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = nativeDevice->GetResourceAllocationInfo(0, 1, &desc);
+        return { allocationInfo.SizeInBytes, allocationInfo.Alignment, DX12Heap::GetHeapCategoryBits(*this, desc) };
+    }
+
+    ResourceAllocationInfo DX12Device::GetResourceAllocationInfo(const TextureCreateInfo& inCreateInfo)
+    {
+        const D3D12_RESOURCE_DESC desc = DX12Texture::GetNativeResourceDesc(inCreateInfo);
+        const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = nativeDevice->GetResourceAllocationInfo(0, 1, &desc);
+        return { allocationInfo.SizeInBytes, allocationInfo.Alignment, DX12Heap::GetHeapCategoryBits(*this, desc) };
+    }
+
     ID3D12Device* DX12Device::GetNative() const
     {
         return nativeDevice.Get();
     }
 
+    D3D12_RESOURCE_HEAP_TIER DX12Device::GetResourceHeapTier() const
+    {
+        return nativeResourceHeapTier;
+    }
+
     ID3D12CommandSignature* DX12Device::GetDrawIndirectCommandSignature() const
     {
         return drawIndirectCommandSignature.Get();
@@ -377,6 +414,13 @@ namespace RHI::DirectX12 {
         nativeDsvDescriptorSize = nativeDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
     }
 
+    void DX12Device::QueryNativeResourceHeapTier()
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS options {};
+        Assert(SUCCEEDED(nativeDevice->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options))));
+        nativeResourceHeapTier = options.ResourceHeapTier;
+    }
+
     void DX12Device::CreateDescriptorPools()
     {
         rtvDescriptorPool = Common::MakeUnique<DescriptorPool>(*this, D3D12_DESCRIPTOR_HEAP_TYPE_RTV, nativeRtvDescriptorSize, 16);
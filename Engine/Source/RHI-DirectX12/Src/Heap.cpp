@@ -0,0 +1,71 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <directx/d3dx12.h>
+
+#include <Common/String.h>
+#include <RHI/DirectX12/Heap.h>
+#include <RHI/DirectX12/Device.h>
+#include <Common/Debug.h>
+
+namespace RHI::DirectX12 {
+    DX12Heap::DX12Heap(DX12Device& inDevice, const HeapCreateInfo& inCreateInfo)
+        : Heap(inCreateInfo)
+    {
+        CreateNativeHeap(inDevice, inCreateInfo);
+    }
+
+    DX12Heap::~DX12Heap() = default;
+
+    ID3D12Heap* DX12Heap::GetNative() const
+    {
+        return nativeHeap.Get();
+    }
+
+    uint32_t DX12Heap::GetHeapCategoryBits(const DX12Device& inDevice, const D3D12_RESOURCE_DESC& inDesc)
+    {
+        if (inDevice.GetResourceHeapTier() >= D3D12_RESOURCE_HEAP_TIER_2) {
+            return UINT32_MAX;
+        }
+        if (inDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+            return heapCategoryBuffers;
+        }
+        return (inDesc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0
+            ? heapCategoryRtDsTextures
+            : heapCategoryNonRtDsTextures;
+    }
+
+    D3D12_HEAP_FLAGS DX12Heap::GetNativeHeapFlags(const DX12Device& inDevice, uint32_t inMemoryTypeBits)
+    {
+        if (inDevice.GetResourceHeapTier() >= D3D12_RESOURCE_HEAP_TIER_2) {
+            return D3D12_HEAP_FLAG_ALLOW_ALL_BUFFERS_AND_TEXTURES;
+        }
+        // the lowest category the heap accepts, the resources placed in it all share it
+        if ((inMemoryTypeBits & heapCategoryBuffers) != 0) {
+            return D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+        }
+        if ((inMemoryTypeBits & heapCategoryRtDsTextures) != 0) {
+            return D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+        }
+        AssertWithReason((inMemoryTypeBits & heapCategoryNonRtDsTextures) != 0, "resource heap tier 1 needs the heap category in the memory type bits");
+        return D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+    }
+
+    void DX12Heap::CreateNativeHeap(DX12Device& inDevice, const HeapCreateInfo& inCreateInfo)
+    {
+        // msaa alignment covers every placed resource
+        const CD3DX12_HEAP_DESC desc(
+            inCreateInfo.size,
+            D3D12_HEAP_TYPE_DEFAULT,
+            D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT,
+            GetNativeHeapFlags(inDevice, inCreateInfo.memoryTypeBits));
+        Assert(SUCCEEDED(inDevice.GetNative()->CreateHeap(&desc, IID_PPV_ARGS(&nativeHeap))));
+
+#if BUILD_CONFIG_DEBUG
+        if (!inCreateInfo.debugName.empty()) {
+            Assert(SUCCEEDED(nativeHeap->SetName(Common::StringUtils::ToWideString(inCreateInfo.debugName).c_str())));
+        }
+#endif
+    }
+}
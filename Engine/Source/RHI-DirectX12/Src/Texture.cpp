@@ -7,10 +7,26 @@
 #include <Common/String.h>
 #include <RHI/DirectX12/Common.h>
 #include <RHI/DirectX12/Device.h>
+#include <RHI/DirectX12/Heap.h>
 #include <RHI/DirectX12/Texture.h>
 #include <RHI/DirectX12/TextureView.h>
 
 namespace RHI::DirectX12 {
+    D3D12_RESOURCE_DESC DX12Texture::GetNativeResourceDesc(const TextureCreateInfo& inCreateInfo)
+    {
+        D3D12_RESOURCE_DESC textureDesc = {};
+        textureDesc.MipLevels = inCreateInfo.mipLevels;
+        textureDesc.Format = EnumCast<PixelFormat, DXGI_FORMAT>(inCreateInfo.format);
+        textureDesc.Width = inCreateInfo.width;
+        textureDesc.Height = inCreateInfo.height;
+        textureDesc.Flags = FlagsCast<TextureUsageFlags, D3D12_RESOURCE_FLAGS>(inCreateInfo.usages);
+        textureDesc.DepthOrArraySize = inCreateInfo.depthOrArraySize;
+        textureDesc.SampleDesc.Count = inCreateInfo.samples;
+        textureDesc.SampleDesc.Quality = 0;
+        textureDesc.Dimension = EnumCast<TextureDimension, D3D12_RESOURCE_DIMENSION>(inCreateInfo.dimension);
+        return textureDesc;
+    }
+
     DX12Texture::DX12Texture(DX12Device& inDevice, const TextureCreateInfo& inCreateInfo)
         : Texture(inCreateInfo)
         , device(inDevice)
@@ -18,6 +34,13 @@ namespace RHI::DirectX12 {
         CreateNativeTexture(inCreateInfo);
     }
 
+    DX12Texture::DX12Texture(DX12Device& inDevice, DX12Heap& inHeap, const uint64_t inOffset, const TextureCreateInfo& inCreateInfo)
+        : Texture(inCreateInfo)
+        , device(inDevice)
+    {
+        CreatePlacedNativeTexture(inHeap, inOffset, inCreateInfo);
+    }
+
     DX12Texture::DX12Texture(DX12Device& inDevice, const TextureCreateInfo& inCreateInfo, ComPtr<ID3D12Resource>&& nativeResource)
         : Texture(inCreateInfo)
         , device(inDevice)
@@ -40,16 +63,7 @@ namespace RHI::DirectX12 {
     void DX12Texture::CreateNativeTexture(const TextureCreateInfo& inCreateInfo)
     {
         const CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_DEFAULT);
-        D3D12_RESOURCE_DESC textureDesc = {};
-        textureDesc.MipLevels = inCreateInfo.mipLevels;
-        textureDesc.Format = EnumCast<PixelFormat, DXGI_FORMAT>(inCreateInfo.format);
-        textureDesc.Width = inCreateInfo.width;
-        textureDesc.Height = inCreateInfo.height;
-        textureDesc.Flags = FlagsCast<TextureUsageFlags, D3D12_RESOURCE_FLAGS>(inCreateInfo.usages);
-        textureDesc.DepthOrArraySize = inCreateInfo.depthOrArraySize;
-        textureDesc.SampleDesc.Count = inCreateInfo.samples;
-        textureDesc.SampleDesc.Quality = 0;
-        textureDesc.Dimension = EnumCast<TextureDimension, D3D12_RESOURCE_DIMENSION>(inCreateInfo.dimension);
+        const D3D12_RESOURCE_DESC textureDesc = GetNativeResourceDesc(inCreateInfo);
 
         bool success = SUCCEEDED(device.GetNative()->CreateCommittedResource(
             &heapProperties,
@@ -59,7 +73,26 @@ namespace RHI::DirectX12 {
             nullptr,
             IID_PPV_ARGS(&nativeResource)));
         Assert(success);
+        SetNativeObjectName(inCreateInfo);
+    }
 
+    void DX12Texture::CreatePlacedNativeTexture(DX12Heap& inHeap, const uint64_t inOffset, const TextureCreateInfo& inCreateInfo)
+    {
+        const D3D12_RESOURCE_DESC textureDesc = GetNativeResourceDesc(inCreateInfo);
+
+        const bool success = SUCCEEDED(device.GetNative()->CreatePlacedResource(
+            inHeap.GetNative(),
+            inOffset,
+            &textureDesc,
+            EnumCast<TextureState, D3D12_RESOURCE_STATES>(inCreateInfo.initialState),
+            nullptr,
+            IID_PPV_ARGS(&nativeResource)));
+        Assert(success);
+        SetNativeObjectName(inCreateInfo);
+    }
+
+    void DX12Texture::SetNativeObjectName(const TextureCreateInfo& inCreateInfo) const
+    {
 #if BUILD_CONFIG_DEBUG
         if (!inCreateInfo.debugName.empty()) {
             Assert(SUCCEEDED(nativeResource->SetName(Common::StringUtils::ToWideString(inCreateInfo.debugName).c_str())));
@@ -35,9 +35,14 @@ namespace RHI::Dummy {
         Common::UniquePtr<Fence> CreateFence(bool bInitAsSignaled) override;
         Common::UniquePtr<Semaphore> CreateSemaphore() override;
         Common::UniquePtr<QuerySet> CreateQuerySet(const QuerySetCreateInfo& createInfo) override;
+        Common::UniquePtr<Heap> CreateHeap(const HeapCreateInfo& createInfo) override;
+        Common::UniquePtr<Buffer> CreatePlacedBuffer(Heap& heap, uint64_t offset, const BufferCreateInfo& createInfo) override;
+        Common::UniquePtr<Texture> CreatePlacedTexture(Heap& heap, uint64_t offset, const TextureCreateInfo& createInfo) override;
 
         bool CheckSwapChainFormatSupport(Surface *surface, PixelFormat format, ColorSpace colorSpace) override;
         TextureSubResourceCopyFootprint GetTextureSubResourceCopyFootprint(const Texture& texture, const TextureSubResourceInfo& subResourceInfo) override;
+        ResourceAllocationInfo GetResourceAllocationInfo(const BufferCreateInfo& createInfo) override;
+        ResourceAllocationInfo GetResourceAllocationInfo(const TextureCreateInfo& createInfo) override;
 
     private:
         DummyGpu& gpu;
@@ -0,0 +1,16 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <RHI/Heap.h>
+
+namespace RHI::Dummy {
+    class DummyHeap final : public Heap {
+    public:
+        NonCopyable(DummyHeap)
+        explicit DummyHeap(const HeapCreateInfo& createInfo);
+        ~DummyHeap() override;
+    };
+}
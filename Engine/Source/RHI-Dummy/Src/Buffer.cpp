@@ -2,13 +2,15 @@
 // Created by johnk on 2023/3/21.
 //
 
+#include <algorithm>
+
 #include <RHI/Dummy/Buffer.h>
 #include <RHI/Dummy/BufferView.h>
 
 namespace RHI::Dummy {
     DummyBuffer::DummyBuffer(const BufferCreateInfo& createInfo)
         : Buffer(createInfo)
-        , dummyData(1)
+        , dummyData(std::max<size_t>(createInfo.size, 1))
     {
     }
 
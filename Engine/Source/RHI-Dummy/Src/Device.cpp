@@ -2,6 +2,8 @@
 // Created by johnk on 2023/3/21.
 //
 
+#include <algorithm>
+
 #include <RHI/Dummy/Device.h>
 #include <RHI/Dummy/Queue.h>
 #include <RHI/Dummy/SwapChain.h>
@@ -18,7 +20,9 @@
 #include <RHI/Dummy/Surface.h>
 #include <RHI/Dummy/QuerySet.h>
 #include <RHI/Dummy/PipelineCache.h>
+#include <RHI/Dummy/Heap.h>
 #include <Common/Debug.h>
+#include <Common/Utility.h>
 
 namespace RHI::Dummy {
     DummyDevice::DummyDevice(DummyGpu& gpu, const DeviceCreateInfo& createInfo)
@@ -121,6 +125,23 @@ namespace RHI::Dummy {
         return { new DummyQuerySet(createInfo) };
     }
 
+    Common::UniquePtr<Heap> DummyDevice::CreateHeap(const HeapCreateInfo& createInfo)
+    {
+        return { new DummyHeap(createInfo) };
+    }
+
+    Common::UniquePtr<Buffer> DummyDevice::CreatePlacedBuffer(Heap& heap, const uint64_t offset, const BufferCreateInfo& createInfo)
+    {
+        Assert(offset + GetResourceAllocationInfo(createInfo).size <= heap.GetCreateInfo().size);
+        return { new DummyBuffer(createInfo) };
+    }
+
+    Common::UniquePtr<Texture> DummyDevice::CreatePlacedTexture(Heap& heap, const uint64_t offset, const TextureCreateInfo& createInfo)
+    {
+        Assert(offset + GetResourceAllocationInfo(createInfo).size <= heap.GetCreateInfo().size);
+        return { new DummyTexture(createInfo) };
+    }
+
     Common::UniquePtr<PipelineCache> DummyDevice::CreatePipelineCache(const PipelineCacheCreateInfo& createInfo)
     {
         return { new DummyPipelineCache(createInfo) };
@@ -135,4 +156,24 @@ namespace RHI::Dummy {
     {
         return {};
     }
+
+    ResourceAllocationInfo DummyDevice::GetResourceAllocationInfo(const BufferCreateInfo& createInfo)
+    {
+        return { Common::AlignUp<256>(createInfo.size), 256 };
+    }
+
+    ResourceAllocationInfo DummyDevice::GetResourceAllocationInfo(const TextureCreateInfo& createInfo)
+    {
+        // mirrors the footprint of a real device closely enough for the saved bytes of aliasing to be meaningful
+        uint64_t texels = 0;
+        uint64_t width = createInfo.width;
+        uint64_t height = createInfo.height;
+        for (auto i = 0; i < std::max<uint8_t>(createInfo.mipLevels, 1); i++) {
+            texels += width * height;
+            width = std::max<uint64_t>(width / 2, 1);
+            height = std::max<uint64_t>(height / 2, 1);
+        }
+        const uint64_t size = texels * GetBytesPerPixel(createInfo.format) * createInfo.depthOrArraySize * std::max<uint8_t>(createInfo.samples, 1);
+        return { Common::AlignUp<64 * 1024>(size), 64 * 1024 };
+    }
 }
@@ -0,0 +1,14 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RHI/Dummy/Heap.h>
+
+namespace RHI::Dummy {
+    DummyHeap::DummyHeap(const HeapCreateInfo& createInfo)
+        : Heap(createInfo)
+    {
+    }
+
+    DummyHeap::~DummyHeap() = default;
+}
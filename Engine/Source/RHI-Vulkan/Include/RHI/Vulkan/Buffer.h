@@ -12,11 +12,15 @@
 
 namespace RHI::Vulkan {
     class VulkanDevice;
+    class VulkanHeap;
 
     class VulkanBuffer final : public Buffer {
     public:
         NonCopyable(VulkanBuffer)
+        static VkBufferCreateInfo GetNativeCreateInfo(const BufferCreateInfo& inCreateInfo);
+
         VulkanBuffer(VulkanDevice& inDevice, const BufferCreateInfo& inCreateInfo);
+        VulkanBuffer(VulkanDevice& inDevice, VulkanHeap& inHeap, uint64_t inOffset, const BufferCreateInfo& inCreateInfo);
         ~VulkanBuffer() override;
 
         void* Map(MapMode inMapMode, size_t inOffset, size_t inLength) override;
@@ -28,6 +32,8 @@ namespace RHI::Vulkan {
 
     private:
         void CreateNativeBuffer(const BufferCreateInfo& inCreateInfo);
+        void CreatePlacedNativeBuffer(VulkanHeap& inHeap, uint64_t inOffset, const BufferCreateInfo& inCreateInfo);
+        void SetNativeObjectName(const BufferCreateInfo& inCreateInfo) const;
         void TransitionToInitState(const BufferCreateInfo& inCreateInfo);
 
         VulkanDevice& device;
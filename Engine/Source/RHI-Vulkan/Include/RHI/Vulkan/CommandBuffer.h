@@ -16,7 +16,9 @@ namespace RHI::Vulkan {
     class VulkanCommandBuffer final : public CommandBuffer {
     public:
         NonCopyable(VulkanCommandBuffer)
-        VulkanCommandBuffer(VulkanDevice& inDevice, VkCommandPool inNativeCmdPool);
+        // owns a pool recycled by the device, so command buffers are created, recorded and freed on any thread
+        // without sharing a pool
+        explicit VulkanCommandBuffer(VulkanDevice& inDevice);
         ~VulkanCommandBuffer() override;
 
         Common::UniquePtr<CommandRecorder> Begin() override;
@@ -24,8 +26,6 @@ namespace RHI::Vulkan {
         VkCommandBuffer GetNative() const;
 
     private:
-        void CreateNativeCommandBuffer();
-
         VulkanDevice& device;
         VkCommandPool pool;
         VkCommandBuffer nativeCmdBuffer;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -17,6 +18,16 @@
 namespace RHI::Vulkan {
     class VulkanQueue;
 
+    // extension entry points, resolved once at device creation so recording threads never look them up
+    struct VulkanDynamicFuncs {
+        PFN_vkCmdBeginDebugUtilsLabelEXT cmdBeginDebugUtilsLabel;
+        PFN_vkCmdEndDebugUtilsLabelEXT cmdEndDebugUtilsLabel;
+        PFN_vkSetDebugUtilsObjectNameEXT setDebugUtilsObjectName;
+        PFN_vkCmdBeginRenderingKHR cmdBeginRendering;
+        PFN_vkCmdEndRenderingKHR cmdEndRendering;
+        PFN_vkCmdSetPrimitiveTopologyEXT cmdSetPrimitiveTopology;
+    };
+
     class VulkanDevice final : public Device {
     public:
         NonCopyable(VulkanDevice)
@@ -42,12 +53,23 @@ namespace RHI::Vulkan {
         Common::UniquePtr<Fence> CreateFence(bool initAsSignaled) override;
         Common::UniquePtr<Semaphore> CreateSemaphore() override;
         Common::UniquePtr<QuerySet> CreateQuerySet(const QuerySetCreateInfo& inCreateInfo) override;
+        Common::UniquePtr<Heap> CreateHeap(const HeapCreateInfo& inCreateInfo) override;
+        Common::UniquePtr<Buffer> CreatePlacedBuffer(Heap& inHeap, uint64_t inOffset, const BufferCreateInfo& inCreateInfo) override;
+        Common::UniquePtr<Texture> CreatePlacedTexture(Heap& inHeap, uint64_t inOffset, const TextureCreateInfo& inCreateInfo) override;
 
         bool CheckSwapChainFormatSupport(Surface* inSurface, PixelFormat inFormat, ColorSpace inColorSpace) override;
         TextureSubResourceCopyFootprint GetTextureSubResourceCopyFootprint(const Texture& texture, const TextureSubResourceInfo& subResourceInfo) override;
+        ResourceAllocationInfo GetResourceAllocationInfo(const BufferCreateInfo& inCreateInfo) override;
+        ResourceAllocationInfo GetResourceAllocationInfo(const TextureCreateInfo& inCreateInfo) override;
 
         VkDevice GetNative() const;
         VmaAllocator& GetNativeAllocator();
+        const VulkanDynamicFuncs& GetDynamicFuncs() const;
+        // command pools are recycled instead of created per command buffer, a command buffer takes a pool with its
+        // native command buffer, and gives them back reset when destroyed, so the pools settle at one per recording
+        // thread per frame in flight
+        std::pair<VkCommandPool, VkCommandBuffer> AcquireNativeCommandBuffer();
+        void ReleaseNativeCommandBuffer(VkCommandPool inPool, VkCommandBuffer inCommandBuffer);
 
 #if BUILD_CONFIG_DEBUG
         void SetObjectName(VkObjectType inObjectType, uint64_t inObjectHandle, const char* inObjectName) const;
@@ -58,12 +80,15 @@ namespace RHI::Vulkan {
         void CreateNativeDevice(const DeviceCreateInfo& inCreateInfo);
         void GetQueues();
         void CreateNativeVmaAllocator();
+        void GetDynamicFuncPointers();
 
         VulkanGpu& gpu;
         VkDevice nativeDevice;
         VmaAllocator nativeAllocator;
+        VulkanDynamicFuncs dynamicFuncs;
         std::unordered_map<QueueType, std::pair<uint32_t, uint32_t>> queueFamilyMappings;
         std::unordered_map<QueueType, std::vector<Common::UniquePtr<VulkanQueue>>> queues;
-        std::unordered_map<QueueType, VkCommandPool> nativeCmdPools;
+        std::mutex commandPoolMutex;
+        std::vector<std::pair<VkCommandPool, VkCommandBuffer>> freeCommandPools;
     };
 }
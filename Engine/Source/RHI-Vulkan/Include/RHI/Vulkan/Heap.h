@@ -0,0 +1,31 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <vk_mem_alloc.h>
+#include <vulkan/vulkan.h>
+
+#include <RHI/Heap.h>
+
+namespace RHI::Vulkan {
+    class VulkanDevice;
+
+    class VulkanHeap final : public Heap {
+    public:
+        NonCopyable(VulkanHeap)
+        VulkanHeap(VulkanDevice& inDevice, const HeapCreateInfo& inCreateInfo);
+        ~VulkanHeap() override;
+
+        VmaAllocation GetNative() const;
+        uint32_t GetNativeMemoryType() const;
+
+    private:
+        void AllocateNativeMemory(const HeapCreateInfo& inCreateInfo);
+
+        VulkanDevice& device;
+        VmaAllocation nativeAllocation;
+        uint32_t nativeMemoryType;
+    };
+}
@@ -27,6 +27,7 @@ namespace RHI::Vulkan {
 
         VkInstance GetNative() const;
 
+        // not synchronized, only called while creating the instance and its devices
         template <typename T>
         T FindOrGetTypedDynamicFuncPointer(const std::string& inName)
         {
@@ -14,13 +14,17 @@
 
 namespace RHI::Vulkan {
     class VulkanDevice;
+    class VulkanHeap;
 
     class VulkanTexture final : public Texture {
     public:
         NonCopyable(VulkanTexture)
 
+        static VkImageCreateInfo GetNativeCreateInfo(const TextureCreateInfo& inCreateInfo);
+
         VulkanTexture(VulkanDevice& inDevice, const TextureCreateInfo& inCreateInfo, VkImage inNativeImage);
         VulkanTexture(VulkanDevice& inDevice, const TextureCreateInfo& inCreateInfo);
+        VulkanTexture(VulkanDevice& inDevice, VulkanHeap& inHeap, uint64_t inOffset, const TextureCreateInfo& inCreateInfo);
         ~VulkanTexture() override;
 
         Common::UniquePtr<TextureView> CreateTextureView(const TextureViewCreateInfo& inCreateInfo) override;
@@ -30,6 +34,8 @@ namespace RHI::Vulkan {
 
     private:
         void CreateNativeImage(const TextureCreateInfo& inCreateInfo);
+        void CreatePlacedNativeImage(VulkanHeap& inHeap, uint64_t inOffset, const TextureCreateInfo& inCreateInfo);
+        void SetNativeObjectName(const TextureCreateInfo& inCreateInfo) const;
         void GetAspect(const TextureCreateInfo& inCreateInfo);
         void TransitionToInitState(const TextureCreateInfo& inCreateInfo);
 
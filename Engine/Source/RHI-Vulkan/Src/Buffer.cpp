@@ -6,12 +6,23 @@
 #include <RHI/Vulkan/Common.h>
 #include <RHI/Vulkan/Device.h>
 #include <RHI/Vulkan/BufferView.h>
+#include <RHI/Vulkan/Heap.h>
 #include <RHI/Queue.h>
 #include <RHI/CommandBuffer.h>
 #include <RHI/CommandRecorder.h>
 #include <RHI/Synchronous.h>
 
 namespace RHI::Vulkan {
+    VkBufferCreateInfo VulkanBuffer::GetNativeCreateInfo(const BufferCreateInfo& inCreateInfo)
+    {
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        bufferInfo.usage = FlagsCast<BufferUsageFlags, VkBufferUsageFlags>(inCreateInfo.usages);
+        bufferInfo.size = inCreateInfo.size;
+        return bufferInfo;
+    }
+
     VulkanBuffer::VulkanBuffer(VulkanDevice& inDevice, const BufferCreateInfo& inCreateInfo)
         : Buffer(inCreateInfo)
         , device(inDevice)
@@ -24,15 +35,35 @@ namespace RHI::Vulkan {
         TransitionToInitState(inCreateInfo);
     }
 
+    VulkanBuffer::VulkanBuffer(VulkanDevice& inDevice, VulkanHeap& inHeap, const uint64_t inOffset, const BufferCreateInfo& inCreateInfo)
+        : Buffer(inCreateInfo)
+        , device(inDevice)
+        , nativeAllocation(VK_NULL_HANDLE)
+        , usages(inCreateInfo.usages)
+        , mapMode(MapMode::read)
+        , mapOffset(0)
+        , mapLength(0)
+    {
+        CreatePlacedNativeBuffer(inHeap, inOffset, inCreateInfo);
+        TransitionToInitState(inCreateInfo);
+    }
+
     VulkanBuffer::~VulkanBuffer()
     {
-        if (nativeBuffer != VK_NULL_HANDLE) {
+        if (nativeBuffer == VK_NULL_HANDLE) {
+            return;
+        }
+        if (nativeAllocation != VK_NULL_HANDLE) {
             vmaDestroyBuffer(device.GetNativeAllocator(), nativeBuffer, nativeAllocation);
+        } else {
+            // placed buffer, memory is owned by the heap
+            vkDestroyBuffer(device.GetNative(), nativeBuffer, nullptr);
         }
     }
 
     void* VulkanBuffer::Map(const MapMode inMapMode, const size_t inOffset, const size_t inLength)
     {
+        AssertWithReason(nativeAllocation != VK_NULL_HANDLE, "placed buffers live in device local heaps and can not be mapped");
         mapMode = inMapMode;
         mapOffset = inOffset;
         mapLength = inLength;
@@ -60,11 +91,7 @@ namespace RHI::Vulkan {
 
     void VulkanBuffer::CreateNativeBuffer(const BufferCreateInfo& inCreateInfo)
     {
-        VkBufferCreateInfo bufferInfo = {};
-        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        bufferInfo.usage = FlagsCast<BufferUsageFlags, VkBufferUsageFlags>(inCreateInfo.usages);
-        bufferInfo.size = inCreateInfo.size;
+        const VkBufferCreateInfo bufferInfo = GetNativeCreateInfo(inCreateInfo);
 
         VmaAllocationCreateInfo allocInfo = {};
         allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
@@ -75,7 +102,25 @@ namespace RHI::Vulkan {
         }
 
         Assert(vmaCreateBuffer(device.GetNativeAllocator(), &bufferInfo, &allocInfo, &nativeBuffer, &nativeAllocation, nullptr) == VK_SUCCESS);
+        SetNativeObjectName(inCreateInfo);
+    }
 
+    void VulkanBuffer::CreatePlacedNativeBuffer(VulkanHeap& inHeap, const uint64_t inOffset, const BufferCreateInfo& inCreateInfo)
+    {
+        AssertWithReason(!(inCreateInfo.usages & (BufferUsageBits::mapRead | BufferUsageBits::mapWrite)), "placed buffers can not be mapped");
+        const VkBufferCreateInfo bufferInfo = GetNativeCreateInfo(inCreateInfo);
+        Assert(vkCreateBuffer(device.GetNative(), &bufferInfo, nullptr, &nativeBuffer) == VK_SUCCESS);
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetBufferMemoryRequirements(device.GetNative(), nativeBuffer, &memoryRequirements);
+        Assert((memoryRequirements.memoryTypeBits & (1u << inHeap.GetNativeMemoryType())) != 0);
+        Assert(inOffset % memoryRequirements.alignment == 0 && inOffset + memoryRequirements.size <= inHeap.GetCreateInfo().size);
+        Assert(vmaBindBufferMemory2(device.GetNativeAllocator(), inHeap.GetNative(), inOffset, nativeBuffer, nullptr) == VK_SUCCESS);
+        SetNativeObjectName(inCreateInfo);
+    }
+
+    void VulkanBuffer::SetNativeObjectName(const BufferCreateInfo& inCreateInfo) const
+    {
 #if BUILD_CONFIG_DEBUG
         if (!inCreateInfo.debugName.empty()) {
             device.SetObjectName(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<uint64_t>(nativeBuffer), inCreateInfo.debugName.c_str());
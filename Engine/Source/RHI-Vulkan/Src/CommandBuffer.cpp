@@ -2,25 +2,23 @@
 // Created by Zach Lee on 2022/6/4.
 //
 
+#include <tuple>
+
 #include <RHI/Vulkan/CommandBuffer.h>
 #include <RHI/Vulkan/Device.h>
 #include <RHI/Vulkan/CommandRecorder.h>
 #include <Common/Debug.h>
 
 namespace RHI::Vulkan {
-    VulkanCommandBuffer::VulkanCommandBuffer(VulkanDevice& inDevice, VkCommandPool inNativeCmdPool) // NOLINT
+    VulkanCommandBuffer::VulkanCommandBuffer(VulkanDevice& inDevice) // NOLINT
         : device(inDevice)
-        , pool(inNativeCmdPool)
     {
-        CreateNativeCommandBuffer();
+        std::tie(pool, nativeCmdBuffer) = device.AcquireNativeCommandBuffer();
     }
 
     VulkanCommandBuffer::~VulkanCommandBuffer()
     {
-        auto* const vkDevice = device.GetNative();
-        if (nativeCmdBuffer != VK_NULL_HANDLE) {
-            vkFreeCommandBuffers(vkDevice, pool, 1, &nativeCmdBuffer);
-        }
+        device.ReleaseNativeCommandBuffer(pool, nativeCmdBuffer);
     }
 
     Common::UniquePtr<CommandRecorder> VulkanCommandBuffer::Begin()
@@ -38,15 +36,4 @@ namespace RHI::Vulkan {
     {
         return nativeCmdBuffer;
     }
-
-    void VulkanCommandBuffer::CreateNativeCommandBuffer()
-    {
-        VkCommandBufferAllocateInfo cmdInfo = {};
-        cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        cmdInfo.commandBufferCount = 1;
-        cmdInfo.commandPool = pool;
-        cmdInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-
-        Assert(vkAllocateCommandBuffers(device.GetNative(), &cmdInfo, &nativeCmdBuffer) == VK_SUCCESS);
-    }
-}
\ No newline at end of file
+}
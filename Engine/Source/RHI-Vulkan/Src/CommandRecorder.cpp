@@ -170,7 +170,22 @@ namespace RHI::Vulkan {
 
     void VulkanCommandRecorder::ResourceBarrier(const Barrier& inBarrier)
     {
-        if (inBarrier.type == ResourceType::buffer) {
+        if (inBarrier.barrierType == BarrierType::aliasing) {
+            // memory of a placed resource is bound once, so the barrier only needs to order all previous accesses to
+            // the heap range, the following transition from undefined layout discards the old contents
+            VkMemoryBarrier memoryBarrier {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+            memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+            vkCmdPipelineBarrier(
+                commandBuffer.GetNative(),
+                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                0,
+                1, &memoryBarrier,
+                0, nullptr,
+                0, nullptr);
+        } else if (inBarrier.type == ResourceType::buffer) {
             const auto& bufferBarrierInfo = inBarrier.buffer;
             const auto* nativeBuffer = static_cast<VulkanBuffer*>(bufferBarrierInfo.pointer);
 
@@ -221,16 +236,14 @@ namespace RHI::Vulkan {
         labelInfo.pLabelName = inLabel.c_str();
         labelInfo.color[0] = labelInfo.color[1] = labelInfo.color[2] = labelInfo.color[3] = 1.0f;
 
-        auto* pfn = device.GetGpu().GetInstance().FindOrGetTypedDynamicFuncPointer<PFN_vkCmdBeginDebugUtilsLabelEXT>("vkCmdBeginDebugUtilsLabelEXT");
-        pfn(commandBuffer.GetNative(), &labelInfo);
+        device.GetDynamicFuncs().cmdBeginDebugUtilsLabel(commandBuffer.GetNative(), &labelInfo);
 #endif
     }
 
     void VulkanCommandRecorder::EndMarker()
     {
 #if BUILD_CONFIG_DEBUG
-        auto* pfn = device.GetGpu().GetInstance().FindOrGetTypedDynamicFuncPointer<PFN_vkCmdEndDebugUtilsLabelEXT>("vkCmdEndDebugUtilsLabelEXT");
-        pfn(commandBuffer.GetNative());
+        device.GetDynamicFuncs().cmdEndDebugUtilsLabel(commandBuffer.GetNative());
 #endif
     }
 
@@ -483,8 +496,7 @@ namespace RHI::Vulkan {
             }
         }
 
-        auto* pfn = device.GetGpu().GetInstance().FindOrGetTypedDynamicFuncPointer<PFN_vkCmdBeginRenderingKHR>("vkCmdBeginRenderingKHR");
-        pfn(commandBuffer.GetNative(), &renderingInfo);
+        device.GetDynamicFuncs().cmdBeginRendering(commandBuffer.GetNative(), &renderingInfo);
     }
 
     VulkanRasterPassCommandRecorder::~VulkanRasterPassCommandRecorder() = default;
@@ -581,8 +593,7 @@ namespace RHI::Vulkan {
     {
 #if PLATFORM_MACOS
         // MoltenVK not support use vkCmdSetPrimitiveTopology() directly current
-        auto* pfn = device.GetGpu().GetInstance().FindOrGetTypedDynamicFuncPointer<PFN_vkCmdSetPrimitiveTopologyEXT>("vkCmdSetPrimitiveTopologyEXT");
-        pfn(commandBuffer.GetNative(), EnumCast<PrimitiveTopology, VkPrimitiveTopology>(inPrimitiveTopology));
+        device.GetDynamicFuncs().cmdSetPrimitiveTopology(commandBuffer.GetNative(), EnumCast<PrimitiveTopology, VkPrimitiveTopology>(inPrimitiveTopology));
 #else
         vkCmdSetPrimitiveTopology(commandBuffer.GetNative(), EnumCast<PrimitiveTopology, VkPrimitiveTopology>(inPrimitiveTopology));
 #endif
@@ -636,7 +647,6 @@ namespace RHI::Vulkan {
 
     void VulkanRasterPassCommandRecorder::EndPass()
     {
-        auto* pfn = device.GetGpu().GetInstance().FindOrGetTypedDynamicFuncPointer<PFN_vkCmdEndRenderingKHR>("vkCmdEndRenderingKHR");
-        pfn(commandBuffer.GetNative());
+        device.GetDynamicFuncs().cmdEndRendering(commandBuffer.GetNative());
     }
 }
@@ -4,6 +4,7 @@
 
 #include <map>
 #include <algorithm>
+#include <ranges>
 
 #include <RHI/Vulkan/Common.h>
 #include <RHI/Vulkan/Instance.h>
@@ -24,6 +25,7 @@
 #include <RHI/Vulkan/Surface.h>
 #include <RHI/Vulkan/QuerySet.h>
 #include <RHI/Vulkan/PipelineCache.h>
+#include <RHI/Vulkan/Heap.h>
 
 namespace RHI::Vulkan {
     const std::vector requiredExtensions = {
@@ -43,19 +45,20 @@ namespace RHI::Vulkan {
     VulkanDevice::VulkanDevice(VulkanGpu& inGpu, const DeviceCreateInfo& inCreateInfo)
         : Device(inCreateInfo)
         , gpu(inGpu)
+        , dynamicFuncs()
     {
         CreateNativeDevice(inCreateInfo);
         GetQueues();
         CreateNativeVmaAllocator();
+        GetDynamicFuncPointers();
     }
 
     VulkanDevice::~VulkanDevice()
     {
-        vmaDestroyAllocator(nativeAllocator);
-
-        for (auto& [queue, pool] : nativeCmdPools) {
+        for (const auto& pool : freeCommandPools | std::views::keys) {
             vkDestroyCommandPool(nativeDevice, pool, nullptr);
         }
+        vmaDestroyAllocator(nativeAllocator);
         vkDestroyDevice(nativeDevice, nullptr);
     }
 
@@ -133,7 +136,7 @@ namespace RHI::Vulkan {
 
     Common::UniquePtr<CommandBuffer> VulkanDevice::CreateCommandBuffer()
     {
-        return { new VulkanCommandBuffer(*this, nativeCmdPools[QueueType::graphics]) };
+        return { new VulkanCommandBuffer(*this) };
     }
 
     Common::UniquePtr<Fence> VulkanDevice::CreateFence(const bool initAsSignaled)
@@ -151,6 +154,21 @@ namespace RHI::Vulkan {
         return { new VulkanQuerySet(*this, inCreateInfo) };
     }
 
+    Common::UniquePtr<Heap> VulkanDevice::CreateHeap(const HeapCreateInfo& inCreateInfo)
+    {
+        return { new VulkanHeap(*this, inCreateInfo) };
+    }
+
+    Common::UniquePtr<Buffer> VulkanDevice::CreatePlacedBuffer(Heap& inHeap, const uint64_t inOffset, const BufferCreateInfo& inCreateInfo)
+    {
+        return { new VulkanBuffer(*this, static_cast<VulkanHeap&>(inHeap), inOffset, inCreateInfo) };
+    }
+
+    Common::UniquePtr<Texture> VulkanDevice::CreatePlacedTexture(Heap& inHeap, const uint64_t inOffset, const TextureCreateInfo& inCreateInfo)
+    {
+        return { new VulkanTexture(*this, static_cast<VulkanHeap&>(inHeap), inOffset, inCreateInfo) };
+    }
+
     Common::UniquePtr<PipelineCache> VulkanDevice::CreatePipelineCache(const PipelineCacheCreateInfo& inCreateInfo)
     {
         return { new VulkanPipelineCache(*this, inCreateInfo) };
@@ -194,6 +212,31 @@ namespace RHI::Vulkan {
         return result;
     }
 
+    ResourceAllocationInfo VulkanDevice::GetResourceAllocationInfo(const BufferCreateInfo& inCreateInfo)
+    {
+        // requirements depend on the native create info only, query them on a short-lived resource without memory
+        const VkBufferCreateInfo bufferInfo = VulkanBuffer::GetNativeCreateInfo(inCreateInfo);
+        VkBuffer nativeBuffer;
+        Assert(vkCreateBuffer(nativeDevice, &bufferInfo, nullptr, &nativeBuffer) == VK_SUCCESS);
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetBufferMemoryRequirements(nativeDevice, nativeBuffer, &memoryRequirements);
+        vkDestroyBuffer(nativeDevice, nativeBuffer, nullptr);
+        return { memoryRequirements.size, memoryRequirements.alignment, memoryRequirements.memoryTypeBits };
+    }
+
+    ResourceAllocationInfo VulkanDevice::GetResourceAllocationInfo(const TextureCreateInfo& inCreateInfo)
+    {
+        const VkImageCreateInfo imageInfo = VulkanTexture::GetNativeCreateInfo(inCreateInfo);
+        VkImage nativeImage;
+        Assert(vkCreateImage(nativeDevice, &imageInfo, nullptr, &nativeImage) == VK_SUCCESS);
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetImageMemoryRequirements(nativeDevice, nativeImage, &memoryRequirements);
+        vkDestroyImage(nativeDevice, nativeImage, nullptr);
+        return { memoryRequirements.size, memoryRequirements.alignment, memoryRequirements.memoryTypeBits };
+    }
+
     VkDevice VulkanDevice::GetNative() const
     {
         return nativeDevice;
@@ -285,10 +328,6 @@ namespace RHI::Vulkan {
 
     void VulkanDevice::GetQueues()
     {
-        VkCommandPoolCreateInfo poolInfo = {};
-        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-
         for (auto [queueType, queueFamilyInfo] : queueFamilyMappings) {
             auto [queueFamilyIndex, queueNum] = queueFamilyInfo;
 
@@ -299,12 +338,6 @@ namespace RHI::Vulkan {
                 tempQueues[i] = Common::MakeUnique<VulkanQueue>(*this, queue);
             }
             queues[queueType] = std::move(tempQueues);
-
-            poolInfo.queueFamilyIndex = queueFamilyIndex;
-
-            VkCommandPool pool;
-            Assert(vkCreateCommandPool(nativeDevice, &poolInfo, nullptr, &pool) == VK_SUCCESS);
-            nativeCmdPools.emplace(queueType, pool);
         }
     }
 
@@ -324,11 +357,68 @@ namespace RHI::Vulkan {
         vmaCreateAllocator(&info, &nativeAllocator);
     }
 
+    void VulkanDevice::GetDynamicFuncPointers()
+    {
+        auto& instance = gpu.GetInstance();
+        dynamicFuncs.cmdBeginDebugUtilsLabel = instance.FindOrGetTypedDynamicFuncPointer<PFN_vkCmdBeginDebugUtilsLabelEXT>("vkCmdBeginDebugUtilsLabelEXT");
+        dynamicFuncs.cmdEndDebugUtilsLabel = instance.FindOrGetTypedDynamicFuncPointer<PFN_vkCmdEndDebugUtilsLabelEXT>("vkCmdEndDebugUtilsLabelEXT");
+        dynamicFuncs.setDebugUtilsObjectName = instance.FindOrGetTypedDynamicFuncPointer<PFN_vkSetDebugUtilsObjectNameEXT>("vkSetDebugUtilsObjectNameEXT");
+        dynamicFuncs.cmdBeginRendering = instance.FindOrGetTypedDynamicFuncPointer<PFN_vkCmdBeginRenderingKHR>("vkCmdBeginRenderingKHR");
+        dynamicFuncs.cmdEndRendering = instance.FindOrGetTypedDynamicFuncPointer<PFN_vkCmdEndRenderingKHR>("vkCmdEndRenderingKHR");
+        dynamicFuncs.cmdSetPrimitiveTopology = instance.FindOrGetTypedDynamicFuncPointer<PFN_vkCmdSetPrimitiveTopologyEXT>("vkCmdSetPrimitiveTopologyEXT");
+    }
+
     VmaAllocator& VulkanDevice::GetNativeAllocator()
     {
         return nativeAllocator;
     }
 
+    const VulkanDynamicFuncs& VulkanDevice::GetDynamicFuncs() const
+    {
+        return dynamicFuncs;
+    }
+
+    std::pair<VkCommandPool, VkCommandBuffer> VulkanDevice::AcquireNativeCommandBuffer()
+    {
+        {
+            std::unique_lock lock(commandPoolMutex);
+            if (!freeCommandPools.empty()) {
+                const auto result = freeCommandPools.back();
+                freeCommandPools.pop_back();
+                return result;
+            }
+        }
+
+        // command buffers are only created for the graphics queue family
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = queueFamilyMappings.at(QueueType::graphics).first;
+
+        VkCommandPool pool;
+        Assert(vkCreateCommandPool(nativeDevice, &poolInfo, nullptr, &pool) == VK_SUCCESS);
+
+        VkCommandBufferAllocateInfo cmdInfo = {};
+        cmdInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmdInfo.commandBufferCount = 1;
+        cmdInfo.commandPool = pool;
+        cmdInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+
+        VkCommandBuffer commandBuffer;
+        Assert(vkAllocateCommandBuffers(nativeDevice, &cmdInfo, &commandBuffer) == VK_SUCCESS);
+        return { pool, commandBuffer };
+    }
+
+    void VulkanDevice::ReleaseNativeCommandBuffer(VkCommandPool inPool, VkCommandBuffer inCommandBuffer)
+    {
+        // the command buffer is no longer pending once it is destroyed, resetting the pool hands its memory back
+        // and leaves the command buffer ready to begin again
+        Assert(vkResetCommandPool(nativeDevice, inPool, 0) == VK_SUCCESS);
+
+        std::unique_lock lock(commandPoolMutex);
+        freeCommandPools.emplace_back(inPool, inCommandBuffer);
+    }
+
 #if BUILD_CONFIG_DEBUG
     void VulkanDevice::SetObjectName(const VkObjectType inObjectType, const uint64_t inObjectHandle, const char* inObjectName) const
     {
@@ -337,8 +427,7 @@ namespace RHI::Vulkan {
         info.objectHandle                  = inObjectHandle;
         info.pObjectName                   = inObjectName;
 
-        auto* pfn = gpu.GetInstance().FindOrGetTypedDynamicFuncPointer<PFN_vkSetDebugUtilsObjectNameEXT>("vkSetDebugUtilsObjectNameEXT");
-        pfn(nativeDevice, &info);
+        dynamicFuncs.setDebugUtilsObjectName(nativeDevice, &info);
     }
 #endif
 }
@@ -0,0 +1,59 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RHI/Vulkan/Heap.h>
+#include <RHI/Vulkan/Device.h>
+#include <Common/Debug.h>
+
+namespace RHI::Vulkan {
+    VulkanHeap::VulkanHeap(VulkanDevice& inDevice, const HeapCreateInfo& inCreateInfo)
+        : Heap(inCreateInfo)
+        , device(inDevice)
+        , nativeAllocation(VK_NULL_HANDLE)
+        , nativeMemoryType(0)
+    {
+        AllocateNativeMemory(inCreateInfo);
+    }
+
+    VulkanHeap::~VulkanHeap()
+    {
+        if (nativeAllocation != VK_NULL_HANDLE) {
+            vmaFreeMemory(device.GetNativeAllocator(), nativeAllocation);
+        }
+    }
+
+    VmaAllocation VulkanHeap::GetNative() const
+    {
+        return nativeAllocation;
+    }
+
+    uint32_t VulkanHeap::GetNativeMemoryType() const
+    {
+        return nativeMemoryType;
+    }
+
+    void VulkanHeap::AllocateNativeMemory(const HeapCreateInfo& inCreateInfo)
+    {
+        // transient render graph resources are device local only, the memory type is picked among the ones every
+        // resource to be placed accepts, and validated against each placed resource when binding
+        VkMemoryRequirements memoryRequirements {};
+        memoryRequirements.size = inCreateInfo.size;
+        memoryRequirements.alignment = 64 * 1024;
+        memoryRequirements.memoryTypeBits = inCreateInfo.memoryTypeBits;
+
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        allocInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+
+        VmaAllocationInfo nativeAllocationInfo {};
+        Assert(vmaAllocateMemory(device.GetNativeAllocator(), &memoryRequirements, &allocInfo, &nativeAllocation, &nativeAllocationInfo) == VK_SUCCESS);
+        nativeMemoryType = nativeAllocationInfo.memoryType;
+
+#if BUILD_CONFIG_DEBUG
+        if (!inCreateInfo.debugName.empty()) {
+            vmaSetAllocationName(device.GetNativeAllocator(), nativeAllocation, inCreateInfo.debugName.c_str());
+        }
+#endif
+    }
+}
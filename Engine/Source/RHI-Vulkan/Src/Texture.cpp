@@ -5,6 +5,7 @@
 #include <RHI/Vulkan/Texture.h>
 #include <RHI/Vulkan/TextureView.h>
 #include <RHI/Vulkan/Device.h>
+#include <RHI/Vulkan/Heap.h>
 #include <RHI/Vulkan/Common.h>
 #include <RHI/Vulkan/Queue.h>
 #include <RHI/Vulkan/CommandBuffer.h>
@@ -12,6 +13,25 @@
 #include <RHI/Vulkan/Synchronous.h>
 
 namespace RHI::Vulkan {
+    VkImageCreateInfo VulkanTexture::GetNativeCreateInfo(const TextureCreateInfo& inCreateInfo)
+    {
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.mipLevels = inCreateInfo.mipLevels;
+        if (inCreateInfo.dimension == TextureDimension::t3D) {
+            imageInfo.extent = { inCreateInfo.width, inCreateInfo.height, inCreateInfo.depthOrArraySize };
+            imageInfo.arrayLayers = 1;
+        } else {
+            imageInfo.extent = { inCreateInfo.width, inCreateInfo.height, 1 };
+            imageInfo.arrayLayers = inCreateInfo.depthOrArraySize;
+        }
+        imageInfo.samples = static_cast<VkSampleCountFlagBits>(inCreateInfo.samples);
+        imageInfo.imageType = EnumCast<TextureDimension, VkImageType>(inCreateInfo.dimension);
+        imageInfo.format = EnumCast<PixelFormat, VkFormat>(inCreateInfo.format);
+        imageInfo.usage = FlagsCast<TextureUsageFlags, VkImageUsageFlags>(inCreateInfo.usages);
+        return imageInfo;
+    }
+
     VulkanTexture::VulkanTexture(VulkanDevice& inDevice, const TextureCreateInfo& inCreateInfo, VkImage inNativeImage)
         : Texture(inCreateInfo)
         , device(inDevice)
@@ -32,10 +52,28 @@ namespace RHI::Vulkan {
         TransitionToInitState(inCreateInfo);
     }
 
+    VulkanTexture::VulkanTexture(VulkanDevice& inDevice, VulkanHeap& inHeap, const uint64_t inOffset, const TextureCreateInfo& inCreateInfo)
+        : Texture(inCreateInfo)
+        , device(inDevice)
+        , nativeImage(VK_NULL_HANDLE)
+        , nativeAllocation(VK_NULL_HANDLE)
+        , nativeAspect(VK_IMAGE_ASPECT_COLOR_BIT)
+        , ownMemory(true)
+    {
+        CreatePlacedNativeImage(inHeap, inOffset, inCreateInfo);
+        TransitionToInitState(inCreateInfo);
+    }
+
     VulkanTexture::~VulkanTexture()
     {
-        if (nativeImage != VK_NULL_HANDLE && ownMemory) {
+        if (nativeImage == VK_NULL_HANDLE || !ownMemory) {
+            return;
+        }
+        if (nativeAllocation != VK_NULL_HANDLE) {
             vmaDestroyImage(device.GetNativeAllocator(), nativeImage, nativeAllocation);
+        } else {
+            // placed image, memory is owned by the heap
+            vkDestroyImage(device.GetNative(), nativeImage, nullptr);
         }
     }
 
@@ -71,27 +109,31 @@ namespace RHI::Vulkan {
     void VulkanTexture::CreateNativeImage(const TextureCreateInfo& inCreateInfo)
     {
         GetAspect(inCreateInfo);
-
-        VkImageCreateInfo imageInfo = {};
-        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        imageInfo.mipLevels = inCreateInfo.mipLevels;
-        if (inCreateInfo.dimension == TextureDimension::t3D) {
-            imageInfo.extent = { inCreateInfo.width, inCreateInfo.height, inCreateInfo.depthOrArraySize };
-            imageInfo.arrayLayers = 1;
-        } else {
-            imageInfo.extent = { inCreateInfo.width, inCreateInfo.height, 1 };
-            imageInfo.arrayLayers = inCreateInfo.depthOrArraySize;
-        }
-        imageInfo.samples = static_cast<VkSampleCountFlagBits>(inCreateInfo.samples);
-        imageInfo.imageType = EnumCast<TextureDimension, VkImageType>(inCreateInfo.dimension);
-        imageInfo.format = EnumCast<PixelFormat, VkFormat>(inCreateInfo.format);
-        imageInfo.usage = FlagsCast<TextureUsageFlags, VkImageUsageFlags>(inCreateInfo.usages);
+        const VkImageCreateInfo imageInfo = GetNativeCreateInfo(inCreateInfo);
 
         VmaAllocationCreateInfo allocInfo = {};
         allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
 
         Assert(vmaCreateImage(device.GetNativeAllocator(), &imageInfo, &allocInfo, &nativeImage, &nativeAllocation, nullptr) == VK_SUCCESS);
+        SetNativeObjectName(inCreateInfo);
+    }
+
+    void VulkanTexture::CreatePlacedNativeImage(VulkanHeap& inHeap, const uint64_t inOffset, const TextureCreateInfo& inCreateInfo)
+    {
+        GetAspect(inCreateInfo);
+        const VkImageCreateInfo imageInfo = GetNativeCreateInfo(inCreateInfo);
+        Assert(vkCreateImage(device.GetNative(), &imageInfo, nullptr, &nativeImage) == VK_SUCCESS);
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetImageMemoryRequirements(device.GetNative(), nativeImage, &memoryRequirements);
+        Assert((memoryRequirements.memoryTypeBits & (1u << inHeap.GetNativeMemoryType())) != 0);
+        Assert(inOffset % memoryRequirements.alignment == 0 && inOffset + memoryRequirements.size <= inHeap.GetCreateInfo().size);
+        Assert(vmaBindImageMemory2(device.GetNativeAllocator(), inHeap.GetNative(), inOffset, nativeImage, nullptr) == VK_SUCCESS);
+        SetNativeObjectName(inCreateInfo);
+    }
 
+    void VulkanTexture::SetNativeObjectName(const TextureCreateInfo& inCreateInfo) const
+    {
 #if BUILD_CONFIG_DEBUG
         if (!inCreateInfo.debugName.empty()) {
             device.SetObjectName(VK_OBJECT_TYPE_IMAGE, reinterpret_cast<uint64_t>(nativeImage), inCreateInfo.debugName.c_str());
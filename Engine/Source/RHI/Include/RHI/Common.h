@@ -386,6 +386,12 @@ namespace RHI {
         max
     };
 
+    enum class BarrierType : uint8_t {
+        transition,
+        aliasing, // the resource starts using heap memory that another placed resource was using before
+        max
+    };
+
     enum class BufferState : uint8_t {
         undefined,
         staging,
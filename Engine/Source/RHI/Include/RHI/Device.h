@@ -28,10 +28,13 @@ namespace RHI {
     struct SwapChainCreateInfo;
     struct SurfaceCreateInfo;
     struct QuerySetCreateInfo;
+    struct HeapCreateInfo;
+    struct ResourceAllocationInfo;
     struct TextureSubResourceCopyFootprint;
     struct TextureSubResourceInfo;
     class Queue;
     class QuerySet;
+    class Heap;
     class Buffer;
     class Texture;
     class Sampler;
@@ -86,9 +89,16 @@ namespace RHI {
         virtual Common::UniquePtr<Fence> CreateFence(bool bInitAsSignaled) = 0;
         virtual Common::UniquePtr<Semaphore> CreateSemaphore() = 0;
         virtual Common::UniquePtr<QuerySet> CreateQuerySet(const QuerySetCreateInfo& createInfo) = 0;
+        virtual Common::UniquePtr<Heap> CreateHeap(const HeapCreateInfo& createInfo) = 0;
+        // placed resources don't own memory, they live in [offset, offset + allocationInfo.size) of the heap and only
+        // hold valid data after an aliasing barrier once another resource overlapping the range was used
+        virtual Common::UniquePtr<Buffer> CreatePlacedBuffer(Heap& heap, uint64_t offset, const BufferCreateInfo& createInfo) = 0;
+        virtual Common::UniquePtr<Texture> CreatePlacedTexture(Heap& heap, uint64_t offset, const TextureCreateInfo& createInfo) = 0;
 
         virtual bool CheckSwapChainFormatSupport(Surface* surface, PixelFormat format, ColorSpace colorSpace) = 0;
         virtual TextureSubResourceCopyFootprint GetTextureSubResourceCopyFootprint(const Texture& texture, const TextureSubResourceInfo& subResourceInfo) = 0;
+        virtual ResourceAllocationInfo GetResourceAllocationInfo(const BufferCreateInfo& createInfo) = 0;
+        virtual ResourceAllocationInfo GetResourceAllocationInfo(const TextureCreateInfo& createInfo) = 0;
 
     protected:
         explicit Device(const DeviceCreateInfo& createInfo);
@@ -0,0 +1,50 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <string>
+
+#include <Common/Utility.h>
+#include <RHI/Common.h>
+
+namespace RHI {
+    struct HeapCreateInfo {
+        uint64_t size;
+        // memory types the heap may be allocated from, see ResourceAllocationInfo::memoryTypeBits
+        uint32_t memoryTypeBits;
+        std::string debugName;
+
+        HeapCreateInfo();
+        explicit HeapCreateInfo(uint64_t inSize, std::string inDebugName = "");
+
+        HeapCreateInfo& SetSize(uint64_t inSize);
+        HeapCreateInfo& SetMemoryTypeBits(uint32_t inMemoryTypeBits);
+        HeapCreateInfo& SetDebugName(std::string inDebugName);
+    };
+
+    // memory requirements of a resource that is to be placed in a heap
+    struct ResourceAllocationInfo {
+        uint64_t size;
+        uint64_t alignment;
+        // backend memory types the resource can be placed in, a resource fits a heap allocated from one of them,
+        // backends without such a restriction leave all bits set
+        uint32_t memoryTypeBits = UINT32_MAX;
+    };
+
+    // device local memory block, placed buffers and textures bind at an offset of it and may alias each other,
+    // the heap must outlive every resource placed in it
+    class Heap {
+    public:
+        NonCopyable(Heap)
+        virtual ~Heap();
+
+        const HeapCreateInfo& GetCreateInfo() const;
+
+    protected:
+        explicit Heap(const HeapCreateInfo& inCreateInfo);
+
+        HeapCreateInfo createInfo;
+    };
+}
@@ -36,7 +36,12 @@ namespace RHI {
 
         static Barrier Transition(Buffer* buffer, BufferState before, BufferState after);
         static Barrier Transition(Texture* texture, TextureState before, TextureState after);
+        // orders the use of a placed resource after all previous uses of the resources it aliases, contents of the
+        // resource are undefined afterward, so a transition from undefined state usually follows
+        static Barrier Aliasing(Buffer* buffer);
+        static Barrier Aliasing(Texture* texture);
 
+        BarrierType barrierType;
         ResourceType type;
         union {
             BufferTransition buffer;
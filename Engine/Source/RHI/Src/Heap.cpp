@@ -0,0 +1,50 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RHI/Heap.h>
+
+namespace RHI {
+    HeapCreateInfo::HeapCreateInfo()
+        : size(0)
+        , memoryTypeBits(UINT32_MAX)
+    {
+    }
+
+    HeapCreateInfo::HeapCreateInfo(const uint64_t inSize, std::string inDebugName)
+        : size(inSize)
+        , memoryTypeBits(UINT32_MAX)
+        , debugName(std::move(inDebugName))
+    {
+    }
+
+    HeapCreateInfo& HeapCreateInfo::SetSize(const uint64_t inSize)
+    {
+        size = inSize;
+        return *this;
+    }
+
+    HeapCreateInfo& HeapCreateInfo::SetMemoryTypeBits(const uint32_t inMemoryTypeBits)
+    {
+        memoryTypeBits = inMemoryTypeBits;
+        return *this;
+    }
+
+    HeapCreateInfo& HeapCreateInfo::SetDebugName(std::string inDebugName)
+    {
+        debugName = std::move(inDebugName);
+        return *this;
+    }
+
+    Heap::Heap(const HeapCreateInfo& inCreateInfo)
+        : createInfo(inCreateInfo)
+    {
+    }
+
+    Heap::~Heap() = default;
+
+    const HeapCreateInfo& Heap::GetCreateInfo() const
+    {
+        return createInfo;
+    }
+}
@@ -8,6 +8,7 @@ namespace RHI {
     Barrier Barrier::Transition(Buffer* buffer, const BufferState before, const BufferState after)
     {
         Barrier barrier {};
+        barrier.barrierType = BarrierType::transition;
         barrier.type = ResourceType::buffer;
         barrier.buffer.pointer = buffer;
         barrier.buffer.before = before;
@@ -18,6 +19,7 @@ namespace RHI {
     Barrier Barrier::Transition(Texture* texture, const TextureState before, const TextureState after)
     {
         Barrier barrier {};
+        barrier.barrierType = BarrierType::transition;
         barrier.type = ResourceType::texture;
         barrier.texture.pointer = texture;
         barrier.texture.before = before;
@@ -25,6 +27,28 @@ namespace RHI {
         return barrier;
     }
 
+    Barrier Barrier::Aliasing(Buffer* buffer)
+    {
+        Barrier barrier {};
+        barrier.barrierType = BarrierType::aliasing;
+        barrier.type = ResourceType::buffer;
+        barrier.buffer.pointer = buffer;
+        barrier.buffer.before = BufferState::undefined;
+        barrier.buffer.after = BufferState::undefined;
+        return barrier;
+    }
+
+    Barrier Barrier::Aliasing(Texture* texture)
+    {
+        Barrier barrier {};
+        barrier.barrierType = BarrierType::aliasing;
+        barrier.type = ResourceType::texture;
+        barrier.texture.pointer = texture;
+        barrier.texture.before = TextureState::undefined;
+        barrier.texture.after = TextureState::undefined;
+        return barrier;
+    }
+
     Fence::Fence(Device&, bool) {}
 
     Fence::~Fence() = default;
@@ -0,0 +1,120 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <RenderTestDevice.h>
+#include <Render/Instancing.h>
+#include <Render/RenderCache.h>
+#include <Render/UniformRingBuffer.h>
+
+using namespace Render;
+
+// state.range(0) visible primitives share meshNum meshes in a random order, both variants build the base pass draws of a
+// frame and record them, one draw per primitive against one instanced draw per mesh
+namespace {
+    constexpr size_t meshNum = 16;
+
+    struct ALIGN_AS_GPU PerPrimitiveVsUniform {
+        Common::FMat4x4 localToWorld;
+        Common::FMat4x4 worldToClip;
+    };
+
+    struct ALIGN_AS_GPU PerPrimitivePsUniform {
+        Common::FVec4 baseColor;
+    };
+
+    struct ALIGN_AS_GPU InstancedViewUniform {
+        Common::FMat4x4 worldToClip;
+        uint32_t firstInstance;
+    };
+
+    struct Scene : RenderTestDevice {
+        explicit Scene(size_t inPrimitiveNum)
+        {
+            const std::vector<MeshRenderData::Vertex> vertices = {
+                { Common::FVec3(0, 0, 0), Common::FVec2(0, 0) },
+                { Common::FVec3(1, 0, 0), Common::FVec2(1, 0) },
+                { Common::FVec3(0, 1, 0), Common::FVec2(0, 1) }
+            };
+            for (size_t i = 0; i < meshNum; i++) {
+                meshes.emplace_back(Common::MakeShared<MeshRenderData>(*device, vertices, std::vector<uint32_t> { 0, 1, 2 }));
+            }
+
+            std::mt19937 rng(0x1234u);
+            std::uniform_int_distribution<size_t> dist(0, meshNum - 1);
+            proxies.resize(inPrimitiveNum);
+            for (size_t i = 0; i < inPrimitiveNum; i++) {
+                proxies[i].mesh = meshes[dist(rng)];
+                proxies[i].gpuSceneSlot = static_cast<uint32_t>(i);
+                primitives.emplace_back(&proxies[i]);
+            }
+        }
+
+        std::vector<Common::SharedPtr<MeshRenderData>> meshes;
+        std::vector<StaticPrimitiveSceneProxy> proxies;
+        std::vector<const StaticPrimitiveSceneProxy*> primitives;
+    };
+}
+
+static void PerPrimitiveDraws(benchmark::State& state)
+{
+    const Scene scene(state.range(0));
+    auto& ring = UniformRingBuffer::Get(*scene.device);
+    const auto commandBuffer = scene.device->CreateCommandBuffer();
+
+    size_t drawCalls = 0;
+    for (auto _ : state) {
+        const auto recorder = commandBuffer->Begin();
+        const auto rasterRecorder = recorder->BeginRasterPass(RHI::RasterPassBeginInfo());
+        drawCalls = 0;
+        for (const auto* primitive : scene.primitives) {
+            benchmark::DoNotOptimize(ring.Allocate(PerPrimitiveVsUniform { primitive->localToWorld, Common::FMat4x4Consts::identity }));
+            benchmark::DoNotOptimize(ring.Allocate(PerPrimitivePsUniform { primitive->baseColor }));
+            rasterRecorder->DrawIndexed(primitive->mesh->GetIndexCount(), 1, 0, 0, 0);
+            drawCalls++;
+        }
+        rasterRecorder->EndPass();
+        recorder->End();
+        ring.Forfeit();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(scene.primitives.size()));
+    state.counters["drawCalls"] = static_cast<double>(drawCalls);
+}
+
+static void InstancedDraws(benchmark::State& state)
+{
+    const Scene scene(state.range(0));
+    auto& ring = UniformRingBuffer::Get(*scene.device);
+    const auto commandBuffer = scene.device->CreateCommandBuffer();
+    Common::FrameArena arena;
+
+    size_t drawCalls = 0;
+    for (auto _ : state) {
+        Common::FrameVector<StaticMeshDrawBucket> buckets(&arena);
+        Common::FrameVector<uint32_t> instanceSlots(&arena);
+        BuildStaticMeshDrawBuckets(scene.primitives, buckets, instanceSlots, &arena);
+        benchmark::DoNotOptimize(ring.Allocate(instanceSlots.data(), instanceSlots.size() * sizeof(uint32_t)));
+
+        const auto recorder = commandBuffer->Begin();
+        const auto rasterRecorder = recorder->BeginRasterPass(RHI::RasterPassBeginInfo());
+        for (const auto& [primitive, firstInstance, instanceNum] : buckets) {
+            benchmark::DoNotOptimize(ring.Allocate(InstancedViewUniform { Common::FMat4x4Consts::identity, firstInstance }));
+            rasterRecorder->DrawIndexed(primitive->mesh->GetIndexCount(), instanceNum, 0, 0, 0);
+        }
+        rasterRecorder->EndPass();
+        recorder->End();
+        drawCalls = buckets.size();
+        ring.Forfeit();
+        arena.Reset();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(scene.primitives.size()));
+    state.counters["drawCalls"] = static_cast<double>(drawCalls);
+}
+
+BENCHMARK(PerPrimitiveDraws)->RangeMultiplier(4)->Range(1024, 16384);
+BENCHMARK(InstancedDraws)->RangeMultiplier(4)->Range(1024, 16384);
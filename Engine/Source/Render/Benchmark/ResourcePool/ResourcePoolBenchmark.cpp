@@ -0,0 +1,108 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <RenderTestDevice.h>
+#include <Render/RenderCache.h>
+#include <Render/ResourcePool.h>
+
+using namespace Render;
+
+// state.range(0) distinct descs are pooled and free, every iteration allocates one of them and gives it back, the
+// hashed pool should stay flat over the rows while the linear scan grows with the pool size
+namespace {
+    constexpr size_t lookupCount = 1024;
+
+    // the ResourcePool::Allocate() before it was bucketed by desc hash, kept here as the baseline
+    class LinearScanBufferPool {
+    public:
+        explicit LinearScanBufferPool(RHI::Device& inDevice)
+            : device(inDevice)
+        {
+        }
+
+        PooledBufferRef Allocate(const PooledBufferDesc& desc)
+        {
+            for (auto& pooledResource : pooledResources) {
+                if (pooledResource.RefCount() == 1 && desc == pooledResource->GetDesc()) {
+                    pooledResource->MarkUsedThisFrame();
+                    return pooledResource;
+                }
+            }
+            auto result = PooledResTraits<PooledBuffer>::CreateResource(device, desc);
+            pooledResources.emplace_back(result);
+            return result;
+        }
+
+    private:
+        RHI::Device& device;
+        std::vector<PooledBufferRef> pooledResources;
+    };
+
+    std::vector<PooledBufferDesc> MakeDescs(size_t count)
+    {
+        std::vector<PooledBufferDesc> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            result.emplace_back(static_cast<uint32_t>(256 * (i + 1)), RHI::BufferUsageBits::storage | RHI::BufferUsageBits::copyDst, RHI::BufferState::undefined);
+        }
+        return result;
+    }
+
+    std::vector<size_t> MakeLookups(size_t count)
+    {
+        std::mt19937 rng(0x1234u);
+        std::uniform_int_distribution<size_t> dist(0, count - 1);
+        std::vector<size_t> result(lookupCount);
+        for (auto& lookup : result) {
+            lookup = dist(rng);
+        }
+        return result;
+    }
+}
+
+static void ResourcePoolAllocate(benchmark::State& state)
+{
+    const RenderTestDevice dummyDevice;
+    auto& pool = BufferPool::Get(*dummyDevice.device);
+    const auto descs = MakeDescs(state.range(0));
+    const auto lookups = MakeLookups(descs.size());
+    for (const auto& desc : descs) {
+        pool.Release(pool.Allocate(desc));
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        PooledBufferRef buffer = pool.Allocate(descs[lookups[i++ % lookupCount]]);
+        benchmark::DoNotOptimize(buffer.Get());
+        pool.Release(std::move(buffer));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["hitRate"] = static_cast<double>(pool.Stats().hits) / static_cast<double>(pool.Stats().hits + pool.Stats().misses);
+}
+
+static void LinearScanPoolAllocate(benchmark::State& state)
+{
+    const RenderTestDevice dummyDevice;
+    LinearScanBufferPool pool(*dummyDevice.device);
+    const auto descs = MakeDescs(state.range(0));
+    const auto lookups = MakeLookups(descs.size());
+    for (const auto& desc : descs) {
+        pool.Allocate(desc);
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        PooledBufferRef buffer = pool.Allocate(descs[lookups[i++ % lookupCount]]);
+        benchmark::DoNotOptimize(buffer.Get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(ResourcePoolAllocate)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(LinearScanPoolAllocate)->RangeMultiplier(4)->Range(16, 4096);
@@ -0,0 +1,69 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <vector>
+
+#include <Common/Math/Matrix.h>
+#include <Common/Math/Vector.h>
+#include <Common/Memory.h>
+#include <RHI/RHI.h>
+#include <Render/RenderGraph.h>
+#include <Render/SceneProxy/Primitive.h>
+
+namespace Render::Internal {
+    constexpr size_t gpuSceneMinCapacity = 1024;
+    constexpr uint64_t gpuSceneRetiredBufferFrameLatency = 2;
+}
+
+namespace Render {
+    // element of the primitives structured buffer read by BasePassVS, keep both layouts in sync
+    struct GpuScenePrimitive {
+        Common::FMat4x4 localToWorld;
+        Common::FVec4 baseColor;
+    };
+
+    // gpu resident copy of the static primitives of a scene, every primitive keeps its slot for its whole lifetime and
+    // only slots written since the last flush are uploaded, so static primitives cost nothing per frame, render thread
+    // only like the scene owning it
+    class GpuScene {
+    public:
+        GpuScene();
+        ~GpuScene();
+
+        NonCopyable(GpuScene)
+        NonMovable(GpuScene)
+
+        uint32_t AllocateSlot();
+        void FreeSlot(uint32_t inSlot);
+        void Update(uint32_t inSlot, const StaticPrimitiveSceneProxy& inSceneProxy);
+        // slots handed out so far, freed ones included
+        size_t SlotNum() const;
+        size_t DirtySlotNum() const;
+        // imports the primitive buffer into the graph, dirty slots are packed into one staging upload and scattered by
+        // one copy pass, the graph must read the buffer as storage afterward, call once per graph
+        RGBufferRef Flush(RHI::Device& inDevice, RGBuilder& inBuilder);
+
+    private:
+        struct RetiredBuffer {
+            Common::UniquePtr<RHI::Buffer> buffer;
+            uint64_t retiredFrame;
+        };
+
+        void MarkDirty(uint32_t inSlot);
+        void Grow(RHI::Device& inDevice);
+
+        std::vector<GpuScenePrimitive> primitives;
+        std::vector<uint32_t> freeSlots;
+        std::vector<uint32_t> dirtySlots;
+        std::vector<uint8_t> dirtyFlags;
+        // dirty slots packed by the last flush, the graph reads it in place when executing
+        std::vector<GpuScenePrimitive> uploadData;
+        Common::UniquePtr<RHI::Buffer> buffer;
+        size_t bufferCapacity;
+        // frames in flight may still read a buffer replaced by a growth
+        std::vector<RetiredBuffer> retiredBuffers;
+    };
+}
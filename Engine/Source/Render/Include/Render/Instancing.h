@@ -0,0 +1,30 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <span>
+
+#include <Common/Memory.h>
+#include <Render/SceneProxy/Primitive.h>
+
+namespace Render {
+    // visible primitives sharing mesh, vertex factory and shaders (so also the pipeline), drawn by one instanced draw
+    // of the instance slots [firstInstance, firstInstance + instanceNum)
+    struct StaticMeshDrawBucket {
+        // the first primitive of the bucket, all of them share what the draw binds
+        const StaticPrimitiveSceneProxy* primitive;
+        uint32_t firstInstance;
+        uint32_t instanceNum;
+    };
+
+    // appends one bucket per distinct (mesh, vertex factory, vertex shader, pixel shader) to outBuckets, in the order
+    // the keys first appear, and the gpu scene slots of the primitives to outInstanceSlots grouped by bucket, primitives
+    // keep their relative order inside a bucket
+    void BuildStaticMeshDrawBuckets(
+        std::span<const StaticPrimitiveSceneProxy* const> inPrimitives,
+        Common::FrameVector<StaticMeshDrawBucket>& outBuckets,
+        Common::FrameVector<uint32_t>& outInstanceSlots,
+        Common::FrameArena* inArena);
+}
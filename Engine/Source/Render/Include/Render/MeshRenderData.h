@@ -4,8 +4,9 @@
 
 #pragma once
 
-#include <vector>
+#include <span>
 
+#include <Common/Math/Box.h>
 #include <Common/Math/Vector.h>
 #include <Common/Memory.h>
 #include <Common/Utility.h>
@@ -23,7 +24,8 @@ namespace Render {
 
         static constexpr size_t vertexStride = sizeof(Vertex);
 
-        MeshRenderData(RHI::Device& inDevice, const std::vector<Vertex>& inVertices, const std::vector<uint32_t>& inIndices);
+        // the data is copied into the buffers, spans may point into a mapped asset file
+        MeshRenderData(RHI::Device& inDevice, std::span<const Vertex> inVertices, std::span<const uint32_t> inIndices);
         ~MeshRenderData();
 
         NonCopyable(MeshRenderData)
@@ -32,10 +34,13 @@ namespace Render {
         RHI::Buffer* GetVertexBuffer() const;
         RHI::Buffer* GetIndexBuffer() const;
         uint32_t GetIndexCount() const;
+        const Common::FBox& GetLocalBounds() const;
 
     private:
+        RHI::Device& device;
         Common::UniquePtr<RHI::Buffer> vertexBuffer;
         Common::UniquePtr<RHI::Buffer> indexBuffer;
         uint32_t indexCount;
+        Common::FBox localBounds;
     };
 }
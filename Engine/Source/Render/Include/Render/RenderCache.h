@@ -5,6 +5,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <unordered_set>
 
 #include <RHI/RHI.h>
 #include <Render/Shader.h>
@@ -272,6 +273,8 @@ namespace Render {
 
         RHI::BufferView* GetOrCreate(RHI::Buffer* buffer, const RHI::BufferViewCreateInfo& inDesc);
         RHI::TextureView* GetOrCreate(RHI::Texture* texture, const RHI::TextureViewCreateInfo& inDesc);
+        // views live on across frames while their resource keeps being used, the owner of a resource must invalidate
+        // it before destroying it, so that a new resource at the same address never gets the old views
         void Invalidate(RHI::Buffer* buffer);
         void Invalidate(RHI::Texture* texture);
         void Forfeit();
@@ -282,13 +285,11 @@ namespace Render {
         explicit ResourceViewCache(RHI::Device& inDevice);
 
         struct BufferViewCache {
-            bool valid;
             uint64_t lastUsedFrame;
             std::unordered_map<size_t, Common::UniquePtr<RHI::BufferView>> views;
         };
 
         struct TextureViewCache {
-            bool valid;
             uint64_t lastUsedFrame;
             std::unordered_map<size_t, Common::UniquePtr<RHI::TextureView>> views;
         };
@@ -298,6 +299,16 @@ namespace Render {
         std::unordered_map<RHI::Texture*, TextureViewCache> textureViewCaches;
     };
 
+    struct BindGroupCacheStats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+
+        double HitRate() const;
+    };
+
+    // bind groups are keyed by the hash of their layout and entries and compared in full on lookup, an identical group is
+    // returned from the cache instead of being created again, groups not used for a few frames are evicted
     class BindGroupCache {
     public:
         static BindGroupCache& Get(RHI::Device& device);
@@ -306,17 +317,27 @@ namespace Render {
 
         RHI::BindGroup* Allocate(const RHI::BindGroupCreateInfo& inCreateInfo);
         void Invalidate();
+        // drops the groups referencing any of the entities (views or samplers) which are about to be destroyed
+        void Invalidate(const std::unordered_set<const void*>& inEntities);
         void Forfeit();
+        size_t Size() const;
+        const BindGroupCacheStats& Stats() const;
 
     private:
-        using AllocateFrameNumber = uint64_t;
+        struct CachedBindGroup {
+            Common::UniquePtr<RHI::BindGroup> bindGroup;
+            RHI::BindGroupLayout* layout;
+            std::vector<RHI::BindGroupEntry> entries;
+            uint64_t lastUsedFrame;
+        };
 
         static std::mutex mutex;
 
         explicit BindGroupCache(RHI::Device& inDevice);
 
         RHI::Device& device;
-        std::vector<std::pair<Common::UniquePtr<RHI::BindGroup>, AllocateFrameNumber>> bindGroups;
+        std::unordered_multimap<uint64_t, CachedBindGroup> bindGroups;
+        BindGroupCacheStats stats;
     };
 
     void DestroyDeviceResources(RHI::Device& device);
@@ -14,6 +14,7 @@
 #include <RHI/RHI.h>
 #include <Render/ResourcePool.h>
 #include <Render/RenderCache.h>
+#include <Render/TransientHeap.h>
 
 namespace Render {
     class RGBuilder;
@@ -346,7 +347,9 @@ namespace Render {
     public:
         NonCopyable(RGBuilder);
         NonMovable(RGBuilder);
+        // internals live in the frame arena of the calling thread, or on the heap when the thread has none
         explicit RGBuilder(RHI::Device& inDevice);
+        RGBuilder(RHI::Device& inDevice, Common::FrameArena* inArena);
         ~RGBuilder();
 
         // setup
@@ -372,61 +375,101 @@ namespace Render {
         RHI::BindGroup* GetRHI(RGBindGroupRef inBindGroup) const;
 
     private:
+        using ResourceSet = Common::FrameUnorderedSet<RGResourceRef>;
+
+        using BarrierList = Common::FrameVector<RHI::Barrier>;
+
         struct AsyncTimelineExecuteContext {
-            std::unordered_map<RGQueueType, Common::UniquePtr<RHI::CommandBuffer>> queueCmdBufferMap;
+            // passes of a queue are recorded into several command buffers, which are submitted in pass order
+            std::unordered_map<RGQueueType, std::vector<Common::UniquePtr<RHI::CommandBuffer>>> queueCmdBuffersMap;
             std::unordered_map<RGQueueType, Common::UniquePtr<RHI::Semaphore>> queueSemaphoreToSignalMap;
 
             AsyncTimelineExecuteContext();
             AsyncTimelineExecuteContext(AsyncTimelineExecuteContext&& inOther) noexcept;
         };
 
+        // contiguous passes of one queue, recorded into one command buffer on a render worker thread
+        struct PassRecordBatch {
+            std::vector<RGPassRef> passes;
+            Common::UniquePtr<RHI::CommandBuffer>* commandBuffer;
+        };
+
+        template <typename T, typename... Args> T* NewObject(Args&&... inArgs);
         void Compile();
         void ExecuteInternal(const RGExecuteInfo& inExecuteInfo);
 
         void CompilePassReadWrites();
         void PerformSyncCheck() const;
         void PerformCull();
+        // places transient resources of disjoint lifetimes at the same range of the transient heap
+        void PlanTransientAliasing();
         // TODO resource states check inside pass (e.g. read/write a resource within a pass)
         void ComputeResourcesInitialState();
-        void ExecuteCopyPass(RHI::CommandRecorder& inRecoder, RGCopyPass* inCopyPass);
-        void ExecuteComputePass(RHI::CommandRecorder& inRecoder, RGComputePass* inComputePass);
-        void ExecuteRasterPass(RHI::CommandRecorder& inRecoder, RGRasterPass* inRasterPass);
+        // devirtualizes what the pass touches and computes its barriers, runs on the calling thread in pass order so
+        // barrier placement never depends on how passes are recorded
+        void PreparePass(RGPassRef inPass);
+        void PrepareCopyPass(RGCopyPass* inCopyPass);
+        void PrepareComputePass(RGComputePass* inComputePass);
+        void PrepareRasterPass(RGRasterPass* inRasterPass);
+        // only reads the graph, so batches of prepared passes are recorded concurrently
+        void RecordPassBatches(std::vector<PassRecordBatch>& inBatches) const;
+        void RecordPass(RHI::CommandRecorder& inRecoder, RGPassRef inPass) const;
+        void RecordCopyPass(RHI::CommandRecorder& inRecoder, RGCopyPass* inCopyPass) const;
+        void RecordComputePass(RHI::CommandRecorder& inRecoder, RGComputePass* inComputePass) const;
+        void RecordRasterPass(RHI::CommandRecorder& inRecoder, RGRasterPass* inRasterPass) const;
+        void RecordPassBarriers(RHI::CommandRecorder& inRecoder, RGPassRef inPass) const;
+        void FinalizePass(RGPassRef inPass);
         void PerformBufferUploads();
         void WaitBufferUploadsFinish() const;
         void DevirtualizeViewsCreatedOnImportedResources();
         void DevirtualizeResource(RGResourceRef inResource);
-        void DevirtualizeResources(const std::unordered_set<RGResourceRef>& inResources);
+        void DevirtualizeResources(const ResourceSet& inResources);
+        void AliasResources(BarrierList& outBarriers, const ResourceSet& inResources);
         void DevirtualizeBindGroupsAndViews(const std::vector<RGBindGroupRef>& inBindGroups);
         void DevirtualizeAttachmentViews(const RGRasterPassDesc& inDesc);
-        void FinalizePassResources(const std::unordered_set<RGResourceRef>& inResources);
+        void FinalizePassResources(const ResourceSet& inResources);
         void FinalizePassBindGroups(const std::vector<RGBindGroupRef>& inBindGroups);
-        void TransitionResourcesForCopyPassDesc(RHI::CommonCommandRecorder& inRecoder, const RGCopyPassDesc& inDesc);
-        void TransitionResourcesForRasterPassDesc(RHI::CommonCommandRecorder& inRecoder, const RGRasterPassDesc& inDesc);
-        void TransitionResourcesForBindGroups(RHI::CommonCommandRecorder& inRecoder, const std::vector<RGBindGroupRef>& inBindGroups);
-        void TransitionBuffer(RHI::CommonCommandRecorder& inRecoder, RGBufferRef inBuffer, RHI::BufferState inState);
-        void TransitionTexture(RHI::CommonCommandRecorder& inRecoder, RGTextureRef inTexture, RHI::TextureState inState);
+        void TransitionResourcesForCopyPassDesc(BarrierList& outBarriers, const RGCopyPassDesc& inDesc);
+        void TransitionResourcesForRasterPassDesc(BarrierList& outBarriers, const RGRasterPassDesc& inDesc);
+        void TransitionResourcesForBindGroups(BarrierList& outBarriers, const std::vector<RGBindGroupRef>& inBindGroups);
+        void TransitionBuffer(BarrierList& outBarriers, RGBufferRef inBuffer, RHI::BufferState inState);
+        void TransitionTexture(BarrierList& outBarriers, RGTextureRef inTexture, RHI::TextureState inState);
 
+        Common::FrameArena* arena;
         bool executed;
         RHI::Device& device;
-        std::vector<Common::UniquePtr<RGResource>> resources;
-        std::vector<Common::UniquePtr<RGResourceView>> views;
-        std::vector<Common::UniquePtr<RGBindGroup>> bindGroups;
-        std::vector<Common::UniquePtr<RGPass>> passes;
+        Common::FrameVector<Common::FrameUniquePtr<RGResource>> resources;
+        Common::FrameVector<Common::FrameUniquePtr<RGResourceView>> views;
+        Common::FrameVector<Common::FrameUniquePtr<RGBindGroup>> bindGroups;
+        Common::FrameVector<Common::FrameUniquePtr<RGPass>> passes;
         std::unordered_map<RGQueueType, std::vector<RGPassRef>> recordingAsyncTimeline;
         std::vector<std::unordered_map<RGQueueType, std::vector<RGPassRef>>> asyncTimelines;
-        std::unordered_map<RGBufferRef, RGBufferUploadInfo> bufferUploads;
+        Common::FrameUnorderedMap<RGBufferRef, RGBufferUploadInfo> bufferUploads;
 
         // execute context
-        std::unordered_map<RGResourceRef, uint32_t> resourceReadCounts;
-        std::unordered_map<RGPassRef, std::unordered_set<RGResourceRef>> passReadsMap;
-        std::unordered_map<RGPassRef, std::unordered_set<RGResourceRef>> passWritesMap;
-        std::unordered_set<RGResourceRef> culledResources;
-        std::unordered_set<RGPassRef> culledPasses;
-        std::unordered_map<RGResourceRef, std::variant<RHI::BufferState, RHI::TextureState>> resourceStates;
+        Common::FrameUnorderedMap<RGResourceRef, uint32_t> resourceReadCounts;
+        Common::FrameUnorderedMap<RGPassRef, ResourceSet> passReadsMap;
+        Common::FrameUnorderedMap<RGPassRef, ResourceSet> passWritesMap;
+        ResourceSet culledResources;
+        Common::FrameUnorderedSet<RGPassRef> culledPasses;
+        Common::FrameUnorderedMap<RGResourceRef, std::variant<RHI::BufferState, RHI::TextureState>> resourceStates;
+        TransientHeapRange transientRange;
+        Common::FrameUnorderedMap<RGResourceRef, uint64_t> transientOffsets;
+        ResourceSet pendingAliasingBarriers;
+        Common::FrameUnorderedMap<RGPassRef, BarrierList> passBarriers;
         std::vector<AsyncTimelineExecuteContext> asyncTimelineExecuteContexts;
-        std::unordered_map<RGResourceRef, std::variant<PooledBufferRef, PooledTextureRef>> devirtualizedResources;
-        std::unordered_map<RGResourceViewRef, std::variant<RHI::BufferView*, RHI::TextureView*>> devirtualizedResourceViews;
-        std::unordered_map<RGBindGroupRef, RHI::BindGroup*> devirtualizedBindGroups;
-        std::vector<std::future<void>> bufferUploadTasks;
+        Common::FrameUnorderedMap<RGResourceRef, std::variant<PooledBufferRef, PooledTextureRef>> devirtualizedResources;
+        Common::FrameUnorderedMap<RGResourceViewRef, std::variant<RHI::BufferView*, RHI::TextureView*>> devirtualizedResourceViews;
+        Common::FrameUnorderedMap<RGBindGroupRef, RHI::BindGroup*> devirtualizedBindGroups;
+        Common::FrameVector<std::future<void>> bufferUploadTasks;
     };
+
+    template <typename T, typename... Args>
+    T* RGBuilder::NewObject(Args&&... inArgs)
+    {
+        if (arena == nullptr) {
+            return new T(std::forward<Args>(inArgs)...);
+        }
+        return new (arena->Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(inArgs)...);
+    }
 }
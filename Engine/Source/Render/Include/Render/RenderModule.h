@@ -31,16 +31,21 @@ namespace Render {
         void DeInitialize();
         RHI::Device* GetDevice() const;
         Render::RenderThread& GetRenderThread() const;
-        void BeginFrame() const;
+        void BeginFrame();
         Scene* NewScene() const;
         ViewState* NewViewState() const;
         View CreateView() const;
-        std::future<ShaderTypeCompileResult> CompileShaderTypes(const std::vector<const ShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions) const;
+        Common::Task<ShaderTypeCompileResult> CompileShaderTypes(std::vector<const ShaderType*> inShaderTypes, ShaderCompileOptions inOptions) const;
         Common::UniquePtr<Renderer> CreateStandardRenderer(const StandardRenderer::Params& inParams) const;
+        // render side transient per-frame data, reset at BeginFrame()
+        Common::FrameArena& GetFrameArena() const;
+        const Common::FrameArenaStats& GetLastFrameArenaStats() const;
 
     private:
         bool initialized;
         RHI::Instance* rhiInstance;
         Common::UniquePtr<RHI::Device> rhiDevice;
+        Common::UniquePtr<Common::FrameArena> frameArena;
+        Common::FrameArenaStats lastFrameArenaStats;
     };
 }
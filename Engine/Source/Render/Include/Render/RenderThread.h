@@ -6,6 +6,7 @@
 
 #include <Common/Memory.h>
 #include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
 #include <Core/Thread.h>
 
 namespace Render {
@@ -18,7 +19,10 @@ namespace Render {
         void Start();
         void Stop();
         void Flush() const;
-        template <typename F> auto EmplaceTask(F&& inTask);
+        // inTask runs on the render thread once the returned task is awaited, the awaiting coroutine then continues there
+        template <typename F> [[nodiscard]] Common::Task<std::invoke_result_t<F&>> EmplaceTask(F inTask);
+        // fire-and-forget, prefer it over EmplaceTask() when the result is not waited on
+        template <typename F> void Spawn(F&& inTask);
 
     private:
         RenderThread();
@@ -34,8 +38,11 @@ namespace Render {
 
         void Start();
         void Stop();
+        bool Started() const;
         template <typename F> auto EmplaceTask(F&& inTask);
+        template <typename F> void Spawn(F&& inTask);
         template <typename F> void ExecuteTasks(size_t inTaskNum, F&& inTask);
+        template <typename F> void ParallelFor(size_t inBegin, size_t inEnd, size_t inGrainSize, F&& inTask);
 
     private:
         RenderWorkerThreads();
@@ -46,10 +53,18 @@ namespace Render {
 
 namespace Render {
     template <typename F>
-    auto RenderThread::EmplaceTask(F&& inTask)
+    Common::Task<std::invoke_result_t<F&>> RenderThread::EmplaceTask(F inTask)
+    {
+        Assert(thread != nullptr);
+        co_await Common::ScheduleOn(*thread);
+        co_return inTask();
+    }
+
+    template <typename F>
+    void RenderThread::Spawn(F&& inTask)
     {
         Assert(thread != nullptr);
-        return thread->EmplaceTask(std::forward<F>(inTask));
+        thread->Spawn(std::forward<F>(inTask));
     }
 
     template <typename F>
@@ -64,6 +79,16 @@ namespace Render {
         });
     }
 
+    template <typename F>
+    void RenderWorkerThreads::Spawn(F&& inTask)
+    {
+        Assert(threads != nullptr);
+        threads->Spawn([task = std::forward<F>(inTask)]() mutable -> void {
+            Core::ScopedThreadTag tag(Core::ThreadTag::renderWorker);
+            task();
+        });
+    }
+
     template <typename F>
     void RenderWorkerThreads::ExecuteTasks(size_t inTaskNum, F&& inTask)
     {
@@ -74,4 +99,14 @@ namespace Render {
             reboundTask(inIndex);
         });
     }
+
+    template <typename F>
+    void RenderWorkerThreads::ParallelFor(size_t inBegin, size_t inEnd, size_t inGrainSize, F&& inTask)
+    {
+        Assert(threads != nullptr);
+        threads->ParallelFor(inBegin, inEnd, inGrainSize, [&inTask](size_t inRangeBegin, size_t inRangeEnd) -> void {
+            Core::ScopedThreadTag tag(Core::ThreadTag::renderWorker);
+            inTask(inRangeBegin, inRangeEnd);
+        });
+    }
 }
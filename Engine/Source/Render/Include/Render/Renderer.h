@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <span>
+
 #include <Render/Scene.h>
 #include <Render/View.h>
 #include <Render/RenderGraph.h>
@@ -19,12 +21,13 @@ namespace Render {
     public:
         struct Params {
             RHI::Device* device;
-            const Scene* scene;
+            Scene* scene;
             RHI::Texture* surface;
             Common::UVec2 surfaceExtent;
             RHI::TextureState surfaceBeforeRenderState;
             RHI::TextureState surfaceAfterRenderState;
-            std::vector<View> views;
+            // must stay alive until Render() returns, usually backed by a frame arena
+            std::span<const View> views;
             RHI::Semaphore* waitSemaphore;
             RHI::Semaphore* signalSemaphore;
             RHI::Fence* signalFence;
@@ -39,12 +42,12 @@ namespace Render {
 
     protected:
         RHI::Device* device;
-        const Scene* scene;
+        Scene* scene;
         RHI::Texture* surface;
         Common::UVec2 surfaceExtent;
         RHI::TextureState surfaceBeforeRenderState;
         RHI::TextureState surfaceAfterRenderState;
-        std::vector<View> views;
+        std::span<const View> views;
         RHI::Semaphore* waitSemaphore;
         RHI::Semaphore* signalSemaphore;
         RHI::Fence* signalFence;
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <array>
 #include <unordered_map>
 
 #include <Common/Memory.h>
 #include <Common/Container.h>
+#include <Common/Hash.h>
 #include <Core/Thread.h>
 #include <RHI/RHI.h>
+#include <Render/RenderCache.h>
 
 namespace Render::Internal {
     constexpr uint64_t pooledResourceReleaseFrameLatency = 2;
@@ -33,9 +36,13 @@ namespace Render {
         void MarkUsedThisFrame();
 
     private:
+        template <typename> friend class ResourcePool;
+
         Common::UniquePtr<RHIRes> rhiHandle;
         DescType desc;
         uint64_t lastUsedFrame;
+        uint64_t poolHash;
+        size_t poolIndex;
     };
 
     using PooledBuffer = PooledResource<RHI::Buffer>;
@@ -48,6 +55,15 @@ namespace Render {
     template <typename PooledRes>
     struct PooledResTraits {};
 
+    struct ResourcePoolStats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        uint64_t pooledBytes;
+    };
+
+    // free resources are bucketed by the hash of their desc, each bucket keeps a free list, so an allocation costs
+    // one map lookup plus a pop instead of a scan over every pooled resource
     template <typename PooledRes>
     class ResourcePool {
     public:
@@ -58,18 +74,33 @@ namespace Render {
         static void Destroy(RHI::Device& device);
 
         ResRefType Allocate(const DescType& desc);
+        // gives a reference back and puts the resource onto its free list once no one else holds it, a reference
+        // which is just dropped still gets reused, but is only found by a scan of its bucket or after Forfeit()
+        void Release(ResRefType&& inResource);
         size_t Size() const;
+        const ResourcePoolStats& Stats() const;
         void Forfeit();
         void Invalidate();
 
     private:
         using DeviceMap = std::unordered_map<RHI::Device*, Common::UniquePtr<ResourcePool>>;
 
+        struct Bucket {
+            DescType desc;
+            std::vector<size_t> memberIndices;
+            std::vector<size_t> freeIndices;
+        };
+
         explicit ResourcePool(RHI::Device& inDevice);
         static DeviceMap& GetDeviceMap();
+        Bucket& FindOrAddBucket(uint64_t hash, const DescType& desc);
+        ResRefType Reuse(size_t index);
 
         RHI::Device& device;
         std::vector<ResRefType> pooledResources;
+        // descs of the same hash but different values share a slot, the vector is almost always of size 1
+        std::unordered_map<uint64_t, std::vector<Bucket>> buckets;
+        ResourcePoolStats stats;
     };
 
     using BufferPool = ResourcePool<PooledBuffer>;
@@ -92,6 +123,8 @@ namespace Render {
         : rhiHandle(std::move(inRhiHandle))
         , desc(std::move(inDesc))
         , lastUsedFrame(Core::ThreadContext::FrameNumber())
+        , poolHash(0)
+        , poolIndex(0)
     {
     }
 
@@ -132,6 +165,22 @@ namespace Render {
         {
             return { new ResType(device.CreateBuffer(desc), desc) };
         }
+
+        // debug name is not a part of the desc equality, so it is left out of the hash too
+        static uint64_t Hash(const DescType& desc)
+        {
+            const std::array<uint64_t, 3> values = {
+                desc.size,
+                desc.usages.Value(),
+                static_cast<uint64_t>(desc.initialState)
+            };
+            return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(uint64_t));
+        }
+
+        static uint64_t Bytes(const DescType& desc)
+        {
+            return desc.size;
+        }
     };
 
     template <>
@@ -144,6 +193,36 @@ namespace Render {
         {
             return { new ResType(device.CreateTexture(desc), desc) };
         }
+
+        static uint64_t Hash(const DescType& desc)
+        {
+            const std::array<uint64_t, 9> values = {
+                static_cast<uint64_t>(desc.dimension),
+                desc.width,
+                desc.height,
+                desc.depthOrArraySize,
+                static_cast<uint64_t>(desc.format),
+                desc.usages.Value(),
+                desc.mipLevels,
+                desc.samples,
+                static_cast<uint64_t>(desc.initialState)
+            };
+            return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(uint64_t));
+        }
+
+        // an estimation without the alignment and padding of the backend, good enough for the pool statistics
+        static uint64_t Bytes(const DescType& desc)
+        {
+            uint64_t result = 0;
+            uint64_t width = desc.width;
+            uint64_t height = desc.height;
+            for (auto i = 0; i < std::max<uint8_t>(desc.mipLevels, 1); i++) {
+                result += width * height;
+                width = std::max<uint64_t>(width / 2, 1);
+                height = std::max<uint64_t>(height / 2, 1);
+            }
+            return result * RHI::GetBytesPerPixel(desc.format) * desc.depthOrArraySize * std::max<uint8_t>(desc.samples, 1);
+        }
     };
 
     template <typename PooledResource>
@@ -176,49 +255,137 @@ namespace Render {
     template <typename PooledResource>
     ResourcePool<PooledResource>::ResourcePool(RHI::Device& inDevice)
         : device(inDevice)
+        , stats()
     {
     }
 
-    template <typename PooledResource>
-    typename ResourcePool<PooledResource>::ResRefType ResourcePool<PooledResource>::Allocate(const DescType& desc)
+    template <typename PooledRes>
+    typename ResourcePool<PooledRes>::Bucket& ResourcePool<PooledRes>::FindOrAddBucket(uint64_t hash, const DescType& desc)
     {
-        for (auto& pooledResource : pooledResources) {
-            if (pooledResource.RefCount() == 1 && desc == pooledResource->GetDesc()) {
-                pooledResource->MarkUsedThisFrame();
-                return pooledResource;
+        auto& slot = buckets[hash];
+        for (auto& bucket : slot) {
+            if (bucket.desc == desc) {
+                return bucket;
+            }
+        }
+        auto& bucket = slot.emplace_back();
+        bucket.desc = desc;
+        return bucket;
+    }
+
+    template <typename PooledRes>
+    typename ResourcePool<PooledRes>::ResRefType ResourcePool<PooledRes>::Reuse(size_t index)
+    {
+        auto& pooledResource = pooledResources[index];
+        pooledResource->MarkUsedThisFrame();
+        stats.hits++;
+        return pooledResource;
+    }
+
+    template <typename PooledRes>
+    typename ResourcePool<PooledRes>::ResRefType ResourcePool<PooledRes>::Allocate(const DescType& desc)
+    {
+        const uint64_t hash = PooledResTraits<PooledRes>::Hash(desc);
+        auto& bucket = FindOrAddBucket(hash, desc);
+
+        // entries of the free list may have been taken by the bucket scan meanwhile, skip the ones in use
+        while (!bucket.freeIndices.empty()) {
+            const size_t index = bucket.freeIndices.back();
+            bucket.freeIndices.pop_back();
+            if (pooledResources[index].RefCount() == 1) {
+                return Reuse(index);
             }
         }
-        auto result = PooledResTraits<PooledResource>::CreateResource(device, desc);
+        for (const size_t index : bucket.memberIndices) {
+            if (pooledResources[index].RefCount() == 1) {
+                return Reuse(index);
+            }
+        }
+
+        auto result = PooledResTraits<PooledRes>::CreateResource(device, desc);
+        result->poolHash = hash;
+        result->poolIndex = pooledResources.size();
+        bucket.memberIndices.emplace_back(result->poolIndex);
         pooledResources.emplace_back(result);
+        stats.misses++;
+        stats.pooledBytes += PooledResTraits<PooledRes>::Bytes(desc);
         return result;
     }
 
+    template <typename PooledRes>
+    void ResourcePool<PooledRes>::Release(ResRefType&& inResource)
+    {
+        if (inResource == nullptr) {
+            return;
+        }
+        const size_t index = inResource->poolIndex;
+        inResource.Reset();
+
+        auto& pooledResource = pooledResources[index];
+        if (pooledResource.RefCount() == 1) {
+            FindOrAddBucket(pooledResource->poolHash, pooledResource->GetDesc()).freeIndices.emplace_back(index);
+        }
+    }
+
     template <typename PooledRes>
     size_t ResourcePool<PooledRes>::Size() const
     {
         return pooledResources.size();
     }
 
+    template <typename PooledRes>
+    const ResourcePoolStats& ResourcePool<PooledRes>::Stats() const
+    {
+        return stats;
+    }
+
     template <typename PooledRes>
     void ResourcePool<PooledRes>::Forfeit()
     {
         const auto currentFrame = Core::ThreadContext::FrameNumber();
 
-        for (auto i = 0; i < pooledResources.size();) {
-            bool needRelease = false;
-            auto& pooledResource = pooledResources[i];
+        // one pass compaction, survivors move down in place and the bucket lists are rebuilt from the new indices,
+        // which also brings the references dropped without Release() back onto the free lists
+        for (auto& [hash, slot] : buckets) {
+            for (auto& bucket : slot) {
+                bucket.memberIndices.clear();
+                bucket.freeIndices.clear();
+            }
+        }
 
-            if (pooledResource.RefCount() <= 1) {
-                needRelease = currentFrame - pooledResource->LastUsedFrame() > Internal::pooledResourceReleaseFrameLatency;
-            } else {
+        size_t keepNum = 0;
+        for (size_t i = 0; i < pooledResources.size(); i++) {
+            auto& pooledResource = pooledResources[i];
+            const bool free = pooledResource.RefCount() <= 1;
+
+            if (free && currentFrame - pooledResource->LastUsedFrame() > Internal::pooledResourceReleaseFrameLatency) {
+                // the views outlive the frames a pooled resource is used in, they must go with it
+                ResourceViewCache::Get(device).Invalidate(pooledResource->GetRHI());
+                stats.evictions++;
+                stats.pooledBytes -= PooledResTraits<PooledRes>::Bytes(pooledResource->GetDesc());
+                continue;
+            }
+            if (!free) {
                 pooledResource->MarkUsedThisFrame();
             }
 
-            if (needRelease) { // NOLINT
-                pooledResources.erase(pooledResources.begin() + i);
-            } else {
-                i++;
+            auto& bucket = FindOrAddBucket(pooledResource->poolHash, pooledResource->GetDesc());
+            pooledResource->poolIndex = keepNum;
+            bucket.memberIndices.emplace_back(keepNum);
+            if (free) {
+                bucket.freeIndices.emplace_back(keepNum);
             }
+            if (i != keepNum) {
+                pooledResources[keepNum] = std::move(pooledResource);
+            }
+            keepNum++;
+        }
+        pooledResources.erase(pooledResources.begin() + static_cast<std::ptrdiff_t>(keepNum), pooledResources.end());
+
+        for (auto iter = buckets.begin(); iter != buckets.end();) {
+            auto& slot = iter->second;
+            std::erase_if(slot, [](const Bucket& bucket) -> bool { return bucket.memberIndices.empty(); });
+            iter = slot.empty() ? buckets.erase(iter) : std::next(iter);
         }
     }
 
@@ -229,5 +396,7 @@ namespace Render {
             Assert(pooledResource.RefCount() == 1);
         }
         pooledResources.clear();
+        buckets.clear();
+        stats.pooledBytes = 0;
     }
 } // namespace Render
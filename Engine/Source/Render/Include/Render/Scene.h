@@ -6,6 +6,7 @@
 
 #include <Common/Debug.h>
 #include <Core/Thread.h>
+#include <Render/GpuScene.h>
 #include <Render/SceneProxy/Light.h>
 #include <Render/SceneProxy/Primitive.h>
 
@@ -26,8 +27,12 @@ namespace Render {
         template <typename SP> void Add(EntityId inEntity, SP&& inSceneProxy);
         template <typename SP> SP& Get(EntityId inEntity);
         template <typename SP> const SP& Get(EntityId inEntity) const;
+        // modifies a scene proxy in place, static primitives are written to the gpu scene again, prefer it to Get() for
+        // every change the gpu needs to see
+        template <typename SP, typename F> void Update(EntityId inEntity, F&& inFunc);
         template <typename SP> void Remove(EntityId inEntity);
         template <typename SP> const SceneProxyContainer<SP>& All() const;
+        GpuScene& GetGpuScene();
 
     private:
         template <typename SP> SceneProxyContainer<SP>& GetSceneProxyContainer();
@@ -37,6 +42,7 @@ namespace Render {
         SceneProxyContainer<PointLightSceneProxy> pointLightSceneProxies;
         SceneProxyContainer<SpotLightSceneProxy> spotLightSceneProxies;
         SceneProxyContainer<StaticPrimitiveSceneProxy> staticPrimitiveSceneProxies;
+        GpuScene gpuScene;
     };
 }
 
@@ -45,7 +51,13 @@ namespace Render {
     void Scene::Add(EntityId inEntity, SP&& inSceneProxy)
     {
         Assert(Core::ThreadContext::IsRenderThread());
-        GetSceneProxyContainer<SP>().emplace(inEntity, std::move(inSceneProxy)); // NOLINT
+        const auto [iter, inserted] = GetSceneProxyContainer<SP>().emplace(inEntity, std::move(inSceneProxy)); // NOLINT
+        if constexpr (std::is_same_v<SP, StaticPrimitiveSceneProxy>) {
+            if (inserted) {
+                iter->second.gpuSceneSlot = gpuScene.AllocateSlot();
+                gpuScene.Update(iter->second.gpuSceneSlot, iter->second);
+            }
+        }
     }
 
     template <typename SP>
@@ -62,11 +74,28 @@ namespace Render {
         return GetSceneProxyContainer<SP>().at(inEntity);
     }
 
+    template <typename SP, typename F>
+    void Scene::Update(EntityId inEntity, F&& inFunc)
+    {
+        Assert(Core::ThreadContext::IsRenderThread());
+        auto& sceneProxy = GetSceneProxyContainer<SP>().at(inEntity);
+        inFunc(sceneProxy);
+        if constexpr (std::is_same_v<SP, StaticPrimitiveSceneProxy>) {
+            gpuScene.Update(sceneProxy.gpuSceneSlot, sceneProxy);
+        }
+    }
+
     template <typename SP>
     void Scene::Remove(EntityId inEntity)
     {
         Assert(Core::ThreadContext::IsRenderThread());
-        GetSceneProxyContainer<SP>().erase(inEntity);
+        auto& container = GetSceneProxyContainer<SP>();
+        if constexpr (std::is_same_v<SP, StaticPrimitiveSceneProxy>) {
+            if (const auto iter = container.find(inEntity); iter != container.end()) {
+                gpuScene.FreeSlot(iter->second.gpuSceneSlot);
+            }
+        }
+        container.erase(inEntity);
     }
 
     template <typename SP>
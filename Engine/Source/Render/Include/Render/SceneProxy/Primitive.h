@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
+
+#include <Common/Math/Box.h>
 #include <Common/Math/Matrix.h>
 #include <Common/Math/Vector.h>
 #include <Common/Memory.h>
@@ -16,7 +20,13 @@ namespace Render {
     struct PrimitiveSceneProxy {
         PrimitiveSceneProxy();
 
+        // call after changing localToWorld or localBounds
+        void UpdateWorldBounds();
+
         Common::FMat4x4 localToWorld;
+        Common::FBox localBounds;
+        // axis aligned box around the transformed local bounds, used by view culling
+        Common::FBox worldBounds;
     };
 
     struct StaticPrimitiveSceneProxy final : PrimitiveSceneProxy {
@@ -27,6 +37,8 @@ namespace Render {
         const MaterialShaderType* vertexShaderType;
         const MaterialShaderType* pixelShaderType;
         Common::FVec4 baseColor;
+        // index of the primitive in the gpu scene, assigned by Scene::Add()
+        uint32_t gpuSceneSlot;
     };
 }
 
@@ -36,11 +48,30 @@ namespace Render {
     {
     }
 
+    inline void PrimitiveSceneProxy::UpdateWorldBounds()
+    {
+        const Common::FVec3 localCenter = localBounds.Center();
+        const Common::FVec3 localHalfExtent = localBounds.Extent() / 2.0f;
+
+        Common::FVec3 center;
+        Common::FVec3 halfExtent;
+        for (uint8_t i = 0; i < 3; i++) {
+            center[i] = localToWorld.At(i, 3);
+            halfExtent[i] = 0.0f;
+            for (uint8_t j = 0; j < 3; j++) {
+                center[i] += localToWorld.At(i, j) * localCenter[j];
+                halfExtent[i] += std::abs(localToWorld.At(i, j)) * localHalfExtent[j];
+            }
+        }
+        worldBounds = Common::FBox(center - halfExtent, center + halfExtent);
+    }
+
     inline StaticPrimitiveSceneProxy::StaticPrimitiveSceneProxy()
         : vertexFactoryType(nullptr)
         , vertexShaderType(nullptr)
         , pixelShaderType(nullptr)
         , baseColor(1.0f, 1.0f, 1.0f, 1.0f)
+        , gpuSceneSlot(std::numeric_limits<uint32_t>::max())
     {
     }
 }
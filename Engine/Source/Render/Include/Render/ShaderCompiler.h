@@ -10,6 +10,7 @@
 #include <RHI/Common.h>
 #include <Render/Shader.h>
 #include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
 
 namespace Render {
     enum class ShaderByteCodeType : uint8_t {
@@ -66,8 +67,9 @@ namespace Render {
         static ShaderTypeCompiler& Get();
         ~ShaderTypeCompiler();
 
-        std::future<ShaderTypeCompileResult> Compile(const std::vector<const ShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions);
-        std::future<ShaderTypeCompileResult> CompileAll(const ShaderCompileOptions& inOptions);
+        // must be started on the game thread, the compilation itself runs on the compiler pool
+        Common::Task<ShaderTypeCompileResult> Compile(std::vector<const ShaderType*> inShaderTypes, ShaderCompileOptions inOptions);
+        Common::Task<ShaderTypeCompileResult> CompileAll(ShaderCompileOptions inOptions);
 
     private:
         ShaderTypeCompiler();
@@ -0,0 +1,135 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <Common/Memory.h>
+#include <RHI/RHI.h>
+#include <Render/ResourcePool.h>
+
+namespace Render::Internal {
+    constexpr uint64_t transientHeapGranularity = 16 * 1024 * 1024;
+    constexpr uint64_t transientResourceReleaseFrameLatency = 2;
+}
+
+namespace Render {
+    // a transient resource used by the steps [firstStep, lastStep] of a render graph, passes running at the same time
+    // on different queues share their steps
+    struct TransientAllocationRequest {
+        RHI::ResourceAllocationInfo allocationInfo;
+        uint32_t firstStep;
+        uint32_t lastStep;
+    };
+
+    struct TransientPlacement {
+        uint64_t offset;
+        // the memory was used by another resource at an earlier step, an aliasing barrier must precede the first use
+        bool aliased;
+    };
+
+    struct TransientAllocationPlan {
+        std::vector<TransientPlacement> placements;
+        uint64_t heapSize;
+        uint64_t alignment;
+        uint64_t requestedBytes;
+        // memory types every request can be placed in
+        uint32_t memoryTypeBits;
+    };
+
+    // places requests with disjoint lifetimes in the same memory, largest first at the lowest aligned offset not used
+    // by any request of an overlapping lifetime
+    TransientAllocationPlan PlanTransientAllocations(const std::vector<TransientAllocationRequest>& inRequests);
+
+    struct TransientHeapStats {
+        // sum of the sizes of all placed resources, what committed allocations would have taken
+        uint64_t requestedBytes;
+        // heap bytes taken by the aliased placements
+        uint64_t placedBytes;
+        uint64_t heapBytes;
+
+        uint64_t SavedBytes() const;
+    };
+
+    struct TransientHeapRange {
+        RHI::Heap* heap;
+        uint64_t offset;
+    };
+
+    // device local heaps the render graphs place their transient resources into, one chain of heaps per set of memory
+    // types, each graph reserves a range per frame, placed resources are kept across frames by heap offset and desc,
+    // so a steady frame creates none of them
+    class TransientHeap {
+    public:
+        static TransientHeap& Get(RHI::Device& inDevice);
+        static void Destroy(RHI::Device& inDevice);
+
+        ~TransientHeap();
+        NonCopyable(TransientHeap)
+        NonMovable(TransientHeap)
+
+        RHI::ResourceAllocationInfo GetAllocationInfo(const RHI::BufferCreateInfo& inCreateInfo);
+        RHI::ResourceAllocationInfo GetAllocationInfo(const RHI::TextureCreateInfo& inCreateInfo);
+        // ranges of a frame never overlap, the heap grows when a frame does not fit, retired heaps are released
+        // once no placed resource lives in them anymore
+        TransientHeapRange AllocateRange(const TransientAllocationPlan& inPlan);
+        // call in the order the resources are first used, outAliased tells that another resource used the memory
+        // last, in this graph or in an earlier one, so an aliasing barrier must precede the first use
+        PooledBufferRef AllocateBuffer(const TransientHeapRange& inRange, uint64_t inOffset, const RHI::BufferCreateInfo& inCreateInfo, bool& outAliased);
+        PooledTextureRef AllocateTexture(const TransientHeapRange& inRange, uint64_t inOffset, const RHI::TextureCreateInfo& inCreateInfo, bool& outAliased);
+        // of the current frame, reset by Forfeit()
+        const TransientHeapStats& Stats() const;
+        size_t PlacedResourceNum() const;
+        size_t HeapNum() const;
+        // rewinds the frame ranges and releases placed resources unused for a few frames, call at the beginning of a
+        // render frame
+        void Forfeit();
+
+    private:
+        // the pooled resource keeps its desc, a cache hit compares it with the heap offset as the key is only a hash
+        template <typename Ref>
+        struct PlacedResource {
+            Ref resource;
+            RHI::Heap* heap;
+            uint64_t offset;
+            uint64_t id;
+        };
+
+        template <typename Desc>
+        struct CachedAllocationInfo {
+            Desc desc;
+            RHI::ResourceAllocationInfo allocationInfo;
+        };
+
+        // the placed resource which used a heap range last, keyed by the range begin
+        struct Occupant {
+            uint64_t end;
+            uint64_t id;
+        };
+
+        struct HeapChain {
+            // the last heap is the one ranges are reserved from
+            std::vector<Common::UniquePtr<RHI::Heap>> heaps;
+            uint64_t frameOffset;
+        };
+
+        explicit TransientHeap(RHI::Device& inDevice);
+        void Grow(HeapChain& inChain, uint64_t inMinSize, uint32_t inMemoryTypeBits);
+        // records the placed resource as the last user of the range, returns whether another one used a part of it
+        bool Occupy(const RHI::Heap* inHeap, uint64_t inBegin, uint64_t inEnd, uint64_t inId);
+
+        RHI::Device& device;
+        std::unordered_map<uint32_t, HeapChain> heapChains;
+        std::unordered_map<const RHI::Heap*, std::map<uint64_t, Occupant>> occupants;
+        uint64_t nextPlacedResourceId;
+        std::unordered_multimap<uint64_t, CachedAllocationInfo<RHI::BufferCreateInfo>> bufferAllocationInfos;
+        std::unordered_multimap<uint64_t, CachedAllocationInfo<RHI::TextureCreateInfo>> textureAllocationInfos;
+        std::unordered_multimap<uint64_t, PlacedResource<PooledBufferRef>> placedBuffers;
+        std::unordered_multimap<uint64_t, PlacedResource<PooledTextureRef>> placedTextures;
+        TransientHeapStats stats;
+    };
+}
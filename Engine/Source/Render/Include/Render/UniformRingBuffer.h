@@ -0,0 +1,79 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <Common/Memory.h>
+#include <RHI/RHI.h>
+
+namespace Render::Internal {
+    // the renderer of a frame waits its gpu work before the next BeginFrame(), the second slot keeps the ring safe
+    // should a frame ever be left in flight
+    constexpr size_t uniformRingFramesInFlight = 2;
+    // covers the offset alignment of every backend (vulkan minUniformBufferOffsetAlignment, d3d12 cbv placement)
+    constexpr size_t uniformRingAlignment = 256;
+    constexpr size_t uniformRingPageSize = 4 * 1024 * 1024;
+}
+
+namespace Render {
+    struct UniformAllocation {
+        RHI::Buffer* buffer;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    // per frame linear allocator for draw constants: large upload pages per frame slot, aligned sub allocations and a
+    // pointer bump per call instead of a pooled buffer plus a queued upload per draw, bind the result through a
+    // uniform buffer view at the returned offset
+    class UniformRingBuffer {
+    public:
+        static UniformRingBuffer& Get(RHI::Device& inDevice);
+        static void Destroy(RHI::Device& inDevice);
+
+        ~UniformRingBuffer();
+        NonCopyable(UniformRingBuffer)
+        NonMovable(UniformRingBuffer)
+
+        UniformAllocation Allocate(const void* inData, size_t inSize);
+        template <typename T> UniformAllocation Allocate(const T& inData);
+        // pages stay mapped while a frame records and are unmapped (flushed) here, call it before submitting the
+        // commands that read the allocations, allocating again maps the current page anew
+        void Flush();
+        // moves to the next frame slot and rewinds it, call at the beginning of a render frame, the pages of the slot are
+        // host written again from then on, so a frame imports them into the render graph in the staging state
+        void Forfeit();
+        size_t PageNum() const;
+
+    private:
+        struct Page {
+            Common::UniquePtr<RHI::Buffer> buffer;
+            size_t size;
+            uint8_t* mapped;
+        };
+
+        struct FrameSlot {
+            std::vector<Page> pages;
+            size_t pageIndex;
+            size_t offset;
+        };
+
+        explicit UniformRingBuffer(RHI::Device& inDevice);
+        Page& AcquirePage(size_t inSize);
+
+        RHI::Device& device;
+        std::array<FrameSlot, Internal::uniformRingFramesInFlight> frameSlots;
+        size_t frameSlotIndex;
+    };
+}
+
+namespace Render {
+    template <typename T>
+    UniformAllocation UniformRingBuffer::Allocate(const T& inData)
+    {
+        return Allocate(&inData, sizeof(T));
+    }
+}
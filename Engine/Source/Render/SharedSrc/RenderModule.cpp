@@ -7,6 +7,8 @@
 #include <Render/RenderModule.h>
 #include <Render/ResourcePool.h>
 #include <Render/Scene.h>
+#include <Render/TransientHeap.h>
+#include <Render/UniformRingBuffer.h>
 
 namespace Render {
     RenderModule::RenderModule()
@@ -38,6 +40,9 @@ namespace Render {
 
         RenderThread::Get().Start();
         RenderWorkerThreads::Get().Start();
+        frameArena = new Common::FrameArena();
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::render, frameArena.Get());
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::renderWorker, frameArena.Get());
 
         rhiInstance = RHI::Instance::GetByType(inParams.rhiType);
         rhiDevice = rhiInstance->GetGpu(0)->RequestDevice(
@@ -53,6 +58,9 @@ namespace Render {
     {
         RenderThread::Get().Stop();
         RenderWorkerThreads::Get().Stop();
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::render, nullptr);
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::renderWorker, nullptr);
+        frameArena = nullptr;
 
         DestroyDeviceResources(*rhiDevice);
 
@@ -71,13 +79,19 @@ namespace Render {
         return RenderThread::Get();
     }
 
-    void RenderModule::BeginFrame() const // NOLINT
+    void RenderModule::BeginFrame()
     {
+        // the renderer of the last frame waited its gpu work and is gone, nothing references the arena anymore
+        lastFrameArenaStats = frameArena->Stats();
+        frameArena->Reset();
+
         ShaderArtifactRegistry::Get().PerformThreadCopy();
         BufferPool::Get(*rhiDevice).Forfeit();
         TexturePool::Get(*rhiDevice).Forfeit();
         ResourceViewCache::Get(*rhiDevice).Forfeit();
         BindGroupCache::Get(*rhiDevice).Forfeit();
+        UniformRingBuffer::Get(*rhiDevice).Forfeit();
+        TransientHeap::Get(*rhiDevice).Forfeit();
     }
 
     Scene* RenderModule::NewScene() const // NOLINT
@@ -95,15 +109,25 @@ namespace Render {
         return View();
     }
 
-    std::future<ShaderTypeCompileResult> RenderModule::CompileShaderTypes(const std::vector<const ShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions) const
+    Common::Task<ShaderTypeCompileResult> RenderModule::CompileShaderTypes(std::vector<const ShaderType*> inShaderTypes, ShaderCompileOptions inOptions) const
     {
-        return ShaderTypeCompiler::Get().Compile(inShaderTypes, inOptions);
+        return ShaderTypeCompiler::Get().Compile(std::move(inShaderTypes), std::move(inOptions));
     }
 
     Common::UniquePtr<Renderer> RenderModule::CreateStandardRenderer(const StandardRenderer::Params& inParams) const // NOLINT
     {
         return Common::UniquePtr<Renderer>(new StandardRenderer(inParams));
     }
+
+    Common::FrameArena& RenderModule::GetFrameArena() const
+    {
+        return *frameArena;
+    }
+
+    const Common::FrameArenaStats& RenderModule::GetLastFrameArenaStats() const
+    {
+        return lastFrameArenaStats;
+    }
 } // namespace Render
 
 IMPLEMENT_DYNAMIC_MODULE(RENDER_API, Render::RenderModule);
@@ -0,0 +1,133 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <algorithm>
+#include <bit>
+
+#include <Core/Thread.h>
+#include <Render/GpuScene.h>
+
+namespace Render {
+    GpuScene::GpuScene()
+        : bufferCapacity(0)
+    {
+    }
+
+    GpuScene::~GpuScene() = default;
+
+    uint32_t GpuScene::AllocateSlot()
+    {
+        if (!freeSlots.empty()) {
+            const uint32_t slot = freeSlots.back();
+            freeSlots.pop_back();
+            return slot;
+        }
+        primitives.emplace_back();
+        dirtyFlags.emplace_back(0);
+        return static_cast<uint32_t>(primitives.size() - 1);
+    }
+
+    void GpuScene::FreeSlot(uint32_t inSlot)
+    {
+        Assert(inSlot < primitives.size());
+        // the stale data stays in the buffer, nothing references the slot until it is handed out and written again
+        freeSlots.emplace_back(inSlot);
+    }
+
+    void GpuScene::Update(uint32_t inSlot, const StaticPrimitiveSceneProxy& inSceneProxy)
+    {
+        Assert(inSlot < primitives.size());
+        primitives[inSlot] = GpuScenePrimitive { inSceneProxy.localToWorld, inSceneProxy.baseColor };
+        MarkDirty(inSlot);
+    }
+
+    size_t GpuScene::SlotNum() const
+    {
+        return primitives.size();
+    }
+
+    size_t GpuScene::DirtySlotNum() const
+    {
+        return dirtySlots.size();
+    }
+
+    RGBufferRef GpuScene::Flush(RHI::Device& inDevice, RGBuilder& inBuilder)
+    {
+        const auto currentFrame = Core::ThreadContext::FrameNumber();
+        std::erase_if(retiredBuffers, [&](const RetiredBuffer& retired) -> bool {
+            return currentFrame - retired.retiredFrame >= Internal::gpuSceneRetiredBufferFrameLatency;
+        });
+
+        if (buffer == nullptr || bufferCapacity < primitives.size()) {
+            Grow(inDevice);
+        }
+        auto* primitiveBuffer = inBuilder.ImportBuffer(buffer.Get(), RHI::BufferState::storage);
+        if (dirtySlots.empty()) {
+            return primitiveBuffer;
+        }
+
+        // consecutive slots are scattered by a single copy
+        std::ranges::sort(dirtySlots);
+        std::vector<RHI::BufferCopyInfo> copyInfos;
+        uploadData.clear();
+        for (const auto slot : dirtySlots) {
+            const size_t srcOffset = uploadData.size() * sizeof(GpuScenePrimitive);
+            const size_t dstOffset = slot * sizeof(GpuScenePrimitive);
+            if (!copyInfos.empty() && copyInfos.back().dstOffset + copyInfos.back().copySize == dstOffset) {
+                copyInfos.back().copySize += sizeof(GpuScenePrimitive);
+            } else {
+                copyInfos.emplace_back(srcOffset, dstOffset, sizeof(GpuScenePrimitive));
+            }
+            uploadData.emplace_back(primitives[slot]);
+            dirtyFlags[slot] = 0;
+        }
+        dirtySlots.clear();
+
+        const auto uploadBytes = static_cast<uint32_t>(uploadData.size() * sizeof(GpuScenePrimitive));
+        auto* stagingBuffer = inBuilder.CreateBuffer(
+            RGBufferDesc()
+                .SetSize(uploadBytes)
+                .SetUsages(RHI::BufferUsageBits::copySrc | RHI::BufferUsageBits::mapWrite)
+                .SetInitialState(RHI::BufferState::staging)
+                .SetDebugName("gpuSceneUpload"));
+        inBuilder.QueueBufferUpload(stagingBuffer, RGBufferUploadInfo(uploadData.data(), uploadBytes));
+        inBuilder.AddCopyPass(
+            "GpuSceneUpload",
+            RGCopyPassDesc { { stagingBuffer }, { primitiveBuffer } },
+            [stagingBuffer, primitiveBuffer, copyInfos = std::move(copyInfos)](const RGBuilder& rg, RHI::CopyPassCommandRecorder& recorder) -> void {
+                for (const auto& copyInfo : copyInfos) {
+                    recorder.CopyBufferToBuffer(rg.GetRHI(stagingBuffer), rg.GetRHI(primitiveBuffer), copyInfo);
+                }
+            });
+        return primitiveBuffer;
+    }
+
+    void GpuScene::MarkDirty(uint32_t inSlot)
+    {
+        if (dirtyFlags[inSlot] == 0) {
+            dirtyFlags[inSlot] = 1;
+            dirtySlots.emplace_back(inSlot);
+        }
+    }
+
+    void GpuScene::Grow(RHI::Device& inDevice)
+    {
+        if (buffer != nullptr) {
+            retiredBuffers.emplace_back(RetiredBuffer { std::move(buffer), Core::ThreadContext::FrameNumber() });
+        }
+
+        bufferCapacity = std::max(Internal::gpuSceneMinCapacity, std::bit_ceil(primitives.size()));
+        buffer = inDevice.CreateBuffer(
+            RHI::BufferCreateInfo()
+                .SetSize(static_cast<uint32_t>(bufferCapacity * sizeof(GpuScenePrimitive)))
+                .SetUsages(RHI::BufferUsageBits::storage | RHI::BufferUsageBits::copyDst)
+                .SetInitialState(RHI::BufferState::storage)
+                .SetDebugName("gpuScenePrimitives"));
+
+        // a new buffer starts empty, every slot is uploaded again
+        for (uint32_t slot = 0; slot < primitives.size(); slot++) {
+            MarkDirty(slot);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <array>
+
+#include <Common/Hash.h>
+#include <Render/Instancing.h>
+
+namespace Render::Internal {
+    struct DrawBucketKey {
+        const MeshRenderData* mesh;
+        const VertexFactoryType* vertexFactoryType;
+        const MaterialShaderType* vertexShaderType;
+        const MaterialShaderType* pixelShaderType;
+
+        bool operator==(const DrawBucketKey& inRhs) const = default;
+    };
+
+    struct DrawBucketKeyHash {
+        size_t operator()(const DrawBucketKey& inKey) const
+        {
+            const std::array<const void*, 4> values = { inKey.mesh, inKey.vertexFactoryType, inKey.vertexShaderType, inKey.pixelShaderType };
+            return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(const void*));
+        }
+    };
+}
+
+namespace Render {
+    void BuildStaticMeshDrawBuckets(
+        std::span<const StaticPrimitiveSceneProxy* const> inPrimitives,
+        Common::FrameVector<StaticMeshDrawBucket>& outBuckets,
+        Common::FrameVector<uint32_t>& outInstanceSlots,
+        Common::FrameArena* inArena)
+    {
+        // a counting sort, buckets are numbered by the first appearance of their key, then every primitive is written
+        // to the next free instance slot of its bucket
+        Common::FrameUnorderedMap<Internal::DrawBucketKey, uint32_t, Internal::DrawBucketKeyHash> bucketIndices(inArena);
+        Common::FrameVector<uint32_t> primitiveBuckets(inArena);
+        Common::FrameVector<uint32_t> bucketCursors(inArena);
+        primitiveBuckets.reserve(inPrimitives.size());
+
+        const size_t firstBucket = outBuckets.size();
+        for (const auto* primitive : inPrimitives) {
+            const Internal::DrawBucketKey key { primitive->mesh.Get(), primitive->vertexFactoryType, primitive->vertexShaderType, primitive->pixelShaderType };
+            const auto [iter, inserted] = bucketIndices.emplace(key, static_cast<uint32_t>(outBuckets.size() - firstBucket));
+            if (inserted) {
+                outBuckets.emplace_back(StaticMeshDrawBucket { primitive, 0, 0 });
+            }
+            outBuckets[firstBucket + iter->second].instanceNum++;
+            primitiveBuckets.emplace_back(iter->second);
+        }
+
+        auto nextInstance = static_cast<uint32_t>(outInstanceSlots.size());
+        bucketCursors.reserve(outBuckets.size() - firstBucket);
+        for (size_t i = firstBucket; i < outBuckets.size(); i++) {
+            outBuckets[i].firstInstance = nextInstance;
+            bucketCursors.emplace_back(nextInstance);
+            nextInstance += outBuckets[i].instanceNum;
+        }
+
+        outInstanceSlots.resize(nextInstance);
+        for (size_t i = 0; i < inPrimitives.size(); i++) {
+            outInstanceSlots[bucketCursors[primitiveBuckets[i]]++] = inPrimitives[i]->gpuSceneSlot;
+        }
+    }
+}
@@ -2,9 +2,11 @@
 // Created by johnk on 2026/7/5.
 //
 
+#include <algorithm>
 #include <cstring>
 
 #include <Render/MeshRenderData.h>
+#include <Render/RenderCache.h>
 
 namespace Render::Internal {
     static Common::UniquePtr<RHI::Buffer> CreateUploadedBuffer(RHI::Device& inDevice, const void* inData, size_t inSize, RHI::BufferUsageBits inUsage, const std::string& inDebugName)
@@ -22,17 +24,39 @@ namespace Render::Internal {
         result->Unmap();
         return result;
     }
+
+    static Common::FBox ComputeLocalBounds(std::span<const MeshRenderData::Vertex> inVertices)
+    {
+        if (inVertices.empty()) {
+            return {};
+        }
+        Common::FBox result(inVertices[0].position, inVertices[0].position);
+        for (const auto& vertex : inVertices) {
+            for (uint8_t i = 0; i < 3; i++) {
+                result.min[i] = std::min(result.min[i], vertex.position[i]);
+                result.max[i] = std::max(result.max[i], vertex.position[i]);
+            }
+        }
+        return result;
+    }
 }
 
 namespace Render {
-    MeshRenderData::MeshRenderData(RHI::Device& inDevice, const std::vector<Vertex>& inVertices, const std::vector<uint32_t>& inIndices)
-        : vertexBuffer(Internal::CreateUploadedBuffer(inDevice, inVertices.data(), inVertices.size() * sizeof(Vertex), RHI::BufferUsageBits::vertex, "meshVertexBuffer"))
+    MeshRenderData::MeshRenderData(RHI::Device& inDevice, std::span<const Vertex> inVertices, std::span<const uint32_t> inIndices)
+        : device(inDevice)
+        , vertexBuffer(Internal::CreateUploadedBuffer(inDevice, inVertices.data(), inVertices.size() * sizeof(Vertex), RHI::BufferUsageBits::vertex, "meshVertexBuffer"))
         , indexBuffer(Internal::CreateUploadedBuffer(inDevice, inIndices.data(), inIndices.size() * sizeof(uint32_t), RHI::BufferUsageBits::index, "meshIndexBuffer"))
         , indexCount(static_cast<uint32_t>(inIndices.size()))
+        , localBounds(Internal::ComputeLocalBounds(inVertices))
     {
     }
 
-    MeshRenderData::~MeshRenderData() = default;
+    MeshRenderData::~MeshRenderData()
+    {
+        auto& resourceViewCache = ResourceViewCache::Get(device);
+        resourceViewCache.Invalidate(vertexBuffer.Get());
+        resourceViewCache.Invalidate(indexBuffer.Get());
+    }
 
     RHI::Buffer* MeshRenderData::GetVertexBuffer() const
     {
@@ -48,4 +72,9 @@ namespace Render {
     {
         return indexCount;
     }
+
+    const Common::FBox& MeshRenderData::GetLocalBounds() const
+    {
+        return localBounds;
+    }
 }
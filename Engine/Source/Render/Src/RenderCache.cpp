@@ -4,6 +4,7 @@
 
 #include <Render/RenderCache.h>
 
+#include <algorithm>
 #include <utility>
 #include <variant>
 
@@ -11,6 +12,8 @@
 #include <Common/IO.h>
 #include <Core/Thread.h>
 #include <Render/ResourcePool.h>
+#include <Render/TransientHeap.h>
+#include <Render/UniformRingBuffer.h>
 
 namespace Render::Internal {
     constexpr uint64_t resourceViewCacheReleaseFrameLatency = 2;
@@ -100,6 +103,83 @@ namespace Render::Internal {
         }
         return CombineHashes(values);
     }
+
+    static uint64_t HashRhiState(const RHI::ResourceBinding& binding)
+    {
+        const uint64_t platformBindingHash = std::visit(
+            []<typename T>(const T& platformBinding) -> uint64_t {
+                if constexpr (std::is_same_v<T, RHI::HlslBinding>) {
+                    return CombineHashes({ static_cast<uint64_t>(platformBinding.rangeType), platformBinding.index });
+                } else {
+                    return platformBinding.index;
+                }
+            },
+            binding.platformBinding);
+        return CombineHashes({
+            static_cast<uint64_t>(binding.type),
+            static_cast<uint64_t>(binding.platformBinding.index()),
+            platformBindingHash
+        });
+    }
+
+    // entries arrive in the iteration order of the bind item map of the render graph, their hashes are sorted so the
+    // same content always gives the same key
+    static uint64_t HashRhiState(const RHI::BindGroupCreateInfo& createInfo)
+    {
+        std::vector<uint64_t> values;
+        values.reserve(createInfo.entries.size() + 1);
+        for (const auto& entry : createInfo.entries) {
+            values.emplace_back(CombineHashes({
+                HashRhiState(entry.binding),
+                static_cast<uint64_t>(entry.shaderVisibility.Value()),
+                static_cast<uint64_t>(entry.entity.index()),
+                std::visit([](const auto* entity) -> uint64_t { return reinterpret_cast<uint64_t>(entity); }, entry.entity)
+            }));
+        }
+        std::ranges::sort(values);
+        values.emplace_back(reinterpret_cast<uint64_t>(createInfo.layout));
+        return CombineHashes(values);
+    }
+
+    static bool SameRhiState(const RHI::ResourceBinding& lhs, const RHI::ResourceBinding& rhs)
+    {
+        if (lhs.type != rhs.type || lhs.platformBinding.index() != rhs.platformBinding.index()) {
+            return false;
+        }
+        if (const auto* hlslBinding = std::get_if<RHI::HlslBinding>(&lhs.platformBinding)) {
+            const auto& otherHlslBinding = std::get<RHI::HlslBinding>(rhs.platformBinding);
+            return hlslBinding->rangeType == otherHlslBinding.rangeType && hlslBinding->index == otherHlslBinding.index;
+        }
+        return std::get<RHI::GlslBinding>(lhs.platformBinding).index == std::get<RHI::GlslBinding>(rhs.platformBinding).index;
+    }
+
+    static bool SameRhiState(const RHI::BindGroupEntry& lhs, const RHI::BindGroupEntry& rhs)
+    {
+        return SameRhiState(lhs.binding, rhs.binding) && lhs.shaderVisibility == rhs.shaderVisibility && lhs.entity == rhs.entity;
+    }
+
+    // bindings are unique inside a group, so equal sizes plus every entry finding its match means the same content in
+    // any order, as HashRhiState() treats it
+    static bool SameRhiState(const RHI::BindGroupLayout* inLayout, const std::vector<RHI::BindGroupEntry>& inEntries, const RHI::BindGroupCreateInfo& createInfo)
+    {
+        if (inLayout != createInfo.layout || inEntries.size() != createInfo.entries.size()) {
+            return false;
+        }
+        return std::ranges::all_of(createInfo.entries, [&](const RHI::BindGroupEntry& entry) -> bool {
+            return std::ranges::any_of(inEntries, [&](const RHI::BindGroupEntry& cachedEntry) -> bool { return SameRhiState(cachedEntry, entry); });
+        });
+    }
+
+    template <typename Views>
+    static void InvalidateBindGroupsReferencing(RHI::Device& device, const Views& views)
+    {
+        std::unordered_set<const void*> entities;
+        entities.reserve(views.size());
+        for (const auto& [hash, view] : views) {
+            entities.emplace(view.Get());
+        }
+        BindGroupCache::Get(device).Invalidate(entities);
+    }
 }
 
 namespace Render {
@@ -732,7 +812,8 @@ namespace Render {
 
     RHI::BufferView* ResourceViewCache::GetOrCreate(RHI::Buffer* buffer, const RHI::BufferViewCreateInfo& inDesc)
     {
-        auto& views = bufferViewCaches[buffer].views;
+        auto& [lastUsedFrame, views] = bufferViewCaches[buffer];
+        lastUsedFrame = Core::ThreadContext::FrameNumber();
 
         auto hash = Internal::HashRhiState(inDesc);
         if (const auto iter = views.find(hash);
@@ -744,7 +825,8 @@ namespace Render {
 
     RHI::TextureView* ResourceViewCache::GetOrCreate(RHI::Texture* texture, const RHI::TextureViewCreateInfo& inDesc)
     {
-        auto& views = textureViewCaches[texture].views;
+        auto& [lastUsedFrame, views] = textureViewCaches[texture];
+        lastUsedFrame = Core::ThreadContext::FrameNumber();
 
         auto hash = Internal::HashRhiState(inDesc);
         if (const auto iter = views.find(hash);
@@ -758,7 +840,8 @@ namespace Render {
     {
         if (const auto iter = bufferViewCaches.find(buffer);
             iter != bufferViewCaches.end()) {
-            iter->second.valid = false;
+            Internal::InvalidateBindGroupsReferencing(device, iter->second.views);
+            bufferViewCaches.erase(iter);
         }
     }
 
@@ -766,31 +849,25 @@ namespace Render {
     {
         if (const auto iter = textureViewCaches.find(texture);
             iter != textureViewCaches.end()) {
-            iter->second.valid = false;
+            Internal::InvalidateBindGroupsReferencing(device, iter->second.views);
+            textureViewCaches.erase(iter);
         }
     }
 
     void ResourceViewCache::Forfeit()
     {
-        const auto forfeitCaches = [](auto& caches) -> void { // NOLINT
+        const auto forfeitCaches = [this](auto& caches) -> void { // NOLINT
             const auto currentFrameNumber = Core::ThreadContext::FrameNumber();
 
-            std::vector<typename std::decay_t<decltype(caches)>::key_type> resourcesToRelease;
-            resourcesToRelease.reserve(caches.size());
-
-            for (auto& [resource, cache] : caches) {
-                auto& [valid, lastUsedFrame, views] = cache;
-
-                if (valid) {
-                    lastUsedFrame = currentFrameNumber;
-                } else if (currentFrameNumber - lastUsedFrame > Internal::resourceViewCacheReleaseFrameLatency) {
-                    resourcesToRelease.emplace_back(resource);
+            for (auto iter = caches.begin(); iter != caches.end();) {
+                if (auto& [lastUsedFrame, views] = iter->second;
+                    currentFrameNumber - lastUsedFrame > Internal::resourceViewCacheReleaseFrameLatency) {
+                    Internal::InvalidateBindGroupsReferencing(device, views);
+                    iter = caches.erase(iter);
+                } else {
+                    ++iter;
                 }
             }
-
-            for (auto* resourceToRelease : resourcesToRelease) {
-                caches.erase(resourceToRelease);
-            }
         };
 
         forfeitCaches(bufferViewCaches);
@@ -819,8 +896,23 @@ namespace Render {
 
     RHI::BindGroup* BindGroupCache::Allocate(const RHI::BindGroupCreateInfo& inCreateInfo)
     {
-        const auto& [ptr, frameNumber] = bindGroups.emplace_back(device.CreateBindGroup(inCreateInfo), Core::ThreadContext::FrameNumber());
-        return ptr.Get();
+        // the hash only narrows the search, a hit must match the layout and entries too
+        const auto hash = Internal::HashRhiState(inCreateInfo);
+        for (auto [iter, end] = bindGroups.equal_range(hash); iter != end; ++iter) {
+            if (Internal::SameRhiState(iter->second.layout, iter->second.entries, inCreateInfo)) {
+                iter->second.lastUsedFrame = Core::ThreadContext::FrameNumber();
+                stats.hits++;
+                return iter->second.bindGroup.Get();
+            }
+        }
+
+        CachedBindGroup cachedBindGroup;
+        cachedBindGroup.bindGroup = device.CreateBindGroup(inCreateInfo);
+        cachedBindGroup.layout = inCreateInfo.layout;
+        cachedBindGroup.entries = inCreateInfo.entries;
+        cachedBindGroup.lastUsedFrame = Core::ThreadContext::FrameNumber();
+        stats.misses++;
+        return bindGroups.emplace(hash, std::move(cachedBindGroup))->second.bindGroup.Get();
     }
 
     void BindGroupCache::Invalidate()
@@ -828,23 +920,45 @@ namespace Render {
         bindGroups.clear();
     }
 
+    void BindGroupCache::Invalidate(const std::unordered_set<const void*>& inEntities)
+    {
+        std::erase_if(bindGroups, [&](const auto& pair) -> bool {
+            return std::ranges::any_of(pair.second.entries, [&](const RHI::BindGroupEntry& entry) -> bool {
+                return inEntities.contains(std::visit([](const auto* entity) -> const void* { return entity; }, entry.entity));
+            });
+        });
+    }
+
     void BindGroupCache::Forfeit()
     {
         const auto currentFrame = Core::ThreadContext::FrameNumber();
 
-        for (auto i = 0; i < bindGroups.size();) {
-            const auto& [ptr, lastUsedFrame] = bindGroups[i];
-            if (currentFrame - lastUsedFrame > Internal::bindGroupCacheReleaseFrameLatency) { // NOLINT
-                bindGroups.erase(bindGroups.begin() + i);
-            } else {
-                i++;
-            }
-        }
+        // groups used within the latency stay, so the least recently used ones are the ones evicted
+        stats.evictions += std::erase_if(bindGroups, [&](const auto& pair) -> bool {
+            return currentFrame - pair.second.lastUsedFrame > Internal::bindGroupCacheReleaseFrameLatency;
+        });
+    }
+
+    size_t BindGroupCache::Size() const
+    {
+        return bindGroups.size();
+    }
+
+    const BindGroupCacheStats& BindGroupCache::Stats() const
+    {
+        return stats;
     }
 
     BindGroupCache::BindGroupCache(RHI::Device& inDevice)
         : device(inDevice)
+        , stats()
+    {
+    }
+
+    double BindGroupCacheStats::HitRate() const
     {
+        const auto total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
     }
 
     void DestroyDeviceResources(RHI::Device& device)
@@ -856,5 +970,7 @@ namespace Render {
         ShaderMap::Destroy(device);
         BufferPool::Destroy(device);
         TexturePool::Destroy(device);
+        UniformRingBuffer::Destroy(device);
+        TransientHeap::Destroy(device);
     }
 } // namespace Render
@@ -2,15 +2,18 @@
 // Created by johnk on 2023/11/28.
 //
 
+#include <algorithm>
 #include <cstring>
 #include <ranges>
 
 #include <Render/RenderGraph.h>
 #include <Render/RenderThread.h>
 #include <Common/Container.h>
+#include <Core/Thread.h>
 
 namespace Render::Internal {
-    static void ComputeReadsWritesForBindGroup(const RGBindGroupDesc& inDesc, std::unordered_set<RGResourceRef>& outReads, std::unordered_set<RGResourceRef>& outWrites)
+    template <typename S>
+    static void ComputeReadsWritesForBindGroup(const RGBindGroupDesc& inDesc, S& outReads, S& outWrites)
     {
         for (const auto& [type, view] : inDesc.items | std::views::values) {
             if (type == RHI::BindingType::uniformBuffer) {
@@ -33,6 +36,16 @@ namespace Render::Internal {
         }
     }
 
+    // passes of a queue are split into at most one batch per render worker, a batch takes a few passes at least so
+    // small graphs are not spread over command buffers and submits for nothing
+    constexpr size_t minPassNumPerRecordBatch = 4;
+    constexpr size_t maxRecordBatchNum = 8;
+
+    static size_t GetRecordBatchNum(size_t inPassNum)
+    {
+        return std::clamp<size_t>((inPassNum + minPassNumPerRecordBatch - 1) / minPassNumPerRecordBatch, 1, maxRecordBatchNum);
+    }
+
     static std::pair<RHI::QueueType, uint8_t> GetRHIQueueTypeAndIndex(RGQueueType inType)
     {
         if (inType == RGQueueType::main) {
@@ -48,7 +61,7 @@ namespace Render::Internal {
         return {};
     }
 
-    static RHI::RasterPassBeginInfo GetRHIRasterPassBeginInfo(RGBuilder& builder, const RGRasterPassDesc& inDesc)
+    static RHI::RasterPassBeginInfo GetRHIRasterPassBeginInfo(const RGBuilder& builder, const RGRasterPassDesc& inDesc)
     {
         RHI::RasterPassBeginInfo result;
         if (inDesc.depthStencilAttachment.has_value()) {
@@ -399,8 +412,33 @@ namespace Render {
     RGRasterPass::~RGRasterPass() = default;
 
     RGBuilder::RGBuilder(RHI::Device& inDevice)
-        : executed(false)
+        : RGBuilder(inDevice, Core::ThreadContext::CurrentFrameArena())
+    {
+    }
+
+    RGBuilder::RGBuilder(RHI::Device& inDevice, Common::FrameArena* inArena)
+        : arena(inArena)
+        , executed(false)
         , device(inDevice)
+        , resources(arena)
+        , views(arena)
+        , bindGroups(arena)
+        , passes(arena)
+        , bufferUploads(arena)
+        , resourceReadCounts(arena)
+        , passReadsMap(arena)
+        , passWritesMap(arena)
+        , culledResources(arena)
+        , culledPasses(arena)
+        , resourceStates(arena)
+        , transientRange()
+        , transientOffsets(arena)
+        , pendingAliasingBarriers(arena)
+        , passBarriers(arena)
+        , devirtualizedResources(arena)
+        , devirtualizedResourceViews(arena)
+        , devirtualizedBindGroups(arena)
+        , bufferUploadTasks(arena)
     {
     }
 
@@ -409,56 +447,55 @@ namespace Render {
     RGBufferRef RGBuilder::CreateBuffer(const RGBufferDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGBuffer(inDesc);
-        resources.emplace_back(result);
+        auto* const result = NewObject<RGBuffer>(inDesc);
+        resources.emplace_back(result, arena);
         return result;
     }
 
     RGTextureRef RGBuilder::CreateTexture(const RGTextureDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGTexture(inDesc);
-        resources.emplace_back(result);
+        auto* const result = NewObject<RGTexture>(inDesc);
+        resources.emplace_back(result, arena);
         return result;
     }
 
     RGBufferViewRef RGBuilder::CreateBufferView(RGBufferRef inBuffer, const RGBufferViewDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGBufferView(inBuffer, inDesc);
-        views.emplace_back(result);
+        auto* const result = NewObject<RGBufferView>(inBuffer, inDesc);
+        views.emplace_back(result, arena);
         return result;
     }
 
     RGTextureViewRef RGBuilder::CreateTextureView(RGTextureRef inTexture, const RGTextureViewDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGTextureView(inTexture, inDesc);
-        views.emplace_back(result);
+        auto* const result = NewObject<RGTextureView>(inTexture, inDesc);
+        views.emplace_back(result, arena);
         return result;
     }
 
     RGBufferRef RGBuilder::ImportBuffer(RHI::Buffer* inBuffer, RHI::BufferState inInitialState)
     {
         Assert(!executed);
-        auto* const result = new RGBuffer(inBuffer, inInitialState);
-        resources.emplace_back(result);
+        auto* const result = NewObject<RGBuffer>(inBuffer, inInitialState);
+        resources.emplace_back(result, arena);
         return result;
     }
 
     RGTextureRef RGBuilder::ImportTexture(RHI::Texture* inTexture, RHI::TextureState inInitialState)
     {
         Assert(!executed);
-        auto* const result = new RGTexture(inTexture, inInitialState);
-        resources.emplace_back(result);
+        auto* const result = NewObject<RGTexture>(inTexture, inInitialState);
+        resources.emplace_back(result, arena);
         return result;
     }
 
     RGBindGroupRef RGBuilder::AllocateBindGroup(const RGBindGroupDesc& inDesc)
     {
         Assert(!executed);
-        bindGroups.emplace_back(new RGBindGroup(inDesc));
-        return bindGroups.back().Get();
+        return bindGroups.emplace_back(NewObject<RGBindGroup>(inDesc), arena).get();
     }
 
     void RGBuilder::QueueBufferUpload(RGBufferRef inBuffer, const RGBufferUploadInfo& inUploadInfo)
@@ -470,22 +507,22 @@ namespace Render {
     void RGBuilder::AddCopyPass(const std::string& inName, const RGCopyPassDesc& inPassDesc, const RGCopyPassExecuteFunc& inFunc, bool inAsyncCopy, const RGCommonPassExecuteFunc& inPreExecuteFunc, const RGCommonPassExecuteFunc& inPostExecuteFunc)
     {
         Assert(!executed);
-        const auto& pass = passes.emplace_back(new RGCopyPass(inName, inPassDesc, inFunc, inPreExecuteFunc, inPostExecuteFunc));
-        recordingAsyncTimeline[inAsyncCopy ? RGQueueType::asyncCopy : RGQueueType::main].emplace_back(pass.Get());
+        const auto& pass = passes.emplace_back(NewObject<RGCopyPass>(inName, inPassDesc, inFunc, inPreExecuteFunc, inPostExecuteFunc), arena);
+        recordingAsyncTimeline[inAsyncCopy ? RGQueueType::asyncCopy : RGQueueType::main].emplace_back(pass.get());
     }
 
     void RGBuilder::AddComputePass(const std::string& inName, const std::vector<RGBindGroupRef>& inBindGroups, const RGComputePassExecuteFunc& inFunc, bool inAsyncCompute, const RGCommonPassExecuteFunc& inPreExecuteFunc, const RGCommonPassExecuteFunc& inPostExecuteFunc)
     {
         Assert(!executed);
-        const auto& pass = passes.emplace_back(new RGComputePass(inName, inBindGroups, inFunc, inPreExecuteFunc, inPostExecuteFunc));
-        recordingAsyncTimeline[inAsyncCompute ? RGQueueType::asyncCompute : RGQueueType::main].emplace_back(pass.Get());
+        const auto& pass = passes.emplace_back(NewObject<RGComputePass>(inName, inBindGroups, inFunc, inPreExecuteFunc, inPostExecuteFunc), arena);
+        recordingAsyncTimeline[inAsyncCompute ? RGQueueType::asyncCompute : RGQueueType::main].emplace_back(pass.get());
     }
 
     void RGBuilder::AddRasterPass(const std::string& inName, const RGRasterPassDesc& inPassDesc, const std::vector<RGBindGroupRef>& inBindGroups, const RGRasterPassExecuteFunc& inFunc, const RGCommonPassExecuteFunc& inPreExecuteFunc, const RGCommonPassExecuteFunc& inPostExecuteFunc)
     {
         Assert(!executed);
-        const auto& pass = passes.emplace_back(new RGRasterPass(inName, inPassDesc, inBindGroups, inFunc, inPreExecuteFunc, inPostExecuteFunc));
-        recordingAsyncTimeline[RGQueueType::main].emplace_back(pass.Get());
+        const auto& pass = passes.emplace_back(NewObject<RGRasterPass>(inName, inPassDesc, inBindGroups, inFunc, inPreExecuteFunc, inPostExecuteFunc), arena);
+        recordingAsyncTimeline[RGQueueType::main].emplace_back(pass.get());
     }
 
     void RGBuilder::AddSyncPoint()
@@ -554,7 +591,7 @@ namespace Render {
     RGBuilder::AsyncTimelineExecuteContext::AsyncTimelineExecuteContext() = default;
 
     RGBuilder::AsyncTimelineExecuteContext::AsyncTimelineExecuteContext(AsyncTimelineExecuteContext&& inOther) noexcept // NOLINT
-        : queueCmdBufferMap(std::move(inOther.queueCmdBufferMap))
+        : queueCmdBuffersMap(std::move(inOther.queueCmdBuffersMap))
         , queueSemaphoreToSignalMap(std::move(inOther.queueSemaphoreToSignalMap))
     {
     }
@@ -563,6 +600,7 @@ namespace Render {
     {
         CompilePassReadWrites();
         PerformCull();
+        PlanTransientAliasing();
         ComputeResourcesInitialState();
     }
 
@@ -576,8 +614,54 @@ namespace Render {
 
         WaitBufferUploadsFinish();
         for (const auto& queuePasses : asyncTimelines) {
-            const bool isFirstAsyncTimeline = asyncTimelineExecuteContexts.empty();
-            const bool isLastAsyncTimeline = asyncTimelineExecuteContexts.size() + 1 == asyncTimelines.size();
+            for (const auto& passes : queuePasses | std::views::values) {
+                for (auto* pass : passes) {
+                    if (!culledPasses.contains(pass)) {
+                        PreparePass(pass);
+                    }
+                }
+            }
+        }
+
+        std::vector<PassRecordBatch> batches;
+        for (const auto& queuePasses : asyncTimelines) {
+            auto& [commandBuffersMap, semaphoreMap] = asyncTimelineExecuteContexts.emplace_back();
+            commandBuffersMap.reserve(queuePasses.size());
+
+            for (const auto& [queueType, passes] : queuePasses) {
+                std::vector<RGPassRef> passesToRecord;
+                passesToRecord.reserve(passes.size());
+                for (auto* pass : passes) {
+                    if (!culledPasses.contains(pass)) {
+                        passesToRecord.emplace_back(pass);
+                    }
+                }
+
+                // an empty queue still submits one command buffer, later timelines wait on its semaphore
+                const auto batchNum = Internal::GetRecordBatchNum(passesToRecord.size());
+                auto& commandBuffers = commandBuffersMap.emplace(queueType, batchNum).first->second;
+                for (size_t i = 0; i < batchNum; i++) {
+                    const auto begin = passesToRecord.begin() + static_cast<ptrdiff_t>(passesToRecord.size() * i / batchNum);
+                    const auto end = passesToRecord.begin() + static_cast<ptrdiff_t>(passesToRecord.size() * (i + 1) / batchNum);
+                    batches.emplace_back(PassRecordBatch { std::vector<RGPassRef>(begin, end), &commandBuffers[i] });
+                }
+            }
+        }
+        RecordPassBatches(batches);
+
+        for (const auto& queuePasses : asyncTimelines) {
+            for (const auto& passes : queuePasses | std::views::values) {
+                for (auto* pass : passes) {
+                    if (!culledPasses.contains(pass)) {
+                        FinalizePass(pass);
+                    }
+                }
+            }
+        }
+
+        for (size_t timelineIndex = 0; timelineIndex < asyncTimelineNum; timelineIndex++) {
+            const bool isFirstAsyncTimeline = timelineIndex == 0;
+            const bool isLastAsyncTimeline = timelineIndex + 1 == asyncTimelineNum;
 
             std::vector<RHI::Semaphore*> semaphoresToWait;
             if (isFirstAsyncTimeline) {
@@ -587,65 +671,42 @@ namespace Render {
                 }
             } else {
                 // wait all cmd buffers in last async timeline executed
-                for (const AsyncTimelineExecuteContext& lastContext = asyncTimelineExecuteContexts.back();
-                    const auto& semaphore : lastContext.queueSemaphoreToSignalMap | std::views::values) {
+                for (const auto& semaphore : asyncTimelineExecuteContexts[timelineIndex - 1].queueSemaphoreToSignalMap | std::views::values) {
                     semaphoresToWait.emplace_back(semaphore.Get());
                 }
             }
 
-            auto& [commandBufferMap, semaphoreMap] = asyncTimelineExecuteContexts.emplace_back();
+            auto& [commandBuffersMap, semaphoreMap] = asyncTimelineExecuteContexts[timelineIndex];
+            semaphoreMap.reserve(commandBuffersMap.size());
 
-            const auto queueNumInAsyncTimeline = queuePasses.size();
-            commandBufferMap.reserve(queueNumInAsyncTimeline);
-            semaphoreMap.reserve(queueNumInAsyncTimeline);
-
-            for (const auto& [queueType, passes] : queuePasses) {
-                commandBufferMap.emplace(queueType, device.CreateCommandBuffer());
-                semaphoreMap.emplace(queueType, isLastAsyncTimeline ? nullptr : device.CreateSemaphore());
-
-                auto& commandBufferToRecord = commandBufferMap.at(queueType);
-                auto& semaphoreToSignal = semaphoreMap.at(queueType);
-
-                {
-                    auto commandRecorder = commandBufferToRecord->Begin();
-                    for (auto* pass : passes) {
-                        if (culledPasses.contains(pass)) {
-                            continue;
-                        }
+            for (const auto& [queueType, commandBuffers] : commandBuffersMap) {
+                auto& semaphoreToSignal = semaphoreMap.emplace(queueType, isLastAsyncTimeline ? nullptr : device.CreateSemaphore()).first->second;
+                auto [rhiQueueType, rhiQueueIndex] = Internal::GetRHIQueueTypeAndIndex(queueType);
+                auto* queue = device.GetQueue(rhiQueueType, rhiQueueIndex);
 
-                        if (pass->type == RGPassType::copy) {
-                            ExecuteCopyPass(*commandRecorder, static_cast<RGCopyPass*>(pass));
-                        } else if (pass->type == RGPassType::compute) {
-                            ExecuteComputePass(*commandRecorder, static_cast<RGComputePass*>(pass));
-                        } else if (pass->type == RGPassType::raster) {
-                            ExecuteRasterPass(*commandRecorder, static_cast<RGRasterPass*>(pass));
+                // submissions to one queue execute in order, so only the first batch waits and only the last signals
+                for (auto i = 0; i < commandBuffers.size(); i++) {
+                    auto submitInfo = RHI::QueueSubmitInfo();
+                    if (i == 0) {
+                        submitInfo.SetWaitSemaphores(semaphoresToWait);
+                    }
+                    if (i + 1 == commandBuffers.size()) {
+                        if (isLastAsyncTimeline) {
+                            // if is last async timeline, need notify all commands inside build has been executed
+                            for (auto* finalSignalSemaphore : inExecuteInfo.semaphoresToSignal) {
+                                submitInfo.AddSignalSemaphore(finalSignalSemaphore);
+                            }
                         } else {
-                            Unimplement();
+                            // if within the builder, just wait last async timeline commands executed
+                            submitInfo.AddSignalSemaphore(semaphoreToSignal.Get());
+                        }
+                        if (queueType == RGQueueType::main && isLastAsyncTimeline && inExecuteInfo.inFenceToSignal != nullptr) {
+                            // if is last async timeline, also need signal fence to notify CPU if needed
+                            submitInfo.SetSignalFence(inExecuteInfo.inFenceToSignal);
                         }
                     }
-                    commandRecorder->End();
-                }
-
-                auto [rhiQueueType, rhiQueueIndex] = Internal::GetRHIQueueTypeAndIndex(queueType);
-                auto submitInfo = RHI::QueueSubmitInfo()
-                    .SetWaitSemaphores(semaphoresToWait);
-                if (isLastAsyncTimeline) {
-                    // if is last async timeline, need notify all commands inside build has been executed
-                    for (auto* finalSignalSemaphore : inExecuteInfo.semaphoresToSignal) {
-                        submitInfo.AddSignalSemaphore(finalSignalSemaphore);
-                    }
-                } else {
-                    // if within the builder, just wait last async timeline commands executed
-                    submitInfo.AddSignalSemaphore(semaphoreToSignal.Get());
-                }
-                if (queueType == RGQueueType::main && isLastAsyncTimeline && inExecuteInfo.inFenceToSignal != nullptr) {
-                    // if is last async timeline, also need signal fence to notify CPU if needed
-                    submitInfo.SetSignalFence(inExecuteInfo.inFenceToSignal);
+                    queue->Submit(commandBuffers[i].Get(), submitInfo);
                 }
-
-                device
-                    .GetQueue(rhiQueueType, rhiQueueIndex)
-                    ->Submit(commandBufferToRecord.Get(), submitInfo);
             }
         }
     }
@@ -653,11 +714,11 @@ namespace Render {
     void RGBuilder::CompilePassReadWrites() // NOLINT
     {
         for (const auto& pass : passes) {
-            auto* passRef = pass.Get();
+            auto* passRef = pass.get();
             Assert(!passReadsMap.contains(passRef));
             Assert(!passWritesMap.contains(passRef));
-            passReadsMap.emplace(std::make_pair(passRef, std::unordered_set<RGResourceRef> {}));
-            passWritesMap.emplace(std::make_pair(passRef, std::unordered_set<RGResourceRef> {}));
+            passReadsMap.emplace(passRef, ResourceSet(arena));
+            passWritesMap.emplace(passRef, ResourceSet(arena));
             auto& passReads = passReadsMap.at(passRef);
             auto& passWrites = passWritesMap.at(passRef);
 
@@ -693,10 +754,10 @@ namespace Render {
         }
 
         for (const auto& resource : resources) {
-            resourceReadCounts[resource.Get()] = resource->forceUsed || resource->imported ? 1 : 0;
+            resourceReadCounts[resource.get()] = resource->forceUsed || resource->imported ? 1 : 0;
         }
         for (const auto& pass : passes) {
-            for (auto* read : passReadsMap.at(pass.Get())) {
+            for (auto* read : passReadsMap.at(pass.get())) {
                 resourceReadCounts[read]++;
             }
         }
@@ -706,8 +767,10 @@ namespace Render {
     {
         auto collectQueueReadWrites = [this](const std::vector<RGPassRef>& passes, std::unordered_set<RGResourceRef>& outReads, std::unordered_set<RGResourceRef>& outWrites) -> void {
             for (auto* pass : passes) {
-                Common::SetUtils::GetUnionInplace(outReads, passReadsMap.at(pass));
-                Common::SetUtils::GetUnionInplace(outWrites, passWritesMap.at(pass));
+                const auto& passReads = passReadsMap.at(pass);
+                const auto& passWrites = passWritesMap.at(pass);
+                outReads.insert(passReads.begin(), passReads.end());
+                outWrites.insert(passWrites.begin(), passWrites.end());
             }
         };
 
@@ -744,7 +807,7 @@ namespace Render {
     {
         // initial cull
         for (const auto& resource : resources) {
-            if (auto* resourceRef = resource.Get();
+            if (auto* resourceRef = resource.get();
                 resourceReadCounts.at(resourceRef) == 0) {
                 culledResources.emplace(resourceRef);
             }
@@ -752,7 +815,7 @@ namespace Render {
 
         // iterative cull
         for (auto riter = passes.rbegin(); riter != passes.rend(); ++riter) {
-            const auto& pass = riter->Get();
+            const auto& pass = riter->get();
             const auto& passWrites = passWritesMap.at(pass);
 
             bool allWritesCulled = true;
@@ -777,14 +840,117 @@ namespace Render {
         }
     }
 
+    void RGBuilder::PlanTransientAliasing()
+    {
+        // passes of an async timeline which runs on several queues may execute at the same time, so they all share
+        // the steps of the timeline
+        Common::FrameUnorderedMap<RGPassRef, std::pair<uint32_t, uint32_t>> passSteps(arena);
+        uint32_t timelineBegin = 0;
+        for (const auto& queuePasses : asyncTimelines) {
+            uint32_t timelineEnd = timelineBegin;
+            for (const auto& queuePassList : queuePasses | std::views::values) {
+                uint32_t step = timelineBegin;
+                for (auto* pass : queuePassList) {
+                    if (!culledPasses.contains(pass)) {
+                        passSteps[pass] = { step, step };
+                        step++;
+                    }
+                }
+                timelineEnd = std::max(timelineEnd, step);
+            }
+            if (queuePasses.size() > 1 && timelineEnd > timelineBegin) {
+                for (const auto& queuePassList : queuePasses | std::views::values) {
+                    for (auto* pass : queuePassList) {
+                        if (passSteps.contains(pass)) {
+                            passSteps[pass] = { timelineBegin, timelineEnd - 1 };
+                        }
+                    }
+                }
+            }
+            timelineBegin = timelineEnd;
+        }
+
+        Common::FrameUnorderedMap<RGResourceRef, std::pair<uint32_t, uint32_t>> lifetimes(arena);
+        auto extendLifetime = [&](RGResourceRef inResource, const std::pair<uint32_t, uint32_t>& inSteps) -> void {
+            if (const auto iter = lifetimes.find(inResource); iter != lifetimes.end()) {
+                iter->second.first = std::min(iter->second.first, inSteps.first);
+                iter->second.second = std::max(iter->second.second, inSteps.second);
+            } else {
+                lifetimes.emplace(inResource, inSteps);
+            }
+        };
+        for (const auto& [pass, steps] : passSteps) {
+            for (auto* read : passReadsMap.at(pass)) {
+                extendLifetime(read, steps);
+            }
+            for (auto* write : passWritesMap.at(pass)) {
+                extendLifetime(write, steps);
+            }
+        }
+
+        // resources visible outside the graph or written by the host keep their own memory, so do the ones sharing no
+        // memory type with the earlier ones, requests follow the creation order so a steady graph gets the same
+        // placements every frame
+        auto& transientHeap = TransientHeap::Get(device);
+        std::vector<RGResourceRef> candidates;
+        std::vector<TransientAllocationRequest> requests;
+        uint32_t memoryTypeBits = UINT32_MAX;
+        for (const auto& resource : resources) {
+            auto* resourceRef = resource.get();
+            const auto iter = lifetimes.find(resourceRef);
+            if (resourceRef->imported || resourceRef->forceUsed || culledResources.contains(resourceRef) || iter == lifetimes.end()) {
+                continue;
+            }
+
+            RHI::ResourceAllocationInfo allocationInfo {};
+            if (resourceRef->type == RGResType::buffer) {
+                auto* buffer = static_cast<RGBufferRef>(resourceRef);
+                if (bufferUploads.contains(buffer) || buffer->desc.usages & (RHI::BufferUsageBits::mapRead | RHI::BufferUsageBits::mapWrite)) {
+                    continue;
+                }
+                allocationInfo = transientHeap.GetAllocationInfo(buffer->desc);
+            } else if (resourceRef->type == RGResType::texture) {
+                allocationInfo = transientHeap.GetAllocationInfo(static_cast<RGTextureRef>(resourceRef)->desc);
+            } else {
+                Unimplement();
+            }
+            if ((memoryTypeBits & allocationInfo.memoryTypeBits) == 0) {
+                continue;
+            }
+            memoryTypeBits &= allocationInfo.memoryTypeBits;
+            candidates.emplace_back(resourceRef);
+            requests.emplace_back(TransientAllocationRequest { allocationInfo, iter->second.first, iter->second.second });
+        }
+        if (requests.empty()) {
+            return;
+        }
+
+        const auto plan = PlanTransientAllocations(requests);
+        transientRange = transientHeap.AllocateRange(plan);
+        for (auto i = 0; i < candidates.size(); i++) {
+            transientOffsets.emplace(candidates[i], plan.placements[i].offset);
+            if (plan.placements[i].aliased) {
+                pendingAliasingBarriers.emplace(candidates[i]);
+            }
+        }
+    }
+
     void RGBuilder::ComputeResourcesInitialState()
     {
         for (const auto& resource : resources) {
-            auto* resourceRef = resource.Get();
+            auto* resourceRef = resource.get();
             if (culledResources.contains(resourceRef)) {
                 continue;
             }
 
+            // contents of a placed resource are undefined at the beginning of each graph
+            if (transientOffsets.contains(resourceRef)) {
+                resourceStates[resourceRef] = resourceRef->type == RGResType::buffer
+                    ? std::variant<RHI::BufferState, RHI::TextureState>(RHI::BufferState::undefined)
+                    : std::variant<RHI::BufferState, RHI::TextureState>(RHI::TextureState::undefined);
+                continue;
+            }
+
             if (resourceRef->type == RGResType::buffer) {
                 resourceStates[resourceRef] = static_cast<RGBufferRef>(resourceRef)->desc.initialState;
             } else if (resourceRef->type == RGResType::texture) {
@@ -795,73 +961,149 @@ namespace Render {
         }
     }
 
-    void RGBuilder::ExecuteCopyPass(RHI::CommandRecorder& inRecoder, RGCopyPass* inCopyPass)
+    void RGBuilder::PreparePass(RGPassRef inPass)
     {
-        RHI_SCOPED_MARKER(inRecoder, inCopyPass->name);
+        passBarriers.emplace(inPass, BarrierList(arena));
+        if (inPass->type == RGPassType::copy) {
+            PrepareCopyPass(static_cast<RGCopyPass*>(inPass));
+        } else if (inPass->type == RGPassType::compute) {
+            PrepareComputePass(static_cast<RGComputePass*>(inPass));
+        } else if (inPass->type == RGPassType::raster) {
+            PrepareRasterPass(static_cast<RGRasterPass*>(inPass));
+        } else {
+            Unimplement();
+        }
+    }
+
+    void RGBuilder::PrepareCopyPass(RGCopyPass* inCopyPass)
+    {
+        auto& barriers = passBarriers.at(inCopyPass);
         DevirtualizeResources(passWritesMap.at(inCopyPass));
-        {
-            TransitionResourcesForCopyPassDesc(inRecoder, inCopyPass->passDesc);
-            if (inCopyPass->prePassFunc) {
-                inCopyPass->prePassFunc(*this, inRecoder);
-            }
-            {
-                const auto copyPassRecoder = inRecoder.BeginCopyPass();
-                inCopyPass->passFunc(*this, *copyPassRecoder);
-                copyPassRecoder->EndPass();
+        AliasResources(barriers, passWritesMap.at(inCopyPass));
+        TransitionResourcesForCopyPassDesc(barriers, inCopyPass->passDesc);
+    }
+
+    void RGBuilder::PrepareComputePass(RGComputePass* inComputePass)
+    {
+        auto& barriers = passBarriers.at(inComputePass);
+        DevirtualizeResources(passWritesMap.at(inComputePass));
+        AliasResources(barriers, passWritesMap.at(inComputePass));
+        DevirtualizeBindGroupsAndViews(inComputePass->bindGroups);
+        TransitionResourcesForBindGroups(barriers, inComputePass->bindGroups);
+    }
+
+    void RGBuilder::PrepareRasterPass(RGRasterPass* inRasterPass)
+    {
+        auto& barriers = passBarriers.at(inRasterPass);
+        DevirtualizeResources(passWritesMap.at(inRasterPass));
+        AliasResources(barriers, passWritesMap.at(inRasterPass));
+        DevirtualizeAttachmentViews(inRasterPass->passDesc);
+        DevirtualizeBindGroupsAndViews(inRasterPass->bindGroups);
+        TransitionResourcesForBindGroups(barriers, inRasterPass->bindGroups);
+        TransitionResourcesForRasterPassDesc(barriers, inRasterPass->passDesc);
+    }
+
+    void RGBuilder::RecordPassBatches(std::vector<PassRecordBatch>& inBatches) const
+    {
+        const auto recordBatch = [&](size_t inIndex) -> void {
+            auto& [batchPasses, commandBuffer] = inBatches[inIndex];
+            *commandBuffer = device.CreateCommandBuffer();
+
+            const auto commandRecorder = (*commandBuffer)->Begin();
+            for (auto* pass : batchPasses) {
+                RecordPass(*commandRecorder, pass);
             }
-            if (inCopyPass->postPassFunc) {
-                inCopyPass->postPassFunc(*this, inRecoder);
+            commandRecorder->End();
+        };
+
+        if (inBatches.size() > 1 && RenderWorkerThreads::Get().Started()) {
+            RenderWorkerThreads::Get().ExecuteTasks(inBatches.size(), recordBatch);
+        } else {
+            for (size_t i = 0; i < inBatches.size(); i++) {
+                recordBatch(i);
             }
         }
-        FinalizePassResources(passReadsMap.at(inCopyPass));
     }
 
-    void RGBuilder::ExecuteComputePass(RHI::CommandRecorder& inRecoder, RGComputePass* inComputePass)
+    void RGBuilder::RecordPass(RHI::CommandRecorder& inRecoder, RGPassRef inPass) const
+    {
+        if (inPass->type == RGPassType::copy) {
+            RecordCopyPass(inRecoder, static_cast<RGCopyPass*>(inPass));
+        } else if (inPass->type == RGPassType::compute) {
+            RecordComputePass(inRecoder, static_cast<RGComputePass*>(inPass));
+        } else if (inPass->type == RGPassType::raster) {
+            RecordRasterPass(inRecoder, static_cast<RGRasterPass*>(inPass));
+        } else {
+            Unimplement();
+        }
+    }
+
+    void RGBuilder::RecordCopyPass(RHI::CommandRecorder& inRecoder, RGCopyPass* inCopyPass) const
+    {
+        RHI_SCOPED_MARKER(inRecoder, inCopyPass->name);
+        RecordPassBarriers(inRecoder, inCopyPass);
+        if (inCopyPass->prePassFunc) {
+            inCopyPass->prePassFunc(*this, inRecoder);
+        }
+        {
+            const auto copyPassRecoder = inRecoder.BeginCopyPass();
+            inCopyPass->passFunc(*this, *copyPassRecoder);
+            copyPassRecoder->EndPass();
+        }
+        if (inCopyPass->postPassFunc) {
+            inCopyPass->postPassFunc(*this, inRecoder);
+        }
+    }
+
+    void RGBuilder::RecordComputePass(RHI::CommandRecorder& inRecoder, RGComputePass* inComputePass) const
     {
         RHI_SCOPED_MARKER(inRecoder, inComputePass->name);
-        DevirtualizeResources(passWritesMap.at(inComputePass));
-        DevirtualizeBindGroupsAndViews(inComputePass->bindGroups);
+        RecordPassBarriers(inRecoder, inComputePass);
+        if (inComputePass->prePassFunc) {
+            inComputePass->prePassFunc(*this, inRecoder);
+        }
         {
-            TransitionResourcesForBindGroups(inRecoder, inComputePass->bindGroups);
-            if (inComputePass->prePassFunc) {
-                inComputePass->prePassFunc(*this, inRecoder);
-            }
-            {
-                const auto computePassRecoder = inRecoder.BeginComputePass();
-                inComputePass->passFunc(*this, *computePassRecoder);
-                computePassRecoder->EndPass();
-            }
-            if (inComputePass->postPassFunc) {
-                inComputePass->postPassFunc(*this, inRecoder);
-            }
+            const auto computePassRecoder = inRecoder.BeginComputePass();
+            inComputePass->passFunc(*this, *computePassRecoder);
+            computePassRecoder->EndPass();
+        }
+        if (inComputePass->postPassFunc) {
+            inComputePass->postPassFunc(*this, inRecoder);
         }
-        FinalizePassResources(passReadsMap.at(inComputePass));
-        FinalizePassBindGroups(inComputePass->bindGroups);
     }
 
-    void RGBuilder::ExecuteRasterPass(RHI::CommandRecorder& inRecoder, RGRasterPass* inRasterPass)
+    void RGBuilder::RecordRasterPass(RHI::CommandRecorder& inRecoder, RGRasterPass* inRasterPass) const
     {
         RHI_SCOPED_MARKER(inRecoder, inRasterPass->name);
-        DevirtualizeResources(passWritesMap.at(inRasterPass));
-        DevirtualizeAttachmentViews(inRasterPass->passDesc);
-        DevirtualizeBindGroupsAndViews(inRasterPass->bindGroups);
+        RecordPassBarriers(inRecoder, inRasterPass);
+        if (inRasterPass->prePassFunc) {
+            inRasterPass->prePassFunc(*this, inRecoder);
+        }
         {
-            TransitionResourcesForBindGroups(inRecoder, inRasterPass->bindGroups);
-            TransitionResourcesForRasterPassDesc(inRecoder, inRasterPass->passDesc);
-            if (inRasterPass->prePassFunc) {
-                inRasterPass->prePassFunc(*this, inRecoder);
-            }
-            {
-                const auto rasterPassRecoder = inRecoder.BeginRasterPass(Internal::GetRHIRasterPassBeginInfo(*this, inRasterPass->passDesc));
-                inRasterPass->passFunc(*this, *rasterPassRecoder);
-                rasterPassRecoder->EndPass();
-            }
-            if (inRasterPass->postPassFunc) {
-                inRasterPass->postPassFunc(*this, inRecoder);
-            }
+            const auto rasterPassRecoder = inRecoder.BeginRasterPass(Internal::GetRHIRasterPassBeginInfo(*this, inRasterPass->passDesc));
+            inRasterPass->passFunc(*this, *rasterPassRecoder);
+            rasterPassRecoder->EndPass();
+        }
+        if (inRasterPass->postPassFunc) {
+            inRasterPass->postPassFunc(*this, inRecoder);
+        }
+    }
+
+    void RGBuilder::RecordPassBarriers(RHI::CommandRecorder& inRecoder, RGPassRef inPass) const
+    {
+        for (const auto& barrier : passBarriers.at(inPass)) {
+            inRecoder.ResourceBarrier(barrier);
+        }
+    }
+
+    void RGBuilder::FinalizePass(RGPassRef inPass)
+    {
+        FinalizePassResources(passReadsMap.at(inPass));
+        if (inPass->type == RGPassType::compute) {
+            FinalizePassBindGroups(static_cast<RGComputePass*>(inPass)->bindGroups);
+        } else if (inPass->type == RGPassType::raster) {
+            FinalizePassBindGroups(static_cast<RGRasterPass*>(inPass)->bindGroups);
         }
-        FinalizePassResources(passReadsMap.at(inRasterPass));
-        FinalizePassBindGroups(inRasterPass->bindGroups);
     }
 
     void RGBuilder::PerformBufferUploads()
@@ -909,7 +1151,7 @@ namespace Render {
                 continue;
             }
 
-            if (auto* viewRef = view.Get();
+            if (auto* viewRef = view.get();
                 viewRef->Type() == RGResViewType::bufferView) {
                 const auto* bufferView = static_cast<RGBufferViewRef>(viewRef);
                 auto* buffer = bufferView->GetBuffer();
@@ -932,6 +1174,27 @@ namespace Render {
             return;
         }
 
+        if (const auto iter = transientOffsets.find(inResource); iter != transientOffsets.end()) {
+            // resources are devirtualized in pass order, so the heap also sees memory last used by an earlier graph
+            auto& transientHeap = TransientHeap::Get(device);
+            bool aliased = false;
+            if (inResource->type == RGResType::buffer) {
+                auto desc = static_cast<RGBufferRef>(inResource)->desc;
+                desc.initialState = RHI::BufferState::undefined;
+                devirtualizedResources.emplace(std::make_pair(inResource, transientHeap.AllocateBuffer(transientRange, iter->second, desc, aliased)));
+            } else if (inResource->type == RGResType::texture) {
+                auto desc = static_cast<RGTextureRef>(inResource)->desc;
+                desc.initialState = RHI::TextureState::undefined;
+                devirtualizedResources.emplace(std::make_pair(inResource, transientHeap.AllocateTexture(transientRange, iter->second, desc, aliased)));
+            } else {
+                Unimplement();
+            }
+            if (aliased) {
+                pendingAliasingBarriers.emplace(inResource);
+            }
+            return;
+        }
+
         if (inResource->type == RGResType::buffer) {
             devirtualizedResources.emplace(std::make_pair(inResource, BufferPool::Get(device).Allocate(static_cast<RGBufferRef>(inResource)->desc)));
         } else if (inResource->type == RGResType::texture) {
@@ -941,13 +1204,29 @@ namespace Render {
         }
     }
 
-    void RGBuilder::DevirtualizeResources(const std::unordered_set<RGResourceRef>& inResources)
+    void RGBuilder::DevirtualizeResources(const ResourceSet& inResources)
     {
         for (auto* resource : inResources) {
             DevirtualizeResource(resource);
         }
     }
 
+    void RGBuilder::AliasResources(BarrierList& outBarriers, const ResourceSet& inResources)
+    {
+        for (auto* resource : inResources) {
+            if (!pendingAliasingBarriers.erase(resource)) {
+                continue;
+            }
+            if (resource->type == RGResType::buffer) {
+                outBarriers.emplace_back(RHI::Barrier::Aliasing(GetRHI(static_cast<RGBufferRef>(resource))));
+            } else if (resource->type == RGResType::texture) {
+                outBarriers.emplace_back(RHI::Barrier::Aliasing(GetRHI(static_cast<RGTextureRef>(resource))));
+            } else {
+                Unimplement();
+            }
+        }
+    }
+
     void RGBuilder::DevirtualizeBindGroupsAndViews(const std::vector<RGBindGroupRef>& inBindGroups)
     {
         for (auto* bindGroup : inBindGroups) {
@@ -997,15 +1276,23 @@ namespace Render {
         }
     }
 
-    void RGBuilder::FinalizePassResources(const std::unordered_set<RGResourceRef>& inResources)
+    void RGBuilder::FinalizePassResources(const ResourceSet& inResources)
     {
         for (auto* resource : inResources) {
             if (auto& readCount = resourceReadCounts.at(resource);
                 --readCount == 0) {
+                // placed resources stay with the transient heap, their memory is taken over by later resources
+                if (transientOffsets.contains(resource)) {
+                    devirtualizedResources.erase(resource);
+                    continue;
+                }
+                // hand the pooled resource back explicitly, so the pool can put it onto its free list, its views stay
+                // cached for the next frames and are dropped by the pool when the resource is evicted
+                auto& devirtualized = devirtualizedResources.at(resource);
                 if (resource->type == RGResType::buffer) {
-                    ResourceViewCache::Get(device).Invalidate(std::get<PooledBufferRef>(devirtualizedResources.at(resource))->GetRHI());
+                    BufferPool::Get(device).Release(std::move(std::get<PooledBufferRef>(devirtualized)));
                 } else if (resource->type == RGResType::texture) {
-                    ResourceViewCache::Get(device).Invalidate(std::get<PooledTextureRef>(devirtualizedResources.at(resource))->GetRHI());
+                    TexturePool::Get(device).Release(std::move(std::get<PooledTextureRef>(devirtualized)));
                 } else {
                     Unimplement();
                 }
@@ -1021,55 +1308,55 @@ namespace Render {
         }
     }
 
-    void RGBuilder::TransitionResourcesForCopyPassDesc(RHI::CommonCommandRecorder& inRecoder, const RGCopyPassDesc& inDesc)
+    void RGBuilder::TransitionResourcesForCopyPassDesc(BarrierList& outBarriers, const RGCopyPassDesc& inDesc)
     {
         for (auto* copySrc : inDesc.copySrcs) {
             if (copySrc->type == RGResType::buffer) {
-                TransitionBuffer(inRecoder, static_cast<RGBufferRef>(copySrc), RHI::BufferState::copySrc);
+                TransitionBuffer(outBarriers, static_cast<RGBufferRef>(copySrc), RHI::BufferState::copySrc);
             } else if (copySrc->type == RGResType::texture) {
-                TransitionTexture(inRecoder, static_cast<RGTextureRef>(copySrc), RHI::TextureState::copySrc);
+                TransitionTexture(outBarriers, static_cast<RGTextureRef>(copySrc), RHI::TextureState::copySrc);
             } else {
                 Unimplement();
             }
         }
         for (auto* copyDst : inDesc.copyDsts) {
             if (copyDst->type == RGResType::buffer) {
-                TransitionBuffer(inRecoder, static_cast<RGBufferRef>(copyDst), RHI::BufferState::copyDst);
+                TransitionBuffer(outBarriers, static_cast<RGBufferRef>(copyDst), RHI::BufferState::copyDst);
             } else if (copyDst->type == RGResType::texture) {
-                TransitionTexture(inRecoder, static_cast<RGTextureRef>(copyDst), RHI::TextureState::copyDst);
+                TransitionTexture(outBarriers, static_cast<RGTextureRef>(copyDst), RHI::TextureState::copyDst);
             } else {
                 Unimplement();
             }
         }
     }
 
-    void RGBuilder::TransitionResourcesForRasterPassDesc(RHI::CommonCommandRecorder& inRecoder, const RGRasterPassDesc& inDesc)
+    void RGBuilder::TransitionResourcesForRasterPassDesc(BarrierList& outBarriers, const RGRasterPassDesc& inDesc)
     {
         if (inDesc.depthStencilAttachment.has_value()) {
             const auto& dsa = inDesc.depthStencilAttachment.value();
-            TransitionTexture(inRecoder, dsa.view->GetTexture(), dsa.depthReadOnly ? RHI::TextureState::depthStencilReadonly : RHI::TextureState::depthStencilWrite);
+            TransitionTexture(outBarriers, dsa.view->GetTexture(), dsa.depthReadOnly ? RHI::TextureState::depthStencilReadonly : RHI::TextureState::depthStencilWrite);
         }
         for (const auto& ca : inDesc.colorAttachments) {
-            TransitionTexture(inRecoder, ca.view->GetTexture(), RHI::TextureState::renderTarget);
+            TransitionTexture(outBarriers, ca.view->GetTexture(), RHI::TextureState::renderTarget);
         }
     }
 
-    void RGBuilder::TransitionResourcesForBindGroups(RHI::CommonCommandRecorder& inRecoder, const std::vector<RGBindGroupRef>& inBindGroups)
+    void RGBuilder::TransitionResourcesForBindGroups(BarrierList& outBarriers, const std::vector<RGBindGroupRef>& inBindGroups)
     {
         for (auto* bindGroup : inBindGroups) {
             for (const auto& [type, view] : bindGroup->desc.items | std::views::values) {
                 if (type == RHI::BindingType::uniformBuffer) {
-                    TransitionBuffer(inRecoder, std::get<RGBufferViewRef>(view)->GetBuffer(), RHI::BufferState::shaderReadOnly);
+                    TransitionBuffer(outBarriers, std::get<RGBufferViewRef>(view)->GetBuffer(), RHI::BufferState::shaderReadOnly);
                 } else if (type == RHI::BindingType::storageBuffer) {
-                    TransitionBuffer(inRecoder, std::get<RGBufferViewRef>(view)->GetBuffer(), RHI::BufferState::storage);
+                    TransitionBuffer(outBarriers, std::get<RGBufferViewRef>(view)->GetBuffer(), RHI::BufferState::storage);
                 } else if (type == RHI::BindingType::rwStorageBuffer) {
-                    TransitionBuffer(inRecoder, std::get<RGBufferViewRef>(view)->GetBuffer(), RHI::BufferState::rwStorage);
+                    TransitionBuffer(outBarriers, std::get<RGBufferViewRef>(view)->GetBuffer(), RHI::BufferState::rwStorage);
                 } else if (type == RHI::BindingType::texture) {
-                    TransitionTexture(inRecoder, std::get<RGTextureViewRef>(view)->GetTexture(), RHI::TextureState::shaderReadOnly);
+                    TransitionTexture(outBarriers, std::get<RGTextureViewRef>(view)->GetTexture(), RHI::TextureState::shaderReadOnly);
                 } else if (type == RHI::BindingType::storageTexture) {
-                    TransitionTexture(inRecoder, std::get<RGTextureViewRef>(view)->GetTexture(), RHI::TextureState::storage);
+                    TransitionTexture(outBarriers, std::get<RGTextureViewRef>(view)->GetTexture(), RHI::TextureState::storage);
                 } else if (type == RHI::BindingType::rwStorageTexture) {
-                    TransitionTexture(inRecoder, std::get<RGTextureViewRef>(view)->GetTexture(), RHI::TextureState::rwStorage);
+                    TransitionTexture(outBarriers, std::get<RGTextureViewRef>(view)->GetTexture(), RHI::TextureState::rwStorage);
                 } else if (type == RHI::BindingType::sampler) {} else {
                     Unimplement();
                 }
@@ -1077,23 +1364,23 @@ namespace Render {
         }
     }
 
-    void RGBuilder::TransitionBuffer(RHI::CommonCommandRecorder& inRecoder, RGBufferRef inBuffer, RHI::BufferState inState)
+    void RGBuilder::TransitionBuffer(BarrierList& outBarriers, RGBufferRef inBuffer, RHI::BufferState inState)
     {
         auto& currentState = std::get<RHI::BufferState>(resourceStates.at(inBuffer));
         if (currentState == inState) {
             return;
         }
-        inRecoder.ResourceBarrier(RHI::Barrier::Transition(GetRHI(inBuffer), currentState, inState));
+        outBarriers.emplace_back(RHI::Barrier::Transition(GetRHI(inBuffer), currentState, inState));
         currentState = inState;
     }
 
-    void RGBuilder::TransitionTexture(RHI::CommonCommandRecorder& inRecoder, RGTextureRef inTexture, RHI::TextureState inState)
+    void RGBuilder::TransitionTexture(BarrierList& outBarriers, RGTextureRef inTexture, RHI::TextureState inState)
     {
         auto& currentState = std::get<RHI::TextureState>(resourceStates.at(inTexture));
         if (currentState == inState) {
             return;
         }
-        inRecoder.ResourceBarrier(RHI::Barrier::Transition(GetRHI(inTexture), currentState, inState));
+        outBarriers.emplace_back(RHI::Barrier::Transition(GetRHI(inTexture), currentState, inState));
         currentState = inState;
     }
 }
@@ -19,12 +19,16 @@ namespace Render {
     {
         Assert(thread == nullptr);
         thread = Common::MakeUnique<Common::WorkerThread>("RenderingThread");
-        thread->EmplaceTask([]() -> void { Core::ThreadContext::SetTag(Core::ThreadTag::render); });
+        thread->Spawn([]() -> void { Core::ThreadContext::SetTag(Core::ThreadTag::render); });
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::render, [](Common::TaskFunction&& inTask) -> void {
+            Get().Spawn(std::move(inTask));
+        });
     }
 
     void RenderThread::Stop()
     {
         Assert(thread != nullptr);
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::render, nullptr);
         thread = nullptr;
     }
 
@@ -48,11 +52,20 @@ namespace Render {
     {
         Assert(threads == nullptr);
         threads = Common::MakeUnique<Common::ThreadPool>("RenderWorkers", 8);
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::renderWorker, [](Common::TaskFunction&& inTask) -> void {
+            Get().Spawn(std::move(inTask));
+        });
     }
 
     void RenderWorkerThreads::Stop()
     {
         Assert(threads != nullptr);
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::renderWorker, nullptr);
         threads = nullptr;
     }
+
+    bool RenderWorkerThreads::Started() const
+    {
+        return threads != nullptr;
+    }
 }
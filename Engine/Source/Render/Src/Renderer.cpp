@@ -2,24 +2,28 @@
 // Created by johnk on 2022/8/3.
 //
 
-#include <format>
+#include <algorithm>
+#include <optional>
 
+#include <Common/Math/Frustum.h>
+#include <Render/GpuScene.h>
+#include <Render/Instancing.h>
 #include <Render/MeshRenderData.h>
 #include <Render/RenderCache.h>
 #include <Render/Renderer.h>
 #include <Render/SceneProxy/Primitive.h>
+#include <Render/RenderThread.h>
 #include <Render/Shader.h>
+#include <Render/UniformRingBuffer.h>
+#include <Core/Thread.h>
 
 namespace Render::Internal {
     const Common::LinearColor surfaceClearColor = { 0.1f, 0.1f, 0.12f, 1.0f };
 
-    struct ALIGN_AS_GPU BasePassVsUniform {
-        Common::FMat4x4 localToWorld;
+    struct ALIGN_AS_GPU BasePassViewUniform {
         Common::FMat4x4 worldToClip;
-    };
-
-    struct ALIGN_AS_GPU BasePassPsUniform {
-        Common::FVec4 baseColor;
+        // BasePassVS reads the instances [firstInstance, firstInstance + instance count) of the instance buffer
+        uint32_t firstInstance;
     };
 
     struct BasePassDraw {
@@ -29,8 +33,48 @@ namespace Render::Internal {
         RGBufferViewRef vertexBufferView;
         RGBufferViewRef indexBufferView;
         uint32_t indexCount;
+        uint32_t firstInstance;
+        uint32_t instanceCount;
     };
 
+    // bounds tested by one cull task, small enough that a view splits across the render workers
+    constexpr size_t cullGrainSize = 1024;
+    // draws recorded by one base pass, the graph records passes on the render workers, so big scenes are split into
+    // several passes continuing on the same attachments
+    constexpr size_t basePassDrawChunkSize = 512;
+
+    // fills view major visibilities (outVisibilities[viewIndex * inBoundNum + boundIndex]), each task culls one chunk of
+    // bounds against one view, on the render workers when they are running
+    static void CullViews(std::span<const Common::FMat4x4> inWorldToClips, const Common::FBox* inBounds, size_t inBoundNum, uint8_t* outVisibilities, Common::FrameArena* inArena)
+    {
+        if (inWorldToClips.empty() || inBoundNum == 0) {
+            return;
+        }
+
+        Common::FrameVector<Common::FFrustum> frustums(inArena);
+        frustums.reserve(inWorldToClips.size());
+        for (const auto& worldToClip : inWorldToClips) {
+            frustums.emplace_back(Common::FFrustum::FromWorldToClip(worldToClip));
+        }
+
+        const size_t chunkNum = (inBoundNum + cullGrainSize - 1) / cullGrainSize;
+        const size_t taskNum = inWorldToClips.size() * chunkNum;
+        const auto cullTask = [&](size_t inTaskIndex) -> void {
+            const size_t viewIndex = inTaskIndex / chunkNum;
+            const size_t begin = inTaskIndex % chunkNum * cullGrainSize;
+            const size_t num = std::min(cullGrainSize, inBoundNum - begin);
+            frustums[viewIndex].IntersectBoxes(inBounds + begin, num, outVisibilities + viewIndex * inBoundNum + begin);
+        };
+
+        if (taskNum > 1 && RenderWorkerThreads::Get().Started()) {
+            RenderWorkerThreads::Get().ExecuteTasks(taskNum, cullTask);
+        } else {
+            for (size_t i = 0; i < taskNum; i++) {
+                cullTask(i);
+            }
+        }
+    }
+
     static RVertexState BuildVertexState(const VertexFactoryType& inVertexFactoryType)
     {
         RVertexBufferLayout layout(RHI::VertexStepMode::perVertex, MeshRenderData::vertexStride);
@@ -88,12 +132,21 @@ namespace Render {
         depthTexture->MaskAsUsed();
         auto* depthTextureView = rgBuilder.CreateTextureView(depthTexture, RGTextureViewDesc(RHI::TextureViewType::depthStencil, RHI::TextureViewDimension::tv2D, RHI::TextureAspect::depth));
 
-        std::vector<Internal::BasePassDraw> draws;
-        std::vector<RGBindGroupRef> passBindGroups;
+        auto* arena = Core::ThreadContext::CurrentFrameArena();
+        Common::FrameVector<Internal::BasePassDraw> draws(arena);
+        Common::FrameVector<StaticMeshDrawBucket> buckets(arena);
+        Common::FrameVector<uint32_t> instanceSlots(arena);
+        Common::FrameVector<Common::FMat4x4> worldToClips(arena);
+        worldToClips.reserve(views.size());
+        for (const auto& view : views) {
+            worldToClips.emplace_back(view.data.projectionMatrix * view.data.viewMatrix);
+        }
+
         if (scene != nullptr) {
             ShaderMap& shaderMap = ShaderMap::Get(*device);
-            size_t drawIndex = 0;
 
+            Common::FrameVector<const StaticPrimitiveSceneProxy*> primitives(arena);
+            Common::FrameVector<Common::FBox> primitiveBounds(arena);
             for (const auto& [entity, proxy] : scene->All<StaticPrimitiveSceneProxy>()) {
                 if (!proxy.mesh.Valid() || proxy.vertexFactoryType == nullptr || proxy.vertexShaderType == nullptr || proxy.pixelShaderType == nullptr) {
                     continue;
@@ -102,99 +155,163 @@ namespace Render {
                 if (!shaderMap.HasShaderInstance(*proxy.vertexShaderType, {}) || !shaderMap.HasShaderInstance(*proxy.pixelShaderType, {})) {
                     continue;
                 }
+                primitives.emplace_back(&proxy);
+                primitiveBounds.emplace_back(proxy.worldBounds);
+            }
 
-                const ShaderInstance vertexShader = shaderMap.GetShaderInstance(*proxy.vertexShaderType, {});
-                const ShaderInstance pixelShader = shaderMap.GetShaderInstance(*proxy.pixelShaderType, {});
-                auto* pipeline = PipelineCache::Get(*device).GetOrCreate(
-                    RasterPipelineStateDesc()
-                        .SetVertexShader(vertexShader)
-                        .SetPixelShader(pixelShader)
-                        .SetVertexState(Internal::BuildVertexState(*proxy.vertexFactoryType))
-                        .SetPrimitiveState(RPrimitiveState().SetCullMode(RHI::CullMode::none))
-                        .SetDepthStencilState(
-                            RDepthStencilState()
-                                .SetDepthEnabled(true)
-                                .SetFormat(RHI::PixelFormat::d32Float)
-                                .SetDepthCompareFunc(RHI::CompareFunc::greaterEqual))
-                        .SetFragmentState(RFragmentState().AddColorTarget(RHI::ColorTargetState(colorFormat, RHI::ColorWriteBits::all, false))));
-
-                auto* vertexBuffer = rgBuilder.ImportBuffer(proxy.mesh->GetVertexBuffer(), RHI::BufferState::shaderReadOnly);
-                auto* vertexBufferView = rgBuilder.CreateBufferView(
-                    vertexBuffer, RGBufferViewDesc(RHI::BufferViewType::vertex, vertexBuffer->GetDesc().size, 0, RHI::VertexBufferViewInfo(MeshRenderData::vertexStride)));
-                auto* indexBuffer = rgBuilder.ImportBuffer(proxy.mesh->GetIndexBuffer(), RHI::BufferState::shaderReadOnly);
-                auto* indexBufferView = rgBuilder.CreateBufferView(
-                    indexBuffer, RGBufferViewDesc(RHI::BufferViewType::index, indexBuffer->GetDesc().size, 0, RHI::IndexBufferViewInfo(RHI::IndexFormat::uint32)));
-
-                for (size_t viewIndex = 0; viewIndex < views.size(); viewIndex++) {
-                    const View& view = views[viewIndex];
-
-                    Internal::BasePassVsUniform vsUniform {};
-                    vsUniform.localToWorld = proxy.localToWorld;
-                    vsUniform.worldToClip = view.data.projectionMatrix * view.data.viewMatrix;
-
-                    Internal::BasePassPsUniform psUniform {};
-                    psUniform.baseColor = proxy.baseColor;
-
-                    auto* vsUniformBuffer = rgBuilder.CreateBuffer(
-                        RGBufferDesc(sizeof(Internal::BasePassVsUniform), RHI::BufferUsageBits::uniform | RHI::BufferUsageBits::mapWrite, RHI::BufferState::staging, std::format("basePassVsUniform{}", drawIndex)));
-                    auto* vsUniformBufferView = rgBuilder.CreateBufferView(vsUniformBuffer, RGBufferViewDesc(RHI::BufferViewType::uniformBinding, sizeof(Internal::BasePassVsUniform)));
-                    rgBuilder.QueueBufferUpload(vsUniformBuffer, RGBufferUploadInfo(&vsUniform, sizeof(Internal::BasePassVsUniform), 0, 0, true));
-
-                    auto* psUniformBuffer = rgBuilder.CreateBuffer(
-                        RGBufferDesc(sizeof(Internal::BasePassPsUniform), RHI::BufferUsageBits::uniform | RHI::BufferUsageBits::mapWrite, RHI::BufferState::staging, std::format("basePassPsUniform{}", drawIndex)));
-                    auto* psUniformBufferView = rgBuilder.CreateBufferView(psUniformBuffer, RGBufferViewDesc(RHI::BufferViewType::uniformBinding, sizeof(Internal::BasePassPsUniform)));
-                    rgBuilder.QueueBufferUpload(psUniformBuffer, RGBufferUploadInfo(&psUniform, sizeof(Internal::BasePassPsUniform), 0, 0, true));
-
-                    auto* bindGroup = rgBuilder.AllocateBindGroup(
-                        RGBindGroupDesc::Create(pipeline->GetPipelineLayout()->GetBindGroupLayout(0))
-                            .UniformBuffer("vsUniform", vsUniformBufferView)
-                            .UniformBuffer("materialUniform", psUniformBufferView));
+            const size_t primitiveNum = primitives.size();
+            Common::FrameVector<uint8_t> visibilities(primitiveNum * views.size(), 0, arena);
+            Internal::CullViews(worldToClips, primitiveBounds.data(), primitiveNum, visibilities.data(), arena);
+
+            // visible primitives sharing mesh and shaders become one instanced draw per view, gpu scene slots of all the
+            // draws go into one structured buffer uploaded with the graph, primitive data itself stays in the gpu scene
+            Common::FrameVector<const StaticPrimitiveSceneProxy*> visiblePrimitives(arena);
+            visiblePrimitives.reserve(primitiveNum);
+            for (size_t viewIndex = 0; viewIndex < views.size(); viewIndex++) {
+                visiblePrimitives.clear();
+                for (size_t primitiveIndex = 0; primitiveIndex < primitiveNum; primitiveIndex++) {
+                    if (visibilities[viewIndex * primitiveNum + primitiveIndex] != 0) {
+                        visiblePrimitives.emplace_back(primitives[primitiveIndex]);
+                    }
+                }
+
+                const size_t firstBucket = buckets.size();
+                BuildStaticMeshDrawBuckets(visiblePrimitives, buckets, instanceSlots, arena);
+                for (size_t bucketIndex = firstBucket; bucketIndex < buckets.size(); bucketIndex++) {
+                    const auto& [primitive, firstInstance, instanceNum] = buckets[bucketIndex];
+                    const StaticPrimitiveSceneProxy& proxy = *primitive;
+
+                    const ShaderInstance vertexShader = shaderMap.GetShaderInstance(*proxy.vertexShaderType, {});
+                    const ShaderInstance pixelShader = shaderMap.GetShaderInstance(*proxy.pixelShaderType, {});
+                    auto* pipeline = PipelineCache::Get(*device).GetOrCreate(
+                        RasterPipelineStateDesc()
+                            .SetVertexShader(vertexShader)
+                            .SetPixelShader(pixelShader)
+                            .SetVertexState(Internal::BuildVertexState(*proxy.vertexFactoryType))
+                            .SetPrimitiveState(RPrimitiveState().SetCullMode(RHI::CullMode::none))
+                            .SetDepthStencilState(
+                                RDepthStencilState()
+                                    .SetDepthEnabled(true)
+                                    .SetFormat(RHI::PixelFormat::d32Float)
+                                    .SetDepthCompareFunc(RHI::CompareFunc::greaterEqual))
+                            .SetFragmentState(RFragmentState().AddColorTarget(RHI::ColorTargetState(colorFormat, RHI::ColorWriteBits::all, false))));
+
+                    auto* vertexBuffer = rgBuilder.ImportBuffer(proxy.mesh->GetVertexBuffer(), RHI::BufferState::shaderReadOnly);
+                    auto* indexBuffer = rgBuilder.ImportBuffer(proxy.mesh->GetIndexBuffer(), RHI::BufferState::shaderReadOnly);
 
                     Internal::BasePassDraw draw {};
                     draw.viewIndex = viewIndex;
                     draw.pipeline = pipeline;
-                    draw.bindGroup = bindGroup;
-                    draw.vertexBufferView = vertexBufferView;
-                    draw.indexBufferView = indexBufferView;
+                    draw.bindGroup = nullptr;
+                    draw.vertexBufferView = rgBuilder.CreateBufferView(
+                        vertexBuffer, RGBufferViewDesc(RHI::BufferViewType::vertex, vertexBuffer->GetDesc().size, 0, RHI::VertexBufferViewInfo(MeshRenderData::vertexStride)));
+                    draw.indexBufferView = rgBuilder.CreateBufferView(
+                        indexBuffer, RGBufferViewDesc(RHI::BufferViewType::index, indexBuffer->GetDesc().size, 0, RHI::IndexBufferViewInfo(RHI::IndexFormat::uint32)));
                     draw.indexCount = proxy.mesh->GetIndexCount();
+                    draw.firstInstance = firstInstance;
+                    draw.instanceCount = instanceNum;
                     draws.emplace_back(draw);
-                    passBindGroups.emplace_back(bindGroup);
-                    drawIndex++;
                 }
             }
         }
 
-        rgBuilder.AddRasterPass(
-            "BasePass",
-            RGRasterPassDesc()
-                .AddColorAttachment(RGColorAttachment(backTextureView, RHI::LoadOp::clear, RHI::StoreOp::store, Internal::surfaceClearColor))
-                .SetDepthStencilAttachment(RGDepthStencilAttachment(depthTextureView, false, RHI::LoadOp::clear, RHI::StoreOp::discard, 0.0f)),
-            passBindGroups,
-            [draws = std::move(draws), views = views](const RGBuilder& rg, RHI::RasterPassCommandRecorder& recorder) -> void {
-                for (size_t viewIndex = 0; viewIndex < views.size(); viewIndex++) {
-                    const auto& viewport = views[viewIndex].data.viewport;
-                    recorder.SetViewport(
-                        static_cast<float>(viewport.min.x), static_cast<float>(viewport.min.y),
-                        static_cast<float>(viewport.ExtentX()), static_cast<float>(viewport.ExtentY()), 0.0f, 1.0f);
-                    recorder.SetScissor(viewport.min.x, viewport.min.y, viewport.max.x, viewport.max.y);
-                    recorder.SetPrimitiveTopology(RHI::PrimitiveTopology::triangleList);
+        if (!instanceSlots.empty()) {
+            // only flushed when drawing, so the base pass always reads the buffer back to storage after an upload,
+            // slots dirtied meanwhile simply wait for the next flush
+            auto* primitiveBuffer = scene->GetGpuScene().Flush(*device, rgBuilder);
+            auto* primitiveBufferView = rgBuilder.CreateBufferView(
+                primitiveBuffer, RGBufferViewDesc(RHI::BufferViewType::storageBinding, primitiveBuffer->GetDesc().size, 0, RHI::StorageBufferViewInfo(sizeof(GpuScenePrimitive))));
+
+            const auto instanceSlotBytes = static_cast<uint32_t>(instanceSlots.size() * sizeof(uint32_t));
+            // host written, so it starts as staging and the base pass transitions it to storage, which makes the host
+            // writes visible to the shaders
+            auto* instanceSlotBuffer = rgBuilder.CreateBuffer(
+                RGBufferDesc()
+                    .SetSize(instanceSlotBytes)
+                    .SetUsages(RHI::BufferUsageBits::storage | RHI::BufferUsageBits::mapWrite)
+                    .SetInitialState(RHI::BufferState::staging)
+                    .SetDebugName("basePassInstanceSlots"));
+            rgBuilder.QueueBufferUpload(instanceSlotBuffer, RGBufferUploadInfo(instanceSlots.data(), instanceSlotBytes));
+            auto* instanceSlotBufferView = rgBuilder.CreateBufferView(
+                instanceSlotBuffer, RGBufferViewDesc(RHI::BufferViewType::storageBinding, instanceSlotBytes, 0, RHI::StorageBufferViewInfo(sizeof(uint32_t))));
+
+            // draw constants are bumped out of the frame's uniform ring, each ring page is imported into the graph once
+            // and every draw binds a view at its offset
+            UniformRingBuffer& uniformRing = UniformRingBuffer::Get(*device);
+            Common::FrameUnorderedMap<RHI::Buffer*, RGBufferRef> uniformPages(arena);
+            const auto uniformBufferView = [&](const UniformAllocation& inAllocation) -> RGBufferViewRef {
+                auto iter = uniformPages.find(inAllocation.buffer);
+                if (iter == uniformPages.end()) {
+                    // the host wrote the page this frame, so its tracked state restarts as staging on every import and the
+                    // base pass transitions it to shader read, which makes the writes visible to the shaders
+                    iter = uniformPages.emplace(inAllocation.buffer, rgBuilder.ImportBuffer(inAllocation.buffer, RHI::BufferState::staging)).first;
+                }
+                return rgBuilder.CreateBufferView(iter->second, RGBufferViewDesc(RHI::BufferViewType::uniformBinding, inAllocation.size, inAllocation.offset));
+            };
+
+            for (auto& draw : draws) {
+                Internal::BasePassViewUniform viewUniform {};
+                viewUniform.worldToClip = worldToClips[draw.viewIndex];
+                viewUniform.firstInstance = draw.firstInstance;
+
+                draw.bindGroup = rgBuilder.AllocateBindGroup(
+                    RGBindGroupDesc::Create(draw.pipeline->GetPipelineLayout()->GetBindGroupLayout(0))
+                        .UniformBuffer("viewUniform", uniformBufferView(uniformRing.Allocate(viewUniform)))
+                        .StorageBuffer("primitives", primitiveBufferView)
+                        .StorageBuffer("instanceSlots", instanceSlotBufferView));
+            }
+        }
+
+        // draws are view major, so every chunk sets the viewport of a view once
+        const size_t chunkNum = std::max<size_t>((draws.size() + Internal::basePassDrawChunkSize - 1) / Internal::basePassDrawChunkSize, 1);
+        for (size_t chunkIndex = 0; chunkIndex < chunkNum; chunkIndex++) {
+            const bool isFirstChunk = chunkIndex == 0;
+            const bool isLastChunk = chunkIndex + 1 == chunkNum;
+            const size_t begin = std::min(chunkIndex * Internal::basePassDrawChunkSize, draws.size());
+            const size_t end = std::min(begin + Internal::basePassDrawChunkSize, draws.size());
+            std::vector<Internal::BasePassDraw> chunkDraws(draws.begin() + static_cast<ptrdiff_t>(begin), draws.begin() + static_cast<ptrdiff_t>(end));
+
+            std::vector<RGBindGroupRef> passBindGroups;
+            passBindGroups.reserve(chunkDraws.size());
+            for (const auto& draw : chunkDraws) {
+                passBindGroups.emplace_back(draw.bindGroup);
+            }
 
+            RGCommonPassExecuteFunc postPassFunc = {};
+            if (isLastChunk) {
+                postPassFunc = [backTexture, surfaceAfterRenderState = surfaceAfterRenderState](const RGBuilder& rg, RHI::CommandRecorder& recorder) -> void {
+                    recorder.ResourceBarrier(RHI::Barrier::Transition(rg.GetRHI(backTexture), RHI::TextureState::renderTarget, surfaceAfterRenderState));
+                };
+            }
+
+            rgBuilder.AddRasterPass(
+                "BasePass",
+                RGRasterPassDesc()
+                    .AddColorAttachment(RGColorAttachment(backTextureView, isFirstChunk ? RHI::LoadOp::clear : RHI::LoadOp::load, RHI::StoreOp::store, Internal::surfaceClearColor))
+                    .SetDepthStencilAttachment(RGDepthStencilAttachment(depthTextureView, false, isFirstChunk ? RHI::LoadOp::clear : RHI::LoadOp::load, isLastChunk ? RHI::StoreOp::discard : RHI::StoreOp::store, 0.0f)),
+                passBindGroups,
+                [draws = std::move(chunkDraws), views = views](const RGBuilder& rg, RHI::RasterPassCommandRecorder& recorder) -> void {
+                    std::optional<size_t> currentViewIndex;
                     for (const auto& draw : draws) {
-                        if (draw.viewIndex != viewIndex) {
-                            continue;
+                        if (draw.viewIndex != currentViewIndex) {
+                            currentViewIndex = draw.viewIndex;
+                            const auto& viewport = views[draw.viewIndex].data.viewport;
+                            recorder.SetViewport(
+                                static_cast<float>(viewport.min.x), static_cast<float>(viewport.min.y),
+                                static_cast<float>(viewport.ExtentX()), static_cast<float>(viewport.ExtentY()), 0.0f, 1.0f);
+                            recorder.SetScissor(viewport.min.x, viewport.min.y, viewport.max.x, viewport.max.y);
+                            recorder.SetPrimitiveTopology(RHI::PrimitiveTopology::triangleList);
                         }
                         recorder.SetPipeline(draw.pipeline->GetRHI());
                         recorder.SetBindGroup(0, rg.GetRHI(draw.bindGroup));
                         recorder.SetVertexBuffer(0, rg.GetRHI(draw.vertexBufferView));
                         recorder.SetIndexBuffer(rg.GetRHI(draw.indexBufferView));
-                        recorder.DrawIndexed(draw.indexCount, 1, 0, 0, 0);
+                        recorder.DrawIndexed(draw.indexCount, draw.instanceCount, 0, 0, 0);
                     }
-                }
-            },
-            {},
-            [backTexture, surfaceAfterRenderState = surfaceAfterRenderState](const RGBuilder& rg, RHI::CommandRecorder& recorder) -> void {
-                recorder.ResourceBarrier(RHI::Barrier::Transition(rg.GetRHI(backTexture), RHI::TextureState::renderTarget, surfaceAfterRenderState));
-            });
+                },
+                {},
+                postPassFunc);
+        }
 
         RGExecuteInfo executeInfo;
         if (waitSemaphore != nullptr) {
@@ -204,6 +321,7 @@ namespace Render {
             executeInfo.semaphoresToSignal.emplace_back(signalSemaphore);
         }
         executeInfo.inFenceToSignal = signalFence;
+        UniformRingBuffer::Get(*device).Flush();
         rgBuilder.Execute(executeInfo);
 
         FinalizeViews();
@@ -8,4 +8,10 @@ namespace Render {
     Scene::Scene() = default;
 
     Scene::~Scene() = default;
+
+    GpuScene& Scene::GetGpuScene()
+    {
+        Assert(Core::ThreadContext::IsRenderThread());
+        return gpuScene;
+    }
 }
@@ -385,81 +385,80 @@ namespace Render {
 
     ShaderTypeCompiler::~ShaderTypeCompiler() = default;
 
-    std::future<ShaderTypeCompileResult> ShaderTypeCompiler::Compile(const std::vector<const ShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions)
+    Common::Task<ShaderTypeCompileResult> ShaderTypeCompiler::Compile(std::vector<const ShaderType*> inShaderTypes, ShaderCompileOptions inOptions)
     {
         Assert(Core::ThreadContext::IsGameThread());
+        co_await Common::ScheduleOn(threadPool);
 
-        return threadPool.EmplaceTask([inShaderTypes, inOptions]() -> ShaderTypeCompileResult {
-            ShaderArtifactRegistry& artifactRegistry = ShaderArtifactRegistry::Get();
+        ShaderArtifactRegistry& artifactRegistry = ShaderArtifactRegistry::Get();
 
-            std::unique_lock lock(artifactRegistry.mutexGT);
-            auto& typeArtifactGT = artifactRegistry.typeArtifactsGT;
+        std::unique_lock lock(artifactRegistry.mutexGT);
+        auto& typeArtifactGT = artifactRegistry.typeArtifactsGT;
 
-            std::unordered_map<ShaderTypeKey, std::unordered_map<ShaderVariantKey, std::future<ShaderCompileOutput>>> compileOutputs;
-            compileOutputs.reserve(inShaderTypes.size());
+        std::unordered_map<ShaderTypeKey, std::unordered_map<ShaderVariantKey, std::future<ShaderCompileOutput>>> compileOutputs;
+        compileOutputs.reserve(inShaderTypes.size());
 
-            for (const auto* shaderType : inShaderTypes) {
-                auto typeKey = shaderType->GetKey();
-                auto sourceFile = Core::Paths::Translate(shaderType->GetSourceFile()).String();
+        for (const auto* shaderType : inShaderTypes) {
+            auto typeKey = shaderType->GetKey();
+            auto sourceFile = Core::Paths::Translate(shaderType->GetSourceFile()).String();
 
-                auto includeDirectories = Common::VectorUtils::Combine(Internal::GetPresetIncludeDirectories(), shaderType->GetIncludeDirectories());
-                includeDirectories = Common::VectorUtils::Combine(includeDirectories, inOptions.includeDirectories);
-                includeDirectories = Internal::TranslateIncludeDirectories(includeDirectories);
-                const auto oldHash = typeArtifactGT.contains(typeKey) ? typeArtifactGT.at(typeKey).sourceHash : shaderSourceHashNotCompiled;
-                const auto newHash = ShaderUtils::ComputeShaderSourceHash(sourceFile, includeDirectories); // NOLINT
+            auto includeDirectories = Common::VectorUtils::Combine(Internal::GetPresetIncludeDirectories(), shaderType->GetIncludeDirectories());
+            includeDirectories = Common::VectorUtils::Combine(includeDirectories, inOptions.includeDirectories);
+            includeDirectories = Internal::TranslateIncludeDirectories(includeDirectories);
+            const auto oldHash = typeArtifactGT.contains(typeKey) ? typeArtifactGT.at(typeKey).sourceHash : shaderSourceHashNotCompiled;
+            const auto newHash = ShaderUtils::ComputeShaderSourceHash(sourceFile, includeDirectories); // NOLINT
 
-                if (oldHash != shaderSourceHashNotCompiled && oldHash == newHash) {
-                    continue;
-                }
-                typeArtifactGT[typeKey].sourceHash = newHash;
-                typeArtifactGT[typeKey].variantArtifacts.clear();
+            if (oldHash != shaderSourceHashNotCompiled && oldHash == newHash) {
+                continue;
+            }
+            typeArtifactGT[typeKey].sourceHash = newHash;
+            typeArtifactGT[typeKey].variantArtifacts.clear();
 
-                const auto stage = shaderType->GetStage();
-                const auto& entryPoint = shaderType->GetEntryPoint();
-                const auto& variantFields = shaderType->GetVariantFields();
-                const auto source = Common::FileUtils::ReadTextFile(sourceFile).Unwrap();
+            const auto stage = shaderType->GetStage();
+            const auto& entryPoint = shaderType->GetEntryPoint();
+            const auto& variantFields = shaderType->GetVariantFields();
+            const auto source = Common::FileUtils::ReadTextFile(sourceFile).Unwrap();
 
-                Assert(!compileOutputs.contains(typeKey));
-                compileOutputs.emplace(std::make_pair(typeKey, std::unordered_map<ShaderVariantKey, std::future<ShaderCompileOutput>> {}));
-                auto& variantCompileOutputs = compileOutputs.at(typeKey);
+            Assert(!compileOutputs.contains(typeKey));
+            compileOutputs.emplace(std::make_pair(typeKey, std::unordered_map<ShaderVariantKey, std::future<ShaderCompileOutput>> {}));
+            auto& variantCompileOutputs = compileOutputs.at(typeKey);
 
-                for (const auto& variantSet : ShaderUtils::GetAllVariants(variantFields)) {
-                    const auto variantKey = ShaderUtils::ComputeVariantKey(variantFields, variantSet);
+            for (const auto& variantSet : ShaderUtils::GetAllVariants(variantFields)) {
+                const auto variantKey = ShaderUtils::ComputeVariantKey(variantFields, variantSet);
 
-                    ShaderCompileInput input {};
-                    input.source = source;
-                    input.entryPoint = entryPoint;
-                    input.stage = stage;
-                    input.definitions = ShaderUtils::ComputeVariantDefinitions(variantFields, variantSet);
-                    input.includeDirectories = includeDirectories;
+                ShaderCompileInput input {};
+                input.source = source;
+                input.entryPoint = entryPoint;
+                input.stage = stage;
+                input.definitions = ShaderUtils::ComputeVariantDefinitions(variantFields, variantSet);
+                input.includeDirectories = includeDirectories;
 
-                    variantCompileOutputs.emplace(variantKey, ShaderCompiler::Get().Compile(input, inOptions));
-                }
+                variantCompileOutputs.emplace(variantKey, ShaderCompiler::Get().Compile(input, inOptions));
             }
+        }
 
-            ShaderTypeCompileResult result;
-            for (auto& [typeKey, variantCompileOutputs] : compileOutputs) {
-                auto& typeArtifact = typeArtifactGT.at(typeKey);
-                for (auto& [variantKey, compileFuture] : variantCompileOutputs) {
-                    ShaderCompileOutput output = compileFuture.get(); // NOLINT
-                    if (output.success) {
-                        ShaderVariantArtifact variantArtifact;
-                        variantArtifact.entryPoint = output.entryPoint;
-                        variantArtifact.byteCode = std::move(output.byteCode);
-                        variantArtifact.reflectionData = std::move(output.reflectionData);
-                        typeArtifact.variantArtifacts.emplace(variantKey, std::move(variantArtifact));
-                    } else {
-                        result.errorInfos.emplace(std::make_pair(std::make_pair(typeKey, variantKey), output.errorInfo));
-                    }
+        ShaderTypeCompileResult result;
+        for (auto& [typeKey, variantCompileOutputs] : compileOutputs) {
+            auto& typeArtifact = typeArtifactGT.at(typeKey);
+            for (auto& [variantKey, compileFuture] : variantCompileOutputs) {
+                ShaderCompileOutput output = compileFuture.get(); // NOLINT
+                if (output.success) {
+                    ShaderVariantArtifact variantArtifact;
+                    variantArtifact.entryPoint = output.entryPoint;
+                    variantArtifact.byteCode = std::move(output.byteCode);
+                    variantArtifact.reflectionData = std::move(output.reflectionData);
+                    typeArtifact.variantArtifacts.emplace(variantKey, std::move(variantArtifact));
+                } else {
+                    result.errorInfos.emplace(std::make_pair(std::make_pair(typeKey, variantKey), output.errorInfo));
                 }
             }
-            result.success = result.errorInfos.empty();
-            return result;
-        });
+        }
+        result.success = result.errorInfos.empty();
+        co_return result;
     }
 
-    std::future<ShaderTypeCompileResult> ShaderTypeCompiler::CompileAll(const ShaderCompileOptions& inOptions)
+    Common::Task<ShaderTypeCompileResult> ShaderTypeCompiler::CompileAll(ShaderCompileOptions inOptions)
     {
-        return Compile(ShaderTypeRegistry::Get().AllTypes(), inOptions);
+        return Compile(ShaderTypeRegistry::Get().AllTypes(), std::move(inOptions));
     }
 }
@@ -0,0 +1,335 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ranges>
+#include <unordered_set>
+
+#include <Common/Debug.h>
+#include <Common/Hash.h>
+#include <Core/Thread.h>
+#include <Render/RenderCache.h>
+#include <Render/TransientHeap.h>
+
+namespace Render::Internal {
+    static std::unordered_map<RHI::Device*, Common::UniquePtr<TransientHeap>>& GetTransientHeapMap()
+    {
+        static std::unordered_map<RHI::Device*, Common::UniquePtr<TransientHeap>> map;
+        return map;
+    }
+
+    static uint64_t AlignUp(uint64_t inValue, uint64_t inAlignment)
+    {
+        return inAlignment == 0 ? inValue : (inValue + inAlignment - 1) / inAlignment * inAlignment;
+    }
+
+    static bool LifetimesOverlap(const TransientAllocationRequest& inLhs, const TransientAllocationRequest& inRhs)
+    {
+        return inLhs.firstStep <= inRhs.lastStep && inRhs.firstStep <= inLhs.lastStep;
+    }
+
+    static uint64_t PlacedResourceKey(const RHI::Heap* inHeap, uint64_t inOffset, uint64_t inDescHash)
+    {
+        const std::array<uint64_t, 3> values = { reinterpret_cast<uint64_t>(inHeap), inOffset, inDescHash };
+        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(uint64_t));
+    }
+
+    // keys are hashes, so they only narrow the search, a hit must have the same desc (and heap offset) too
+    template <typename Map, typename Desc>
+    static auto FindAllocationInfo(Map& inMap, uint64_t inKey, const Desc& inDesc)
+    {
+        for (auto [iter, end] = inMap.equal_range(inKey); iter != end; ++iter) {
+            if (iter->second.desc == inDesc) {
+                return iter;
+            }
+        }
+        return inMap.end();
+    }
+
+    template <typename Map, typename Desc>
+    static auto FindPlacedResource(Map& inMap, uint64_t inKey, const RHI::Heap* inHeap, uint64_t inOffset, const Desc& inDesc)
+    {
+        for (auto [iter, end] = inMap.equal_range(inKey); iter != end; ++iter) {
+            if (iter->second.heap == inHeap && iter->second.offset == inOffset && iter->second.resource->GetDesc() == inDesc) {
+                return iter;
+            }
+        }
+        return inMap.end();
+    }
+
+    template <typename Map>
+    static void EvictPlacedResources(RHI::Device& inDevice, Map& inMap)
+    {
+        const auto currentFrame = Core::ThreadContext::FrameNumber();
+        std::erase_if(inMap, [&](const auto& pair) -> bool {
+            const auto& resource = pair.second.resource;
+            if (currentFrame - resource->LastUsedFrame() <= transientResourceReleaseFrameLatency) {
+                return false;
+            }
+            ResourceViewCache::Get(inDevice).Invalidate(resource->GetRHI());
+            return true;
+        });
+    }
+}
+
+namespace Render {
+    TransientAllocationPlan PlanTransientAllocations(const std::vector<TransientAllocationRequest>& inRequests)
+    {
+        TransientAllocationPlan plan {};
+        plan.placements.resize(inRequests.size(), TransientPlacement { 0, false });
+        plan.alignment = 1;
+        plan.memoryTypeBits = UINT32_MAX;
+
+        std::vector<size_t> order(inRequests.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, [&](size_t lhs, size_t rhs) -> bool {
+            return inRequests[lhs].allocationInfo.size > inRequests[rhs].allocationInfo.size;
+        });
+
+        std::vector<size_t> placed;
+        std::vector<std::pair<uint64_t, uint64_t>> occupied;
+        placed.reserve(inRequests.size());
+        for (const auto index : order) {
+            const auto& request = inRequests[index];
+            const auto [size, alignment, memoryTypeBits] = request.allocationInfo;
+
+            occupied.clear();
+            for (const auto other : placed) {
+                if (Internal::LifetimesOverlap(request, inRequests[other])) {
+                    const auto begin = plan.placements[other].offset;
+                    occupied.emplace_back(begin, begin + inRequests[other].allocationInfo.size);
+                }
+            }
+            std::ranges::sort(occupied);
+
+            uint64_t offset = 0;
+            for (const auto& [begin, end] : occupied) {
+                if (offset + size <= begin) {
+                    break;
+                }
+                offset = std::max(offset, Internal::AlignUp(end, alignment));
+            }
+
+            plan.placements[index].offset = offset;
+            plan.heapSize = std::max(plan.heapSize, offset + size);
+            plan.alignment = std::max<uint64_t>(plan.alignment, alignment);
+            plan.requestedBytes += size;
+            plan.memoryTypeBits &= memoryTypeBits;
+            placed.emplace_back(index);
+        }
+
+        // memory that already served an earlier resource must be handed over by an aliasing barrier
+        for (size_t i = 0; i < inRequests.size(); i++) {
+            const auto begin = plan.placements[i].offset;
+            const auto end = begin + inRequests[i].allocationInfo.size;
+            for (size_t j = 0; j < inRequests.size(); j++) {
+                const auto otherBegin = plan.placements[j].offset;
+                const auto otherEnd = otherBegin + inRequests[j].allocationInfo.size;
+                if (i != j && inRequests[j].lastStep < inRequests[i].firstStep && begin < otherEnd && otherBegin < end) {
+                    plan.placements[i].aliased = true;
+                    break;
+                }
+            }
+        }
+        return plan;
+    }
+
+    uint64_t TransientHeapStats::SavedBytes() const
+    {
+        return requestedBytes - placedBytes;
+    }
+
+    TransientHeap& TransientHeap::Get(RHI::Device& inDevice)
+    {
+        auto& map = Internal::GetTransientHeapMap();
+        if (!map.contains(&inDevice)) {
+            map.emplace(std::make_pair(&inDevice, Common::UniquePtr<TransientHeap>(new TransientHeap(inDevice))));
+        }
+        return *map.at(&inDevice);
+    }
+
+    void TransientHeap::Destroy(RHI::Device& inDevice)
+    {
+        Internal::GetTransientHeapMap().erase(&inDevice);
+    }
+
+    TransientHeap::TransientHeap(RHI::Device& inDevice)
+        : device(inDevice)
+        , nextPlacedResourceId(0)
+        , stats()
+    {
+    }
+
+    TransientHeap::~TransientHeap()
+    {
+        // placed resources must die before the heaps they live in
+        placedBuffers.clear();
+        placedTextures.clear();
+    }
+
+    RHI::ResourceAllocationInfo TransientHeap::GetAllocationInfo(const RHI::BufferCreateInfo& inCreateInfo)
+    {
+        const auto hash = PooledResTraits<PooledBuffer>::Hash(inCreateInfo);
+        if (const auto iter = Internal::FindAllocationInfo(bufferAllocationInfos, hash, inCreateInfo); iter != bufferAllocationInfos.end()) {
+            return iter->second.allocationInfo;
+        }
+        return bufferAllocationInfos.emplace(hash, CachedAllocationInfo<RHI::BufferCreateInfo> { inCreateInfo, device.GetResourceAllocationInfo(inCreateInfo) })->second.allocationInfo;
+    }
+
+    RHI::ResourceAllocationInfo TransientHeap::GetAllocationInfo(const RHI::TextureCreateInfo& inCreateInfo)
+    {
+        const auto hash = PooledResTraits<PooledTexture>::Hash(inCreateInfo);
+        if (const auto iter = Internal::FindAllocationInfo(textureAllocationInfos, hash, inCreateInfo); iter != textureAllocationInfos.end()) {
+            return iter->second.allocationInfo;
+        }
+        return textureAllocationInfos.emplace(hash, CachedAllocationInfo<RHI::TextureCreateInfo> { inCreateInfo, device.GetResourceAllocationInfo(inCreateInfo) })->second.allocationInfo;
+    }
+
+    TransientHeapRange TransientHeap::AllocateRange(const TransientAllocationPlan& inPlan)
+    {
+        Assert(inPlan.heapSize > 0 && inPlan.memoryTypeBits != 0);
+        auto& chain = heapChains[inPlan.memoryTypeBits];
+        auto offset = Internal::AlignUp(chain.frameOffset, inPlan.alignment);
+        if (chain.heaps.empty() || offset + inPlan.heapSize > chain.heaps.back()->GetCreateInfo().size) {
+            Grow(chain, inPlan.heapSize, inPlan.memoryTypeBits);
+            offset = 0;
+        }
+        chain.frameOffset = offset + inPlan.heapSize;
+
+        stats.requestedBytes += inPlan.requestedBytes;
+        stats.placedBytes += inPlan.heapSize;
+        return { chain.heaps.back().Get(), offset };
+    }
+
+    PooledBufferRef TransientHeap::AllocateBuffer(const TransientHeapRange& inRange, uint64_t inOffset, const RHI::BufferCreateInfo& inCreateInfo, bool& outAliased)
+    {
+        const auto offset = inRange.offset + inOffset;
+        const auto end = offset + GetAllocationInfo(inCreateInfo).size;
+        const auto key = Internal::PlacedResourceKey(inRange.heap, offset, PooledResTraits<PooledBuffer>::Hash(inCreateInfo));
+        if (const auto iter = Internal::FindPlacedResource(placedBuffers, key, inRange.heap, offset, inCreateInfo); iter != placedBuffers.end()) {
+            iter->second.resource->MarkUsedThisFrame();
+            outAliased = Occupy(inRange.heap, offset, end, iter->second.id);
+            return iter->second.resource;
+        }
+
+        PooledBufferRef resource = { new PooledBuffer(device.CreatePlacedBuffer(*inRange.heap, offset, inCreateInfo), inCreateInfo) };
+        const auto id = nextPlacedResourceId++;
+        placedBuffers.emplace(key, PlacedResource<PooledBufferRef> { resource, inRange.heap, offset, id });
+        outAliased = Occupy(inRange.heap, offset, end, id);
+        return resource;
+    }
+
+    PooledTextureRef TransientHeap::AllocateTexture(const TransientHeapRange& inRange, uint64_t inOffset, const RHI::TextureCreateInfo& inCreateInfo, bool& outAliased)
+    {
+        const auto offset = inRange.offset + inOffset;
+        const auto end = offset + GetAllocationInfo(inCreateInfo).size;
+        const auto key = Internal::PlacedResourceKey(inRange.heap, offset, PooledResTraits<PooledTexture>::Hash(inCreateInfo));
+        if (const auto iter = Internal::FindPlacedResource(placedTextures, key, inRange.heap, offset, inCreateInfo); iter != placedTextures.end()) {
+            iter->second.resource->MarkUsedThisFrame();
+            outAliased = Occupy(inRange.heap, offset, end, iter->second.id);
+            return iter->second.resource;
+        }
+
+        PooledTextureRef resource = { new PooledTexture(device.CreatePlacedTexture(*inRange.heap, offset, inCreateInfo), inCreateInfo) };
+        const auto id = nextPlacedResourceId++;
+        placedTextures.emplace(key, PlacedResource<PooledTextureRef> { resource, inRange.heap, offset, id });
+        outAliased = Occupy(inRange.heap, offset, end, id);
+        return resource;
+    }
+
+    const TransientHeapStats& TransientHeap::Stats() const
+    {
+        return stats;
+    }
+
+    size_t TransientHeap::PlacedResourceNum() const
+    {
+        return placedBuffers.size() + placedTextures.size();
+    }
+
+    size_t TransientHeap::HeapNum() const
+    {
+        size_t result = 0;
+        for (const auto& chain : heapChains | std::views::values) {
+            result += chain.heaps.size();
+        }
+        return result;
+    }
+
+    void TransientHeap::Forfeit()
+    {
+        Internal::EvictPlacedResources(device, placedBuffers);
+        Internal::EvictPlacedResources(device, placedTextures);
+
+        // a heap left behind by a growth goes away with the last resource placed in it
+        std::unordered_set<const RHI::Heap*> heapsInUse;
+        for (const auto& placed : placedBuffers | std::views::values) {
+            heapsInUse.emplace(placed.heap);
+        }
+        for (const auto& placed : placedTextures | std::views::values) {
+            heapsInUse.emplace(placed.heap);
+        }
+        stats.heapBytes = 0;
+        for (auto& chain : heapChains | std::views::values) {
+            heapsInUse.emplace(chain.heaps.back().Get());
+            std::erase_if(chain.heaps, [&](const Common::UniquePtr<RHI::Heap>& heap) -> bool {
+                if (heapsInUse.contains(heap.Get())) {
+                    return false;
+                }
+                occupants.erase(heap.Get());
+                return true;
+            });
+            for (const auto& heap : chain.heaps) {
+                stats.heapBytes += heap->GetCreateInfo().size;
+            }
+            chain.frameOffset = 0;
+        }
+
+        stats.requestedBytes = 0;
+        stats.placedBytes = 0;
+    }
+
+    void TransientHeap::Grow(HeapChain& inChain, uint64_t inMinSize, uint32_t inMemoryTypeBits)
+    {
+        const uint64_t lastSize = inChain.heaps.empty() ? 0 : inChain.heaps.back()->GetCreateInfo().size;
+        const uint64_t size = Internal::AlignUp(std::max(lastSize * 2, inMinSize), Internal::transientHeapGranularity);
+        inChain.heaps.emplace_back(device.CreateHeap(
+            RHI::HeapCreateInfo()
+                .SetSize(size)
+                .SetMemoryTypeBits(inMemoryTypeBits)
+                .SetDebugName("transientHeap")));
+        stats.heapBytes += size;
+    }
+
+    bool TransientHeap::Occupy(const RHI::Heap* inHeap, uint64_t inBegin, uint64_t inEnd, uint64_t inId)
+    {
+        auto& ranges = occupants[inHeap];
+        auto iter = ranges.lower_bound(inBegin);
+        if (iter != ranges.begin() && std::prev(iter)->second.end > inBegin) {
+            --iter;
+        }
+
+        // parts of the overlapped ranges outside the new one keep their occupant
+        bool aliased = false;
+        std::vector<std::pair<uint64_t, Occupant>> remains;
+        while (iter != ranges.end() && iter->first < inEnd) {
+            const auto [begin, occupant] = *iter;
+            aliased = aliased || occupant.id != inId;
+            if (begin < inBegin) {
+                remains.emplace_back(begin, Occupant { inBegin, occupant.id });
+            }
+            if (occupant.end > inEnd) {
+                remains.emplace_back(inEnd, occupant);
+            }
+            iter = ranges.erase(iter);
+        }
+        for (const auto& remain : remains) {
+            ranges.emplace(remain);
+        }
+        ranges.emplace(inBegin, Occupant { inEnd, inId });
+        return aliased;
+    }
+}
@@ -0,0 +1,125 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include <Common/Debug.h>
+#include <Common/Utility.h>
+#include <Render/UniformRingBuffer.h>
+
+namespace Render::Internal {
+    static std::unordered_map<RHI::Device*, Common::UniquePtr<UniformRingBuffer>>& GetUniformRingBufferMap()
+    {
+        static std::unordered_map<RHI::Device*, Common::UniquePtr<UniformRingBuffer>> map;
+        return map;
+    }
+}
+
+namespace Render {
+    UniformRingBuffer& UniformRingBuffer::Get(RHI::Device& inDevice)
+    {
+        auto& map = Internal::GetUniformRingBufferMap();
+        if (!map.contains(&inDevice)) {
+            map.emplace(std::make_pair(&inDevice, Common::UniquePtr<UniformRingBuffer>(new UniformRingBuffer(inDevice))));
+        }
+        return *map.at(&inDevice);
+    }
+
+    void UniformRingBuffer::Destroy(RHI::Device& inDevice)
+    {
+        Internal::GetUniformRingBufferMap().erase(&inDevice);
+    }
+
+    UniformRingBuffer::UniformRingBuffer(RHI::Device& inDevice)
+        : device(inDevice)
+        , frameSlots()
+        , frameSlotIndex(0)
+    {
+        for (auto& frameSlot : frameSlots) {
+            frameSlot.pageIndex = 0;
+            frameSlot.offset = 0;
+        }
+    }
+
+    UniformRingBuffer::~UniformRingBuffer()
+    {
+        for (auto& frameSlot : frameSlots) {
+            for (auto& page : frameSlot.pages) {
+                if (page.mapped != nullptr) {
+                    page.buffer->Unmap();
+                }
+            }
+        }
+    }
+
+    UniformAllocation UniformRingBuffer::Allocate(const void* inData, size_t inSize)
+    {
+        Assert(inSize > 0);
+        const size_t alignedSize = Common::AlignUp<Internal::uniformRingAlignment>(inSize);
+        Page& page = AcquirePage(alignedSize);
+        if (page.mapped == nullptr) {
+            page.mapped = static_cast<uint8_t*>(page.buffer->Map(RHI::MapMode::write, 0, page.size));
+        }
+
+        auto& frameSlot = frameSlots[frameSlotIndex];
+        std::memcpy(page.mapped + frameSlot.offset, inData, inSize);
+        const UniformAllocation result { page.buffer.Get(), static_cast<uint32_t>(frameSlot.offset), static_cast<uint32_t>(inSize) };
+        frameSlot.offset += alignedSize;
+        return result;
+    }
+
+    void UniformRingBuffer::Flush()
+    {
+        for (auto& page : frameSlots[frameSlotIndex].pages) {
+            if (page.mapped != nullptr) {
+                page.buffer->Unmap();
+                page.mapped = nullptr;
+            }
+        }
+    }
+
+    void UniformRingBuffer::Forfeit()
+    {
+        Flush();
+        frameSlotIndex = (frameSlotIndex + 1) % frameSlots.size();
+        auto& frameSlot = frameSlots[frameSlotIndex];
+        frameSlot.pageIndex = 0;
+        frameSlot.offset = 0;
+    }
+
+    size_t UniformRingBuffer::PageNum() const
+    {
+        size_t result = 0;
+        for (const auto& frameSlot : frameSlots) {
+            result += frameSlot.pages.size();
+        }
+        return result;
+    }
+
+    UniformRingBuffer::Page& UniformRingBuffer::AcquirePage(size_t inSize)
+    {
+        auto& frameSlot = frameSlots[frameSlotIndex];
+        for (; frameSlot.pageIndex < frameSlot.pages.size(); frameSlot.pageIndex++, frameSlot.offset = 0) {
+            if (Page& page = frameSlot.pages[frameSlot.pageIndex]; frameSlot.offset + inSize <= page.size) {
+                return page;
+            }
+        }
+
+        // pages are kept for the following frames of the slot, so a steady frame stops creating buffers after warmup
+        const size_t pageSize = std::max(Internal::uniformRingPageSize, inSize);
+        Page& page = frameSlot.pages.emplace_back();
+        page.buffer = device.CreateBuffer(
+            RHI::BufferCreateInfo()
+                .SetSize(pageSize)
+                .SetUsages(RHI::BufferUsageBits::uniform | RHI::BufferUsageBits::mapWrite)
+                .SetInitialState(RHI::BufferState::staging)
+                .SetDebugName("uniformRingPage"));
+        page.size = pageSize;
+        page.mapped = nullptr;
+        frameSlot.offset = 0;
+        return page;
+    }
+}
@@ -0,0 +1,100 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RenderTestDevice.h>
+#include <Test/Test.h>
+
+#include <Core/Thread.h>
+#include <Render/RenderCache.h>
+#include <Render/RenderGraph.h>
+#include <Render/RenderThread.h>
+#include <Render/Scene.h>
+
+using namespace Render;
+
+struct GpuSceneTest : testing::Test, RenderTestDevice {
+    void SetUp() override
+    {
+        RenderWorkerThreads::Get().Start();
+    }
+
+    void TearDown() override
+    {
+        RenderWorkerThreads::Get().Stop();
+    }
+
+    void Flush(GpuScene& inGpuScene) const
+    {
+        RGBuilder builder(*device);
+        auto* primitiveBuffer = inGpuScene.Flush(*device, builder);
+        ASSERT_NE(primitiveBuffer, nullptr);
+        builder.Execute(RGExecuteInfo {});
+    }
+};
+
+TEST_F(GpuSceneTest, SlotsAreStableAndReused)
+{
+    Core::ScopedThreadTag threadTag(Core::ThreadTag::render);
+    Scene scene;
+    for (Scene::EntityId entity = 0; entity < 4; entity++) {
+        scene.Add<StaticPrimitiveSceneProxy>(entity, StaticPrimitiveSceneProxy());
+        ASSERT_EQ(scene.Get<StaticPrimitiveSceneProxy>(entity).gpuSceneSlot, entity);
+    }
+
+    scene.Remove<StaticPrimitiveSceneProxy>(1);
+    scene.Add<StaticPrimitiveSceneProxy>(4, StaticPrimitiveSceneProxy());
+    ASSERT_EQ(scene.Get<StaticPrimitiveSceneProxy>(4).gpuSceneSlot, 1);
+    ASSERT_EQ(scene.Get<StaticPrimitiveSceneProxy>(3).gpuSceneSlot, 3);
+    ASSERT_EQ(scene.GetGpuScene().SlotNum(), 4);
+}
+
+TEST_F(GpuSceneTest, OnlyChangedSlotsAreUploaded)
+{
+    Core::ScopedThreadTag threadTag(Core::ThreadTag::render);
+    Scene scene;
+    GpuScene& gpuScene = scene.GetGpuScene();
+    for (Scene::EntityId entity = 0; entity < 8; entity++) {
+        scene.Add<StaticPrimitiveSceneProxy>(entity, StaticPrimitiveSceneProxy());
+    }
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 8);
+    Flush(gpuScene);
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 0);
+
+    // static primitives upload nothing
+    Flush(gpuScene);
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 0);
+
+    // a slot changed several times in a frame is uploaded once
+    for (auto i = 0; i < 3; i++) {
+        scene.Update<StaticPrimitiveSceneProxy>(2, [&](StaticPrimitiveSceneProxy& proxy) -> void {
+            proxy.baseColor = Common::FVec4(static_cast<float>(i), 0, 0, 1);
+        });
+    }
+    scene.Update<StaticPrimitiveSceneProxy>(5, [](StaticPrimitiveSceneProxy& proxy) -> void {
+        proxy.localToWorld = Common::FMat4x4Consts::zero;
+    });
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 2);
+    Flush(gpuScene);
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 0);
+}
+
+TEST_F(GpuSceneTest, BufferGrowsToNextPowerOfTwo)
+{
+    Core::ScopedThreadTag threadTag(Core::ThreadTag::render);
+    Scene scene;
+    GpuScene& gpuScene = scene.GetGpuScene();
+    for (Scene::EntityId entity = 0; entity < Internal::gpuSceneMinCapacity; entity++) {
+        scene.Add<StaticPrimitiveSceneProxy>(entity, StaticPrimitiveSceneProxy());
+    }
+    Flush(gpuScene);
+
+    // one more primitive does not fit, the buffer grows to the next power of two
+    scene.Add<StaticPrimitiveSceneProxy>(Internal::gpuSceneMinCapacity, StaticPrimitiveSceneProxy());
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 1);
+    RGBuilder builder(*device);
+    auto* primitiveBuffer = gpuScene.Flush(*device, builder);
+    ASSERT_EQ(primitiveBuffer->GetDesc().size, 2 * Internal::gpuSceneMinCapacity * sizeof(GpuScenePrimitive));
+    builder.Execute(RGExecuteInfo {});
+    ASSERT_EQ(gpuScene.DirtySlotNum(), 0);
+}
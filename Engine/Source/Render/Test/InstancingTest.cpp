@@ -0,0 +1,67 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <array>
+
+#include <RenderTestDevice.h>
+#include <Test/Test.h>
+
+#include <Render/Instancing.h>
+#include <Render/RenderCache.h>
+
+using namespace Render;
+
+struct InstancingTest : testing::Test, RenderTestDevice {
+    void SetUp() override
+    {
+        const std::vector<MeshRenderData::Vertex> vertices = {
+            { Common::FVec3(0, 0, 0), Common::FVec2(0, 0) },
+            { Common::FVec3(1, 0, 0), Common::FVec2(1, 0) },
+            { Common::FVec3(0, 1, 0), Common::FVec2(0, 1) }
+        };
+        for (auto& mesh : meshes) {
+            mesh = Common::MakeShared<MeshRenderData>(*device, vertices, std::vector<uint32_t> { 0, 1, 2 });
+        }
+    }
+
+    std::array<Common::SharedPtr<MeshRenderData>, 2> meshes;
+};
+
+TEST_F(InstancingTest, PrimitivesSharingMeshBecomeOneBucket)
+{
+    // meshes interleaved as 0 1 0 0 1, every primitive tagged by its gpu scene slot
+    std::array<StaticPrimitiveSceneProxy, 5> proxies;
+    const std::array<size_t, 5> meshIndices = { 0, 1, 0, 0, 1 };
+    std::vector<const StaticPrimitiveSceneProxy*> primitives;
+    for (auto i = 0; i < proxies.size(); i++) {
+        proxies[i].mesh = meshes[meshIndices[i]];
+        proxies[i].gpuSceneSlot = i;
+        primitives.emplace_back(&proxies[i]);
+    }
+
+    Common::FrameArena arena;
+    Common::FrameVector<StaticMeshDrawBucket> buckets(&arena);
+    Common::FrameVector<uint32_t> instanceSlots(&arena);
+    BuildStaticMeshDrawBuckets(primitives, buckets, instanceSlots, &arena);
+
+    ASSERT_EQ(buckets.size(), 2);
+    ASSERT_EQ(buckets[0].primitive, &proxies[0]);
+    ASSERT_EQ(buckets[0].firstInstance, 0);
+    ASSERT_EQ(buckets[0].instanceNum, 3);
+    ASSERT_EQ(buckets[1].primitive, &proxies[1]);
+    ASSERT_EQ(buckets[1].firstInstance, 3);
+    ASSERT_EQ(buckets[1].instanceNum, 2);
+
+    const std::array<uint32_t, 5> expectedOrder = { 0, 2, 3, 1, 4 };
+    ASSERT_EQ(instanceSlots.size(), expectedOrder.size());
+    for (auto i = 0; i < expectedOrder.size(); i++) {
+        ASSERT_EQ(instanceSlots[i], expectedOrder[i]);
+    }
+
+    // a second call, e.g. for another view, appends its own buckets behind the existing instance slots
+    BuildStaticMeshDrawBuckets(std::span(primitives).subspan(0, 1), buckets, instanceSlots, &arena);
+    ASSERT_EQ(buckets.size(), 3);
+    ASSERT_EQ(buckets[2].firstInstance, 5);
+    ASSERT_EQ(buckets[2].instanceNum, 1);
+}
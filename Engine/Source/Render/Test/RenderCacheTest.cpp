@@ -0,0 +1,104 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RenderTestDevice.h>
+#include <Test/Test.h>
+
+#include <Core/Thread.h>
+#include <Render/RenderCache.h>
+
+using namespace Render;
+
+struct RenderCacheTest : testing::Test, RenderTestDevice {
+    void SetUp() override
+    {
+        const RHI::ResourceBinding binding(RHI::BindingType::uniformBuffer, RHI::HlslBinding(RHI::HlslBindingRangeType::constantBuffer, 0));
+        bindGroupLayout = device->CreateBindGroupLayout(
+            RHI::BindGroupLayoutCreateInfo(0)
+                .AddEntry(RHI::BindGroupLayoutEntry(binding, RHI::ShaderStageBits::sVertex)));
+
+        for (auto& buffer : buffers) {
+            buffer = device->CreateBuffer(
+                RHI::BufferCreateInfo()
+                    .SetSize(256)
+                    .SetUsages(RHI::BufferUsageBits::uniform)
+                    .SetInitialState(RHI::BufferState::shaderReadOnly));
+        }
+    }
+
+    RHI::BindGroupCreateInfo MakeBindGroupCreateInfo(RHI::Buffer* inBuffer) const
+    {
+        auto* view = ResourceViewCache::Get(*device).GetOrCreate(
+            inBuffer,
+            RHI::BufferViewCreateInfo(RHI::BufferViewType::uniformBinding, 256, 0));
+
+        const RHI::ResourceBinding binding(RHI::BindingType::uniformBuffer, RHI::HlslBinding(RHI::HlslBindingRangeType::constantBuffer, 0));
+        return RHI::BindGroupCreateInfo(bindGroupLayout.Get())
+            .AddEntry(RHI::BindGroupEntry(binding, RHI::ShaderStageBits::sVertex, view));
+    }
+
+    Common::UniquePtr<RHI::BindGroupLayout> bindGroupLayout;
+    Common::UniquePtr<RHI::Buffer> buffers[2];
+};
+
+TEST_F(RenderCacheTest, ResourceViewsLiveAcrossFrames)
+{
+    auto& viewCache = ResourceViewCache::Get(*device);
+    const RHI::BufferViewCreateInfo viewCreateInfo(RHI::BufferViewType::uniformBinding, 256, 0);
+
+    auto* view = viewCache.GetOrCreate(buffers[0].Get(), viewCreateInfo);
+    Core::ThreadContext::IncFrameNumber();
+    viewCache.Forfeit();
+    ASSERT_EQ(viewCache.GetOrCreate(buffers[0].Get(), viewCreateInfo), view);
+}
+
+TEST_F(RenderCacheTest, BindGroupCacheDeduplicates)
+{
+    auto& bindGroupCache = BindGroupCache::Get(*device);
+
+    auto* bindGroup0 = bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[0].Get()));
+    auto* bindGroup1 = bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[1].Get()));
+    ASSERT_NE(bindGroup0, bindGroup1);
+    ASSERT_EQ(bindGroupCache.Size(), 2);
+
+    // steady state, the same content in the following frames creates nothing
+    for (auto i = 0; i < 4; i++) {
+        Core::ThreadContext::IncFrameNumber();
+        ResourceViewCache::Get(*device).Forfeit();
+        bindGroupCache.Forfeit();
+        ASSERT_EQ(bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[0].Get())), bindGroup0);
+        ASSERT_EQ(bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[1].Get())), bindGroup1);
+    }
+    ASSERT_EQ(bindGroupCache.Size(), 2);
+    ASSERT_EQ(bindGroupCache.Stats().misses, 2);
+    ASSERT_EQ(bindGroupCache.Stats().hits, 8);
+    ASSERT_DOUBLE_EQ(bindGroupCache.Stats().HitRate(), 0.8);
+}
+
+TEST_F(RenderCacheTest, BindGroupCacheEvictsLeastRecentlyUsed)
+{
+    auto& bindGroupCache = BindGroupCache::Get(*device);
+    auto* bindGroup0 = bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[0].Get()));
+    bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[1].Get()));
+
+    for (auto i = 0; i < 3; i++) {
+        Core::ThreadContext::IncFrameNumber();
+        bindGroupCache.Forfeit();
+        ASSERT_EQ(bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[0].Get())), bindGroup0);
+    }
+    ASSERT_EQ(bindGroupCache.Size(), 1);
+    ASSERT_EQ(bindGroupCache.Stats().evictions, 1);
+}
+
+TEST_F(RenderCacheTest, InvalidatedResourceDropsBindGroups)
+{
+    auto& bindGroupCache = BindGroupCache::Get(*device);
+    bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[0].Get()));
+    bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[1].Get()));
+
+    ResourceViewCache::Get(*device).Invalidate(buffers[0].Get());
+    ASSERT_EQ(bindGroupCache.Size(), 1);
+    bindGroupCache.Allocate(MakeBindGroupCreateInfo(buffers[0].Get()));
+    ASSERT_EQ(bindGroupCache.Stats().misses, 3);
+}
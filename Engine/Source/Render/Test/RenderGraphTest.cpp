@@ -0,0 +1,109 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <array>
+#include <atomic>
+
+#include <RenderTestDevice.h>
+#include <Test/Test.h>
+
+#include <Render/RenderCache.h>
+#include <Render/RenderGraph.h>
+#include <Render/RenderThread.h>
+
+using namespace Render;
+
+struct RenderGraphTest : testing::Test, RenderTestDevice {
+    static constexpr size_t passNum = 32;
+
+    void SetUp() override
+    {
+        textureDesc.dimension = RHI::TextureDimension::t2D;
+        textureDesc.width = 64;
+        textureDesc.height = 64;
+        textureDesc.depthOrArraySize = 1;
+        textureDesc.format = RHI::PixelFormat::rgba8Unorm;
+        textureDesc.usages = RHI::TextureUsageBits::copySrc | RHI::TextureUsageBits::copyDst;
+        textureDesc.mipLevels = 1;
+        textureDesc.samples = 1;
+        textureDesc.initialState = RHI::TextureState::undefined;
+    }
+
+    void TearDown() override
+    {
+        if (RenderWorkerThreads::Get().Started()) {
+            RenderWorkerThreads::Get().Stop();
+        }
+    }
+
+    // a chain of copies, every pass records the texture it writes and the order its callbacks ran in
+    std::array<RHI::Texture*, passNum> ExecuteCopyChain(std::array<std::atomic<uint32_t>, passNum>& outStages) const
+    {
+        std::array<RHI::Texture*, passNum> result {};
+        RGBuilder builder(*device);
+        std::array<RGTextureRef, passNum> textures {};
+        for (auto& texture : textures) {
+            texture = builder.CreateTexture(textureDesc);
+        }
+        auto* importedOutput = builder.ImportTexture(output.Get(), RHI::TextureState::undefined);
+
+        for (size_t i = 0; i < passNum; i++) {
+            RGCopyPassDesc passDesc {};
+            if (i > 0) {
+                passDesc.copySrcs.emplace_back(textures[i - 1]);
+            }
+            passDesc.copyDsts.emplace_back(textures[i]);
+
+            builder.AddCopyPass(
+                "Copy", passDesc,
+                [&, i](const RGBuilder& rg, RHI::CopyPassCommandRecorder&) -> void {
+                    result[i] = rg.GetRHI(textures[i]);
+                    uint32_t expected = 1;
+                    outStages[i].compare_exchange_strong(expected, 2);
+                },
+                false,
+                [&, i](const RGBuilder&, RHI::CommandRecorder&) -> void {
+                    uint32_t expected = 0;
+                    outStages[i].compare_exchange_strong(expected, 1);
+                },
+                [&, i](const RGBuilder&, RHI::CommandRecorder&) -> void {
+                    uint32_t expected = 2;
+                    outStages[i].compare_exchange_strong(expected, 3);
+                });
+        }
+        builder.AddCopyPass("Output", RGCopyPassDesc { { textures.back() }, { importedOutput } }, [](const RGBuilder&, RHI::CopyPassCommandRecorder&) -> void {});
+        builder.Execute(RGExecuteInfo {});
+        return result;
+    }
+
+    RHI::TextureCreateInfo textureDesc {};
+    Common::UniquePtr<RHI::Texture> output;
+};
+
+TEST_F(RenderGraphTest, ParallelRecordingRunsEveryPassOnceInOrder)
+{
+    output = device->CreateTexture(textureDesc);
+    RenderWorkerThreads::Get().Start();
+
+    std::array<std::atomic<uint32_t>, passNum> stages {};
+    const auto textures = ExecuteCopyChain(stages);
+    for (size_t i = 0; i < passNum; i++) {
+        ASSERT_EQ(stages[i].load(), 3);
+        ASSERT_NE(textures[i], nullptr);
+    }
+}
+
+TEST_F(RenderGraphTest, ParallelRecordingMatchesSerialRecording)
+{
+    output = device->CreateTexture(textureDesc);
+
+    std::array<std::atomic<uint32_t>, passNum> serialStages {};
+    const auto serialTextures = ExecuteCopyChain(serialStages);
+    TransientHeap::Get(*device).Forfeit();
+
+    RenderWorkerThreads::Get().Start();
+    std::array<std::atomic<uint32_t>, passNum> parallelStages {};
+    const auto parallelTextures = ExecuteCopyChain(parallelStages);
+    ASSERT_EQ(serialTextures, parallelTextures);
+}
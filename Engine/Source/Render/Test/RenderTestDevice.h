@@ -0,0 +1,33 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <Common/Memory.h>
+#include <Common/Utility.h>
+#include <RHI/RHI.h>
+#include <Render/RenderCache.h>
+
+// graphics device of the dummy rhi shared by the render tests and benchmarks, test fixtures derive from it so the device
+// lives from the fixture constructor to after TearDown(), and the render caches built on it are released with it
+struct RenderTestDevice {
+    NonCopyable(RenderTestDevice)
+    NonMovable(RenderTestDevice)
+
+    RenderTestDevice()
+        : instance(RHI::Instance::GetByType(RHI::RHIType::dummy))
+        , device(instance->GetGpu(0)->RequestDevice(
+            RHI::DeviceCreateInfo()
+                .AddQueueRequest(RHI::QueueRequestInfo(RHI::QueueType::graphics, 1))))
+    {
+    }
+
+    ~RenderTestDevice()
+    {
+        Render::DestroyDeviceResources(*device);
+    }
+
+    RHI::Instance* instance;
+    Common::UniquePtr<RHI::Device> device;
+};
@@ -2,6 +2,7 @@
 // Created by johnk on 2023/12/11.
 //
 
+#include <RenderTestDevice.h>
 #include <Test/Test.h>
 
 #include <Render/RenderCache.h>
@@ -9,24 +10,7 @@
 
 using namespace Render;
 
-struct ResourcePoolTest : testing::Test {
-    void SetUp() override
-    {
-        instance = RHI::Instance::GetByType(RHI::RHIType::dummy);
-
-        device = instance->GetGpu(0)->RequestDevice(
-            RHI::DeviceCreateInfo()
-                .AddQueueRequest(RHI::QueueRequestInfo(RHI::QueueType::graphics, 1)));
-    }
-
-    void TearDown() override
-    {
-        DestroyDeviceResources(*device);
-    }
-
-    RHI::Instance* instance;
-    Common::UniquePtr<RHI::Device> device;
-};
+struct ResourcePoolTest : testing::Test, RenderTestDevice {};
 
 TEST_F(ResourcePoolTest, BasicTest)
 {
@@ -79,3 +63,61 @@ TEST_F(ResourcePoolTest, BasicTest)
     texturePool.Forfeit();
     ASSERT_EQ(texturePool.Size(), 1);
 }
+
+TEST_F(ResourcePoolTest, ReleaseAndStatsTest)
+{
+    auto& bufferPool = BufferPool::Get(*device);
+    const PooledBufferDesc desc0(256, RHI::BufferUsageBits::storage, RHI::BufferState::undefined);
+    const PooledBufferDesc desc1(512, RHI::BufferUsageBits::storage, RHI::BufferState::undefined);
+
+    PooledBufferRef b0 = bufferPool.Allocate(desc0);
+    PooledBufferRef b1 = bufferPool.Allocate(desc0);
+    const PooledBufferRef b2 = bufferPool.Allocate(desc1);
+    ASSERT_NE(b0.Get(), b1.Get());
+    ASSERT_EQ(bufferPool.Stats().misses, 3);
+    ASSERT_EQ(bufferPool.Stats().hits, 0);
+    ASSERT_EQ(bufferPool.Stats().pooledBytes, 256 * 2 + 512);
+
+    auto* b1Ptr = b1.Get();
+    bufferPool.Release(std::move(b1));
+    ASSERT_EQ(b1, nullptr);
+    const PooledBufferRef b3 = bufferPool.Allocate(desc0);
+    ASSERT_EQ(b3.Get(), b1Ptr);
+    ASSERT_EQ(bufferPool.Stats().hits, 1);
+
+    // the debug name is not a part of the desc
+    bufferPool.Release(std::move(b0));
+    PooledBufferDesc namedDesc = desc0;
+    namedDesc.SetDebugName("named");
+    const PooledBufferRef b4 = bufferPool.Allocate(namedDesc);
+    ASSERT_EQ(bufferPool.Stats().hits, 2);
+    ASSERT_EQ(bufferPool.Size(), 3);
+}
+
+TEST_F(ResourcePoolTest, ForfeitCompactionTest)
+{
+    auto& bufferPool = BufferPool::Get(*device);
+    std::vector<PooledBufferRef> buffers;
+    for (auto i = 0; i < 8; i++) {
+        buffers.emplace_back(bufferPool.Allocate(PooledBufferDesc(64 * (i + 1), RHI::BufferUsageBits::storage, RHI::BufferState::undefined)));
+    }
+    ASSERT_EQ(bufferPool.Size(), 8);
+
+    // keep every other buffer alive, the dropped ones expire and the survivors keep their descs after compaction
+    for (auto i = 0; i < 8; i += 2) {
+        buffers[i].Reset();
+    }
+    for (auto i = 0; i < 3; i++) {
+        Core::ThreadContext::IncFrameNumber();
+        bufferPool.Forfeit();
+    }
+    ASSERT_EQ(bufferPool.Size(), 4);
+    ASSERT_EQ(bufferPool.Stats().evictions, 4);
+    ASSERT_EQ(bufferPool.Stats().pooledBytes, 64 * (2 + 4 + 6 + 8));
+
+    auto* survivor = buffers[3].Get();
+    bufferPool.Release(std::move(buffers[3]));
+    const PooledBufferRef reused = bufferPool.Allocate(PooledBufferDesc(64 * 4, RHI::BufferUsageBits::storage, RHI::BufferState::undefined));
+    ASSERT_EQ(reused.Get(), survivor);
+    ASSERT_EQ(bufferPool.Size(), 4);
+}
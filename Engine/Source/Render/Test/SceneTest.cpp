@@ -6,6 +6,7 @@
 
 #include <Test/Test.h>
 #include <Core/Thread.h>
+#include <Common/Math/Transform.h>
 #include <Render/Scene.h>
 
 using namespace Render;
@@ -37,3 +38,14 @@ TEST(SceneTest, StoresConcreteProxyTypesIndependently)
     EXPECT_EQ(scene.Get<PointLightSceneProxy>(entity).intensity, 2.0f);
     EXPECT_EQ(scene.Get<SpotLightSceneProxy>(entity).intensity, 3.0f);
 }
+
+TEST(SceneTest, PrimitiveWorldBoundsFollowTransform)
+{
+    StaticPrimitiveSceneProxy primitive;
+    primitive.localBounds = Common::FBox(-1, -2, -3, 1, 2, 3);
+    primitive.localToWorld = Common::FTransform(Common::FVec3(2, 2, 2), Common::FQuat::FromEulerZYX(0, 0, 90), Common::FVec3(10, 0, 0)).GetTransformMatrix();
+    primitive.UpdateWorldBounds();
+
+    // 90 degrees around z swaps the x and y extents
+    EXPECT_TRUE(Common::AlmostEqual(primitive.worldBounds, Common::FBox(6, -2, -6, 14, 2, 6), 1.0e-4f));
+}
@@ -0,0 +1,140 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RenderTestDevice.h>
+#include <Test/Test.h>
+
+#include <Render/RenderCache.h>
+#include <Render/RenderGraph.h>
+#include <Render/TransientHeap.h>
+
+using namespace Render;
+
+struct TransientHeapTest : testing::Test, RenderTestDevice {};
+
+TEST_F(TransientHeapTest, PlanAliasesDisjointLifetimes)
+{
+    constexpr uint64_t mb = 1024 * 1024;
+    const std::vector<TransientAllocationRequest> requests = {
+        { { 4 * mb, 64 * 1024 }, 0, 1 },
+        { { 2 * mb, 64 * 1024, 0b110 }, 1, 2 },
+        { { 4 * mb, 64 * 1024, 0b011 }, 2, 3 }
+    };
+
+    const auto plan = PlanTransientAllocations(requests);
+    ASSERT_EQ(plan.placements[0].offset, 0);
+    ASSERT_EQ(plan.placements[1].offset, 4 * mb);
+    ASSERT_EQ(plan.placements[2].offset, 0);
+    ASSERT_FALSE(plan.placements[0].aliased);
+    ASSERT_FALSE(plan.placements[1].aliased);
+    ASSERT_TRUE(plan.placements[2].aliased);
+    ASSERT_EQ(plan.heapSize, 6 * mb);
+    ASSERT_EQ(plan.requestedBytes, 10 * mb);
+    ASSERT_EQ(plan.memoryTypeBits, 0b010);
+}
+
+TEST_F(TransientHeapTest, PlanKeepsOverlappingLifetimesApart)
+{
+    std::vector<TransientAllocationRequest> requests;
+    uint32_t seed = 7;
+    for (auto i = 0; i < 64; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        const uint32_t first = seed % 32;
+        const uint32_t length = (seed >> 8) % 8;
+        const uint64_t alignment = (seed >> 16) % 2 == 0 ? 256 : 64 * 1024;
+        requests.emplace_back(TransientAllocationRequest { { ((seed >> 12) % 1024 + 1) * alignment, alignment }, first, first + length });
+    }
+
+    const auto plan = PlanTransientAllocations(requests);
+    ASSERT_LT(plan.heapSize, plan.requestedBytes);
+    for (auto i = 0; i < requests.size(); i++) {
+        const auto begin = plan.placements[i].offset;
+        const auto end = begin + requests[i].allocationInfo.size;
+        ASSERT_EQ(begin % requests[i].allocationInfo.alignment, 0);
+        ASSERT_LE(end, plan.heapSize);
+        for (auto j = i + 1; j < requests.size(); j++) {
+            const bool lifetimesOverlap = requests[i].firstStep <= requests[j].lastStep && requests[j].firstStep <= requests[i].lastStep;
+            const auto otherBegin = plan.placements[j].offset;
+            const auto otherEnd = otherBegin + requests[j].allocationInfo.size;
+            ASSERT_FALSE(lifetimesOverlap && begin < otherEnd && otherBegin < end);
+        }
+    }
+}
+
+TEST_F(TransientHeapTest, RenderGraphAliasesTransientTextures)
+{
+    RHI::TextureCreateInfo textureDesc {};
+    textureDesc.dimension = RHI::TextureDimension::t2D;
+    textureDesc.width = 1024;
+    textureDesc.height = 1024;
+    textureDesc.depthOrArraySize = 1;
+    textureDesc.format = RHI::PixelFormat::rgba8Unorm;
+    textureDesc.usages = RHI::TextureUsageBits::copySrc | RHI::TextureUsageBits::copyDst;
+    textureDesc.mipLevels = 1;
+    textureDesc.samples = 1;
+    textureDesc.initialState = RHI::TextureState::undefined;
+    const auto output = device->CreateTexture(textureDesc);
+
+    // a chain of copies, the first and the last temporary never live at the same time
+    std::array<RHI::Texture*, 3> rhiTextures {};
+    for (auto frame = 0; frame < 2; frame++) {
+        RGBuilder builder(*device);
+        std::array<RGTextureRef, 3> textures {};
+        for (auto& texture : textures) {
+            texture = builder.CreateTexture(textureDesc);
+        }
+        auto* importedOutput = builder.ImportTexture(output.Get(), RHI::TextureState::undefined);
+
+        builder.AddCopyPass("Init", RGCopyPassDesc { {}, { textures[0] } }, [&](const RGBuilder& rg, RHI::CopyPassCommandRecorder&) -> void {
+            rhiTextures[0] = rg.GetRHI(textures[0]);
+        });
+        for (auto i = 1; i < 3; i++) {
+            builder.AddCopyPass("Copy", RGCopyPassDesc { { textures[i - 1] }, { textures[i] } }, [&, i](const RGBuilder& rg, RHI::CopyPassCommandRecorder&) -> void {
+                rhiTextures[i] = rg.GetRHI(textures[i]);
+            });
+        }
+        builder.AddCopyPass("Output", RGCopyPassDesc { { textures[2] }, { importedOutput } }, [](const RGBuilder&, RHI::CopyPassCommandRecorder&) -> void {});
+        builder.Execute(RGExecuteInfo {});
+
+        const auto& stats = TransientHeap::Get(*device).Stats();
+        const auto textureBytes = device->GetResourceAllocationInfo(textureDesc).size;
+        ASSERT_EQ(stats.requestedBytes, 3 * textureBytes);
+        ASSERT_EQ(stats.placedBytes, 2 * textureBytes);
+        ASSERT_EQ(stats.SavedBytes(), textureBytes);
+        ASSERT_EQ(rhiTextures[0], rhiTextures[2]);
+        ASSERT_NE(rhiTextures[0], rhiTextures[1]);
+        // placed resources are found again by the following frames
+        ASSERT_EQ(TransientHeap::Get(*device).PlacedResourceNum(), 2);
+        TransientHeap::Get(*device).Forfeit();
+    }
+}
+
+TEST_F(TransientHeapTest, AliasingAcrossPlans)
+{
+    auto& transientHeap = TransientHeap::Get(*device);
+    const auto storageDesc = RHI::BufferCreateInfo()
+        .SetSize(1024 * 1024)
+        .SetUsages(RHI::BufferUsageBits::storage)
+        .SetInitialState(RHI::BufferState::undefined);
+    const auto vertexDesc = RHI::BufferCreateInfo()
+        .SetSize(1024 * 1024)
+        .SetUsages(RHI::BufferUsageBits::vertex)
+        .SetInitialState(RHI::BufferState::undefined);
+
+    // each frame a single resource plan, the memory is handed over only when the previous frame placed another one
+    const std::array<std::pair<const RHI::BufferCreateInfo*, bool>, 4> frames = {
+        std::pair { &storageDesc, false },
+        std::pair { &storageDesc, false },
+        std::pair { &vertexDesc, true },
+        std::pair { &storageDesc, true }
+    };
+    for (const auto& [desc, expectAliased] : frames) {
+        const auto plan = PlanTransientAllocations({ { transientHeap.GetAllocationInfo(*desc), 0, 0 } });
+        const auto range = transientHeap.AllocateRange(plan);
+        bool aliased = !expectAliased;
+        transientHeap.AllocateBuffer(range, plan.placements[0].offset, *desc, aliased);
+        ASSERT_EQ(aliased, expectAliased);
+        transientHeap.Forfeit();
+    }
+}
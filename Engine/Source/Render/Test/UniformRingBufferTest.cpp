@@ -0,0 +1,77 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <RenderTestDevice.h>
+#include <Test/Test.h>
+
+#include <Render/RenderCache.h>
+#include <Render/UniformRingBuffer.h>
+
+using namespace Render;
+
+struct UniformRingBufferTest : testing::Test, RenderTestDevice {};
+
+TEST_F(UniformRingBufferTest, AllocationsAreAlignedAndShareAPage)
+{
+    auto& ring = UniformRingBuffer::Get(*device);
+
+    const Common::FVec4 value0(1, 2, 3, 4);
+    const Common::FVec4 value1(5, 6, 7, 8);
+    const UniformAllocation allocation0 = ring.Allocate(value0);
+    const UniformAllocation allocation1 = ring.Allocate(value1);
+    ring.Flush();
+
+    ASSERT_EQ(allocation0.buffer, allocation1.buffer);
+    ASSERT_EQ(allocation0.offset, 0);
+    ASSERT_EQ(allocation1.offset, Internal::uniformRingAlignment);
+    ASSERT_EQ(allocation1.size, sizeof(Common::FVec4));
+    ASSERT_EQ(ring.PageNum(), 1);
+}
+
+TEST_F(UniformRingBufferTest, SpillsIntoNewPagesAndReusesThem)
+{
+    auto& ring = UniformRingBuffer::Get(*device);
+    constexpr size_t allocationsPerPage = Internal::uniformRingPageSize / Internal::uniformRingAlignment;
+
+    const uint32_t value = 42;
+    RHI::Buffer* firstPage = nullptr;
+    for (size_t i = 0; i < allocationsPerPage + 1; i++) {
+        const UniformAllocation allocation = ring.Allocate(value);
+        if (i == 0) {
+            firstPage = allocation.buffer;
+        } else if (i == allocationsPerPage) {
+            ASSERT_NE(allocation.buffer, firstPage);
+            ASSERT_EQ(allocation.offset, 0);
+        }
+    }
+    ASSERT_EQ(ring.PageNum(), 2);
+
+    // the other frame slot gets its own page, coming back to the first slot rewinds onto the retained pages
+    ring.Forfeit();
+    const UniformAllocation otherSlot = ring.Allocate(value);
+    ASSERT_NE(otherSlot.buffer, firstPage);
+    ASSERT_EQ(ring.PageNum(), 3);
+
+    ring.Forfeit();
+    const UniformAllocation rewound = ring.Allocate(value);
+    ASSERT_EQ(rewound.buffer, firstPage);
+    ASSERT_EQ(rewound.offset, 0);
+    ASSERT_EQ(ring.PageNum(), 3);
+    ring.Flush();
+}
+
+TEST_F(UniformRingBufferTest, OversizedAllocationGetsItsOwnPage)
+{
+    auto& ring = UniformRingBuffer::Get(*device);
+    std::vector<uint8_t> data(Internal::uniformRingPageSize + 1, 1);
+
+    const uint32_t value = 1;
+    const UniformAllocation small = ring.Allocate(value);
+    const UniformAllocation large = ring.Allocate(data.data(), data.size());
+    ring.Flush();
+
+    ASSERT_NE(small.buffer, large.buffer);
+    ASSERT_EQ(large.offset, 0);
+    ASSERT_GE(large.buffer->GetCreateInfo().size, data.size());
+}
@@ -0,0 +1,117 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#if PLATFORM_LINUX
+#include <unistd.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <AssetBenchmark.h>
+#include <Common/Serialization.h>
+
+// load a mesh asset of state.range(0) vertices the way the asset manager does, through the schema file reader, from
+// a file read which copies every vertex stream or from a mapped file which leaves the streams as views into it,
+// optionally reading every position as a vertex buffer upload would
+namespace Runtime::AssetBenchmark {
+    MeshAsset::MeshAsset(Core::Uri inUri)
+        : Asset(std::move(inUri))
+    {
+    }
+
+    MeshAsset::~MeshAsset() = default;
+}
+
+namespace {
+    using namespace Runtime;
+    using namespace Runtime::AssetBenchmark;
+
+    const std::string meshFile = "../Test/Generated/Runtime/AssetBenchmark.Mesh.expa";
+
+    // resident memory of the process, page cache pages of a mapped file included once touched, 0 where not supported
+    size_t ResidentBytes()
+    {
+#if PLATFORM_LINUX
+        std::ifstream statm("/proc/self/statm");
+        size_t totalPages = 0;
+        size_t residentPages = 0;
+        statm >> totalPages >> residentPages;
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+        return 0;
+#endif
+    }
+
+    void SaveMesh(uint32_t inVertexCount)
+    {
+        std::mt19937 rng(0x1234u);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+        std::vector<Common::FVec3> positions(inVertexCount);
+        std::vector<Common::FVec3> tangents(inVertexCount);
+        std::vector<Common::FVec2> uv0(inVertexCount);
+        for (auto i = 0; i < inVertexCount; i++) {
+            positions[i] = Common::FVec3(dist(rng), dist(rng), dist(rng));
+            tangents[i] = Common::FVec3(1.0f, 0.0f, 0.0f);
+            uv0[i] = Common::FVec2(dist(rng), dist(rng));
+        }
+        std::vector<uint32_t> indices(static_cast<size_t>(inVertexCount) * 3);
+        std::iota(indices.begin(), indices.end(), 0u);
+        for (auto& index : indices) {
+            index %= inVertexCount;
+        }
+
+        MeshAsset mesh(Core::Uri(""));
+        mesh.vertices.vertexCount = inVertexCount;
+        mesh.vertices.indexCount = static_cast<uint32_t>(indices.size());
+        mesh.vertices.positions = std::move(positions);
+        mesh.vertices.tangents = std::move(tangents);
+        mesh.vertices.uv0 = std::move(uv0);
+        mesh.vertices.indices = std::move(indices);
+
+        Common::BinaryFileSerializeStream stream(meshFile);
+        Mirror::SchemaFile::Serialize(stream, Mirror::Any(std::ref(mesh)));
+    }
+}
+
+template <bool Mapped, bool Touch>
+static void LoadMeshAsset(benchmark::State& state)
+{
+    const auto vertexCount = static_cast<uint32_t>(state.range(0));
+    SaveMesh(vertexCount);
+
+    size_t residentGrowth = 0;
+    for (auto _ : state) {
+        const size_t residentBefore = ResidentBytes();
+        MeshAsset mesh(Core::Uri(""));
+        if constexpr (Mapped) {
+            Common::BinaryMappedFileDeserializeStream stream(meshFile);
+            benchmark::DoNotOptimize(Mirror::SchemaFile::Deserialize(stream, Mirror::Any(std::ref(mesh))));
+        } else {
+            Common::BinaryFileDeserializeStream stream(meshFile);
+            benchmark::DoNotOptimize(Mirror::SchemaFile::Deserialize(stream, Mirror::Any(std::ref(mesh))));
+        }
+        if constexpr (Touch) {
+            const auto& positions = mesh.vertices.positions;
+            benchmark::DoNotOptimize(std::accumulate(positions.begin(), positions.end(), 0.0f, [](float sum, const Common::FVec3& position) -> float {
+                return sum + position.x;
+            }));
+        }
+        residentGrowth = ResidentBytes() - residentBefore;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(vertexCount));
+    state.counters["residentGrowthMB"] = static_cast<double>(residentGrowth) / (1024.0 * 1024.0);
+}
+
+BENCHMARK(LoadMeshAsset<false, false>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadMeshAsset<true, false>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadMeshAsset<false, true>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadMeshAsset<true, true>)->RangeMultiplier(4)->Range(64 * 1024, 1024 * 1024)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,22 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#pragma once
+
+#include <Runtime/Meta.h>
+#include <Runtime/Asset/Asset.h>
+#include <Runtime/Asset/Mesh.h>
+
+namespace Runtime::AssetBenchmark {
+    // the vertex streams of a static mesh without the material reference, which would need a saved material asset
+    class EClass() MeshAsset final : public Asset {
+        EPolyDerivedClassBody(MeshAsset)
+
+    public:
+        explicit MeshAsset(Core::Uri inUri);
+        ~MeshAsset() override;
+
+        EProperty() StaticMeshVertices vertices;
+    };
+}
@@ -2,6 +2,8 @@
 // Created by johnk on 2026/7/12.
 //
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -12,6 +14,7 @@
 #include <flecs.h>
 
 #include <ECSBenchmark.h>
+#include <Common/Concurrent.h>
 #include <Runtime/ECS.h>
 
 namespace Runtime::ECSBenchmark {
@@ -125,6 +128,11 @@ namespace Runtime::ECSBenchmark::Internal {
             return inRegistry.RuntimeView(RuntimeFilter().Include<Position>().Include<Velocity>());
         }
 
+        static void SpawnBatch(Registry& inRegistry, int64_t inCount)
+        {
+            inRegistry.CreateBatch(static_cast<size_t>(inCount), Position(1.0f, 2.0f, 3.0f), Velocity(4.0f, 5.0f, 6.0f), Payload(0));
+        }
+
         template <typename F>
         static void EachMotion(MotionView& inView, F&& inFunc)
         {
@@ -142,6 +150,20 @@ namespace Runtime::ECSBenchmark::Internal {
         }
     };
 
+    class ChunkedECRegistry : public ECRegistry {
+    public:
+        ChunkedECRegistry()
+            : ECRegistry(ArchetypeStorage::chunked)
+        {
+        }
+    };
+
+    struct ExplosionChunkedBackend : ExplosionBackend {
+        static constexpr std::string_view name = "ExplosionChunked";
+
+        using Registry = ChunkedECRegistry;
+    };
+
     struct EnTTBackend {
         static constexpr std::string_view name = "EnTT";
 
@@ -197,6 +219,15 @@ namespace Runtime::ECSBenchmark::Internal {
             return result;
         }
 
+        static void SpawnBatch(Registry& inRegistry, int64_t inCount)
+        {
+            std::vector<Entity> entities(static_cast<size_t>(inCount));
+            inRegistry.create(entities.begin(), entities.end());
+            inRegistry.insert<Position>(entities.begin(), entities.end(), Position(1.0f, 2.0f, 3.0f));
+            inRegistry.insert<Velocity>(entities.begin(), entities.end(), Velocity(4.0f, 5.0f, 6.0f));
+            inRegistry.insert<Payload>(entities.begin(), entities.end(), Payload(0));
+        }
+
         template <typename F>
         static void EachMotion(MotionView& inView, F&& inFunc)
         {
@@ -395,6 +426,86 @@ namespace Runtime::ECSBenchmark::Internal {
         SetEntitiesProcessed(state, entityCount);
     }
 
+    // spawns a burst of entities into an archetype that keeps growing, the worst single spawn is what shows up as a
+    // frame spike, so it is reported next to the average
+    template <typename Backend>
+    static void SpawnBurst(benchmark::State& state)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const auto entityCount = state.range(0);
+        int64_t maxSpawnNs = 0;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            {
+                typename Backend::Registry registry;
+                state.ResumeTiming();
+                for (int64_t i = 0; i < entityCount; i++) {
+                    const auto begin = Clock::now();
+                    const auto entity = Backend::Create(registry);
+                    Backend::template Emplace<Position>(registry, entity, 1.0f, 2.0f, 3.0f);
+                    Backend::template Emplace<Velocity>(registry, entity, 4.0f, 5.0f, 6.0f);
+                    Backend::template Emplace<Payload>(registry, entity, static_cast<uint64_t>(i));
+                    maxSpawnNs = std::max(maxSpawnNs, static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count()));
+                }
+                benchmark::ClobberMemory();
+                state.PauseTiming();
+            }
+            state.ResumeTiming();
+        }
+
+        state.counters["maxSpawnNs"] = static_cast<double>(maxSpawnNs);
+        SetEntitiesProcessed(state, entityCount);
+    }
+
+    // SpawnPerEntity and SpawnBatch spawn the same set of entities into an empty registry, one through create + emplace
+    // per entity and one through the batch api of the backend
+    template <typename Backend>
+    static void SpawnPerEntity(benchmark::State& state)
+    {
+        const auto entityCount = state.range(0);
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            {
+                typename Backend::Registry registry;
+                state.ResumeTiming();
+                for (int64_t i = 0; i < entityCount; i++) {
+                    const auto entity = Backend::Create(registry);
+                    Backend::template Emplace<Position>(registry, entity, 1.0f, 2.0f, 3.0f);
+                    Backend::template Emplace<Velocity>(registry, entity, 4.0f, 5.0f, 6.0f);
+                    Backend::template Emplace<Payload>(registry, entity, uint64_t { 0 });
+                }
+                benchmark::ClobberMemory();
+                state.PauseTiming();
+            }
+            state.ResumeTiming();
+        }
+
+        SetEntitiesProcessed(state, entityCount);
+    }
+
+    template <typename Backend>
+    static void SpawnBatch(benchmark::State& state)
+    {
+        const auto entityCount = state.range(0);
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            {
+                typename Backend::Registry registry;
+                state.ResumeTiming();
+                Backend::SpawnBatch(registry, entityCount);
+                benchmark::ClobberMemory();
+                state.PauseTiming();
+            }
+            state.ResumeTiming();
+        }
+
+        SetEntitiesProcessed(state, entityCount);
+    }
+
     template <typename Backend>
     static void ComponentGet(benchmark::State& state)
     {
@@ -520,6 +631,33 @@ namespace Runtime::ECSBenchmark::Internal {
         SetEntitiesProcessed(state, entityCount);
     }
 
+    // integrates positions with ParallelEach on a dedicated pool of state.range(1) threads, compare the rows of one backend
+    // against each other to read the thread scaling
+    template <typename Backend>
+    static void ViewParallelIterate(benchmark::State& state)
+    {
+        const auto entityCount = state.range(0);
+        const auto threadNum = static_cast<uint8_t>(state.range(1));
+        typename Backend::Registry registry;
+        const auto entities = CreateEntities<Backend>(registry, entityCount);
+        AddMotionComponents<Backend>(registry, entities, false);
+        auto view = registry.template View<Position, const Velocity>();
+        Common::ThreadPool pool("ECSBenchmark", threadNum);
+
+        for (auto _ : state) {
+            view.ParallelEachChunk(pool, [](size_t inCount, const Entity*, Position* inPositions, const Velocity* inVelocities) -> void {
+                for (size_t i = 0; i < inCount; i++) {
+                    inPositions[i].x += inVelocities[i].x;
+                    inPositions[i].y += inVelocities[i].y;
+                    inPositions[i].z += inVelocities[i].z;
+                }
+            });
+            benchmark::ClobberMemory();
+        }
+
+        SetEntitiesProcessed(state, entityCount);
+    }
+
     template <typename Backend>
     static void RegisterBenchmarkCase(std::string_view inCaseName, void (*inFunction)(benchmark::State&))
     {
@@ -534,12 +672,29 @@ namespace Runtime::ECSBenchmark::Internal {
             ->Arg(largeEntityCount);
     }
 
+    template <typename Backend>
+    static void RegisterParallelBenchmarkCase(std::string_view inCaseName, void (*inFunction)(benchmark::State&))
+    {
+        std::string name = "Runtime::ECSBenchmark::";
+        name.append(inCaseName);
+        name += "/";
+        name.append(Backend::name);
+
+        auto* benchmark = benchmark::RegisterBenchmark(name.c_str(), inFunction);
+        for (int64_t threadNum = 1; threadNum <= 8; threadNum *= 2) {
+            benchmark->Args({ largeEntityCount, threadNum });
+        }
+        benchmark->UseRealTime();
+    }
+
     template <typename Backend>
     static void RegisterBackendBenchmarks()
     {
         RegisterBenchmarkCase<Backend>("EntityCreateDestroy", &EntityCreateDestroy<Backend>);
         RegisterBenchmarkCase<Backend>("ComponentAddRemove", &ComponentAddRemove<Backend>);
         RegisterBenchmarkCase<Backend>("ThreeComponentChurn", &ThreeComponentChurn<Backend>);
+        RegisterBenchmarkCase<Backend>("SpawnBurst", &SpawnBurst<Backend>);
+        RegisterBenchmarkCase<Backend>("SpawnPerEntity", &SpawnPerEntity<Backend>);
         RegisterBenchmarkCase<Backend>("ComponentGet", &ComponentGet<Backend>);
         RegisterBenchmarkCase<Backend>("ViewConstruct", &ViewConstruct<Backend>);
         RegisterBenchmarkCase<Backend>("ViewIterate", &ViewIterate<Backend>);
@@ -550,7 +705,13 @@ namespace Runtime::ECSBenchmark::Internal {
 
     const bool benchmarksRegistered = []() -> bool {
         RegisterBackendBenchmarks<ExplosionBackend>();
+        RegisterBackendBenchmarks<ExplosionChunkedBackend>();
+        RegisterParallelBenchmarkCase<ExplosionBackend>("ViewParallelIterate", &ViewParallelIterate<ExplosionBackend>);
+        RegisterParallelBenchmarkCase<ExplosionChunkedBackend>("ViewParallelIterate", &ViewParallelIterate<ExplosionChunkedBackend>);
+        RegisterBenchmarkCase<ExplosionBackend>("SpawnBatch", &SpawnBatch<ExplosionBackend>);
+        RegisterBenchmarkCase<ExplosionChunkedBackend>("SpawnBatch", &SpawnBatch<ExplosionChunkedBackend>);
         RegisterBackendBenchmarks<EnTTBackend>();
+        RegisterBenchmarkCase<EnTTBackend>("SpawnBatch", &SpawnBatch<EnTTBackend>);
         RegisterBackendBenchmarks<FlecsBackend>();
         return true;
     }();
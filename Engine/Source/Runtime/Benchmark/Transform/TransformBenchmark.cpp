@@ -0,0 +1,134 @@
+//
+// Created by johnk on 2026/10/18.
+//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Common/Memory.h>
+#include <Core/Thread.h>
+#include <Runtime/Component/Transform.h>
+#include <Runtime/GameThread.h>
+#include <Runtime/System/Transform.h>
+
+// every case ticks a TransformSystem over a fixed hierarchy with its root and a slice of local transforms dirty, the
+// first arg picks the propagation, the second one runs the game worker threads so levelOrdered can go parallel
+namespace {
+    constexpr int64_t wideFanOut = 128;
+    constexpr int64_t deepChainNum = 64;
+    constexpr int64_t deepChainDepth = 256;
+    constexpr size_t dirtyLocalStride = 16;
+
+    struct Tree {
+        Runtime::Entity root = Runtime::entityNull;
+        std::vector<Runtime::Entity> nodes;
+    };
+
+    Runtime::Entity AddNode(Runtime::ECRegistry& inRegistry, Runtime::Entity inParent)
+    {
+        Common::FTransform localTransform;
+        localTransform.translation = Common::FVec3(1.0f, 0.0f, 0.0f);
+        localTransform.rotation = Common::FQuat(Common::FVec3(0.0f, 0.0f, 1.0f), 5.0f);
+
+        const Runtime::Entity entity = inRegistry.Create();
+        inRegistry.Emplace<Runtime::Hierarchy>(entity);
+        inRegistry.Emplace<Runtime::WorldTransform>(entity);
+        if (inParent != Runtime::entityNull) {
+            inRegistry.Emplace<Runtime::LocalTransform>(entity, localTransform);
+            Runtime::HierarchyOps::AttachToParent(inRegistry, entity, inParent);
+        }
+        return entity;
+    }
+
+    // one root, wideFanOut children, each with wideFanOut children, few levels with a lot of work per level
+    Tree BuildWide(Runtime::ECRegistry& inRegistry)
+    {
+        Tree result;
+        result.root = AddNode(inRegistry, Runtime::entityNull);
+        for (int64_t i = 0; i < wideFanOut; i++) {
+            const auto child = AddNode(inRegistry, result.root);
+            result.nodes.emplace_back(child);
+            for (int64_t j = 0; j < wideFanOut; j++) {
+                result.nodes.emplace_back(AddNode(inRegistry, child));
+            }
+        }
+        return result;
+    }
+
+    // one root with deepChainNum chains of deepChainDepth nodes, many levels with little work per level
+    Tree BuildDeep(Runtime::ECRegistry& inRegistry)
+    {
+        Tree result;
+        result.root = AddNode(inRegistry, Runtime::entityNull);
+        for (int64_t i = 0; i < deepChainNum; i++) {
+            auto parent = result.root;
+            for (int64_t depth = 0; depth < deepChainDepth; depth++) {
+                parent = AddNode(inRegistry, parent);
+                result.nodes.emplace_back(parent);
+            }
+        }
+        return result;
+    }
+
+    template <Tree(*Build)(Runtime::ECRegistry&)>
+    void Propagate(benchmark::State& state)
+    {
+        const auto propagation = static_cast<Runtime::TransformPropagation>(state.range(0));
+        const bool parallel = state.range(1) != 0;
+
+        auto& workers = Runtime::GameWorkerThreads::Get();
+        if (parallel) {
+            workers.Start();
+        }
+        Common::FrameArena arena;
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::game, &arena);
+
+        Runtime::ECRegistry registry;
+        const auto tree = Build(registry);
+        Runtime::SystemSetupContext setupContext;
+        Runtime::TransformSystem transformSystem(registry, setupContext);
+        transformSystem.SetPropagation(propagation);
+        transformSystem.Tick(0.0f);
+        arena.Reset();
+
+        float rootX = 0.0f;
+        for (auto _ : state) {
+            registry.Update<Runtime::WorldTransform>(tree.root, [&](Runtime::WorldTransform& transform) -> void {
+                transform.localToWorld.translation.x = rootX += 1.0f;
+            });
+            for (size_t i = 0; i < tree.nodes.size(); i += dirtyLocalStride) {
+                registry.Update<Runtime::LocalTransform>(tree.nodes[i], [](Runtime::LocalTransform& transform) -> void {
+                    transform.localToParent.translation.y += 1.0f;
+                });
+            }
+            transformSystem.Tick(0.0f);
+            arena.Reset();
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(tree.nodes.size() + 1));
+
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::game, nullptr);
+        if (parallel) {
+            workers.Stop();
+        }
+    }
+
+    void RegisterPropagateCase(const std::string& inName, void (*inFunction)(benchmark::State&))
+    {
+        auto* benchmark = benchmark::RegisterBenchmark(("Runtime::TransformBenchmark::" + inName).c_str(), inFunction);
+        benchmark->ArgNames({ "propagation", "workers" });
+        benchmark->Args({ static_cast<int64_t>(Runtime::TransformPropagation::recursive), 0 });
+        benchmark->Args({ static_cast<int64_t>(Runtime::TransformPropagation::levelOrdered), 0 });
+        benchmark->Args({ static_cast<int64_t>(Runtime::TransformPropagation::levelOrdered), 1 });
+        benchmark->UseRealTime();
+    }
+
+    const bool benchmarksRegistered = []() -> bool {
+        RegisterPropagateCase("Wide", &Propagate<&BuildWide>);
+        RegisterPropagateCase("Deep", &Propagate<&BuildDeep>);
+        return true;
+    }();
+}
@@ -12,6 +12,7 @@
 #include <Common/Memory.h>
 #include <Common/Serialization.h>
 #include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
 #include <Common/Concepts.h>
 #include <Common/String.h>
 #include <Core/Uri.h>
@@ -131,11 +132,19 @@ namespace Runtime {
         template <Common::DerivedFrom<Asset> A> void SyncLoadSoft(SoftAssetPtr<A>& softAssetRef, const Mirror::Class& clazz);
         template <Common::DerivedFrom<Asset> A> void AsyncLoad(const Core::Uri& uri, const Mirror::Class& clazz, const OnAssetLoaded<A>& onAssetLoaded);
         template <Common::DerivedFrom<Asset> A> void AsyncLoadSoft(SoftAssetPtr<A>& softAssetRef, const Mirror::Class& clazz, const OnSoftAssetLoaded<A>& onSoftAssetLoaded);
+        // co_await AssetManager::Get().LoadAsync<A>(uri, clazz) loads on the asset threads and continues the awaiting
+        // coroutine there, follow it with Core::ResumeOn() to get back to an engine thread
+        template <Common::DerivedFrom<Asset> A> Common::Task<AssetPtr<A>> LoadAsync(Core::Uri uri, const Mirror::Class& clazz);
         template <Common::DerivedFrom<Asset> A> void Save(const AssetPtr<A>& assetRef);
         template <Common::DerivedFrom<Asset> A> void SaveSoft(const SoftAssetPtr<A>& softAssetRef);
+        // rewrites an asset file of the plain format as a schema file in place, the class is taken from the file,
+        // returns false if the file is already a schema file or its class is unknown
+        bool ConvertToSchemaFile(const Core::Uri& uri);
 
     private:
+        static void SaveInternal(const Common::Path& path, const Mirror::Any& ref);
         template <Common::DerivedFrom<Asset> A> AssetPtr<A> LoadInternal(const Core::Uri& uri, const Mirror::Class& clazz);
+        template <Common::DerivedFrom<Asset> A> AssetPtr<A> LoadCached(const Core::Uri& uri, const Mirror::Class& clazz);
 
         AssetManager();
 
@@ -570,39 +579,51 @@ namespace Runtime {
     template <Common::DerivedFrom<Asset> A>
     void AssetManager::AsyncLoad(const Core::Uri& uri, const Mirror::Class& clazz, const OnAssetLoaded<A>& onAssetLoaded)
     {
-        threadPool.EmplaceTask([=, this]() -> void {
-            AssetPtr<A> result = nullptr;
-            {
-                std::unique_lock<std::mutex> lock(mutex);
-                auto iter = weakAssetRefs.find(uri);
-                if (iter != weakAssetRefs.end() && !iter->second.Expired()) {
-                    result = iter->second.Lock().StaticCast<A>();
-                }
-            }
+        threadPool.Spawn([=, this]() -> void {
+            onAssetLoaded(LoadCached<A>(uri, clazz));
+        });
+    }
 
-            if (result == nullptr) {
-                result = LoadInternal<A>(uri, clazz);
-            }
+    template <Common::DerivedFrom<Asset> A>
+    Common::Task<AssetPtr<A>> AssetManager::LoadAsync(Core::Uri uri, const Mirror::Class& clazz)
+    {
+        co_await Common::ScheduleOn(threadPool);
+        co_return LoadCached<A>(uri, clazz);
+    }
 
-            AssetPtr<Asset> tempRef = result.template StaticCast<Asset>();
-            {
-                std::unique_lock<std::mutex> lock(mutex);
-                auto iter = weakAssetRefs.find(uri);
-                if (iter == weakAssetRefs.end()) {
-                    weakAssetRefs.emplace(std::make_pair(uri, WeakAssetPtr<Asset>(tempRef)));
-                } else {
-                    iter->second = tempRef;
-                }
+    template <Common::DerivedFrom<Asset> A>
+    AssetPtr<A> AssetManager::LoadCached(const Core::Uri& uri, const Mirror::Class& clazz)
+    {
+        AssetPtr<A> result = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            auto iter = weakAssetRefs.find(uri);
+            if (iter != weakAssetRefs.end() && !iter->second.Expired()) {
+                result = iter->second.Lock().StaticCast<A>();
             }
+        }
 
-            onAssetLoaded(result);
-        });
+        if (result == nullptr) {
+            result = LoadInternal<A>(uri, clazz);
+        }
+
+        AssetPtr<Asset> tempRef = result.template StaticCast<Asset>();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            auto iter = weakAssetRefs.find(uri);
+            if (iter == weakAssetRefs.end()) {
+                weakAssetRefs.emplace(std::make_pair(uri, WeakAssetPtr<Asset>(tempRef)));
+            } else {
+                iter->second = tempRef;
+            }
+        }
+        return result;
     }
 
     template <Common::DerivedFrom<Asset> A>
     void AssetManager::AsyncLoadSoft(SoftAssetPtr<A>& softAssetRef, const Mirror::Class& clazz, const OnSoftAssetLoaded<A>& onSoftAssetLoaded)
     {
-        threadPool.EmplaceTask([this, softAssetRef, onSoftAssetLoaded, clazz]() -> void {
+        threadPool.Spawn([this, softAssetRef, onSoftAssetLoaded, clazz]() -> void {
             AsyncLoad(softAssetRef.Uri(), clazz, [&](AssetPtr<A>& ref) -> void {
                 softAssetRef = ref;
                 onSoftAssetLoaded();
@@ -615,10 +636,7 @@ namespace Runtime {
     {
         Assert(assetRef.Valid());
         const Core::AssetUriParser parser(assetRef.Uri());
-        Common::BinaryFileSerializeStream stream(parser.Parse().Absolute().String());
-
-        const Mirror::Any ref = assetRef->GetClass().Cast(Mirror::ForwardAsArg(*assetRef.Get()));
-        ref.Serialize(stream);
+        SaveInternal(parser.Parse().Absolute(), assetRef->GetClass().Cast(Mirror::ForwardAsArg(*assetRef.Get())));
     }
 
     template <Common::DerivedFrom<Asset> A>
@@ -631,10 +649,15 @@ namespace Runtime {
     AssetPtr<A> AssetManager::LoadInternal(const Core::Uri& uri, const Mirror::Class& clazz)
     {
         const Core::AssetUriParser parser(uri);
-        Common::BinaryFileDeserializeStream stream(parser.Parse().Absolute().String());
+        // blob properties keep pointing into the mapping instead of copying their bytes
+        Common::BinaryMappedFileDeserializeStream stream(parser.Parse().Absolute().String());
 
         Mirror::Any ptr = clazz.New(uri);
-        ptr.Deref().Deserialize(stream);
+        if (Mirror::SchemaFile::Is(stream)) {
+            Mirror::SchemaFile::Deserialize(stream, ptr.Deref());
+        } else {
+            ptr.Deref().Deserialize(stream);
+        }
 
         AssetPtr<A> result = Common::SharedPtr<A>(ptr.As<A*>());
         result->SetUri(uri);
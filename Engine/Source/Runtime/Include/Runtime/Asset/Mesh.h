@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <Common/Blob.h>
 #include <Common/Math/Adapters.h>
 #include <Runtime/Asset/Asset.h>
 #include <Runtime/Asset/Material.h>
@@ -16,13 +17,14 @@ namespace Runtime {
 
         EProperty() uint32_t vertexCount;
         EProperty() uint32_t indexCount;
-        EProperty() std::vector<Common::FVec3> positions;
-        EProperty() std::vector<Common::FVec3> tangents;
-        EProperty() std::vector<Common::FVec2> uv0;
-        EProperty() std::vector<uint32_t> indices;
+        // views into the mapped asset file when loaded
+        EProperty() Common::Blob<Common::FVec3> positions;
+        EProperty() Common::Blob<Common::FVec3> tangents;
+        EProperty() Common::Blob<Common::FVec2> uv0;
+        EProperty() Common::Blob<uint32_t> indices;
         // optional
-        EProperty() std::vector<Common::FVec2> uv1;
-        EProperty() std::vector<Common::FVec3> colors;
+        EProperty() Common::Blob<Common::FVec2> uv1;
+        EProperty() Common::Blob<Common::FVec3> colors;
     };
 
     struct RUNTIME_API EClass() StaticMeshLOD {
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 
+#include <Common/Blob.h>
 #include <RHI/Common.h>
 #include <Runtime/Asset/Asset.h>
 #include <Runtime/RenderThreadPtr.h>
@@ -82,7 +83,8 @@ namespace Runtime {
         EPolyDerivedClassBody(Texture)
 
     public:
-        using Pixels = std::vector<uint8_t>;
+        // loaded from a mapped asset file pixels are a view into it until written
+        using Pixels = Common::Blob<uint8_t>;
 
         explicit Texture(Core::Uri inUri);
         ~Texture() override;
@@ -44,14 +44,14 @@ namespace Runtime {
     public:
         using TraverseFunc = std::function<void(Entity, Entity)>;
 
-        static bool HasParent(ECRegistry& inRegistry, Entity inTarget);
-        static bool HasBro(ECRegistry& inRegistry, Entity inTarget);
-        static bool HasChildren(ECRegistry& inRegistry, Entity inTarget);
+        static bool HasParent(const ECRegistry& inRegistry, Entity inTarget);
+        static bool HasBro(const ECRegistry& inRegistry, Entity inTarget);
+        static bool HasChildren(const ECRegistry& inRegistry, Entity inTarget);
         static void AttachToParent(ECRegistry& inRegistry, Entity inChild, Entity inParent);
         static void DetachFromParent(ECRegistry& inRegistry, Entity inChild);
         static void Remove(ECRegistry& inRegistry, Entity inTarget);
         static void Destroy(ECRegistry& inRegistry, Entity inTarget);
-        static void TraverseChildren(ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc);
-        static void TraverseChildrenRecursively(ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc);
+        static void TraverseChildren(const ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc);
+        static void TraverseChildrenRecursively(const ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc);
     };
 }
@@ -6,8 +6,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <tuple>
 #include <unordered_set>
 #include <unordered_map>
@@ -18,6 +21,7 @@
 #include <Common/Memory.h>
 #include <Mirror/Mirror.h>
 #include <Runtime/Meta.h>
+#include <Runtime/GameThread.h>
 #include <Runtime/Api.h>
 
 namespace Runtime {
@@ -30,12 +34,28 @@ namespace Runtime {
     using SystemClass = const Mirror::Class*;
 
     class ECRegistry;
+    class ECCommandBuffer;
     class Client;
     struct SystemSetupContext;
 
+    // contiguous keeps one growing column per component, so every growth relocates all rows of the archetype. chunked
+    // packs the component columns of a fixed row count into fixed-size blocks, growth only allocates a new block and
+    // rows already stored never move in memory
+    enum class ArchetypeStorage : uint8_t {
+        contiguous,
+        chunked,
+        max
+    };
+
     template <typename T>
     concept ECRegistryOrConst = std::is_same_v<std::remove_const_t<T>, ECRegistry>;
 
+    // anything that can run inTaskNum indexed tasks and wait for all of them, e.g. GameWorkerThreads or Common::ThreadPool
+    template <typename T>
+    concept ParallelTaskExecutor = requires(T& inExecutor) { inExecutor.ExecuteTasks(size_t(), std::declval<std::function<void(size_t)>>()); };
+
+    static constexpr size_t defaultParallelGrainSize = 1024;
+
     class RUNTIME_API EClass() System {
     public:
         EPolyBaseClassBody(System)
@@ -47,6 +67,42 @@ namespace Runtime {
     protected:
         ECRegistry& registry;
     };
+
+    // components and global components a system touches in Tick(), systems of an automatic group whose accesses do not
+    // conflict run concurrently. a system without any declaration is treated as touching everything
+    class RUNTIME_API SystemAccess {
+    public:
+        SystemAccess();
+        // reads the EClass(reads=..., writes=..., globalReads=..., globalWrites=..., structural) meta of the system class
+        static SystemAccess FromMeta(SystemClass inClass);
+
+        template <typename C> SystemAccess& Read();
+        template <typename C> SystemAccess& Write();
+        template <typename G> SystemAccess& GRead();
+        template <typename G> SystemAccess& GWrite();
+        SystemAccess& ReadDyn(CompClass inClass);
+        SystemAccess& WriteDyn(CompClass inClass);
+        SystemAccess& GReadDyn(GCompClass inClass);
+        SystemAccess& GWriteDyn(GCompClass inClass);
+        // creates/destroys entities or adds/removes components, tags or global components, conflicts with every system
+        SystemAccess& Structural();
+
+        bool Declared() const;
+        bool IsStructural() const;
+        bool CanRead(CompClass inClass) const;
+        bool CanWrite(CompClass inClass) const;
+        bool GCanRead(GCompClass inClass) const;
+        bool GCanWrite(GCompClass inClass) const;
+        bool ConflictsWith(const SystemAccess& inOther) const;
+
+    private:
+        bool declared;
+        bool structural;
+        std::unordered_set<CompClass> reads;
+        std::unordered_set<CompClass> writes;
+        std::unordered_set<GCompClass> globalReads;
+        std::unordered_set<GCompClass> globalWrites;
+    };
 }
 
 namespace Runtime::Internal {
@@ -55,6 +111,13 @@ namespace Runtime::Internal {
 
     template <typename T> const Mirror::Class* GetClass();
     template <typename T> struct MemberFuncPtrTraits;
+    template <typename A, typename Q> struct ViewChunkRange;
+    template <typename A, typename Q, typename M> std::vector<ViewChunkRange<A, Q>> SplitViewChunkRanges(M& inArchetypes, const std::vector<Q>& inQuery, size_t inGrainSize);
+
+    // runs every task on the calling thread, used by parallel view traversal when the game worker pool is not running
+    struct SerialTaskExecutor {
+        template <typename F> void ExecuteTasks(size_t inTaskNum, F&& inTask);
+    };
 
     class RUNTIME_API TagStorage {
     public:
@@ -132,7 +195,7 @@ namespace Runtime::Internal {
             std::vector<CompMapping> compMappings;
         };
 
-        explicit Archetype(ArchetypeLayout inLayout = {});
+        explicit Archetype(ArchetypeLayout inLayout = {}, ArchetypeStorage inStorage = ArchetypeStorage::contiguous);
         ~Archetype();
 
         Archetype(const Archetype& inOther);
@@ -144,6 +207,8 @@ namespace Runtime::Internal {
         bool ContainsTag(TagClass inClass) const;
         bool Contains(CompClass inClazz) const;
         bool NotContainsAny(const std::vector<CompClass>& inClasses) const;
+        // makes room for inElemNum more elems at once, so a following run of EmplaceElem() never relocates rows
+        void ReserveElems(size_t inElemNum);
         size_t EmplaceElem(Entity inEntity);
         size_t EmplaceElem(Entity inEntity, Archetype& inSrcArchetype, size_t inSrcElemIndex, const std::vector<CompMapping>& inCompMappings);
         Mirror::Any EmplaceComp(size_t inElemIndex, CompClass inCompClass, const Mirror::Any& inCompRef);
@@ -155,17 +220,22 @@ namespace Runtime::Internal {
         template <typename C> const C& GetComp(size_t inElemIndex) const;
         ElemPtr GetCompAt(size_t inElemIndex, size_t inCompIndex);
         const void* GetCompAt(size_t inElemIndex, size_t inCompIndex) const;
-        ElemPtr GetCompColumn(size_t inCompIndex);
-        const void* GetCompColumn(size_t inCompIndex) const;
+        size_t ChunkCount() const;
+        size_t ChunkBegin(size_t inChunkIndex) const;
+        size_t ChunkElemCount(size_t inChunkIndex) const;
+        ElemPtr GetChunkCompColumn(size_t inChunkIndex, size_t inCompIndex);
+        const void* GetChunkCompColumn(size_t inChunkIndex, size_t inCompIndex) const;
         size_t GetCompIndex(CompClass inCompClass) const;
         template <typename C> size_t GetCompIndex() const;
         Entity EntityAt(size_t inElemIndex) const;
+        const Entity* Entities() const;
         size_t Count() const;
         auto All() const;
         const std::vector<CompRtti>& GetCompRttis() const;
         const TagStorage& GetTags() const;
         ArchetypeLayout GetLayout() const;
         ArchetypeId Id() const;
+        ArchetypeStorage Storage() const;
         const Transition* FindAddTransition(CompClass inClass) const;
         const Transition* FindRemoveTransition(CompClass inClass) const;
         const Transition& CacheAddTransition(CompClass inClass, Archetype& inArchetype);
@@ -173,22 +243,43 @@ namespace Runtime::Internal {
 
     private:
         using CompRttiIndex = size_t;
+
+        struct Chunk {
+            // only used by chunked storage, all columns of the chunk live in this block
+            void* block;
+            std::vector<ElemPtr> columns;
+        };
+
+        static constexpr size_t chunkBlockSize = 16 * 1024;
+        static constexpr size_t maxChunkShift = 16;
+
         size_t Capacity() const;
         void Reserve(float inRatio = 1.5f);
         void DestroyElements();
         void ReleaseMemory();
         void AllocateNewElemBack();
-        ElemPtr CompAt(ElemPtr inMemory, size_t inCompIndex, size_t inElemIndex) const;
+        void ComputeChunkLayout();
+        size_t ComputeChunkColumnOffsets(size_t inRowCount, std::vector<size_t>& outOffsets) const;
+        Chunk AllocateChunk(size_t inRowCount) const;
+        void FreeChunk(Chunk& inChunk) const;
+        ElemPtr CompAt(ElemPtr inMemory, size_t inCompIndex, size_t inRowIndex) const;
         const Transition& CacheTransition(std::vector<Transition>& inTransitions, CompClass inClass, Archetype& inArchetype);
 
         ArchetypeId id;
+        ArchetypeStorage storage;
         size_t count;
         size_t capacity;
+        // elem index -> (elemIndex >> chunkShift, elemIndex & chunkMask), contiguous storage maps every elem to chunk 0
+        size_t chunkShift;
+        size_t chunkMask;
+        size_t chunkBlockBytes;
+        size_t chunkBlockAlignment;
         std::vector<CompRtti> rttiVec;
         TagStorage tags;
         std::unordered_map<CompClass, CompRttiIndex> rttiMap;
-        std::vector<ElemPtr> compMemory;
         std::vector<size_t> compStrides;
+        std::vector<size_t> chunkColumnOffsets;
+        std::vector<Chunk> chunks;
         std::vector<Entity> elemMap;
         std::vector<Transition> addTransitions;
         std::vector<Transition> removeTransitions;
@@ -256,15 +347,57 @@ namespace Runtime::Internal {
         std::unordered_map<std::string, Mirror::Any> GetArguments();
         const std::unordered_map<std::string, Mirror::Any>& GetArguments() const;
         SystemClass GetClass() const;
+        // initialized from the class meta, can be extended when registering the system
+        SystemAccess& GetAccess();
+        const SystemAccess& GetAccess() const;
 
     private:
         void BuildArgumentLists();
 
         SystemClass clazz;
         std::unordered_map<std::string, Mirror::Any> arguments;
+        SystemAccess access;
+    };
+
+    // debug build only, while a system of an executor ticks on this thread, asserts that every registry access of the
+    // system was declared in its SystemAccess. systems without declarations are not checked
+    class RUNTIME_API SystemAccessChecker {
+    public:
+        SystemAccessChecker(const ECRegistry& inRegistry, const SystemFactory& inFactory);
+        ~SystemAccessChecker();
+
+        NonCopyable(SystemAccessChecker)
+        NonMovable(SystemAccessChecker)
+
+        static void CheckRead(const ECRegistry& inRegistry, CompClass inClass);
+        static void CheckWrite(const ECRegistry& inRegistry, CompClass inClass);
+        static void CheckGRead(const ECRegistry& inRegistry, GCompClass inClass);
+        static void CheckGWrite(const ECRegistry& inRegistry, GCompClass inClass);
+        static void CheckStructural(const ECRegistry& inRegistry);
+
+    private:
+        static const SystemAccessChecker* Current(const ECRegistry& inRegistry);
+
+        const ECRegistry& registry;
+        const SystemFactory& factory;
+        const SystemAccessChecker* last;
     };
 }
 
+#if BUILD_CONFIG_DEBUG
+#define ECS_CHECK_READ(registry, clazz) ::Runtime::Internal::SystemAccessChecker::CheckRead(registry, clazz)
+#define ECS_CHECK_WRITE(registry, clazz) ::Runtime::Internal::SystemAccessChecker::CheckWrite(registry, clazz)
+#define ECS_CHECK_G_READ(registry, clazz) ::Runtime::Internal::SystemAccessChecker::CheckGRead(registry, clazz)
+#define ECS_CHECK_G_WRITE(registry, clazz) ::Runtime::Internal::SystemAccessChecker::CheckGWrite(registry, clazz)
+#define ECS_CHECK_STRUCTURAL(registry) ::Runtime::Internal::SystemAccessChecker::CheckStructural(registry)
+#else
+#define ECS_CHECK_READ(registry, clazz) ((void) 0)
+#define ECS_CHECK_WRITE(registry, clazz) ((void) 0)
+#define ECS_CHECK_G_READ(registry, clazz) ((void) 0)
+#define ECS_CHECK_G_WRITE(registry, clazz) ((void) 0)
+#define ECS_CHECK_STRUCTURAL(registry) ((void) 0)
+#endif
+
 namespace Runtime {
     template <typename C>
     class ScopedUpdater {
@@ -354,7 +487,17 @@ namespace Runtime {
         NonCopyable(BasicView)
         NonMovable(BasicView)
 
+        // inFunc(Entity, C&...), or inFunc(Entity)
         template <typename F> void Each(F&& inFunc) const;
+        // inFunc(size_t count, const Entity* entities, C*... comps), called once per contiguous run of rows
+        template <typename F> void EachChunk(F&& inFunc) const;
+        // parallel variants split the matched rows into ranges of at most inGrainSize rows and run them as tasks of the
+        // executor (game worker pool by default), so inFunc must be safe to call concurrently and must not change the
+        // structure of the registry (create/destroy entities, add/remove components or tags)
+        template <typename F> void ParallelEach(F&& inFunc, size_t inGrainSize = defaultParallelGrainSize) const;
+        template <ParallelTaskExecutor X, typename F> void ParallelEach(X& inExecutor, F&& inFunc, size_t inGrainSize = defaultParallelGrainSize) const;
+        template <typename F> void ParallelEachChunk(F&& inFunc, size_t inGrainSize = defaultParallelGrainSize) const;
+        template <ParallelTaskExecutor X, typename F> void ParallelEachChunk(X& inExecutor, F&& inFunc, size_t inGrainSize = defaultParallelGrainSize) const;
         const ResultVector& All() const;
         size_t Count() const;
         ConstIter Begin() const;
@@ -365,15 +508,20 @@ namespace Runtime {
     private:
         using CompColumnPtr = std::conditional_t<std::is_const_v<R>, const void*, void*>;
         using CompColumns = std::array<CompColumnPtr, sizeof...(C)>;
+        using ArchetypeType = std::conditional_t<std::is_const_v<R>, const Internal::Archetype, Internal::Archetype>;
+        template <typename Comp> using CompPtr = std::conditional_t<std::is_const_v<R>, const std::remove_const_t<Comp>*, Comp*>;
 
         struct QueryEntry {
             Internal::ArchetypeId archetype;
             std::array<size_t, sizeof...(C)> compIndices;
         };
 
-        template <typename A, size_t... I> CompColumns ResolveCompColumns(A& inArchetype, const QueryEntry& inEntry, std::index_sequence<I...>) const;
-        template <size_t... I> auto MakeResult(Internal::Archetype& inArchetype, size_t inElemIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const;
-        template <size_t... I> auto MakeResult(const Internal::Archetype& inArchetype, size_t inElemIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const;
+        using ChunkRange = Internal::ViewChunkRange<ArchetypeType, QueryEntry>;
+
+        template <typename A, size_t... I> CompColumns ResolveCompColumns(A& inArchetype, size_t inChunkIndex, const QueryEntry& inEntry, std::index_sequence<I...>) const;
+        template <size_t... I> auto MakeResult(Internal::Archetype& inArchetype, size_t inElemIndex, size_t inRowIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const;
+        template <size_t... I> auto MakeResult(const Internal::Archetype& inArchetype, size_t inElemIndex, size_t inRowIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const;
+        template <typename F, size_t... I> void InvokeChunkFunc(F& inFunc, const ChunkRange& inRange, std::index_sequence<I...>) const;
         void Materialize() const;
         void Evaluate(R& inRegistry);
 
@@ -418,6 +566,9 @@ namespace Runtime {
         NonMovable(BasicRuntimeView)
 
         template <typename F> void Each(F&& inFunc) const;
+        // same contract as BasicView::ParallelEach
+        template <typename F> void ParallelEach(F&& inFunc, size_t inGrainSize = defaultParallelGrainSize) const;
+        template <ParallelTaskExecutor X, typename F> void ParallelEach(X& inExecutor, F&& inFunc, size_t inGrainSize = defaultParallelGrainSize) const;
         size_t Count() const;
         ConstIter Begin() const;
         ConstIter End() const;
@@ -427,14 +578,16 @@ namespace Runtime {
     private:
         using CompColumnPtr = std::conditional_t<std::is_const_v<R>, const void*, void*>;
 
+        using ArchetypeType = std::conditional_t<std::is_const_v<R>, const Internal::Archetype, Internal::Archetype>;
+
         struct QueryEntry {
             Internal::ArchetypeId archetype;
             std::vector<size_t> compIndices;
         };
 
         template <typename ArgTuple, size_t... I> auto BuildCompSlots(std::index_sequence<I...>) const;
-        template <typename F, typename ArgTuple, typename A, size_t... I> void InvokeTraverseFuncInternal(F&& inFunc, A& inArchetype, size_t inElemIndex, const std::vector<CompColumnPtr>& inCompColumns, const std::array<size_t, sizeof...(I)>& inCompSlots, std::index_sequence<I...>) const;
-        template <typename C> decltype(auto) GetCompRef(size_t inElemIndex, const std::vector<CompColumnPtr>& inCompColumns, size_t inCompSlot) const;
+        template <typename F, typename ArgTuple, typename A, size_t... I> void InvokeTraverseFuncInternal(F&& inFunc, A& inArchetype, size_t inElemIndex, size_t inRowIndex, const std::vector<CompColumnPtr>& inCompColumns, const std::array<size_t, sizeof...(I)>& inCompSlots, std::index_sequence<I...>) const;
+        template <typename C> decltype(auto) GetCompRef(size_t inRowIndex, const std::vector<CompColumnPtr>& inCompColumns, size_t inCompSlot) const;
         void MaterializeEntities() const;
         void Evaluate(R& inRegistry, const RuntimeFilter& inFilter);
 
@@ -592,7 +745,7 @@ namespace Runtime {
             GCompEvent onRemove;
         };
 
-        ECRegistry();
+        explicit ECRegistry(ArchetypeStorage inStorage = ArchetypeStorage::contiguous);
         ~ECRegistry();
 
         ECRegistry(const ECRegistry& inOther);
@@ -616,6 +769,12 @@ namespace Runtime {
         size_t CompCount(Entity inEntity) const;
         void TagEach(Entity inEntity, const TagTraverseFunc& inFunc) const;
         size_t TagCount(Entity inEntity) const;
+        ArchetypeStorage GetArchetypeStorage() const;
+
+        // batch, the target archetype is resolved and reserved once for the whole batch and the components are
+        // constructed in place, CreateBatch() copies the given components into every new entity
+        template <typename... C> std::vector<Entity> CreateBatch(size_t inCount, const C&... inComps);
+        template <typename C, typename... Args> void EmplaceBatch(std::span<const Entity> inEntities, const Args&... inArgs);
 
         // component static
         template <typename C, typename... Args> C& Emplace(Entity inEntity, Args&&... inArgs);
@@ -695,6 +854,12 @@ namespace Runtime {
         // comp observer
         Runtime::Observer Observer();
 
+        // deferred structural changes, ThreadCommandBuffer() returns the calling thread's buffer of this registry and
+        // recording into it never touches the registry, FlushCommandBuffers() applies the buffers of all threads and
+        // must be called while nothing else accesses the registry (SystemGraphExecutor calls it after each tick)
+        ECCommandBuffer& ThreadCommandBuffer();
+        void FlushCommandBuffers();
+
         // serialization
         void Save(ECArchive& outArchive) const;
         void Load(const ECArchive& inArchive);
@@ -705,6 +870,7 @@ namespace Runtime {
     private:
         template <typename... T> friend class BasicView;
         template <ECRegistryOrConst R> friend class BasicRuntimeView;
+        friend class ECCommandBuffer;
 
         void NotifyConstructedDyn(CompClass inClass, Entity inEntity);
         void NotifyRemoveDyn(CompClass inClass, Entity inEntity);
@@ -717,9 +883,13 @@ namespace Runtime {
         Internal::EntityPool::Location MoveEntityForAdd(CompClass inClass, Entity inEntity, const Internal::EntityPool::Location& inLocation, Internal::ArchetypeLayout inLayout);
         Internal::EntityPool::Location MoveEntityThroughTransition(Entity inEntity, const Internal::EntityPool::Location& inLocation, const Internal::Archetype::Transition& inTransition);
         void MoveEntityForRemove(CompClass inClass, Entity inEntity);
+        const Internal::Archetype::Transition& FindOrCacheAddTransition(CompClass inClass, Internal::Archetype& inArchetype, Internal::ArchetypeLayout inLayout);
+        Internal::EntityPool::Location CreateBatchElems(std::vector<Internal::CompRtti> inRttis, size_t inCount, std::vector<Entity>& outEntities);
+        void MoveEntitiesForAdd(const Internal::CompRtti& inRtti, std::span<const Entity> inEntities);
         void EraseArchetypeElem(Internal::Archetype& inArchetype, size_t inElemIndex);
         void RebindEntityArchetypes();
 
+        ArchetypeStorage archetypeStorage;
         Internal::EntityPool entities;
         std::unordered_map<GCompClass, Mirror::Any> globalComps;
         std::unordered_map<Internal::ArchetypeId, Internal::Archetype> archetypes;
@@ -728,11 +898,90 @@ namespace Runtime {
         // transients, not copy or move
         std::unordered_map<CompClass, CompEvents> compEvents;
         std::unordered_map<GCompClass, GCompEvents> globalCompEvents;
+        // a copy gets a new uid and no buffers, a move takes both so the thread caches keyed by uid stay valid
+        uint64_t uid;
+        std::mutex commandBuffersMutex;
+        std::vector<Common::UniquePtr<ECCommandBuffer>> commandBuffers;
+    };
+
+    // records creates, destroys, component and tag changes to apply later. Apply() folds the commands of each entity,
+    // sorts the entities by source and target archetype and moves every group of rows with one capacity reservation,
+    // instead of one archetype transition per command
+    class RUNTIME_API ECCommandBuffer {
+    public:
+        ECCommandBuffer();
+        ~ECCommandBuffer();
+
+        NonCopyable(ECCommandBuffer)
+        NonMovable(ECCommandBuffer)
+
+        // returns a pending entity, it can only be used with this buffer until Apply() gives the real entity
+        Entity Create();
+        void Destroy(Entity inEntity);
+        template <typename C, typename... Args> void Emplace(Entity inEntity, Args&&... inArgs);
+        template <typename C> void Remove(Entity inEntity);
+        template <typename T> void AddTag(Entity inEntity);
+        template <typename T> void RemoveTag(Entity inEntity);
+        void EmplaceDyn(CompClass inClass, Entity inEntity, const Mirror::ArgumentList& inArgs);
+        void RemoveDyn(CompClass inClass, Entity inEntity);
+        void AddTagDyn(TagClass inClass, Entity inEntity);
+        void RemoveTagDyn(TagClass inClass, Entity inEntity);
+        size_t Count() const;
+        bool Empty() const;
+        // returns the created entities in Create() order
+        std::vector<Entity> Apply(ECRegistry& inRegistry);
+        void Clear();
+
+        static bool IsPending(Entity inEntity);
+
+    private:
+        static constexpr Entity pendingEntityBit = static_cast<Entity>(1) << (std::numeric_limits<Entity>::digits - 1);
+        static constexpr size_t stagingBlockSize = 16 * 1024;
+        static constexpr size_t maxStagingAlignment = 64;
+
+        enum class CommandType : uint8_t {
+            destroy,
+            emplace,
+            remove,
+            addTag,
+            removeTag,
+            max
+        };
+
+        struct Command {
+            CommandType type;
+            Entity entity;
+            CompClass clazz;
+            // emplace only, the staged component and the index of its rtti in stagedRttis
+            Internal::ElemPtr comp;
+            size_t rttiIndex;
+        };
+
+        struct StagingBlock {
+            void* memory;
+            size_t size;
+        };
+
+        void Record(CommandType inType, Entity inEntity, CompClass inClass, Internal::ElemPtr inComp = nullptr, size_t inRttiIndex = 0);
+        size_t FindOrAddRtti(const Internal::CompRtti& inRtti);
+        Internal::ElemPtr AllocateStaging(size_t inSize, size_t inAlignment);
+        void DestroyStaged(Command& inCommand);
+
+        Entity pendingNum;
+        std::vector<Command> commands;
+        std::vector<Internal::CompRtti> stagedRttis;
+        std::unordered_map<CompClass, size_t> stagedRttiMap;
+        std::vector<StagingBlock> stagingBlocks;
+        size_t stagingBlockIndex;
+        size_t stagingOffset;
     };
 
     enum class SystemExecuteStrategy : uint8_t {
         sequential,
         concurrent,
+        // systems are ordered by their declared SystemAccess, a system only waits for the earlier systems of the group
+        // it conflicts with
+        automatic,
         max
     };
 
@@ -800,11 +1049,15 @@ namespace Runtime {
         struct SystemGroupContext {
             std::vector<SystemContext> systems;
             SystemExecuteStrategy strategy;
+            // automatic strategy only, indices of the earlier systems in the group each system must wait for
+            std::vector<std::vector<size_t>> dependencies;
         };
 
         friend class SystemGraphExecutor;
         using ActionFunc = std::function<void(SystemContext&)>;
 
+        static std::vector<std::vector<size_t>> BuildDependencies(const std::vector<SystemContext>& inSystems);
+
         void ParallelPerformAction(const ActionFunc& inActionFunc);
 
         std::vector<SystemGroupContext> systemGraph;
@@ -879,6 +1132,41 @@ namespace Runtime::Internal {
         return result;
     }
 
+    template <typename A, typename Q>
+    struct ViewChunkRange {
+        A* archetype;
+        const Q* entry;
+        size_t chunkIndex;
+        size_t rowBegin;
+        size_t rowEnd;
+    };
+
+    template <typename A, typename Q, typename M>
+    std::vector<ViewChunkRange<A, Q>> SplitViewChunkRanges(M& inArchetypes, const std::vector<Q>& inQuery, size_t inGrainSize)
+    {
+        Assert(inGrainSize > 0);
+        std::vector<ViewChunkRange<A, Q>> result;
+        for (const auto& entry : inQuery) {
+            A& archetype = inArchetypes.at(entry.archetype);
+            const auto chunkCount = archetype.ChunkCount();
+            for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+                const auto chunkElemCount = archetype.ChunkElemCount(chunkIndex);
+                for (size_t rowBegin = 0; rowBegin < chunkElemCount; rowBegin += inGrainSize) {
+                    result.emplace_back(ViewChunkRange<A, Q> { &archetype, &entry, chunkIndex, rowBegin, std::min(rowBegin + inGrainSize, chunkElemCount) });
+                }
+            }
+        }
+        return result;
+    }
+
+    template <typename F>
+    void SerialTaskExecutor::ExecuteTasks(size_t inTaskNum, F&& inTask)
+    {
+        for (size_t i = 0; i < inTaskNum; i++) {
+            inTask(i);
+        }
+    }
+
     template <typename Class, typename Ret, typename... Args>
     struct MemberFuncPtrTraits<Ret(Class::*)(Args...)> {
         static constexpr auto ArgSize = sizeof...(Args);
@@ -900,29 +1188,45 @@ namespace Runtime::Internal {
 
     inline ElemPtr Archetype::GetCompAt(size_t inElemIndex, size_t inCompIndex)
     {
-        return CompAt(compMemory[inCompIndex], inCompIndex, inElemIndex);
+        return CompAt(chunks[inElemIndex >> chunkShift].columns[inCompIndex], inCompIndex, inElemIndex & chunkMask);
     }
 
     inline const void* Archetype::GetCompAt(size_t inElemIndex, size_t inCompIndex) const
     {
-        return CompAt(compMemory[inCompIndex], inCompIndex, inElemIndex);
+        return CompAt(chunks[inElemIndex >> chunkShift].columns[inCompIndex], inCompIndex, inElemIndex & chunkMask);
+    }
+
+    inline size_t Archetype::ChunkCount() const
+    {
+        return count == 0 ? 0 : ((count - 1) >> chunkShift) + 1;
+    }
+
+    inline size_t Archetype::ChunkBegin(size_t inChunkIndex) const
+    {
+        return inChunkIndex << chunkShift;
+    }
+
+    inline size_t Archetype::ChunkElemCount(size_t inChunkIndex) const
+    {
+        const size_t remaining = count - ChunkBegin(inChunkIndex);
+        return remaining > chunkMask ? chunkMask + 1 : remaining;
     }
 
-    inline ElemPtr Archetype::GetCompColumn(size_t inCompIndex)
+    inline ElemPtr Archetype::GetChunkCompColumn(size_t inChunkIndex, size_t inCompIndex)
     {
-        Assert(inCompIndex < compMemory.size());
-        return compMemory[inCompIndex];
+        Assert(inChunkIndex < chunks.size() && inCompIndex < rttiVec.size());
+        return chunks[inChunkIndex].columns[inCompIndex];
     }
 
-    inline const void* Archetype::GetCompColumn(size_t inCompIndex) const
+    inline const void* Archetype::GetChunkCompColumn(size_t inChunkIndex, size_t inCompIndex) const
     {
-        Assert(inCompIndex < compMemory.size());
-        return compMemory[inCompIndex];
+        Assert(inChunkIndex < chunks.size() && inCompIndex < rttiVec.size());
+        return chunks[inChunkIndex].columns[inCompIndex];
     }
 
-    inline ElemPtr Archetype::CompAt(ElemPtr inMemory, size_t inCompIndex, size_t inElemIndex) const
+    inline ElemPtr Archetype::CompAt(ElemPtr inMemory, size_t inCompIndex, size_t inRowIndex) const
     {
-        return static_cast<uint8_t*>(inMemory) + (inElemIndex * compStrides[inCompIndex]);
+        return static_cast<uint8_t*>(inMemory) + (inRowIndex * compStrides[inCompIndex]);
     }
 
     inline Entity Archetype::EntityAt(size_t inElemIndex) const
@@ -931,6 +1235,11 @@ namespace Runtime::Internal {
         return elemMap[inElemIndex];
     }
 
+    inline const Entity* Archetype::Entities() const
+    {
+        return elemMap.data();
+    }
+
     template <typename C>
     C& Archetype::GetComp(size_t inElemIndex)
     {
@@ -1038,6 +1347,12 @@ namespace Runtime {
         : registry(&inRegistry)
         , materialized(false)
     {
+#if BUILD_CONFIG_DEBUG
+        // mutable components of a mutable registry are writes
+        ((!std::is_const_v<R> && !std::is_const_v<C>
+            ? ECS_CHECK_WRITE(inRegistry, Internal::GetClass<std::remove_const_t<C>>())
+            : ECS_CHECK_READ(inRegistry, Internal::GetClass<std::remove_const_t<C>>())), ...);
+#endif
         Evaluate(inRegistry);
     }
 
@@ -1049,20 +1364,90 @@ namespace Runtime {
 
         for (const auto& entry : query) {
             auto& archetype = registry->archetypes.at(entry.archetype);
-            const auto count = archetype.Count();
             if constexpr (Traits::ArgSize == 1) {
+                const auto count = archetype.Count();
                 for (size_t i = 0; i < count; i++) {
                     inFunc(archetype.EntityAt(i));
                 }
             } else {
-                const CompColumns compColumns = ResolveCompColumns(archetype, entry, std::index_sequence_for<C...> {});
-                for (size_t i = 0; i < count; i++) {
-                    std::apply(inFunc, MakeResult(archetype, i, compColumns, std::index_sequence_for<C...> {}));
+                const auto chunkCount = archetype.ChunkCount();
+                for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+                    const auto chunkBegin = archetype.ChunkBegin(chunkIndex);
+                    const auto chunkElemCount = archetype.ChunkElemCount(chunkIndex);
+                    const CompColumns compColumns = ResolveCompColumns(archetype, chunkIndex, entry, std::index_sequence_for<C...> {});
+                    for (size_t i = 0; i < chunkElemCount; i++) {
+                        std::apply(inFunc, MakeResult(archetype, chunkBegin + i, i, compColumns, std::index_sequence_for<C...> {}));
+                    }
+                }
+            }
+        }
+    }
+
+    template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
+    template <typename F>
+    void BasicView<R, Contains<T...>, Exclude<E...>, C...>::EachChunk(F&& inFunc) const
+    {
+        for (const auto& entry : query) {
+            auto& archetype = registry->archetypes.at(entry.archetype);
+            const auto chunkCount = archetype.ChunkCount();
+            for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+                InvokeChunkFunc(inFunc, ChunkRange { &archetype, &entry, chunkIndex, 0, archetype.ChunkElemCount(chunkIndex) }, std::index_sequence_for<C...> {});
+            }
+        }
+    }
+
+    template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
+    template <typename F>
+    void BasicView<R, Contains<T...>, Exclude<E...>, C...>::ParallelEach(F&& inFunc, size_t inGrainSize) const
+    {
+        if (auto& workers = GameWorkerThreads::Get(); workers.Started()) {
+            ParallelEach(workers, std::forward<F>(inFunc), inGrainSize);
+        } else {
+            Internal::SerialTaskExecutor executor;
+            ParallelEach(executor, std::forward<F>(inFunc), inGrainSize);
+        }
+    }
+
+    template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
+    template <ParallelTaskExecutor X, typename F>
+    void BasicView<R, Contains<T...>, Exclude<E...>, C...>::ParallelEach(X& inExecutor, F&& inFunc, size_t inGrainSize) const
+    {
+        ParallelEachChunk(inExecutor, [&](size_t inCount, const Entity* inEntities, CompPtr<C>... inComps) -> void {
+            for (size_t i = 0; i < inCount; i++) {
+                if constexpr (std::is_invocable_v<F&, Entity>) {
+                    inFunc(inEntities[i]);
+                } else {
+                    inFunc(inEntities[i], inComps[i]...);
                 }
             }
+        }, inGrainSize);
+    }
+
+    template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
+    template <typename F>
+    void BasicView<R, Contains<T...>, Exclude<E...>, C...>::ParallelEachChunk(F&& inFunc, size_t inGrainSize) const
+    {
+        if (auto& workers = GameWorkerThreads::Get(); workers.Started()) {
+            ParallelEachChunk(workers, std::forward<F>(inFunc), inGrainSize);
+        } else {
+            Internal::SerialTaskExecutor executor;
+            ParallelEachChunk(executor, std::forward<F>(inFunc), inGrainSize);
         }
     }
 
+    template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
+    template <ParallelTaskExecutor X, typename F>
+    void BasicView<R, Contains<T...>, Exclude<E...>, C...>::ParallelEachChunk(X& inExecutor, F&& inFunc, size_t inGrainSize) const
+    {
+        const auto ranges = Internal::SplitViewChunkRanges<ArchetypeType>(registry->archetypes, query, inGrainSize);
+        if (ranges.empty()) {
+            return;
+        }
+        inExecutor.ExecuteTasks(ranges.size(), [&](size_t inRangeIndex) -> void {
+            InvokeChunkFunc(inFunc, ranges[inRangeIndex], std::index_sequence_for<C...> {});
+        });
+    }
+
     template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
     const typename BasicView<R, Contains<T...>, Exclude<E...>, C...>::ResultVector& BasicView<R, Contains<T...>, Exclude<E...>, C...>::All() const
     {
@@ -1108,27 +1493,39 @@ namespace Runtime {
 
     template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
     template <typename A, size_t... I>
-    typename BasicView<R, Contains<T...>, Exclude<E...>, C...>::CompColumns BasicView<R, Contains<T...>, Exclude<E...>, C...>::ResolveCompColumns(A& inArchetype, const QueryEntry& inEntry, std::index_sequence<I...>) const
+    typename BasicView<R, Contains<T...>, Exclude<E...>, C...>::CompColumns BasicView<R, Contains<T...>, Exclude<E...>, C...>::ResolveCompColumns(A& inArchetype, size_t inChunkIndex, const QueryEntry& inEntry, std::index_sequence<I...>) const
     {
-        return { inArchetype.GetCompColumn(inEntry.compIndices[I])... };
+        return { inArchetype.GetChunkCompColumn(inChunkIndex, inEntry.compIndices[I])... };
     }
 
     template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
     template <size_t... I>
-    auto BasicView<R, Contains<T...>, Exclude<E...>, C...>::MakeResult(Internal::Archetype& inArchetype, size_t inElemIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const
+    auto BasicView<R, Contains<T...>, Exclude<E...>, C...>::MakeResult(Internal::Archetype& inArchetype, size_t inElemIndex, size_t inRowIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const
     {
         return typename BasicView<R, Contains<T...>, Exclude<E...>, C...>::ResultVector::value_type(
             inArchetype.EntityAt(inElemIndex),
-            static_cast<std::conditional_t<std::is_const_v<C>, const std::remove_const_t<C>, std::remove_const_t<C>>*>(inCompColumns[I])[inElemIndex]...);
+            static_cast<std::conditional_t<std::is_const_v<C>, const std::remove_const_t<C>, std::remove_const_t<C>>*>(inCompColumns[I])[inRowIndex]...);
     }
 
     template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
     template <size_t... I>
-    auto BasicView<R, Contains<T...>, Exclude<E...>, C...>::MakeResult(const Internal::Archetype& inArchetype, size_t inElemIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const
+    auto BasicView<R, Contains<T...>, Exclude<E...>, C...>::MakeResult(const Internal::Archetype& inArchetype, size_t inElemIndex, size_t inRowIndex, const CompColumns& inCompColumns, std::index_sequence<I...>) const
     {
         return typename BasicView<R, Contains<T...>, Exclude<E...>, C...>::ResultVector::value_type(
             inArchetype.EntityAt(inElemIndex),
-            static_cast<const std::remove_const_t<C>*>(inCompColumns[I])[inElemIndex]...);
+            static_cast<const std::remove_const_t<C>*>(inCompColumns[I])[inRowIndex]...);
+    }
+
+    template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
+    template <typename F, size_t... I>
+    void BasicView<R, Contains<T...>, Exclude<E...>, C...>::InvokeChunkFunc(F& inFunc, const ChunkRange& inRange, std::index_sequence<I...>) const
+    {
+        const auto chunkBegin = inRange.archetype->ChunkBegin(inRange.chunkIndex);
+        const CompColumns compColumns = ResolveCompColumns(*inRange.archetype, inRange.chunkIndex, *inRange.entry, std::index_sequence<I...> {});
+        inFunc(
+            inRange.rowEnd - inRange.rowBegin,
+            inRange.archetype->Entities() + chunkBegin + inRange.rowBegin,
+            (static_cast<CompPtr<C>>(compColumns[I]) + inRange.rowBegin)...);
     }
 
     template <ECRegistryOrConst R, typename... T, typename... E, typename... C>
@@ -1141,10 +1538,14 @@ namespace Runtime {
         result.reserve(Count());
         for (const auto& entry : query) {
             auto& archetype = registry->archetypes.at(entry.archetype);
-            const auto count = archetype.Count();
-            const CompColumns compColumns = ResolveCompColumns(archetype, entry, std::index_sequence_for<C...> {});
-            for (size_t i = 0; i < count; i++) {
-                result.emplace_back(MakeResult(archetype, i, compColumns, std::index_sequence_for<C...> {}));
+            const auto chunkCount = archetype.ChunkCount();
+            for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+                const auto chunkBegin = archetype.ChunkBegin(chunkIndex);
+                const auto chunkElemCount = archetype.ChunkElemCount(chunkIndex);
+                const CompColumns compColumns = ResolveCompColumns(archetype, chunkIndex, entry, std::index_sequence_for<C...> {});
+                for (size_t i = 0; i < chunkElemCount; i++) {
+                    result.emplace_back(MakeResult(archetype, chunkBegin + i, i, compColumns, std::index_sequence_for<C...> {}));
+                }
             }
         }
         materialized = true;
@@ -1193,6 +1594,11 @@ namespace Runtime {
         : registry(&inRegistry)
         , materialized(false)
     {
+#if BUILD_CONFIG_DEBUG
+        for (const auto clazz : inFilter.includes) {
+            ECS_CHECK_READ(inRegistry, clazz);
+        }
+#endif
         Evaluate(inRegistry, inFilter);
     }
 
@@ -1207,17 +1613,58 @@ namespace Runtime {
 
         for (const auto& entry : query) {
             auto& archetype = registry->archetypes.at(entry.archetype);
-            const auto count = archetype.Count();
-            compColumns.clear();
-            for (const size_t compIndex : entry.compIndices) {
-                compColumns.emplace_back(archetype.GetCompColumn(compIndex));
-            }
-            for (size_t i = 0; i < count; i++) {
-                InvokeTraverseFuncInternal<F, typename Traits::ArgsTupleType>(std::forward<F>(inFunc), archetype, i, compColumns, compSlots, std::make_index_sequence<Traits::ArgSize - 1> {});
+            const auto chunkCount = archetype.ChunkCount();
+            for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+                const auto chunkBegin = archetype.ChunkBegin(chunkIndex);
+                const auto chunkElemCount = archetype.ChunkElemCount(chunkIndex);
+                compColumns.clear();
+                for (const size_t compIndex : entry.compIndices) {
+                    compColumns.emplace_back(archetype.GetChunkCompColumn(chunkIndex, compIndex));
+                }
+                for (size_t i = 0; i < chunkElemCount; i++) {
+                    InvokeTraverseFuncInternal<F, typename Traits::ArgsTupleType>(std::forward<F>(inFunc), archetype, chunkBegin + i, i, compColumns, compSlots, std::make_index_sequence<Traits::ArgSize - 1> {});
+                }
             }
         }
     }
 
+    template <ECRegistryOrConst R>
+    template <typename F>
+    void BasicRuntimeView<R>::ParallelEach(F&& inFunc, size_t inGrainSize) const
+    {
+        if (auto& workers = GameWorkerThreads::Get(); workers.Started()) {
+            ParallelEach(workers, std::forward<F>(inFunc), inGrainSize);
+        } else {
+            Internal::SerialTaskExecutor executor;
+            ParallelEach(executor, std::forward<F>(inFunc), inGrainSize);
+        }
+    }
+
+    template <ECRegistryOrConst R>
+    template <ParallelTaskExecutor X, typename F>
+    void BasicRuntimeView<R>::ParallelEach(X& inExecutor, F&& inFunc, size_t inGrainSize) const
+    {
+        using Traits = Internal::MemberFuncPtrTraits<decltype(&std::decay_t<F>::operator())>;
+        const auto compSlots = BuildCompSlots<typename Traits::ArgsTupleType>(std::make_index_sequence<Traits::ArgSize - 1> {});
+        const auto ranges = Internal::SplitViewChunkRanges<ArchetypeType>(registry->archetypes, query, inGrainSize);
+        if (ranges.empty()) {
+            return;
+        }
+
+        inExecutor.ExecuteTasks(ranges.size(), [&](size_t inRangeIndex) -> void {
+            const auto& range = ranges[inRangeIndex];
+            const auto chunkBegin = range.archetype->ChunkBegin(range.chunkIndex);
+            std::vector<CompColumnPtr> compColumns;
+            compColumns.reserve(range.entry->compIndices.size());
+            for (const size_t compIndex : range.entry->compIndices) {
+                compColumns.emplace_back(range.archetype->GetChunkCompColumn(range.chunkIndex, compIndex));
+            }
+            for (size_t i = range.rowBegin; i < range.rowEnd; i++) {
+                InvokeTraverseFuncInternal<F&, typename Traits::ArgsTupleType>(inFunc, *range.archetype, chunkBegin + i, i, compColumns, compSlots, std::make_index_sequence<Traits::ArgSize - 1> {});
+            }
+        });
+    }
+
     template <ECRegistryOrConst R>
     size_t BasicRuntimeView<R>::Count() const
     {
@@ -1265,21 +1712,21 @@ namespace Runtime {
 
     template <ECRegistryOrConst R>
     template <typename F, typename ArgTuple, typename A, size_t... I>
-    void BasicRuntimeView<R>::InvokeTraverseFuncInternal(F&& inFunc, A& inArchetype, size_t inElemIndex, const std::vector<CompColumnPtr>& inCompColumns, const std::array<size_t, sizeof...(I)>& inCompSlots, std::index_sequence<I...>) const
+    void BasicRuntimeView<R>::InvokeTraverseFuncInternal(F&& inFunc, A& inArchetype, size_t inElemIndex, size_t inRowIndex, const std::vector<CompColumnPtr>& inCompColumns, const std::array<size_t, sizeof...(I)>& inCompSlots, std::index_sequence<I...>) const
     {
-        inFunc(inArchetype.EntityAt(inElemIndex), GetCompRef<std::tuple_element_t<I + 1, ArgTuple>>(inElemIndex, inCompColumns, inCompSlots[I])...);
+        inFunc(inArchetype.EntityAt(inElemIndex), GetCompRef<std::tuple_element_t<I + 1, ArgTuple>>(inRowIndex, inCompColumns, inCompSlots[I])...);
     }
 
     template <ECRegistryOrConst R>
     template <typename C>
-    decltype(auto) BasicRuntimeView<R>::GetCompRef(size_t inElemIndex, const std::vector<CompColumnPtr>& inCompColumns, size_t inCompSlot) const
+    decltype(auto) BasicRuntimeView<R>::GetCompRef(size_t inRowIndex, const std::vector<CompColumnPtr>& inCompColumns, size_t inCompSlot) const
     {
         static_assert(std::is_reference_v<C>);
         using Value = std::remove_cv_t<std::remove_reference_t<C>>;
         if constexpr (std::is_const_v<std::remove_reference_t<C>> || std::is_const_v<R>) {
-            return static_cast<const Value*>(inCompColumns[inCompSlot])[inElemIndex];
+            return static_cast<const Value*>(inCompColumns[inCompSlot])[inRowIndex];
         } else {
-            return static_cast<Value*>(inCompColumns[inCompSlot])[inElemIndex];
+            return static_cast<Value*>(inCompColumns[inCompSlot])[inRowIndex];
         }
     }
 
@@ -1494,9 +1941,55 @@ namespace Runtime {
         return removedObserver;
     }
 
+    template <typename... C>
+    std::vector<Entity> ECRegistry::CreateBatch(size_t inCount, const C&... inComps)
+    {
+        ECS_CHECK_STRUCTURAL(*this);
+        std::vector<Entity> result;
+        const auto location = CreateBatchElems({ Internal::CompRtti::Create<C>()... }, inCount, result);
+        if constexpr (sizeof...(C) > 0) {
+            Internal::Archetype& archetype = *location.archetype;
+            const std::array<size_t, sizeof...(C)> compIndices = { archetype.template GetCompIndex<C>()... };
+            for (size_t i = 0; i < inCount; i++) {
+                size_t compSlot = 0;
+                (std::construct_at(static_cast<C*>(archetype.GetCompAt(location.elemIndex + i, compIndices[compSlot++])), inComps), ...);
+            }
+            if (!compEvents.empty()) {
+                for (const auto entity : result) {
+                    (NotifyConstructedDyn(Internal::GetClass<C>(), entity), ...);
+                }
+            }
+        }
+        return result;
+    }
+
+    template <typename C, typename... Args>
+    void ECRegistry::EmplaceBatch(std::span<const Entity> inEntities, const Args&... inArgs)
+    {
+        ECS_CHECK_STRUCTURAL(*this);
+        MoveEntitiesForAdd(Internal::CompRtti::Create<C>(), inEntities);
+
+        const Internal::Archetype* lastArchetype = nullptr;
+        size_t compIndex = 0;
+        for (const auto entity : inEntities) {
+            const auto location = entities.GetLocation(entity);
+            if (location.archetype != lastArchetype) {
+                lastArchetype = location.archetype;
+                compIndex = location.archetype->template GetCompIndex<C>();
+            }
+            std::construct_at(static_cast<C*>(location.archetype->GetCompAt(location.elemIndex, compIndex)), inArgs...);
+        }
+        if (!compEvents.empty()) {
+            for (const auto entity : inEntities) {
+                NotifyConstructedDyn(Internal::GetClass<C>(), entity);
+            }
+        }
+    }
+
     template <typename C, typename ... Args>
     C& ECRegistry::Emplace(Entity inEntity, Args&&... inArgs)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         const Internal::CompRtti rtti = Internal::CompRtti::Create<C>();
         const auto location = MoveEntityForAdd(rtti, inEntity);
         C& result = location.archetype->template EmplaceComp<C>(location.elemIndex, std::forward<Args>(inArgs)...);
@@ -1509,6 +2002,7 @@ namespace Runtime {
     template <typename C>
     void ECRegistry::Remove(Entity inEntity)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         Assert(Valid(inEntity) && Has<C>(inEntity));
         MoveEntityForRemove(Internal::GetClass<C>(), inEntity);
     }
@@ -1531,6 +2025,7 @@ namespace Runtime {
     template <typename C>
     bool ECRegistry::Has(Entity inEntity) const
     {
+        ECS_CHECK_READ(*this, Internal::GetClass<C>());
         const auto location = entities.GetLocation(inEntity);
         return location.archetype->ContainsComp(Internal::GetClass<C>());
     }
@@ -1550,6 +2045,7 @@ namespace Runtime {
     template <typename C>
     C& ECRegistry::Get(Entity inEntity)
     {
+        ECS_CHECK_WRITE(*this, Internal::GetClass<C>());
         const auto location = entities.GetLocation(inEntity);
         return location.archetype->template GetComp<C>(location.elemIndex);
     }
@@ -1557,6 +2053,7 @@ namespace Runtime {
     template <typename C>
     const C& ECRegistry::Get(Entity inEntity) const
     {
+        ECS_CHECK_READ(*this, Internal::GetClass<C>());
         const auto location = entities.GetLocation(inEntity);
         return location.archetype->template GetComp<C>(location.elemIndex);
     }
@@ -1706,6 +2203,59 @@ namespace Runtime {
         GNotifyUpdatedDyn(Internal::GetClass<G>());
     }
 
+    template <typename C, typename... Args>
+    void ECCommandBuffer::Emplace(Entity inEntity, Args&&... inArgs)
+    {
+        const auto rttiIndex = FindOrAddRtti(Internal::CompRtti::Create<C>());
+        Internal::ElemPtr comp = AllocateStaging(sizeof(C), alignof(C));
+        std::construct_at(static_cast<C*>(comp), std::forward<Args>(inArgs)...);
+        Record(CommandType::emplace, inEntity, Internal::GetClass<C>(), comp, rttiIndex);
+    }
+
+    template <typename C>
+    void ECCommandBuffer::Remove(Entity inEntity)
+    {
+        RemoveDyn(Internal::GetClass<C>(), inEntity);
+    }
+
+    template <typename T>
+    void ECCommandBuffer::AddTag(Entity inEntity)
+    {
+        static_assert(std::is_empty_v<T> && sizeof(T) == 1 && alignof(T) == 1, "tag components must have the one-byte empty layout");
+        AddTagDyn(Internal::GetClass<T>(), inEntity);
+    }
+
+    template <typename T>
+    void ECCommandBuffer::RemoveTag(Entity inEntity)
+    {
+        static_assert(std::is_empty_v<T> && sizeof(T) == 1 && alignof(T) == 1, "tag components must have the one-byte empty layout");
+        RemoveTagDyn(Internal::GetClass<T>(), inEntity);
+    }
+
+    template <typename C>
+    SystemAccess& SystemAccess::Read()
+    {
+        return ReadDyn(Internal::GetClass<C>());
+    }
+
+    template <typename C>
+    SystemAccess& SystemAccess::Write()
+    {
+        return WriteDyn(Internal::GetClass<C>());
+    }
+
+    template <typename G>
+    SystemAccess& SystemAccess::GRead()
+    {
+        return GReadDyn(Internal::GetClass<G>());
+    }
+
+    template <typename G>
+    SystemAccess& SystemAccess::GWrite()
+    {
+        return GWriteDyn(Internal::GetClass<G>());
+    }
+
     template <typename S>
     Internal::SystemFactory& SystemGroup::EmplaceSystem()
     {
@@ -9,6 +9,7 @@
 
 #include <Core/Module.h>
 #include <Render/RenderModule.h>
+#include <Runtime/FramePipeline.h>
 #include <Runtime/Api.h>
 
 namespace Runtime {
@@ -29,6 +30,7 @@ namespace Runtime {
         void MountWorld(World* inWorld);
         void UnmountWorld(World* inWorld);
         Render::RenderModule& GetRenderModule() const;
+        FramePipeline& GetFramePipeline() const;
         void Tick(float inDeltaTimeSeconds);
 
     protected:
@@ -38,11 +40,12 @@ namespace Runtime {
         void InitRender(const std::string& inRhiTypeStr);
         void LoadPlugins() const;
         void LoadConfigs() const;
+        // points the game side threads at the arena of the frame being built
+        void BindGameFrameArena() const;
 
         std::unordered_set<World*> worlds;
         Render::RenderModule* renderModule;
-        std::future<void> lastFrameRenderThreadFence;
-        std::future<void> last2FrameRenderThreadFence;
+        Common::UniquePtr<FramePipeline> framePipeline;
     };
 
     class RUNTIME_API MinEngine final : public Engine {
@@ -61,6 +64,7 @@ namespace Runtime {
     public:
         static void Load(const std::string& inModuleName, const EngineInitParams& inInitParams);
         static void Unload();
+        static bool Loaded();
         static Engine& Get();
 
     private:
@@ -0,0 +1,109 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <Common/Concurrent.h>
+#include <Common/Memory.h>
+#include <Common/Utility.h>
+#include <Render/RenderThread.h>
+#include <Runtime/Api.h>
+
+namespace Runtime {
+    struct FrameStats {
+        uint64_t frameNumber = 0;
+        // game thread time from BeginFrame() to EndFrame()
+        double gameTimeMs = 0;
+        // render thread time spent on the frame's commands
+        double renderTimeMs = 0;
+        // BeginFrame() on the game thread to the render thread finishing the frame
+        double latencyMs = 0;
+        // game thread time blocked waiting for a free frame slot before the frame could start
+        double stallTimeMs = 0;
+        // what the frame took from its arena, heapAllocationNum stays at zero in a warmed up steady state
+        Common::FrameArenaStats arenaStats;
+    };
+
+    // the game thread builds one frame while up to framesInFlight ended frames wait for or run on the render thread,
+    // every frame owns a slot with its render command list and allocation arena, the whole command list is handed to
+    // the render thread in one task at EndFrame(), and a slot is only reused after the render thread retired it, so
+    // memory taken from the arena stays valid for the render commands of the same frame
+    class RUNTIME_API FramePipeline {
+    public:
+        static constexpr uint8_t defaultFramesInFlight = 2;
+        static constexpr uint8_t maxFramesInFlight = 4;
+
+        explicit FramePipeline(uint8_t inFramesInFlight = defaultFramesInFlight);
+        ~FramePipeline();
+
+        NonCopyable(FramePipeline)
+        NonMovable(FramePipeline)
+
+        uint8_t FramesInFlight() const;
+        uint64_t GameFrameNumber() const;
+
+        // game thread
+        void BeginFrame();
+        void EndFrame(Render::RenderThread& inRenderThread);
+        void Flush(Render::RenderThread& inRenderThread);
+        const FrameStats& LastRetiredFrameStats() const;
+        uint64_t StalledFrameNum() const;
+        // game side threads allocate their transient per-frame data from it, it is reset when the slot is reused
+        Common::FrameArena& GameFrameArena();
+
+        // any thread but the render thread, commands run on the render thread in enqueue order after the frame ended
+        template <typename F> void EnqueueRenderCommand(F&& inCommand);
+        void EnqueueRenderCommands(std::vector<Common::TaskFunction>& inCommands);
+        // any thread but the render thread, the memory lives until the render thread retired the current game frame
+        template <typename T> T* AllocateArray(size_t inCount);
+
+    private:
+        struct Frame {
+            uint64_t frameNumber = 0;
+            std::vector<Common::TaskFunction> renderCommands;
+            Common::FrameArena arena;
+            std::atomic<bool> retired = true;
+            bool statsPending = false;
+            double gameBeginMs = 0;
+            double gameEndMs = 0;
+            double renderBeginMs = 0;
+            double renderEndMs = 0;
+            double stallTimeMs = 0;
+        };
+
+        static void ExecuteFrame(Frame& inFrame);
+
+        Frame& GameFrame();
+        void Retire(Frame& inFrame);
+
+        uint8_t framesInFlight;
+        std::vector<Common::UniquePtr<Frame>> frames;
+        // guards renderCommands of the game frame and the switch to the next game frame
+        std::mutex mutex;
+        uint64_t gameFrameNumber;
+        FrameStats lastRetiredFrameStats;
+        uint64_t stalledFrameNum;
+    };
+}
+
+namespace Runtime {
+    template <typename F>
+    void FramePipeline::EnqueueRenderCommand(F&& inCommand)
+    {
+        std::unique_lock lock(mutex);
+        GameFrame().renderCommands.emplace_back(std::forward<F>(inCommand));
+    }
+
+    template <typename T>
+    T* FramePipeline::AllocateArray(size_t inCount)
+    {
+        std::unique_lock lock(mutex);
+        return GameFrame().arena.AllocateArray<T>(inCount);
+    }
+}
@@ -20,6 +20,7 @@ namespace Runtime {
         ~GameThread();
 
         template <typename F> auto EmplaceTask(F&& inTask);
+        template <typename F> void Spawn(F&& inTask);
 
     private:
         friend class Engine;
@@ -29,7 +30,7 @@ namespace Runtime {
         void Flush();
 
         std::mutex mutex;
-        std::queue<std::function<void()>> tasks;
+        std::queue<Common::TaskFunction> tasks;
     };
 
     class GameWorkerThreads {
@@ -40,8 +41,11 @@ namespace Runtime {
 
         void Start();
         void Stop();
+        bool Started() const;
         template <typename F> auto EmplaceTask(F&& inTask);
+        template <typename F> void Spawn(F&& inTask);
         template <typename F> void ExecuteTasks(size_t inTaskNum, F&& inTask);
+        template <typename F> void ParallelFor(size_t inBegin, size_t inEnd, size_t inGrainSize, F&& inTask);
 
     private:
         GameWorkerThreads();
@@ -55,15 +59,19 @@ namespace Runtime {
     auto GameThread::EmplaceTask(F&& inTask)
     {
         using RetType = std::invoke_result_t<F>;
-        auto packagedTask = Common::MakeShared<std::packaged_task<RetType()>>(inTask);
-        auto result = packagedTask->get_future();
-        {
-            std::unique_lock lock(mutex);
-            tasks.emplace([packagedTask]() -> void { (*packagedTask)(); });
-        }
+        std::packaged_task<RetType()> packagedTask(std::forward<F>(inTask));
+        auto result = packagedTask.get_future();
+        Spawn(std::move(packagedTask));
         return result;
     }
 
+    template <typename F>
+    void GameThread::Spawn(F&& inTask)
+    {
+        std::unique_lock lock(mutex);
+        tasks.emplace(std::forward<F>(inTask));
+    }
+
     template <typename F>
     auto GameWorkerThreads::EmplaceTask(F&& inTask)
     {
@@ -76,6 +84,16 @@ namespace Runtime {
         });
     }
 
+    template <typename F>
+    void GameWorkerThreads::Spawn(F&& inTask)
+    {
+        Assert(threads != nullptr);
+        threads->Spawn([task = std::forward<F>(inTask)]() mutable -> void {
+            Core::ScopedThreadTag tag(Core::ThreadTag::gameWorker);
+            task();
+        });
+    }
+
     template <typename F>
     void GameWorkerThreads::ExecuteTasks(size_t inTaskNum, F&& inTask)
     {
@@ -86,4 +104,14 @@ namespace Runtime {
             reboundTask(inIndex);
         });
     }
+
+    template <typename F>
+    void GameWorkerThreads::ParallelFor(size_t inBegin, size_t inEnd, size_t inGrainSize, F&& inTask)
+    {
+        Assert(threads != nullptr);
+        threads->ParallelFor(inBegin, inEnd, inGrainSize, [&inTask](size_t inRangeBegin, size_t inRangeEnd) -> void {
+            Core::ScopedThreadTag tag(Core::ThreadTag::gameWorker);
+            inTask(inRangeBegin, inRangeEnd);
+        });
+    }
 } // namespace Runtime
@@ -12,5 +12,11 @@ namespace Runtime {
         static constexpr const auto* globalComp = "globalComp";
         static constexpr const auto* gameReadOnly = "gameReadOnly";
         static constexpr const auto* tag = "tag";
+        // system access declarations, values are ';' separated full class names, e.g. EClass(reads=Runtime::Hierarchy)
+        static constexpr const auto* systemReads = "reads";
+        static constexpr const auto* systemWrites = "writes";
+        static constexpr const auto* systemGlobalReads = "globalReads";
+        static constexpr const auto* systemGlobalWrites = "globalWrites";
+        static constexpr const auto* systemStructural = "structural";
     };
 }
@@ -60,11 +60,17 @@ namespace Runtime {
     template <typename T>
     RenderThreadPtr<T>::~RenderThreadPtr()
     {
-        if (ptr.Valid()) {
-            EngineHolder::Get().GetRenderModule().GetRenderThread().EmplaceTask([transferPtr = std::move(ptr)]() mutable -> void {
-                transferPtr.Reset();
-            });
+        if (!ptr.Valid()) {
+            return;
         }
+        if (Core::ThreadContext::IsRenderThread()) {
+            ptr.Reset();
+            return;
+        }
+        // goes through the frame pipeline to stay behind the render commands already queued in this frame
+        EngineHolder::Get().GetFramePipeline().EnqueueRenderCommand([transferPtr = std::move(ptr)]() mutable -> void {
+            transferPtr.Reset();
+        });
     }
 
     template <typename T>
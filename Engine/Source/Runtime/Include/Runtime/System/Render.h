@@ -5,6 +5,7 @@
 #pragma once
 
 #include <Common/Math/Rect.h>
+#include <Common/Memory.h>
 #include <Render/RenderModule.h>
 #include <Render/View.h>
 #include <Runtime/Client.h>
@@ -13,7 +14,7 @@
 #include <Runtime/Api.h>
 
 namespace Runtime {
-    class RUNTIME_API EClass() RenderSystem final : public System {
+    class RUNTIME_API EClass(reads=Runtime::WorldTransform;Runtime::LocalPlayer, writes=Runtime::Camera, globalReads=Runtime::SceneHolder;Runtime::PlayersInfo) RenderSystem final : public System {
         EPolyDerivedClassBody(RenderSystem)
 
     public:
@@ -28,7 +29,7 @@ namespace Runtime {
     private:
         static Common::URect GetPlayerViewport(uint32_t inWidth, uint32_t inHeight, uint8_t inPlayerNum, uint8_t inPlayerIndex);
         Render::View BuildViewForCamera(Entity inEntity) const;
-        std::vector<Render::View> BuildViews() const;
+        Common::FrameVector<Render::View> BuildViews() const;
 
         Render::RenderModule& renderModule;
         Client* client;
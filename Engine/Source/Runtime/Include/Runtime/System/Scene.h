@@ -5,6 +5,9 @@
 #pragma once
 
 #include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <Runtime/ECS.h>
 #include <Runtime/Component/Light.h>
@@ -12,6 +15,7 @@
 #include <Runtime/Component/Transform.h>
 #include <Runtime/Component/Scene.h>
 #include <Runtime/Engine.h>
+#include <Runtime/FramePipeline.h>
 #include <Render/MeshRenderData.h>
 #include <Render/RenderModule.h>
 #include <Render/Scene.h>
@@ -20,7 +24,7 @@
 #include <Render/VertexFactory.h>
 
 namespace Runtime {
-    class RUNTIME_API EClass() SceneSystem final : public System {
+    class RUNTIME_API EClass(reads=Runtime::WorldTransform;Runtime::DirectionalLight;Runtime::PointLight;Runtime::SpotLight;Runtime::StaticPrimitive, globalWrites=Runtime::SceneHolder) SceneSystem final : public System {
         EPolyDerivedClassBody(SceneSystem)
 
     public:
@@ -36,10 +40,13 @@ namespace Runtime {
         template <typename Component, typename SceneProxy> void ProcessSceneProxyEvents(EventsObserver<Component>& inObserver, bool inWithScale = false);
         template <typename Component, typename SceneProxy> void QueueCreateSceneProxy(Entity inEntity, bool inWithScale = false);
         template <typename Component, typename SceneProxy> void QueueUpdateSceneProxyContent(Entity inEntity);
-        template <typename SceneProxy> void QueueUpdateSceneProxyTransform(Entity inEntity, bool inWithScale = false);
+        template <typename SceneProxy> void QueueUpdateSceneProxyTransforms(const std::vector<Entity>& inEntities, bool inWithScale = false);
         template <typename SceneProxy> void QueueRemoveSceneProxy(Entity inEntity);
 
         Render::RenderModule& renderModule;
+        FramePipeline& framePipeline;
+        // scene proxy updates of this tick, handed to the frame pipeline in one go at the end of the tick
+        std::vector<Common::TaskFunction> pendingUpdates;
         Observer transformUpdatedObserver;
         EventsObserver<DirectionalLight> directionalLightsObserver;
         EventsObserver<PointLight> pointLightsObserver;
@@ -49,6 +56,11 @@ namespace Runtime {
 }
 
 namespace Runtime::Internal {
+    struct SceneProxyTransformUpdate {
+        Entity entity;
+        Common::FMat4x4 localToWorld;
+    };
+
     template <typename Component, typename SceneProxy>
     static void UpdateSceneProxyContent(SceneProxy& outSceneProxy, const Component& inComponent)
     {
@@ -59,6 +71,9 @@ namespace Runtime::Internal {
     static void UpdateSceneProxyWorldTransform(SceneProxy& outSceneProxy, const WorldTransform& inTransform, bool withScale = true)
     {
         outSceneProxy.localToWorld = withScale ? inTransform.localToWorld.GetTransformMatrix() : inTransform.localToWorld.GetTransformMatrixNoScale();
+        if constexpr (std::is_base_of_v<Render::PrimitiveSceneProxy, SceneProxy>) {
+            outSceneProxy.UpdateWorldBounds();
+        }
     }
 
     template <typename T>
@@ -112,20 +127,22 @@ namespace Runtime::Internal {
         }
 
         const StaticMeshVertices& vertices = inComponent.mesh->GetLOD(0).vertices;
-        if (vertices.positions.empty() || vertices.indices.empty()) {
+        if (vertices.positions.Empty() || vertices.indices.Empty()) {
             return;
         }
         std::vector<Render::MeshRenderData::Vertex> gpuVertices;
-        gpuVertices.reserve(vertices.positions.size());
-        for (size_t i = 0; i < vertices.positions.size(); i++) {
+        gpuVertices.reserve(vertices.positions.Size());
+        for (size_t i = 0; i < vertices.positions.Size(); i++) {
             Render::MeshRenderData::Vertex vertex;
             vertex.position = vertices.positions[i];
-            vertex.uv0 = i < vertices.uv0.size() ? vertices.uv0[i] : Common::FVec2();
+            vertex.uv0 = i < vertices.uv0.Size() ? vertices.uv0[i] : Common::FVec2();
             gpuVertices.emplace_back(vertex);
         }
 
         RHI::Device* device = EngineHolder::Get().GetRenderModule().GetDevice();
-        outSceneProxy.mesh = new Render::MeshRenderData(*device, gpuVertices, vertices.indices);
+        outSceneProxy.mesh = new Render::MeshRenderData(*device, gpuVertices, vertices.indices.Span());
+        outSceneProxy.localBounds = outSceneProxy.mesh->GetLocalBounds();
+        outSceneProxy.UpdateWorldBounds();
 
         const Render::VertexFactoryType& vertexFactoryType = Render::StaticMeshVertexFactory::Get();
         const Material* material = materialInstance->GetMaterial().Get();
@@ -164,9 +181,9 @@ namespace Runtime {
     void SceneSystem::QueueCreateSceneProxy(Entity inEntity, bool inWithScale)
     {
         const auto& sceneHolder = registry.GGet<SceneHolder>();
-        const auto& component = registry.Get<Component>(inEntity);
-        const auto* transform = registry.Find<WorldTransform>(inEntity);
-        renderModule.GetRenderThread().EmplaceTask([scene = sceneHolder.scene.Get(), inEntity, component, transform = Internal::GetOptional(transform), inWithScale]() -> void {
+        const auto& component = std::as_const(registry).Get<Component>(inEntity);
+        const auto* transform = std::as_const(registry).Find<WorldTransform>(inEntity);
+        pendingUpdates.emplace_back([scene = sceneHolder.scene.Get(), inEntity, component, transform = Internal::GetOptional(transform), inWithScale]() -> void {
             SceneProxy sceneProxy;
             Internal::UpdateSceneProxyContent(sceneProxy, component);
             if (transform.has_value()) {
@@ -180,21 +197,39 @@ namespace Runtime {
     void SceneSystem::QueueUpdateSceneProxyContent(Entity inEntity)
     {
         const auto& sceneHolder = registry.GGet<SceneHolder>();
-        const auto& component = registry.Get<Component>(inEntity);
-        renderModule.GetRenderThread().EmplaceTask([scene = sceneHolder.scene.Get(), inEntity, component]() -> void {
-            auto& sceneProxy = scene->Get<SceneProxy>(inEntity);
-            Internal::UpdateSceneProxyContent(sceneProxy, component);
+        const auto& component = std::as_const(registry).Get<Component>(inEntity);
+        pendingUpdates.emplace_back([scene = sceneHolder.scene.Get(), inEntity, component]() -> void {
+            scene->Update<SceneProxy>(inEntity, [&](SceneProxy& sceneProxy) -> void {
+                Internal::UpdateSceneProxyContent(sceneProxy, component);
+            });
         });
     }
 
     template <typename SceneProxy>
-    void SceneSystem::QueueUpdateSceneProxyTransform(Entity inEntity, bool inWithScale)
+    void SceneSystem::QueueUpdateSceneProxyTransforms(const std::vector<Entity>& inEntities, bool inWithScale)
     {
+        if (inEntities.empty()) {
+            return;
+        }
+
+        // matrices are built here and kept in the frame arena, the render thread only copies them into the proxies, which
+        // also marks their gpu scene slots dirty for the next upload
         const auto& sceneHolder = registry.GGet<SceneHolder>();
-        const auto& transform = registry.Get<WorldTransform>(inEntity);
-        renderModule.GetRenderThread().EmplaceTask([scene = sceneHolder.scene.Get(), inEntity, transform, inWithScale]() -> void {
-            auto& sceneProxy = scene->Get<SceneProxy>(inEntity);
-            Internal::UpdateSceneProxyWorldTransform(sceneProxy, transform, inWithScale);
+        auto* updates = framePipeline.AllocateArray<Internal::SceneProxyTransformUpdate>(inEntities.size());
+        for (size_t i = 0; i < inEntities.size(); i++) {
+            const auto& transform = std::as_const(registry).Get<WorldTransform>(inEntities[i]);
+            updates[i].entity = inEntities[i];
+            updates[i].localToWorld = inWithScale ? transform.localToWorld.GetTransformMatrix() : transform.localToWorld.GetTransformMatrixNoScale();
+        }
+        pendingUpdates.emplace_back([scene = sceneHolder.scene.Get(), updates, updateNum = inEntities.size()]() -> void {
+            for (size_t i = 0; i < updateNum; i++) {
+                scene->Update<SceneProxy>(updates[i].entity, [&](SceneProxy& sceneProxy) -> void {
+                    sceneProxy.localToWorld = updates[i].localToWorld;
+                    if constexpr (std::is_base_of_v<Render::PrimitiveSceneProxy, SceneProxy>) {
+                        sceneProxy.UpdateWorldBounds();
+                    }
+                });
+            }
         });
     }
 
@@ -202,7 +237,7 @@ namespace Runtime {
     void SceneSystem::QueueRemoveSceneProxy(Entity inEntity)
     {
         const auto& sceneHolder = registry.GGet<SceneHolder>();
-        renderModule.GetRenderThread().EmplaceTask([scene = sceneHolder.scene.Get(), inEntity]() -> void {
+        pendingUpdates.emplace_back([scene = sceneHolder.scene.Get(), inEntity]() -> void {
             scene->Remove<SceneProxy>(inEntity);
         });
     }
@@ -4,13 +4,23 @@
 
 #pragma once
 
+#include <Common/Memory.h>
 #include <Runtime/Meta.h>
 #include <Runtime/ECS.h>
 #include <Runtime/Component/Transform.h>
 #include <Runtime/Api.h>
 
 namespace Runtime {
-    class RUNTIME_API EClass() TransformSystem final : public System {
+    // recursive walks the subtree of every dirty entity on the ticking thread. levelOrdered gathers the dirty roots,
+    // drops the ones already covered by a dirty ancestor and updates the hierarchy one depth level at a time, each level
+    // in parallel over contiguous arrays. both compose the TRS form directly, no matrix is built or decomposed
+    enum class TransformPropagation : uint8_t {
+        recursive,
+        levelOrdered,
+        max
+    };
+
+    class RUNTIME_API EClass(reads=Runtime::Hierarchy, writes=Runtime::LocalTransform;Runtime::WorldTransform) TransformSystem final : public System {
         EPolyDerivedClassBody(TransformSystem)
 
     public:
@@ -21,8 +31,15 @@ namespace Runtime {
         NonMovable(TransformSystem)
 
         void Tick(float inDeltaTimeSeconds) override;
+        void SetPropagation(TransformPropagation inPropagation);
+        TransformPropagation GetPropagation() const;
 
     private:
+        void UpdateWorldByLocal(Entity inChild, Entity inParent);
+        void PropagateRecursively(const Common::FrameVector<Entity>& inChildrenDirtyRoots, const Common::FrameVector<Entity>& inSelfDirtyRoots);
+        void PropagateLevelOrdered(const Common::FrameVector<Entity>& inChildrenDirtyRoots, const Common::FrameVector<Entity>& inSelfDirtyRoots);
+
+        TransformPropagation propagation;
         Observer worldTransformUpdatedObserver;
         Observer localTransformUpdatedObserver;
     };
@@ -2,6 +2,9 @@
 // Created by johnk on 2023/10/10.
 //
 
+#include <Common/File.h>
+#include <Render/RenderModule.h>
+#include <Runtime/Engine.h>
 #include <Runtime/Asset/Asset.h>
 
 namespace Runtime {
@@ -38,4 +41,69 @@ namespace Runtime {
     }
 
     AssetManager::~AssetManager() = default;
+
+    bool AssetManager::ConvertToSchemaFile(const Core::Uri& uri)
+    {
+        const Core::AssetUriParser parser(uri);
+        const Common::Path path = parser.Parse().Absolute();
+        if (!path.Exists()) {
+            return false;
+        }
+
+        Common::SharedPtr<Asset> asset;
+        {
+            // a plain stream, blobs must own their bytes before the file is replaced
+            Common::BinaryFileDeserializeStream stream(path.String());
+            if (Mirror::SchemaFile::Is(stream)) {
+                return false;
+            }
+
+            // plain files start with the field header of the asset object followed by its class name
+            std::string className;
+            stream.Seek(static_cast<int64_t>(sizeof(uint64_t) * 2));
+            Common::Serializer<std::string>::Deserialize(stream, className);
+            stream.Seek(-static_cast<int64_t>(stream.Loc()));
+
+            const Mirror::Class* clazz = Mirror::Class::Find(className);
+            if (clazz == nullptr) {
+                return false;
+            }
+            Mirror::Any ptr = clazz->New(uri);
+            asset = Common::SharedPtr<Asset>(ptr.As<Asset*>());
+            ptr.Deref().Deserialize(stream);
+        }
+        SaveInternal(path, asset->GetClass().Cast(Mirror::ForwardAsArg(*asset.Get())));
+        return true;
+    }
+
+    void AssetManager::SaveInternal(const Common::Path& path, const Mirror::Any& ref)
+    {
+        // loaded assets may still map the old file, writing it in place would change or truncate the bytes under
+        // their blobs, write a new file and rename it over the old one, which stays alive until its last mapping goes
+        const Common::Path tempPath = path.String() + ".saving";
+        bool replaced;
+        try {
+            {
+                Common::BinaryFileSerializeStream stream(tempPath.String());
+                Mirror::SchemaFile::Serialize(stream, ref);
+            }
+            replaced = tempPath.RenameTo(path);
+            if (!replaced) {
+                // windows refuses to replace a mapped file, the mappings copy its bytes out so blobs keep them, texture
+                // uploads read blobs on the render thread, so it is flushed first
+                if (EngineHolder::Loaded()) {
+                    EngineHolder::Get().GetRenderModule().GetRenderThread().Flush();
+                }
+                Common::MappedFile::MaterializeAll(path.String());
+                replaced = tempPath.RenameTo(path);
+            }
+        } catch (...) {
+            tempPath.Remove();
+            throw;
+        }
+        if (!replaced) {
+            tempPath.Remove();
+        }
+        AssertWithReason(replaced, "failed to replace the asset file");
+    }
 }
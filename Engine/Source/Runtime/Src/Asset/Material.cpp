@@ -315,7 +315,7 @@ namespace Runtime {
         Render::ShaderCompileOptions options;
         options.byteCodeType = rhiType == RHI::RHIType::directX12 ? Render::ShaderByteCodeType::dxil : Render::ShaderByteCodeType::spirv;
         options.withDebugInfo = static_cast<bool>(BUILD_CONFIG_DEBUG); // NOLINT
-        (void) EngineHolder::Get().GetRenderModule().CompileShaderTypes(typesToCompile, options);
+        Common::Detach(EngineHolder::Get().GetRenderModule().CompileShaderTypes(std::move(typesToCompile), std::move(options)));
     }
 
     MaterialInstance::MaterialInstance(Core::Uri inUri)
@@ -196,7 +196,7 @@ namespace Runtime {
             const auto mipDepth = std::max(depth >> m, 1u);
 
             for (auto a = 0; a < arraySize; a++) {
-                subResourcePixelsData[Internal::GetSubResourceIndex(m, a, arraySize)].resize(mipWidth * mipHeight * mipDepth * bytesPerPixel);
+                subResourcePixelsData[Internal::GetSubResourceIndex(m, a, arraySize)].Resize(mipWidth * mipHeight * mipDepth * bytesPerPixel);
             }
         }
     }
@@ -227,7 +227,7 @@ namespace Runtime {
                 .SetMipLevels(0, mipLevels)
                 .SetArrayLayers(0, type == TextureType::t3D ? 1 : depthOrArraySize));
 
-        renderModule.GetRenderThread().EmplaceTask([
+        renderModule.GetRenderThread().Spawn([
             device,
             texturePtr = texture.Get(),
             type = type,
@@ -235,6 +235,7 @@ namespace Runtime {
             depthOrArraySize = depthOrArraySize,
             mipLevels = mipLevels,
             aspect = Internal::GetTextureAspect(format),
+            // views into the mapped asset file are shared, not copied
             subResourcePixelsData = subResourcePixelsData,
             name = name
         ]() -> void {
@@ -274,7 +275,7 @@ namespace Runtime {
                     const auto srcSlicePitch = srcRowPitch * dstCopyFootprint.extent.y;
                     for (auto z = 0u; z < dstCopyFootprint.extent.z; z++) {
                         for (auto y = 0u; y < dstCopyFootprint.extent.y; y++) {
-                            const auto* src = srcPixels.data() + srcSlicePitch * z + srcRowPitch * y;
+                            const auto* src = srcPixels.Data() + srcSlicePitch * z + srcRowPitch * y;
                             auto* dst = dstData + dstSubResourceOffset + dstCopyFootprint.slicePitch * z + dstCopyFootprint.rowPitch * y;
                             memcpy(dst, src, srcRowPitch);
                         }
@@ -41,19 +41,19 @@ namespace Runtime {
     {
     }
 
-    bool HierarchyOps::HasParent(ECRegistry& inRegistry, Entity inTarget)
+    bool HierarchyOps::HasParent(const ECRegistry& inRegistry, Entity inTarget)
     {
         const auto& hierarchy = inRegistry.Get<Hierarchy>(inTarget);
         return hierarchy.parent != entityNull;
     }
 
-    bool HierarchyOps::HasBro(ECRegistry& inRegistry, Entity inTarget)
+    bool HierarchyOps::HasBro(const ECRegistry& inRegistry, Entity inTarget)
     {
         const auto& hierarchy = inRegistry.Get<Hierarchy>(inTarget);
         return hierarchy.prevBro != entityNull || hierarchy.nextBro != entityNull;
     }
 
-    bool HierarchyOps::HasChildren(ECRegistry& inRegistry, Entity inTarget)
+    bool HierarchyOps::HasChildren(const ECRegistry& inRegistry, Entity inTarget)
     {
         const auto& hierarchy = inRegistry.Get<Hierarchy>(inTarget);
         return hierarchy.firstChild != entityNull;
@@ -142,7 +142,7 @@ namespace Runtime {
         inRegistry.Destroy(inTarget);
     }
 
-    void HierarchyOps::TraverseChildren(ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc)
+    void HierarchyOps::TraverseChildren(const ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc)
     {
         const auto& parentHierarchy = inRegistry.Get<Hierarchy>(inParent);
         for (auto child = parentHierarchy.firstChild; child != entityNull;) {
@@ -152,7 +152,7 @@ namespace Runtime {
         }
     }
 
-    void HierarchyOps::TraverseChildrenRecursively(ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc) // NOLINT
+    void HierarchyOps::TraverseChildrenRecursively(const ECRegistry& inRegistry, Entity inParent, const TraverseFunc& inFunc) // NOLINT
     {
         const auto& parentHierarchy = inRegistry.Get<Hierarchy>(inParent);
         for (auto child = parentHierarchy.firstChild; child != entityNull;) {
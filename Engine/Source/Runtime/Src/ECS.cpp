@@ -4,11 +4,15 @@
 
 #include <taskflow/taskflow.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstring>
+#include <format>
+#include <mutex>
 #include <new>
 #include <utility>
 
+#include <Common/String.h>
 #include <Core/Thread.h>
 #include <Runtime/ECS.h>
 
@@ -21,6 +25,129 @@ namespace Runtime {
     System::~System() = default;
 
     void System::Tick(float inDeltaTimeSeconds) {}
+
+    template <typename T>
+    static bool Intersects(const std::unordered_set<T>& inLhs, const std::unordered_set<T>& inRhs)
+    {
+        const auto& smaller = inLhs.size() < inRhs.size() ? inLhs : inRhs;
+        const auto& bigger = inLhs.size() < inRhs.size() ? inRhs : inLhs;
+        return std::ranges::any_of(smaller, [&](const T& elem) -> bool { return bigger.contains(elem); });
+    }
+
+    static void ParseSystemAccessMeta(SystemClass inClass, const std::string& inKey, const std::function<void(const Mirror::Class*)>& inFunc)
+    {
+        if (!inClass->HasMeta(inKey)) {
+            return;
+        }
+        for (const auto& name : Common::StringUtils::Split(inClass->GetMeta(inKey), ";")) {
+            if (name.empty()) {
+                continue;
+            }
+            const Mirror::Class* clazz = Mirror::Class::Find(name);
+            if (clazz == nullptr) {
+                QuickFailWithReason(std::format("system {} declares unknown class {} in {}", inClass->GetName(), name, inKey));
+                continue;
+            }
+            inFunc(clazz);
+        }
+    }
+
+    SystemAccess::SystemAccess()
+        : declared(false)
+        , structural(false)
+    {
+    }
+
+    SystemAccess SystemAccess::FromMeta(SystemClass inClass)
+    {
+        SystemAccess result;
+        ParseSystemAccessMeta(inClass, MetaPresets::systemReads, [&](const Mirror::Class* clazz) -> void { result.ReadDyn(clazz); });
+        ParseSystemAccessMeta(inClass, MetaPresets::systemWrites, [&](const Mirror::Class* clazz) -> void { result.WriteDyn(clazz); });
+        ParseSystemAccessMeta(inClass, MetaPresets::systemGlobalReads, [&](const Mirror::Class* clazz) -> void { result.GReadDyn(clazz); });
+        ParseSystemAccessMeta(inClass, MetaPresets::systemGlobalWrites, [&](const Mirror::Class* clazz) -> void { result.GWriteDyn(clazz); });
+        if (inClass->GetMetaBoolOr(MetaPresets::systemStructural, false)) {
+            result.Structural();
+        }
+        return result;
+    }
+
+    SystemAccess& SystemAccess::ReadDyn(CompClass inClass)
+    {
+        declared = true;
+        reads.emplace(inClass);
+        return *this;
+    }
+
+    SystemAccess& SystemAccess::WriteDyn(CompClass inClass)
+    {
+        declared = true;
+        writes.emplace(inClass);
+        return *this;
+    }
+
+    SystemAccess& SystemAccess::GReadDyn(GCompClass inClass)
+    {
+        declared = true;
+        globalReads.emplace(inClass);
+        return *this;
+    }
+
+    SystemAccess& SystemAccess::GWriteDyn(GCompClass inClass)
+    {
+        declared = true;
+        globalWrites.emplace(inClass);
+        return *this;
+    }
+
+    SystemAccess& SystemAccess::Structural()
+    {
+        declared = true;
+        structural = true;
+        return *this;
+    }
+
+    bool SystemAccess::Declared() const
+    {
+        return declared;
+    }
+
+    bool SystemAccess::IsStructural() const
+    {
+        return structural;
+    }
+
+    bool SystemAccess::CanRead(CompClass inClass) const
+    {
+        return structural || reads.contains(inClass) || writes.contains(inClass);
+    }
+
+    bool SystemAccess::CanWrite(CompClass inClass) const
+    {
+        return structural || writes.contains(inClass);
+    }
+
+    bool SystemAccess::GCanRead(GCompClass inClass) const
+    {
+        return structural || globalReads.contains(inClass) || globalWrites.contains(inClass);
+    }
+
+    bool SystemAccess::GCanWrite(GCompClass inClass) const
+    {
+        return structural || globalWrites.contains(inClass);
+    }
+
+    bool SystemAccess::ConflictsWith(const SystemAccess& inOther) const
+    {
+        if (!declared || !inOther.declared || structural || inOther.structural) {
+            return true;
+        }
+        return Intersects(writes, inOther.writes)
+            || Intersects(writes, inOther.reads)
+            || Intersects(reads, inOther.writes)
+            || Intersects(globalWrites, inOther.globalWrites)
+            || Intersects(globalWrites, inOther.globalReads)
+            || Intersects(globalReads, inOther.globalWrites);
+    }
 }
 
 namespace Runtime::Internal {
@@ -211,14 +338,19 @@ namespace Runtime::Internal {
         return ArchetypeLayout(std::move(result), tags);
     }
 
-    Archetype::Archetype(ArchetypeLayout inLayout)
+    Archetype::Archetype(ArchetypeLayout inLayout, ArchetypeStorage inStorage)
         : id(inLayout.Id())
+        , storage(inStorage)
         , count(0)
         , capacity(0)
+        , chunkShift(0)
+        , chunkMask(0)
+        , chunkBlockBytes(0)
+        , chunkBlockAlignment(1)
         , rttiVec(inLayout.CompRttis())
         , tags(inLayout.Tags())
-        , compMemory(rttiVec.size(), nullptr)
         , compStrides(rttiVec.size())
+        , chunkColumnOffsets(rttiVec.size(), 0)
     {
         rttiMap.reserve(rttiVec.size());
         for (auto i = 0; i < rttiVec.size(); i++) {
@@ -226,8 +358,8 @@ namespace Runtime::Internal {
             const auto clazz = rtti.Class();
             rttiMap.emplace(clazz, i);
             compStrides[i] = rtti.MemorySize();
-
         }
+        ComputeChunkLayout();
     }
 
     Archetype::~Archetype()
@@ -238,27 +370,36 @@ namespace Runtime::Internal {
 
     Archetype::Archetype(const Archetype& inOther)
         : id(inOther.id)
+        , storage(inOther.storage)
         , count(inOther.count)
         , capacity(inOther.capacity)
+        , chunkShift(inOther.chunkShift)
+        , chunkMask(inOther.chunkMask)
+        , chunkBlockBytes(inOther.chunkBlockBytes)
+        , chunkBlockAlignment(inOther.chunkBlockAlignment)
         , rttiVec(inOther.rttiVec)
         , tags(inOther.tags)
         , rttiMap(inOther.rttiMap)
-        , compMemory(rttiVec.size(), nullptr)
         , compStrides(inOther.compStrides)
+        , chunkColumnOffsets(inOther.chunkColumnOffsets)
         , elemMap(inOther.elemMap)
     {
-        for (size_t compIndex = 0; compIndex < rttiVec.size(); compIndex++) {
-            const auto& rtti = rttiVec[compIndex];
-            if (capacity > 0) {
-                compMemory[compIndex] = ::operator new(capacity * rtti.MemorySize(), std::align_val_t(rtti.MemoryAlignment()));
-            }
-            if (rtti.TriviallyRelocatable()) {
-                if (count > 0) {
-                    std::memcpy(compMemory[compIndex], inOther.compMemory[compIndex], count * compStrides[compIndex]);
-                }
-            } else {
-                for (size_t elemIndex = 0; elemIndex < count; elemIndex++) {
-                    rtti.CopyConstructFrom(GetCompAt(elemIndex, compIndex), const_cast<void*>(inOther.GetCompAt(elemIndex, compIndex)));
+        chunks.reserve(inOther.chunks.size());
+        for (size_t chunkIndex = 0; chunkIndex < inOther.chunks.size(); chunkIndex++) {
+            chunks.emplace_back(AllocateChunk(storage == ArchetypeStorage::chunked ? chunkMask + 1 : capacity));
+        }
+
+        for (size_t chunkIndex = 0; chunkIndex < ChunkCount(); chunkIndex++) {
+            const auto chunkBegin = ChunkBegin(chunkIndex);
+            const auto chunkElemCount = ChunkElemCount(chunkIndex);
+            for (size_t compIndex = 0; compIndex < rttiVec.size(); compIndex++) {
+                const auto& rtti = rttiVec[compIndex];
+                if (rtti.TriviallyRelocatable()) {
+                    std::memcpy(GetChunkCompColumn(chunkIndex, compIndex), inOther.GetChunkCompColumn(chunkIndex, compIndex), chunkElemCount * compStrides[compIndex]);
+                } else {
+                    for (size_t elemIndex = chunkBegin; elemIndex < chunkBegin + chunkElemCount; elemIndex++) {
+                        rtti.CopyConstructFrom(GetCompAt(elemIndex, compIndex), const_cast<void*>(inOther.GetCompAt(elemIndex, compIndex)));
+                    }
                 }
             }
         }
@@ -266,13 +407,19 @@ namespace Runtime::Internal {
 
     Archetype::Archetype(Archetype&& inOther) noexcept
         : id(inOther.id)
+        , storage(inOther.storage)
         , count(std::exchange(inOther.count, 0))
         , capacity(std::exchange(inOther.capacity, 0))
+        , chunkShift(inOther.chunkShift)
+        , chunkMask(inOther.chunkMask)
+        , chunkBlockBytes(inOther.chunkBlockBytes)
+        , chunkBlockAlignment(inOther.chunkBlockAlignment)
         , rttiVec(std::move(inOther.rttiVec))
         , tags(std::move(inOther.tags))
         , rttiMap(std::move(inOther.rttiMap))
-        , compMemory(std::move(inOther.compMemory))
         , compStrides(std::move(inOther.compStrides))
+        , chunkColumnOffsets(std::move(inOther.chunkColumnOffsets))
+        , chunks(std::move(inOther.chunks))
         , elemMap(std::move(inOther.elemMap))
     {
     }
@@ -294,13 +441,19 @@ namespace Runtime::Internal {
         DestroyElements();
         ReleaseMemory();
         id = inOther.id;
+        storage = inOther.storage;
         count = std::exchange(inOther.count, 0);
         capacity = std::exchange(inOther.capacity, 0);
+        chunkShift = inOther.chunkShift;
+        chunkMask = inOther.chunkMask;
+        chunkBlockBytes = inOther.chunkBlockBytes;
+        chunkBlockAlignment = inOther.chunkBlockAlignment;
         rttiVec = std::move(inOther.rttiVec);
         tags = std::move(inOther.tags);
         rttiMap = std::move(inOther.rttiMap);
-        compMemory = std::move(inOther.compMemory);
         compStrides = std::move(inOther.compStrides);
+        chunkColumnOffsets = std::move(inOther.chunkColumnOffsets);
+        chunks = std::move(inOther.chunks);
         elemMap = std::move(inOther.elemMap);
         addTransitions.clear();
         removeTransitions.clear();
@@ -332,6 +485,24 @@ namespace Runtime::Internal {
         return true;
     }
 
+    void Archetype::ReserveElems(size_t inElemNum)
+    {
+        const size_t requiredCapacity = count + inElemNum;
+        if (requiredCapacity <= capacity) {
+            return;
+        }
+        if (storage == ArchetypeStorage::chunked) {
+            while (capacity < requiredCapacity) {
+                Reserve();
+            }
+            return;
+        }
+        Reserve(std::max(1.5f, static_cast<float>(requiredCapacity) / static_cast<float>(std::max(capacity, static_cast<size_t>(1)))));
+        while (capacity < requiredCapacity) {
+            Reserve();
+        }
+    }
+
     size_t Archetype::EmplaceElem(Entity inEntity)
     {
         AllocateNewElemBack();
@@ -440,6 +611,11 @@ namespace Runtime::Internal {
         return id;
     }
 
+    ArchetypeStorage Archetype::Storage() const
+    {
+        return storage;
+    }
+
     const Archetype::Transition* Archetype::FindAddTransition(CompClass inClass) const
     {
         const auto iter = std::ranges::find_if(addTransitions, [&](const Transition& transition) -> bool { return transition.compClass == inClass; });
@@ -484,30 +660,33 @@ namespace Runtime::Internal {
 
     void Archetype::Reserve(float inRatio)
     {
+        if (storage == ArchetypeStorage::chunked) {
+            chunks.emplace_back(AllocateChunk(chunkMask + 1));
+            capacity += chunkMask + 1;
+            return;
+        }
+
         Assert(inRatio > 1.0f);
         const size_t newCapacity = static_cast<size_t>(std::ceil(static_cast<float>(std::max(Capacity(), static_cast<size_t>(1))) * inRatio));
-        std::vector<ElemPtr> newCompMemory(rttiVec.size(), nullptr);
+        Chunk newChunk = AllocateChunk(newCapacity);
 
         for (size_t compIndex = 0; compIndex < rttiVec.size(); compIndex++) {
             const auto& rtti = rttiVec[compIndex];
-            newCompMemory[compIndex] = ::operator new(newCapacity * rtti.MemorySize(), std::align_val_t(rtti.MemoryAlignment()));
             if (rtti.TriviallyRelocatable()) {
                 if (count > 0) {
-                    std::memcpy(newCompMemory[compIndex], compMemory[compIndex], count * compStrides[compIndex]);
+                    std::memcpy(newChunk.columns[compIndex], GetChunkCompColumn(0, compIndex), count * compStrides[compIndex]);
                 }
             } else {
                 for (size_t elemIndex = 0; elemIndex < count; elemIndex++) {
-                    ElemPtr dstElem = CompAt(newCompMemory[compIndex], compIndex, elemIndex);
+                    ElemPtr dstElem = CompAt(newChunk.columns[compIndex], compIndex, elemIndex);
                     ElemPtr srcElem = GetCompAt(elemIndex, compIndex);
                     rtti.MoveConstructFrom(dstElem, srcElem);
                     rtti.Destruct(srcElem);
                 }
             }
-            if (compMemory[compIndex] != nullptr) {
-                ::operator delete(compMemory[compIndex], std::align_val_t(rtti.MemoryAlignment()));
-            }
         }
-        compMemory = std::move(newCompMemory);
+        ReleaseMemory();
+        chunks.emplace_back(std::move(newChunk));
         capacity = newCapacity;
     }
 
@@ -527,12 +706,10 @@ namespace Runtime::Internal {
 
     void Archetype::ReleaseMemory()
     {
-        for (size_t compIndex = 0; compIndex < compMemory.size(); compIndex++) {
-            if (compMemory[compIndex] != nullptr) {
-                ::operator delete(compMemory[compIndex], std::align_val_t(rttiVec[compIndex].MemoryAlignment()));
-                compMemory[compIndex] = nullptr;
-            }
+        for (auto& chunk : chunks) {
+            FreeChunk(chunk);
         }
+        chunks.clear();
         capacity = 0;
     }
 
@@ -544,6 +721,76 @@ namespace Runtime::Internal {
         count++;
     }
 
+    void Archetype::ComputeChunkLayout()
+    {
+        if (storage == ArchetypeStorage::contiguous) {
+            // one chunk growing in place, every elem index resolves to chunk 0 and row == elem index
+            chunkShift = std::numeric_limits<size_t>::digits - 1;
+            chunkMask = std::numeric_limits<size_t>::max();
+            return;
+        }
+
+        // use a power of two row count so elem index -> (chunk, row) is a shift and a mask instead of a division
+        size_t rowShift = 0;
+        while (rowShift < maxChunkShift && ComputeChunkColumnOffsets(static_cast<size_t>(2) << rowShift, chunkColumnOffsets) <= chunkBlockSize) {
+            rowShift++;
+        }
+        chunkShift = rowShift;
+        chunkMask = (static_cast<size_t>(1) << rowShift) - 1;
+        chunkBlockBytes = ComputeChunkColumnOffsets(chunkMask + 1, chunkColumnOffsets);
+        for (const auto& rtti : rttiVec) {
+            chunkBlockAlignment = std::max(chunkBlockAlignment, rtti.MemoryAlignment());
+        }
+    }
+
+    size_t Archetype::ComputeChunkColumnOffsets(size_t inRowCount, std::vector<size_t>& outOffsets) const
+    {
+        size_t offset = 0;
+        for (size_t compIndex = 0; compIndex < rttiVec.size(); compIndex++) {
+            const size_t alignment = rttiVec[compIndex].MemoryAlignment();
+            offset = (offset + alignment - 1) / alignment * alignment;
+            outOffsets[compIndex] = offset;
+            offset += inRowCount * compStrides[compIndex];
+        }
+        return offset;
+    }
+
+    Archetype::Chunk Archetype::AllocateChunk(size_t inRowCount) const
+    {
+        Chunk chunk { nullptr, std::vector<ElemPtr>(rttiVec.size(), nullptr) };
+        if (storage == ArchetypeStorage::chunked) {
+            if (chunkBlockBytes > 0) {
+                chunk.block = ::operator new(chunkBlockBytes, std::align_val_t(chunkBlockAlignment));
+                for (size_t compIndex = 0; compIndex < rttiVec.size(); compIndex++) {
+                    chunk.columns[compIndex] = static_cast<uint8_t*>(chunk.block) + chunkColumnOffsets[compIndex];
+                }
+            }
+        } else {
+            for (size_t compIndex = 0; compIndex < rttiVec.size(); compIndex++) {
+                const auto& rtti = rttiVec[compIndex];
+                chunk.columns[compIndex] = ::operator new(inRowCount * rtti.MemorySize(), std::align_val_t(rtti.MemoryAlignment()));
+            }
+        }
+        return chunk;
+    }
+
+    void Archetype::FreeChunk(Chunk& inChunk) const
+    {
+        if (storage == ArchetypeStorage::chunked) {
+            if (inChunk.block != nullptr) {
+                ::operator delete(inChunk.block, std::align_val_t(chunkBlockAlignment));
+            }
+        } else {
+            for (size_t compIndex = 0; compIndex < inChunk.columns.size(); compIndex++) {
+                if (inChunk.columns[compIndex] != nullptr) {
+                    ::operator delete(inChunk.columns[compIndex], std::align_val_t(rttiVec[compIndex].MemoryAlignment()));
+                }
+            }
+        }
+        inChunk.block = nullptr;
+        inChunk.columns.clear();
+    }
+
     EntityPool::EntityPool()
         : locations(1)
         , states(1)
@@ -685,6 +932,7 @@ namespace Runtime::Internal {
 
     SystemFactory::SystemFactory(SystemClass inClass)
         : clazz(inClass)
+        , access(SystemAccess::FromMeta(inClass))
     {
         BuildArgumentLists();
     }
@@ -718,6 +966,16 @@ namespace Runtime::Internal {
         return clazz;
     }
 
+    SystemAccess& SystemFactory::GetAccess()
+    {
+        return access;
+    }
+
+    const SystemAccess& SystemFactory::GetAccess() const
+    {
+        return access;
+    }
+
     void SystemFactory::BuildArgumentLists()
     {
         const auto& memberVariables = clazz->GetMemberVariables();
@@ -726,6 +984,70 @@ namespace Runtime::Internal {
             arguments.emplace(id.name, member.GetDyn(clazz->GetDefaultObject()));
         }
     }
+
+    static thread_local const SystemAccessChecker* currentSystemAccessChecker = nullptr;
+
+    SystemAccessChecker::SystemAccessChecker(const ECRegistry& inRegistry, const SystemFactory& inFactory)
+        : registry(inRegistry)
+        , factory(inFactory)
+        , last(currentSystemAccessChecker)
+    {
+        currentSystemAccessChecker = this;
+    }
+
+    SystemAccessChecker::~SystemAccessChecker()
+    {
+        currentSystemAccessChecker = last;
+    }
+
+    void SystemAccessChecker::CheckRead(const ECRegistry& inRegistry, CompClass inClass)
+    {
+        if (const auto* checker = Current(inRegistry);
+            checker != nullptr && !checker->factory.GetAccess().CanRead(inClass)) {
+            QuickFailWithReason(std::format("system {} accesses undeclared component {}", checker->factory.GetClass()->GetName(), inClass->GetName()));
+        }
+    }
+
+    void SystemAccessChecker::CheckWrite(const ECRegistry& inRegistry, CompClass inClass)
+    {
+        if (const auto* checker = Current(inRegistry);
+            checker != nullptr && !checker->factory.GetAccess().CanWrite(inClass)) {
+            QuickFailWithReason(std::format("system {} writes component {} without declaring it", checker->factory.GetClass()->GetName(), inClass->GetName()));
+        }
+    }
+
+    void SystemAccessChecker::CheckGRead(const ECRegistry& inRegistry, GCompClass inClass)
+    {
+        if (const auto* checker = Current(inRegistry);
+            checker != nullptr && !checker->factory.GetAccess().GCanRead(inClass)) {
+            QuickFailWithReason(std::format("system {} accesses undeclared global component {}", checker->factory.GetClass()->GetName(), inClass->GetName()));
+        }
+    }
+
+    void SystemAccessChecker::CheckGWrite(const ECRegistry& inRegistry, GCompClass inClass)
+    {
+        if (const auto* checker = Current(inRegistry);
+            checker != nullptr && !checker->factory.GetAccess().GCanWrite(inClass)) {
+            QuickFailWithReason(std::format("system {} writes global component {} without declaring it", checker->factory.GetClass()->GetName(), inClass->GetName()));
+        }
+    }
+
+    void SystemAccessChecker::CheckStructural(const ECRegistry& inRegistry)
+    {
+        if (const auto* checker = Current(inRegistry);
+            checker != nullptr && !checker->factory.GetAccess().IsStructural()) {
+            QuickFailWithReason(std::format("system {} changes registry structure without declaring structural", checker->factory.GetClass()->GetName()));
+        }
+    }
+
+    const SystemAccessChecker* SystemAccessChecker::Current(const ECRegistry& inRegistry)
+    {
+        const auto* checker = currentSystemAccessChecker;
+        if (checker == nullptr || &checker->registry != &inRegistry || !checker->factory.GetAccess().Declared()) {
+            return nullptr;
+        }
+        return checker;
+    }
 } // namespace Runtime::Internal
 
 namespace Runtime {
@@ -969,32 +1291,107 @@ namespace Runtime {
         return removedObserver;
     }
 
-    ECRegistry::ECRegistry()
+    static uint64_t AllocateRegistryUid()
+    {
+        static std::atomic<uint64_t> counter = 0;
+        return ++counter;
+    }
+
+    // every thread caches the command buffer it owns in each registry, the caches are listed here so a destroyed
+    // registry can evict its entries from the caches of all threads
+    class ThreadCommandBufferCaches {
+    public:
+        struct Entry {
+            uint64_t registryUid;
+            ECCommandBuffer* buffer;
+        };
+
+        struct Cache {
+            std::mutex mutex;
+            std::vector<Entry> entries;
+        };
+
+        static ThreadCommandBufferCaches& Get()
+        {
+            // never destroyed, registries with static storage evict from it on exit
+            static auto* instance = new ThreadCommandBufferCaches();
+            return *instance;
+        }
+
+        void Register(Cache* inCache)
+        {
+            std::unique_lock lock(mutex);
+            caches.emplace_back(inCache);
+        }
+
+        void Unregister(Cache* inCache)
+        {
+            std::unique_lock lock(mutex);
+            std::erase(caches, inCache);
+        }
+
+        void Evict(uint64_t inRegistryUid)
+        {
+            std::unique_lock lock(mutex);
+            for (auto* cache : caches) {
+                std::unique_lock cacheLock(cache->mutex);
+                std::erase_if(cache->entries, [&](const Entry& inEntry) -> bool { return inEntry.registryUid == inRegistryUid; });
+            }
+        }
+
+    private:
+        std::mutex mutex;
+        std::vector<Cache*> caches;
+    };
+
+    struct ThreadCommandBufferCacheHolder {
+        ThreadCommandBufferCacheHolder()
+        {
+            ThreadCommandBufferCaches::Get().Register(&cache);
+        }
+
+        ~ThreadCommandBufferCacheHolder()
+        {
+            ThreadCommandBufferCaches::Get().Unregister(&cache);
+        }
+
+        ThreadCommandBufferCaches::Cache cache;
+    };
+
+    ECRegistry::ECRegistry(ArchetypeStorage inStorage)
+        : archetypeStorage(inStorage)
+        , uid(AllocateRegistryUid())
     {
-        archetypes.emplace(0, Internal::Archetype());
+        archetypes.emplace(0, Internal::Archetype({}, archetypeStorage));
     }
 
     ECRegistry::~ECRegistry()
     {
         CheckEventsUnbound();
+        ThreadCommandBufferCaches::Get().Evict(uid);
     }
 
     ECRegistry::ECRegistry(const ECRegistry& inOther)
-        : entities(inOther.entities)
+        : archetypeStorage(inOther.archetypeStorage)
+        , entities(inOther.entities)
         , globalComps(inOther.globalComps)
         , archetypes(inOther.archetypes)
         , dataCompClasses(inOther.dataCompClasses)
         , tagClasses(inOther.tagClasses)
+        , uid(AllocateRegistryUid())
     {
         RebindEntityArchetypes();
     }
 
     ECRegistry::ECRegistry(ECRegistry&& inOther) noexcept
-        : entities(std::move(inOther.entities))
+        : archetypeStorage(inOther.archetypeStorage)
+        , entities(std::move(inOther.entities))
         , globalComps(std::move(inOther.globalComps))
         , archetypes(std::move(inOther.archetypes))
         , dataCompClasses(std::move(inOther.dataCompClasses))
         , tagClasses(std::move(inOther.tagClasses))
+        , uid(std::exchange(inOther.uid, AllocateRegistryUid()))
+        , commandBuffers(std::move(inOther.commandBuffers))
     {
         RebindEntityArchetypes();
     }
@@ -1004,6 +1401,7 @@ namespace Runtime {
         if (this == &inOther) {
             return *this;
         }
+        archetypeStorage = inOther.archetypeStorage;
         entities = inOther.entities;
         globalComps = inOther.globalComps;
         archetypes = inOther.archetypes;
@@ -1018,17 +1416,24 @@ namespace Runtime {
         if (this == &inOther) {
             return *this;
         }
+        archetypeStorage = inOther.archetypeStorage;
         entities = std::move(inOther.entities);
         globalComps = std::move(inOther.globalComps);
         archetypes = std::move(inOther.archetypes);
         dataCompClasses = std::move(inOther.dataCompClasses);
         tagClasses = std::move(inOther.tagClasses);
+        // the buffers of this registry are dropped, the cached ones of the other follow its uid
+        ThreadCommandBufferCaches::Get().Evict(uid);
+        uid = std::exchange(inOther.uid, AllocateRegistryUid());
+        commandBuffers = std::move(inOther.commandBuffers);
+        inOther.commandBuffers.clear();
         RebindEntityArchetypes();
         return *this;
     }
 
     Entity ECRegistry::Create()
     {
+        ECS_CHECK_STRUCTURAL(*this);
         const Entity result = entities.Allocate();
         Internal::Archetype& archetype = archetypes.at(0);
         const auto elemIndex = archetype.EmplaceElem(result);
@@ -1038,6 +1443,7 @@ namespace Runtime {
 
     void ECRegistry::Create(Entity inEntity)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         entities.Allocate(inEntity);
         Internal::Archetype& archetype = archetypes.at(0);
         const auto elemIndex = archetype.EmplaceElem(inEntity);
@@ -1046,6 +1452,7 @@ namespace Runtime {
 
     void ECRegistry::Destroy(Entity inEntity)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         const auto location = entities.GetLocation(inEntity);
         Internal::Archetype& archetype = *location.archetype;
         if (!compEvents.empty()) {
@@ -1077,7 +1484,7 @@ namespace Runtime {
         archetypes.clear();
         dataCompClasses.clear();
         tagClasses.clear();
-        archetypes.emplace(0, Internal::Archetype());
+        archetypes.emplace(0, Internal::Archetype({}, archetypeStorage));
     }
 
     void ECRegistry::Each(const EntityTraverseFunc& inFunc) const
@@ -1132,6 +1539,11 @@ namespace Runtime {
         return entities.GetArchetypePtr(inEntity)->GetTags().Count();
     }
 
+    ArchetypeStorage ECRegistry::GetArchetypeStorage() const
+    {
+        return archetypeStorage;
+    }
+
     Runtime::RuntimeView ECRegistry::RuntimeView(const RuntimeFilter& inFilter)
     {
         return Runtime::RuntimeView { *this, inFilter };
@@ -1154,6 +1566,7 @@ namespace Runtime {
 
     void ECRegistry::NotifyUpdatedDyn(CompClass inClass, Entity inEntity)
     {
+        ECS_CHECK_WRITE(*this, inClass);
         if (compEvents.empty()) {
             return;
         }
@@ -1312,6 +1725,7 @@ namespace Runtime {
 
     Mirror::Any ECRegistry::EmplaceDyn(CompClass inClass, Entity inEntity, const Mirror::ArgumentList& inArgs)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         const auto location = MoveEntityForAdd(Internal::CompRtti(inClass), inEntity);
         Mirror::Any tempObj = inClass->ConstructDyn(inArgs);
         Mirror::Any compRef = location.archetype->EmplaceComp(location.elemIndex, inClass, tempObj.Ref());
@@ -1321,6 +1735,7 @@ namespace Runtime {
 
     void ECRegistry::RemoveDyn(CompClass inClass, Entity inEntity)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         Assert(Valid(inEntity) && HasDyn(inClass, inEntity));
         MoveEntityForRemove(inClass, inEntity);
     }
@@ -1348,19 +1763,105 @@ namespace Runtime {
 
     Internal::EntityPool::Location ECRegistry::MoveEntityForAdd(CompClass inClass, Entity inEntity, const Internal::EntityPool::Location& inLocation, Internal::ArchetypeLayout inLayout)
     {
-        Internal::Archetype& archetype = *inLocation.archetype;
-        Assert(archetype.FindAddTransition(inClass) == nullptr);
+        Assert(inLocation.archetype->FindAddTransition(inClass) == nullptr);
+        return MoveEntityThroughTransition(inEntity, inLocation, FindOrCacheAddTransition(inClass, *inLocation.archetype, std::move(inLayout)));
+    }
+
+    const Internal::Archetype::Transition& ECRegistry::FindOrCacheAddTransition(CompClass inClass, Internal::Archetype& inArchetype, Internal::ArchetypeLayout inLayout)
+    {
+        if (const auto* transition = inArchetype.FindAddTransition(inClass)) {
+            return *transition;
+        }
         const Internal::ArchetypeId newArchetypeId = inLayout.Id();
         if (!archetypes.contains(newArchetypeId)) {
-            archetypes.emplace(newArchetypeId, Internal::Archetype(std::move(inLayout)));
+            archetypes.emplace(newArchetypeId, Internal::Archetype(std::move(inLayout), archetypeStorage));
         }
         Internal::Archetype& newArchetype = archetypes.at(newArchetypeId);
-        const auto& transition = archetype.CacheAddTransition(inClass, newArchetype);
+        const auto& transition = inArchetype.CacheAddTransition(inClass, newArchetype);
         if (newArchetype.FindRemoveTransition(inClass) == nullptr) {
-            newArchetype.CacheRemoveTransition(inClass, archetype);
+            newArchetype.CacheRemoveTransition(inClass, inArchetype);
+        }
+        return transition;
+    }
+
+    Internal::EntityPool::Location ECRegistry::CreateBatchElems(std::vector<Internal::CompRtti> inRttis, size_t inCount, std::vector<Entity>& outEntities)
+    {
+        for (const auto& rtti : inRttis) {
+            RegisterDataCompClass(rtti.Class());
+        }
+        Internal::ArchetypeLayout layout(std::move(inRttis), {});
+        const Internal::ArchetypeId archetypeId = layout.Id();
+        if (!archetypes.contains(archetypeId)) {
+            archetypes.emplace(archetypeId, Internal::Archetype(std::move(layout), archetypeStorage));
+        }
+        Internal::Archetype& archetype = archetypes.at(archetypeId);
+        archetype.ReserveElems(inCount);
+
+        // EmplaceElem() always appends, so the batch occupies [firstElemIndex, firstElemIndex + inCount)
+        const size_t firstElemIndex = archetype.Count();
+        outEntities.reserve(outEntities.size() + inCount);
+        for (size_t i = 0; i < inCount; i++) {
+            const Entity entity = entities.Allocate();
+            const auto elemIndex = archetype.EmplaceElem(entity);
+            entities.SetLocation(entity, archetype, elemIndex);
+            outEntities.emplace_back(entity);
+        }
+        return { &archetype, firstElemIndex };
+    }
+
+    void ECRegistry::MoveEntitiesForAdd(const Internal::CompRtti& inRtti, std::span<const Entity> inEntities)
+    {
+        struct BatchTransition {
+            Internal::Archetype* srcArchetype;
+            const Internal::Archetype::Transition* transition;
+        };
+
+        struct BatchTarget {
+            Internal::Archetype* archetype;
+            size_t elemNum;
+        };
+
+        const CompClass clazz = inRtti.Class();
+        RegisterDataCompClass(clazz);
+
+        // a batch usually spans only a few source archetypes, so linear lookups beat hashing here
+        std::vector<BatchTransition> transitions;
+        std::vector<BatchTarget> targets;
+        const auto findTransition = [&](const Internal::Archetype* inSrcArchetype) -> const Internal::Archetype::Transition* {
+            for (const auto& [srcArchetype, transition] : transitions) {
+                if (srcArchetype == inSrcArchetype) {
+                    return transition;
+                }
+            }
+            return nullptr;
+        };
+
+        for (const auto entity : inEntities) {
+            Assert(Valid(entity));
+            Internal::Archetype* srcArchetype = entities.GetArchetypePtr(entity);
+            const auto* transition = findTransition(srcArchetype);
+            if (transition == nullptr) {
+                Assert(!srcArchetype->ContainsComp(clazz));
+                transition = &FindOrCacheAddTransition(clazz, *srcArchetype, srcArchetype->GetLayout().WithComp(inRtti));
+                transitions.emplace_back(srcArchetype, transition);
+            }
+            const auto targetIter = std::ranges::find_if(targets, [&](const BatchTarget& target) -> bool { return target.archetype == transition->archetype; });
+            if (targetIter == targets.end()) {
+                targets.emplace_back(transition->archetype, 1);
+            } else {
+                targetIter->elemNum++;
+            }
+        }
+        for (const auto& [archetype, elemNum] : targets) {
+            archetype->ReserveElems(elemNum);
         }
 
-        return MoveEntityThroughTransition(inEntity, inLocation, transition);
+        for (const auto entity : inEntities) {
+            const auto location = entities.GetLocation(entity);
+            const auto* transition = findTransition(location.archetype);
+            Assert(transition != nullptr);
+            MoveEntityThroughTransition(entity, location, *transition);
+        }
     }
 
     Internal::EntityPool::Location ECRegistry::MoveEntityThroughTransition(Entity inEntity, const Internal::EntityPool::Location& inLocation, const Internal::Archetype::Transition& inTransition)
@@ -1384,7 +1885,7 @@ namespace Runtime {
             Internal::ArchetypeLayout newLayout = archetype.GetLayout().Without(inClass);
             const Internal::ArchetypeId newArchetypeId = newLayout.Id();
             if (!archetypes.contains(newArchetypeId)) {
-                archetypes.emplace(newArchetypeId, Internal::Archetype(std::move(newLayout)));
+                archetypes.emplace(newArchetypeId, Internal::Archetype(std::move(newLayout), archetypeStorage));
             }
             Internal::Archetype& newArchetype = archetypes.at(newArchetypeId);
             transition = &archetype.CacheRemoveTransition(inClass, newArchetype);
@@ -1414,6 +1915,7 @@ namespace Runtime {
 
     bool ECRegistry::HasDyn(CompClass inClass, Entity inEntity) const
     {
+        ECS_CHECK_READ(*this, inClass);
         Assert(Valid(inEntity));
         return entities.GetArchetypePtr(inEntity)->ContainsComp(inClass);
     }
@@ -1430,6 +1932,7 @@ namespace Runtime {
 
     Mirror::Any ECRegistry::GetDyn(CompClass inClass, Entity inEntity)
     {
+        ECS_CHECK_WRITE(*this, inClass);
         Assert(Valid(inEntity) && HasDyn(inClass, inEntity));
         Mirror::Any compRef = entities.GetArchetypePtr(inEntity)->GetComp(entities.GetElemIndex(inEntity), inClass);
         return compRef;
@@ -1437,6 +1940,7 @@ namespace Runtime {
 
     Mirror::Any ECRegistry::GetDyn(CompClass inClass, Entity inEntity) const
     {
+        ECS_CHECK_READ(*this, inClass);
         Assert(Valid(inEntity) && HasDyn(inClass, inEntity));
         Mirror::Any compRef = entities.GetArchetypePtr(inEntity)->GetComp(entities.GetElemIndex(inEntity), inClass);
         return compRef.ConstRef();
@@ -1449,6 +1953,7 @@ namespace Runtime {
 
     void ECRegistry::AddTagDyn(TagClass inClass, Entity inEntity)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         Assert(inClass->SizeOf() == 1 && inClass->AlignOf() == 1);
         Assert(Valid(inEntity) && !HasTagDyn(inClass, inEntity));
         MoveEntityForAddTag(inClass, inEntity);
@@ -1457,6 +1962,7 @@ namespace Runtime {
 
     void ECRegistry::RemoveTagDyn(TagClass inClass, Entity inEntity)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         Assert(Valid(inEntity) && HasTagDyn(inClass, inEntity));
         MoveEntityForRemove(inClass, inEntity);
     }
@@ -1469,6 +1975,7 @@ namespace Runtime {
 
     void ECRegistry::GNotifyUpdatedDyn(GCompClass inClass)
     {
+        ECS_CHECK_G_WRITE(*this, inClass);
         const auto iter = globalCompEvents.find(inClass);
         if (iter == globalCompEvents.end()) {
             return;
@@ -1496,6 +2003,7 @@ namespace Runtime {
 
     Mirror::Any ECRegistry::GEmplaceDyn(GCompClass inClass, const Mirror::ArgumentList& inArgs)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         Assert(Internal::IsGlobalCompClass(inClass));
         Assert(!GHasDyn(inClass));
         globalComps.emplace(inClass, inClass->ConstructDyn(inArgs));
@@ -1505,6 +2013,7 @@ namespace Runtime {
 
     void ECRegistry::GRemoveDyn(GCompClass inClass)
     {
+        ECS_CHECK_STRUCTURAL(*this);
         Assert(Internal::IsGlobalCompClass(inClass));
         Assert(GHasDyn(inClass));
         GNotifyRemoveDyn(inClass);
@@ -1528,6 +2037,7 @@ namespace Runtime {
 
     bool ECRegistry::GHasDyn(GCompClass inClass) const
     {
+        ECS_CHECK_G_READ(*this, inClass);
         Assert(Internal::IsGlobalCompClass(inClass));
         return globalComps.contains(inClass);
     }
@@ -1546,6 +2056,7 @@ namespace Runtime {
 
     Mirror::Any ECRegistry::GGetDyn(GCompClass inClass)
     {
+        ECS_CHECK_G_WRITE(*this, inClass);
         Assert(Internal::IsGlobalCompClass(inClass));
         Assert(GHasDyn(inClass));
         return globalComps.at(inClass).Ref();
@@ -1553,6 +2064,7 @@ namespace Runtime {
 
     Mirror::Any ECRegistry::GGetDyn(GCompClass inClass) const
     {
+        ECS_CHECK_G_READ(*this, inClass);
         Assert(Internal::IsGlobalCompClass(inClass));
         Assert(GHasDyn(inClass));
         return globalComps.at(inClass).ConstRef();
@@ -1576,6 +2088,345 @@ namespace Runtime {
         return globalComps.size();
     }
 
+    ECCommandBuffer& ECRegistry::ThreadCommandBuffer()
+    {
+        static thread_local ThreadCommandBufferCacheHolder holder;
+        auto& cache = holder.cache;
+
+        std::unique_lock cacheLock(cache.mutex);
+        for (const auto& [registryUid, buffer] : cache.entries) {
+            if (registryUid == uid) {
+                return *buffer;
+            }
+        }
+
+        ECCommandBuffer* buffer;
+        {
+            std::unique_lock lock(commandBuffersMutex);
+            buffer = commandBuffers.emplace_back(Common::MakeUnique<ECCommandBuffer>()).Get();
+        }
+        cache.entries.emplace_back(uid, buffer);
+        return *buffer;
+    }
+
+    void ECRegistry::FlushCommandBuffers()
+    {
+        std::unique_lock lock(commandBuffersMutex);
+        for (const auto& buffer : commandBuffers) {
+            if (!buffer->Empty()) {
+                buffer->Apply(*this);
+            }
+        }
+    }
+
+    ECCommandBuffer::ECCommandBuffer()
+        : pendingNum(0)
+        , stagingBlockIndex(0)
+        , stagingOffset(0)
+    {
+    }
+
+    ECCommandBuffer::~ECCommandBuffer()
+    {
+        Clear();
+        for (const auto& block : stagingBlocks) {
+            ::operator delete(block.memory, std::align_val_t(maxStagingAlignment));
+        }
+    }
+
+    Entity ECCommandBuffer::Create()
+    {
+        Assert(pendingNum < pendingEntityBit);
+        return pendingEntityBit | pendingNum++;
+    }
+
+    void ECCommandBuffer::Destroy(Entity inEntity)
+    {
+        Record(CommandType::destroy, inEntity, nullptr);
+    }
+
+    void ECCommandBuffer::EmplaceDyn(CompClass inClass, Entity inEntity, const Mirror::ArgumentList& inArgs)
+    {
+        const auto rttiIndex = FindOrAddRtti(Internal::CompRtti(inClass));
+        Internal::ElemPtr comp = AllocateStaging(inClass->SizeOf(), inClass->AlignOf());
+        inClass->InplaceNewDyn(comp, inArgs);
+        Record(CommandType::emplace, inEntity, inClass, comp, rttiIndex);
+    }
+
+    void ECCommandBuffer::RemoveDyn(CompClass inClass, Entity inEntity)
+    {
+        Record(CommandType::remove, inEntity, inClass);
+    }
+
+    void ECCommandBuffer::AddTagDyn(TagClass inClass, Entity inEntity)
+    {
+        Assert(inClass->SizeOf() == 1 && inClass->AlignOf() == 1);
+        Record(CommandType::addTag, inEntity, inClass);
+    }
+
+    void ECCommandBuffer::RemoveTagDyn(TagClass inClass, Entity inEntity)
+    {
+        Record(CommandType::removeTag, inEntity, inClass);
+    }
+
+    size_t ECCommandBuffer::Count() const
+    {
+        return commands.size();
+    }
+
+    bool ECCommandBuffer::Empty() const
+    {
+        return commands.empty() && pendingNum == 0;
+    }
+
+    std::vector<Entity> ECCommandBuffer::Apply(ECRegistry& inRegistry)
+    {
+        ECS_CHECK_STRUCTURAL(inRegistry);
+
+        struct EntityChange {
+            Entity entity;
+            bool destroy;
+            // indices of the emplace/addTag commands that survive folding, and the classes to remove
+            std::vector<size_t> adds;
+            std::vector<CompClass> removes;
+            Internal::Archetype* srcArchetype;
+            Internal::ArchetypeId dstArchetypeId;
+            Internal::ArchetypeLayout dstLayout;
+        };
+
+        std::vector<Entity> created;
+        created.reserve(pendingNum);
+        for (Entity i = 0; i < pendingNum; i++) {
+            created.emplace_back(inRegistry.Create());
+            Assert(!IsPending(created.back()));
+        }
+
+        // fold the commands of each entity in record order, a later command on the same class overrides an earlier one
+        std::vector<EntityChange> changes;
+        std::unordered_map<Entity, size_t> changeIndices;
+        for (size_t commandIndex = 0; commandIndex < commands.size(); commandIndex++) {
+            auto& command = commands[commandIndex];
+            const Entity entity = IsPending(command.entity) ? created[command.entity & ~pendingEntityBit] : command.entity;
+            Assert(inRegistry.Valid(entity));
+
+            auto [iter, emplaced] = changeIndices.emplace(entity, changes.size());
+            if (emplaced) {
+                changes.emplace_back(EntityChange { entity, false, {}, {}, nullptr, 0, {} });
+            }
+            auto& change = changes[iter->second];
+            if (change.destroy) {
+                DestroyStaged(command);
+                continue;
+            }
+
+            const auto addIter = std::ranges::find_if(change.adds, [&](size_t addIndex) -> bool { return commands[addIndex].clazz == command.clazz; });
+            if (command.type == CommandType::destroy) {
+                for (const size_t addIndex : change.adds) {
+                    DestroyStaged(commands[addIndex]);
+                }
+                change.adds.clear();
+                change.removes.clear();
+                change.destroy = true;
+            } else if (command.type == CommandType::emplace || command.type == CommandType::addTag) {
+                if (addIter != change.adds.end()) {
+                    DestroyStaged(commands[*addIter]);
+                    *addIter = commandIndex;
+                } else {
+                    change.adds.emplace_back(commandIndex);
+                }
+            } else {
+                // a remove drops the staged add of the class, and still removes the one the entity already holds
+                const bool staged = addIter != change.adds.end();
+                if (staged) {
+                    DestroyStaged(commands[*addIter]);
+                    change.adds.erase(addIter);
+                }
+                if ((!staged || inRegistry.entities.GetArchetypePtr(entity)->Contains(command.clazz))
+                    && std::ranges::find(change.removes, command.clazz) == change.removes.end()) {
+                    change.removes.emplace_back(command.clazz);
+                }
+            }
+        }
+
+        for (const auto& change : changes) {
+            if (change.destroy) {
+                inRegistry.Destroy(change.entity);
+            }
+        }
+        std::erase_if(changes, [](const EntityChange& change) -> bool { return change.destroy || (change.adds.empty() && change.removes.empty()); });
+
+        for (auto& change : changes) {
+            change.srcArchetype = inRegistry.entities.GetArchetypePtr(change.entity);
+            change.dstLayout = change.srcArchetype->GetLayout();
+            for (const auto clazz : change.removes) {
+                Assert(change.srcArchetype->Contains(clazz));
+                change.dstLayout = change.dstLayout.Without(clazz);
+            }
+            for (const size_t addIndex : change.adds) {
+                const auto& command = commands[addIndex];
+                if (command.type == CommandType::emplace) {
+                    inRegistry.RegisterDataCompClass(command.clazz);
+                    if (!change.dstLayout.ContainsComp(command.clazz)) {
+                        change.dstLayout = change.dstLayout.WithComp(stagedRttis[command.rttiIndex]);
+                    }
+                } else {
+                    inRegistry.RegisterTagClass(command.clazz);
+                    Assert(!change.dstLayout.ContainsTag(command.clazz));
+                    change.dstLayout = change.dstLayout.WithTag(command.clazz);
+                }
+            }
+            change.dstArchetypeId = change.dstLayout.Id();
+        }
+
+        std::ranges::stable_sort(changes, [](const EntityChange& lhs, const EntityChange& rhs) -> bool {
+            if (lhs.dstArchetypeId != rhs.dstArchetypeId) {
+                return lhs.dstArchetypeId < rhs.dstArchetypeId;
+            }
+            return lhs.srcArchetype->Id() < rhs.srcArchetype->Id();
+        });
+
+        std::vector<Internal::Archetype::CompMapping> groupMappings;
+        std::vector<Internal::Archetype::CompMapping> entityMappings;
+        for (size_t groupBegin = 0; groupBegin < changes.size();) {
+            auto& first = changes[groupBegin];
+            size_t groupEnd = groupBegin + 1;
+            while (groupEnd < changes.size() && changes[groupEnd].dstArchetypeId == first.dstArchetypeId && changes[groupEnd].srcArchetype == first.srcArchetype) {
+                groupEnd++;
+            }
+
+            Internal::Archetype& srcArchetype = *first.srcArchetype;
+            auto dstIter = inRegistry.archetypes.find(first.dstArchetypeId);
+            if (dstIter == inRegistry.archetypes.end()) {
+                dstIter = inRegistry.archetypes.emplace(first.dstArchetypeId, Internal::Archetype(std::move(first.dstLayout), inRegistry.archetypeStorage)).first;
+            }
+            Internal::Archetype& dstArchetype = dstIter->second;
+            dstArchetype.ReserveElems(groupEnd - groupBegin);
+
+            groupMappings.clear();
+            const auto& srcRttis = srcArchetype.GetCompRttis();
+            for (size_t srcCompIndex = 0; srcCompIndex < srcRttis.size(); srcCompIndex++) {
+                if (const auto clazz = srcRttis[srcCompIndex].Class(); dstArchetype.ContainsComp(clazz)) {
+                    groupMappings.emplace_back(srcCompIndex, dstArchetype.GetCompIndex(clazz));
+                }
+            }
+
+            for (size_t changeIndex = groupBegin; changeIndex < groupEnd; changeIndex++) {
+                const auto& change = changes[changeIndex];
+                if (!inRegistry.compEvents.empty()) {
+                    for (const auto clazz : change.removes) {
+                        inRegistry.NotifyRemoveDyn(clazz, change.entity);
+                    }
+                }
+
+                // an emplace on a component the entity already has replaces it, the old value is left to EraseElem()
+                const auto* mappings = &groupMappings;
+                if (std::ranges::any_of(change.adds, [&](size_t addIndex) -> bool { return commands[addIndex].type == CommandType::emplace && srcArchetype.ContainsComp(commands[addIndex].clazz); })) {
+                    entityMappings.clear();
+                    for (const auto& mapping : groupMappings) {
+                        const auto clazz = srcRttis[mapping.srcCompIndex].Class();
+                        if (std::ranges::none_of(change.adds, [&](size_t addIndex) -> bool { return commands[addIndex].clazz == clazz; })) {
+                            entityMappings.emplace_back(mapping);
+                        }
+                    }
+                    mappings = &entityMappings;
+                }
+
+                const auto location = inRegistry.entities.GetLocation(change.entity);
+                const auto dstElemIndex = dstArchetype.EmplaceElem(change.entity, srcArchetype, location.elemIndex, *mappings);
+                for (const size_t addIndex : change.adds) {
+                    auto& command = commands[addIndex];
+                    if (command.type != CommandType::emplace) {
+                        continue;
+                    }
+                    const auto& rtti = stagedRttis[command.rttiIndex];
+                    const auto dstCompIndex = dstArchetype.GetCompIndex(command.clazz);
+                    if (rtti.TriviallyRelocatable()) {
+                        std::memcpy(dstArchetype.GetCompAt(dstElemIndex, dstCompIndex), command.comp, rtti.MemorySize());
+                    } else {
+                        rtti.MoveConstructFrom(dstArchetype.GetCompAt(dstElemIndex, dstCompIndex), command.comp);
+                        rtti.Destruct(command.comp);
+                    }
+                    command.comp = nullptr;
+                }
+                inRegistry.entities.SetLocation(change.entity, dstArchetype, dstElemIndex);
+                inRegistry.EraseArchetypeElem(srcArchetype, location.elemIndex);
+
+                if (!inRegistry.compEvents.empty()) {
+                    for (const size_t addIndex : change.adds) {
+                        inRegistry.NotifyConstructedDyn(commands[addIndex].clazz, change.entity);
+                    }
+                }
+            }
+            groupBegin = groupEnd;
+        }
+
+        Clear();
+        return created;
+    }
+
+    void ECCommandBuffer::Clear()
+    {
+        for (auto& command : commands) {
+            DestroyStaged(command);
+        }
+        commands.clear();
+        pendingNum = 0;
+        stagingBlockIndex = 0;
+        stagingOffset = 0;
+    }
+
+    bool ECCommandBuffer::IsPending(Entity inEntity)
+    {
+        return (inEntity & pendingEntityBit) != 0;
+    }
+
+    void ECCommandBuffer::Record(CommandType inType, Entity inEntity, CompClass inClass, Internal::ElemPtr inComp, size_t inRttiIndex)
+    {
+        Assert(!IsPending(inEntity) || (inEntity & ~pendingEntityBit) < pendingNum);
+        commands.emplace_back(Command { inType, inEntity, inClass, inComp, inRttiIndex });
+    }
+
+    size_t ECCommandBuffer::FindOrAddRtti(const Internal::CompRtti& inRtti)
+    {
+        const auto [iter, emplaced] = stagedRttiMap.emplace(inRtti.Class(), stagedRttis.size());
+        if (emplaced) {
+            stagedRttis.emplace_back(inRtti);
+        }
+        return iter->second;
+    }
+
+    Internal::ElemPtr ECCommandBuffer::AllocateStaging(size_t inSize, size_t inAlignment)
+    {
+        Assert(inAlignment <= maxStagingAlignment);
+        while (true) {
+            if (stagingBlockIndex < stagingBlocks.size()) {
+                const auto& block = stagingBlocks[stagingBlockIndex];
+                const size_t offset = (stagingOffset + inAlignment - 1) & ~(inAlignment - 1);
+                if (offset + inSize <= block.size) {
+                    stagingOffset = offset + inSize;
+                    return static_cast<std::byte*>(block.memory) + offset;
+                }
+                if (stagingOffset != 0 || inSize <= block.size) {
+                    stagingBlockIndex++;
+                    stagingOffset = 0;
+                    continue;
+                }
+            }
+            const size_t blockSize = std::max(stagingBlockSize, inSize);
+            stagingBlocks.insert(stagingBlocks.begin() + static_cast<std::ptrdiff_t>(stagingBlockIndex), StagingBlock { ::operator new(blockSize, std::align_val_t(maxStagingAlignment)), blockSize });
+            stagingOffset = 0;
+        }
+    }
+
+    void ECCommandBuffer::DestroyStaged(Command& inCommand)
+    {
+        if (inCommand.comp == nullptr) {
+            return;
+        }
+        stagedRttis[inCommand.rttiIndex].Destruct(inCommand.comp);
+        inCommand.comp = nullptr;
+    }
+
     SystemGroup::SystemGroup(std::string inName, SystemExecuteStrategy inStrategy)
         : name(std::move(inName))
         , strategy(inStrategy)
@@ -1733,7 +2584,7 @@ namespace Runtime {
         systemGraph.reserve(systemGroups.size());
 
         for (const auto& group : systemGroups) {
-            auto& [systemContexts, strategy] = systemGraph.emplace_back();
+            auto& [systemContexts, strategy, dependencies] = systemGraph.emplace_back();
             const auto& factories = group.GetSystems();
 
             strategy = group.GetStrategy();
@@ -1741,9 +2592,38 @@ namespace Runtime {
             for (const auto& factory : group.GetSystems()) {
                 systemContexts.emplace_back(factory, nullptr);
             }
+            if (strategy == SystemExecuteStrategy::automatic) {
+                dependencies = BuildDependencies(systemContexts);
+            }
         }
     }
 
+    std::vector<std::vector<size_t>> SystemPipeline::BuildDependencies(const std::vector<SystemContext>& inSystems)
+    {
+        // a system waits for every earlier system it conflicts with, except the ones already reached through another
+        // dependency, so the graph keeps the declaration order of conflicting systems and nothing more
+        const auto systemNum = inSystems.size();
+        std::vector<std::vector<size_t>> result(systemNum);
+        std::vector<std::vector<bool>> ancestors(systemNum, std::vector<bool>(systemNum, false));
+
+        for (size_t i = 0; i < systemNum; i++) {
+            const auto& access = inSystems[i].factory.GetAccess();
+            for (size_t j = i; j-- > 0;) {
+                if (ancestors[i][j] || !access.ConflictsWith(inSystems[j].factory.GetAccess())) {
+                    continue;
+                }
+                result[i].emplace_back(j);
+                ancestors[i][j] = true;
+                for (size_t k = 0; k < j; k++) {
+                    if (ancestors[j][k]) {
+                        ancestors[i][k] = true;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
     void SystemPipeline::ParallelPerformAction(const ActionFunc& inActionFunc)
     {
         tf::Taskflow taskFlow;
@@ -1778,6 +2658,32 @@ namespace Runtime {
                     barrier.succeed(task);
                 }
                 lastBarrier = barrier;
+            } else if (groupContext.strategy == SystemExecuteStrategy::automatic) {
+                std::vector<tf::Task> tasks;
+                tasks.reserve(groupContext.systems.size());
+
+                for (size_t i = 0; i < groupContext.systems.size(); i++) {
+                    auto& systemContext = groupContext.systems[i];
+                    tasks.emplace_back(taskFlow.emplace([&]() -> void {
+                        Core::ScopedThreadTag threadTag(Core::ThreadTag::gameWorker);
+                        inActionFunc(systemContext);
+                    }));
+
+                    const auto& dependencies = groupContext.dependencies[i];
+                    if (dependencies.empty()) {
+                        tasks.back().succeed(lastBarrier);
+                    }
+                    for (const auto dependency : dependencies) {
+                        tasks.back().succeed(tasks[dependency]);
+                    }
+                }
+
+                auto barrier = taskFlow.emplace([]() -> void { Core::ScopedThreadTag threadTag(Core::ThreadTag::gameWorker); });
+                barrier.succeed(lastBarrier);
+                for (const auto& task : tasks) {
+                    barrier.succeed(task);
+                }
+                lastBarrier = barrier;
             } else {
                 QuickFail();
             }
@@ -1816,7 +2722,11 @@ namespace Runtime {
     void SystemGraphExecutor::Tick(float inDeltaTimeSeconds)
     {
         pipeline.ParallelPerformAction([&](const SystemPipeline::SystemContext& context) -> void {
+#if BUILD_CONFIG_DEBUG
+            Internal::SystemAccessChecker accessChecker(ecRegistry, context.factory);
+#endif
             context.instance->Tick(inDeltaTimeSeconds);
         });
+        ecRegistry.FlushCommandBuffers();
     }
 } // namespace Runtime
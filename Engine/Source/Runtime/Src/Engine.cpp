@@ -16,6 +16,12 @@
 #include <Runtime/World.h>
 
 namespace Runtime {
+    static Core::ConsoleSettingValue<uint8_t> csFramesInFlight(
+        "r.framesInFlight",
+        "max frames the game thread may end before the render thread finished them",
+        FramePipeline::defaultFramesInFlight,
+        Core::CSFlagBits::configOverridable);
+
     Engine::Engine(const EngineInitParams& inParams)
     {
         Core::ThreadContext::SetTag(Core::ThreadTag::game);
@@ -31,10 +37,18 @@ namespace Runtime {
         InitRender(inParams.rhiType);
         LoadPlugins();
         LoadConfigs();
+
+        framePipeline = new FramePipeline(csFramesInFlight.GetGT());
+        BindGameFrameArena();
     }
 
     Engine::~Engine()
     {
+        // worlds unmounted before the engine may still have queued their releases into the game frame
+        framePipeline->Flush(renderModule->GetRenderThread());
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::game, nullptr);
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::gameWorker, nullptr);
+
         renderModule->DeInitialize();
         ::Core::ModuleManager::Get().Unload("Render");
 
@@ -56,17 +70,17 @@ namespace Runtime {
         return *renderModule;
     }
 
-    void Engine::Tick(float inDeltaTimeSeconds)
+    FramePipeline& Engine::GetFramePipeline() const
     {
-        // game thread can run faster than render thread 1 frame as max
-        if (last2FrameRenderThreadFence.valid()) {
-            last2FrameRenderThreadFence.wait();
-        }
+        return *framePipeline;
+    }
 
+    void Engine::Tick(float inDeltaTimeSeconds)
+    {
+        framePipeline->BeginFrame();
         Core::ThreadContext::IncFrameNumber();
 
-        auto& renderThread = renderModule->GetRenderThread();
-        renderThread.EmplaceTask([renderModule = renderModule]() -> void {
+        framePipeline->EnqueueRenderCommand([renderModule = renderModule]() -> void {
             Core::ThreadContext::IncFrameNumber();
             Core::Console::Get().PerformRenderThreadSettingsCopy();
             renderModule->BeginFrame();
@@ -80,8 +94,11 @@ namespace Runtime {
         }
 
         GameThread::Get().Flush();
-        last2FrameRenderThreadFence = std::move(lastFrameRenderThreadFence);
-        lastFrameRenderThreadFence = renderThread.EmplaceTask([]() -> void {});
+        // hands the frame's render commands over in one task, and blocks only when framesInFlight ended frames are
+        // still waiting for the render thread
+        framePipeline->EndFrame(renderModule->GetRenderThread());
+        // switched right away, so nothing allocated after the frame ended lands in an arena the render thread still reads
+        BindGameFrameArena();
     }
 
     void Engine::AttachLogFile() const // NOLINT
@@ -116,6 +133,12 @@ namespace Runtime {
         SettingsRegistry::Get().LoadAllSettings();
     }
 
+    void Engine::BindGameFrameArena() const
+    {
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::game, &framePipeline->GameFrameArena());
+        Core::ThreadContext::SetFrameArena(Core::ThreadTag::gameWorker, &framePipeline->GameFrameArena());
+    }
+
     Common::UniquePtr<Engine> EngineHolder::engine = nullptr;
 
     MinEngine::MinEngine(const EngineInitParams& inParams)
@@ -143,6 +166,11 @@ namespace Runtime {
         engine = nullptr;
     }
 
+    bool EngineHolder::Loaded()
+    {
+        return engine != nullptr;
+    }
+
     Engine& EngineHolder::Get()
     {
         AssertWithReason(engine != nullptr, "no valid engine");
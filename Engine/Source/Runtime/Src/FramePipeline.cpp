@@ -0,0 +1,140 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <Common/Debug.h>
+#include <Common/Time.h>
+#include <Runtime/FramePipeline.h>
+
+namespace Runtime {
+    FramePipeline::FramePipeline(uint8_t inFramesInFlight)
+        : framesInFlight(inFramesInFlight)
+        , gameFrameNumber(0)
+        , stalledFrameNum(0)
+    {
+        Assert(framesInFlight > 0 && framesInFlight <= maxFramesInFlight);
+        // one slot for the frame the game thread is building plus one per frame in flight
+        frames.reserve(framesInFlight + 1);
+        for (auto i = 0; i < framesInFlight + 1; i++) {
+            frames.emplace_back(new Frame());
+        }
+    }
+
+    FramePipeline::~FramePipeline()
+    {
+        for (const auto& frame : frames) {
+            frame->retired.wait(false, std::memory_order_acquire);
+        }
+    }
+
+    uint8_t FramePipeline::FramesInFlight() const
+    {
+        return framesInFlight;
+    }
+
+    uint64_t FramePipeline::GameFrameNumber() const
+    {
+        return gameFrameNumber;
+    }
+
+    void FramePipeline::BeginFrame()
+    {
+        GameFrame().gameBeginMs = Common::TimePoint::Now().ToMilliseconds();
+    }
+
+    void FramePipeline::EndFrame(Render::RenderThread& inRenderThread)
+    {
+        // the lock is held until the next slot is retired, so no command lands in a frame the render thread still
+        // executes, render commands must not enqueue into the pipeline for the same reason
+        std::unique_lock lock(mutex);
+
+        Frame& endedFrame = GameFrame();
+        endedFrame.gameEndMs = Common::TimePoint::Now().ToMilliseconds();
+        endedFrame.statsPending = true;
+        endedFrame.retired.store(false, std::memory_order_relaxed);
+        inRenderThread.Spawn([frame = &endedFrame]() -> void { ExecuteFrame(*frame); });
+
+        gameFrameNumber++;
+        Frame& nextFrame = GameFrame();
+        const double stallBeginMs = Common::TimePoint::Now().ToMilliseconds();
+        if (!nextFrame.retired.load(std::memory_order_acquire)) {
+            stalledFrameNum++;
+        }
+        Retire(nextFrame);
+        nextFrame.frameNumber = gameFrameNumber;
+        nextFrame.stallTimeMs = Common::TimePoint::Now().ToMilliseconds() - stallBeginMs;
+        nextFrame.gameBeginMs = stallBeginMs;
+        nextFrame.arena.Reset();
+    }
+
+    void FramePipeline::Flush(Render::RenderThread& inRenderThread)
+    {
+        EndFrame(inRenderThread);
+
+        // oldest first, so the stats left behind are the ones of the last ended frame
+        std::unique_lock lock(mutex);
+        for (size_t i = 1; i <= frames.size(); i++) {
+            Retire(*frames[(gameFrameNumber + i) % frames.size()]);
+        }
+    }
+
+    const FrameStats& FramePipeline::LastRetiredFrameStats() const
+    {
+        return lastRetiredFrameStats;
+    }
+
+    uint64_t FramePipeline::StalledFrameNum() const
+    {
+        return stalledFrameNum;
+    }
+
+    Common::FrameArena& FramePipeline::GameFrameArena()
+    {
+        return GameFrame().arena;
+    }
+
+    void FramePipeline::EnqueueRenderCommands(std::vector<Common::TaskFunction>& inCommands)
+    {
+        std::unique_lock lock(mutex);
+        auto& renderCommands = GameFrame().renderCommands;
+        for (auto& command : inCommands) {
+            renderCommands.emplace_back(std::move(command));
+        }
+        inCommands.clear();
+    }
+
+    void FramePipeline::ExecuteFrame(Frame& inFrame)
+    {
+        inFrame.renderBeginMs = Common::TimePoint::Now().ToMilliseconds();
+        for (auto& command : inFrame.renderCommands) {
+            command();
+        }
+        // clear() keeps the capacity, the slot reuses it next time around
+        inFrame.renderCommands.clear();
+        inFrame.renderEndMs = Common::TimePoint::Now().ToMilliseconds();
+
+        inFrame.retired.store(true, std::memory_order_release);
+        inFrame.retired.notify_one();
+    }
+
+    FramePipeline::Frame& FramePipeline::GameFrame()
+    {
+        return *frames[gameFrameNumber % frames.size()];
+    }
+
+    void FramePipeline::Retire(Frame& inFrame)
+    {
+        inFrame.retired.wait(false, std::memory_order_acquire);
+        if (!inFrame.statsPending) {
+            return;
+        }
+        inFrame.statsPending = false;
+
+        lastRetiredFrameStats.frameNumber = inFrame.frameNumber;
+        lastRetiredFrameStats.gameTimeMs = inFrame.gameEndMs - inFrame.gameBeginMs;
+        lastRetiredFrameStats.renderTimeMs = inFrame.renderEndMs - inFrame.renderBeginMs;
+        lastRetiredFrameStats.latencyMs = inFrame.renderEndMs - inFrame.gameBeginMs;
+        lastRetiredFrameStats.stallTimeMs = inFrame.stallTimeMs;
+        lastRetiredFrameStats.arenaStats = inFrame.arena.Stats();
+    }
+}
@@ -11,16 +11,22 @@ namespace Runtime {
         return instance;
     }
 
-    GameThread::GameThread() = default;
+    GameThread::GameThread()
+    {
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::game, [](Common::TaskFunction&& inTask) -> void {
+            Get().Spawn(std::move(inTask));
+        });
+    }
 
     GameThread::~GameThread()
     {
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::game, nullptr);
         Flush();
     }
 
     void GameThread::Flush()
     {
-        std::queue<std::function<void()>> tasksToExecute;
+        std::queue<Common::TaskFunction> tasksToExecute;
         {
             std::unique_lock lock(mutex);
             tasksToExecute.swap(tasks);
@@ -47,11 +53,20 @@ namespace Runtime {
     {
         Assert(threads == nullptr);
         threads = Common::MakeUnique<Common::ThreadPool>("GameWorkers", 8);
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::gameWorker, [](Common::TaskFunction&& inTask) -> void {
+            Get().Spawn(std::move(inTask));
+        });
     }
 
     void GameWorkerThreads::Stop()
     {
         Assert(threads != nullptr);
+        Core::ThreadContext::SetDispatcher(Core::ThreadTag::gameWorker, nullptr);
         threads = nullptr;
     }
+
+    bool GameWorkerThreads::Started() const
+    {
+        return threads != nullptr;
+    }
 } // namespace Runtime
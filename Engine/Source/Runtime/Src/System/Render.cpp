@@ -2,8 +2,11 @@
 // Created by johnk on 2025/3/4.
 //
 
+#include <utility>
+
 #include <Common/Math/Projection.h>
 #include <Common/Math/View.h>
+#include <Core/Thread.h>
 #include <Render/Renderer.h>
 #include <Runtime/Component/Camera.h>
 #include <Runtime/Component/Player.h>
@@ -24,7 +27,7 @@ namespace Runtime {
 
     RenderSystem::~RenderSystem() // NOLINT
     {
-        renderModule.GetRenderThread().EmplaceTask([fence = lastFrameFence]() -> void {
+        EngineHolder::Get().GetFramePipeline().EnqueueRenderCommand([fence = lastFrameFence]() -> void {
             fence->Wait();
             delete fence;
         });
@@ -42,11 +45,11 @@ namespace Runtime {
         Assert(texture != nullptr);
         const auto& textureDesc = texture->GetCreateInfo();
 
-        renderModule.GetRenderThread().EmplaceTask(
+        EngineHolder::Get().GetFramePipeline().EnqueueRenderCommand(
             [
                 fence = lastFrameFence,
                 views = BuildViews(),
-                scene = registry.GGet<SceneHolder>().scene.Get(),
+                scene = std::as_const(registry).GGet<SceneHolder>().scene.Get(),
                 surfaceExtent = Common::UVec2(textureDesc.width, textureDesc.height),
                 target,
                 window,
@@ -69,7 +72,7 @@ namespace Runtime {
                 rendererParams.surfaceAfterRenderState = window != nullptr
                     ? RHI::TextureState::present
                     : RHI::TextureState::shaderReadOnly;
-                rendererParams.views = views;
+                rendererParams.views = std::span<const Render::View>(views);
                 rendererParams.waitSemaphore = window != nullptr ? window->GetImageReadySemaphore() : nullptr;
                 rendererParams.signalSemaphore = window != nullptr ? window->GetRenderFinishedSemaphore() : nullptr;
                 rendererParams.signalFence = fence;
@@ -106,7 +109,7 @@ namespace Runtime {
     Render::View RenderSystem::BuildViewForCamera(Entity inEntity) const
     {
         auto& camera = registry.Get<Camera>(inEntity);
-        const auto& worldTransform = registry.Get<WorldTransform>(inEntity);
+        const auto& worldTransform = std::as_const(registry).Get<WorldTransform>(inEntity);
         auto* target = client->GetRenderSurface();
         Assert(target != nullptr && target->GetTexture() != nullptr);
         const auto& textureDesc = target->GetTexture()->GetCreateInfo();
@@ -121,8 +124,8 @@ namespace Runtime {
         // covers the whole render surface
         Common::URect viewportRect = { 0, 0, width, height };
         if (registry.Has<LocalPlayer>(inEntity)) {
-            const auto& playersInfo = registry.GGet<PlayersInfo>();
-            viewportRect = GetPlayerViewport(width, height, static_cast<uint8_t>(playersInfo.players.size()), registry.Get<LocalPlayer>(inEntity).localPlayerIndex);
+            const auto& playersInfo = std::as_const(registry).GGet<PlayersInfo>();
+            viewportRect = GetPlayerViewport(width, height, static_cast<uint8_t>(playersInfo.players.size()), std::as_const(registry).Get<LocalPlayer>(inEntity).localPlayerIndex);
         }
 
         Render::View view = renderModule.CreateView();
@@ -140,11 +143,12 @@ namespace Runtime {
         return view;
     }
 
-    std::vector<Render::View> RenderSystem::BuildViews() const
+    Common::FrameVector<Render::View> RenderSystem::BuildViews() const
     {
-        const auto cameras = registry.View<Camera, WorldTransform>().All();
+        const auto cameras = registry.View<Camera, const WorldTransform>().All();
 
-        std::vector<Render::View> result;
+        // the game frame arena outlives the render command that consumes the views
+        Common::FrameVector<Render::View> result(Core::ThreadContext::CurrentFrameArena());
         result.reserve(cameras.size());
         for (const auto& camera : cameras) {
             result.emplace_back(BuildViewForCamera(std::get<0>(camera)));
@@ -13,6 +13,7 @@ namespace Runtime {
     SceneSystem::SceneSystem(ECRegistry& inRegistry, const SystemSetupContext& inContext)
         : System(inRegistry, inContext)
         , renderModule(EngineHolder::Get().GetRenderModule())
+        , framePipeline(EngineHolder::Get().GetFramePipeline())
         , transformUpdatedObserver(inRegistry.Observer())
         , directionalLightsObserver(inRegistry.EventsObserver<DirectionalLight>())
         , pointLightsObserver(inRegistry.EventsObserver<PointLight>())
@@ -29,6 +30,7 @@ namespace Runtime {
         inRegistry.View<PointLight>().Each([this](Entity e, PointLight&) -> void { QueueCreateSceneProxy<PointLight, Render::PointLightSceneProxy>(e); });
         inRegistry.View<SpotLight>().Each([this](Entity e, SpotLight&) -> void { QueueCreateSceneProxy<SpotLight, Render::SpotLightSceneProxy>(e); });
         inRegistry.View<StaticPrimitive>().Each([this](Entity e, StaticPrimitive&) -> void { QueueCreateSceneProxy<StaticPrimitive, Render::StaticPrimitiveSceneProxy>(e, true); });
+        framePipeline.EnqueueRenderCommands(pendingUpdates);
     }
 
     SceneSystem::~SceneSystem() // NOLINT
@@ -45,24 +47,34 @@ namespace Runtime {
 
         std::unordered_set<Entity> changedWorldTransforms;
         transformUpdatedObserver.Each([&](Entity e) -> void { changedWorldTransforms.emplace(e); });
+
+        std::vector<Entity> changedDirectionalLights;
+        std::vector<Entity> changedPointLights;
+        std::vector<Entity> changedSpotLights;
+        std::vector<Entity> changedStaticPrimitives;
         for (const Entity e : changedWorldTransforms) {
             if (!registry.Valid(e) || !registry.Has<WorldTransform>(e)) {
                 continue;
             }
             if (registry.Has<DirectionalLight>(e)) {
-                QueueUpdateSceneProxyTransform<Render::DirectionalLightSceneProxy>(e);
+                changedDirectionalLights.emplace_back(e);
             }
             if (registry.Has<PointLight>(e)) {
-                QueueUpdateSceneProxyTransform<Render::PointLightSceneProxy>(e);
+                changedPointLights.emplace_back(e);
             }
             if (registry.Has<SpotLight>(e)) {
-                QueueUpdateSceneProxyTransform<Render::SpotLightSceneProxy>(e);
+                changedSpotLights.emplace_back(e);
             }
             if (registry.Has<StaticPrimitive>(e)) {
-                QueueUpdateSceneProxyTransform<Render::StaticPrimitiveSceneProxy>(e, true);
+                changedStaticPrimitives.emplace_back(e);
             }
         }
+        QueueUpdateSceneProxyTransforms<Render::DirectionalLightSceneProxy>(changedDirectionalLights);
+        QueueUpdateSceneProxyTransforms<Render::PointLightSceneProxy>(changedPointLights);
+        QueueUpdateSceneProxyTransforms<Render::SpotLightSceneProxy>(changedSpotLights);
+        QueueUpdateSceneProxyTransforms<Render::StaticPrimitiveSceneProxy>(changedStaticPrimitives, true);
 
         transformUpdatedObserver.Clear();
+        framePipeline.EnqueueRenderCommands(pendingUpdates);
     }
 }
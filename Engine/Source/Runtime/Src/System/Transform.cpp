@@ -2,11 +2,47 @@
 // Created by johnk on 2025/1/21.
 //
 
+#include <limits>
+#include <utility>
+
+#include <Core/Thread.h>
+#include <Runtime/GameThread.h>
 #include <Runtime/System/Transform.h>
 
+namespace Runtime::Internal {
+    static constexpr size_t transformPropagationRootIndex = std::numeric_limits<size_t>::max();
+    static constexpr size_t transformPropagationGrainSize = 256;
+
+    struct TransformPropagationItem {
+        // roots take the parent transform from parentWorld, everything else from the item at parentIndex. without a local
+        // transform (or a parent to apply it to) the world transform is kept and only feeds the children
+        bool Updates() const
+        {
+            return local != nullptr && (parentIndex != transformPropagationRootIndex || parentWorld != nullptr);
+        }
+
+        Entity entity = entityNull;
+        size_t parentIndex = transformPropagationRootIndex;
+        const WorldTransform* parentWorld = nullptr;
+        WorldTransform* world = nullptr;
+        const LocalTransform* local = nullptr;
+    };
+
+    template <typename F>
+    static void ParallelForRange(size_t inBegin, size_t inEnd, F&& inTask)
+    {
+        if (auto& workers = GameWorkerThreads::Get(); workers.Started() && inEnd - inBegin > transformPropagationGrainSize) {
+            workers.ParallelFor(inBegin, inEnd, transformPropagationGrainSize, std::forward<F>(inTask));
+        } else {
+            inTask(inBegin, inEnd);
+        }
+    }
+}
+
 namespace Runtime {
     TransformSystem::TransformSystem(ECRegistry& inRegistry, const SystemSetupContext& inContext)
         : System(inRegistry, inContext)
+        , propagation(TransformPropagation::levelOrdered)
         , worldTransformUpdatedObserver(registry.Observer())
         , localTransformUpdatedObserver(registry.Observer())
     {
@@ -22,9 +58,10 @@ namespace Runtime {
     {
         static_cast<void>(inDeltaTimeSeconds);
 
-        std::vector<Entity> pendingUpdateLocalTransforms;
-        std::vector<Entity> pendingUpdateChildrenWorldTransforms;
-        std::vector<Entity> pendingUpdateSelfAndChildrenWorldTransforms;
+        auto* arena = Core::ThreadContext::CurrentFrameArena();
+        Common::FrameVector<Entity> pendingUpdateLocalTransforms(arena);
+        Common::FrameVector<Entity> pendingUpdateChildrenWorldTransforms(arena);
+        Common::FrameVector<Entity> pendingUpdateSelfAndChildrenWorldTransforms(arena);
 
         pendingUpdateLocalTransforms.reserve(worldTransformUpdatedObserver.Count());
         pendingUpdateChildrenWorldTransforms.reserve(worldTransformUpdatedObserver.Count());
@@ -54,43 +91,148 @@ namespace Runtime {
         for (auto e : pendingUpdateLocalTransforms) {
             auto& localTransform = registry.Get<LocalTransform>(e);
             const auto& worldTransform = registry.Get<WorldTransform>(e);
-            const auto& hierarchy = registry.Get<Hierarchy>(e);
+            const auto& hierarchy = std::as_const(registry).Get<Hierarchy>(e);
             const auto& parentWorldTransform = registry.Get<WorldTransform>(hierarchy.parent);
+            localTransform.localToParent = worldTransform.localToWorld.GetRelativeTransform(parentWorldTransform.localToWorld);
+        }
 
-            const auto& localToWorldMatrix = worldTransform.localToWorld.GetTransformMatrix();
-            const auto& parentLocalToWorldMatrix = parentWorldTransform.localToWorld.GetTransformMatrix();
-            localTransform.localToParent = Common::FTransform(parentLocalToWorldMatrix.Inverse() * localToWorldMatrix);
+        if (propagation == TransformPropagation::levelOrdered) {
+            PropagateLevelOrdered(pendingUpdateChildrenWorldTransforms, pendingUpdateSelfAndChildrenWorldTransforms);
+        } else {
+            PropagateRecursively(pendingUpdateChildrenWorldTransforms, pendingUpdateSelfAndChildrenWorldTransforms);
         }
 
-        const auto updateWorldByLocal = [&](Entity child, Entity parent) -> void {
-            if (!registry.Has<LocalTransform>(child) || !registry.Has<WorldTransform>(child) || !registry.Has<WorldTransform>(parent)) {
-                return;
-            }
+        worldTransformUpdatedObserver.Clear();
+    }
 
-            auto& childWorldTransform = registry.Get<WorldTransform>(child);
-            const auto& childLocalTransform = registry.Get<LocalTransform>(child);
-            const auto& parentWorldTransform = registry.Get<WorldTransform>(parent);
+    void TransformSystem::SetPropagation(TransformPropagation inPropagation)
+    {
+        Assert(inPropagation < TransformPropagation::max);
+        propagation = inPropagation;
+    }
 
-            const auto& parentLocalToWorldMatrix = parentWorldTransform.localToWorld.GetTransformMatrix();
-            const auto& childLocalToParentMatrix = childLocalTransform.localToParent.GetTransformMatrix();
-            childWorldTransform.localToWorld = Common::FTransform(parentLocalToWorldMatrix * childLocalToParentMatrix);
-            registry.NotifyUpdated<WorldTransform>(child);
-        };
+    TransformPropagation TransformSystem::GetPropagation() const
+    {
+        return propagation;
+    }
+
+    void TransformSystem::UpdateWorldByLocal(Entity inChild, Entity inParent)
+    {
+        if (!registry.Has<LocalTransform>(inChild) || !registry.Has<WorldTransform>(inChild) || !registry.Has<WorldTransform>(inParent)) {
+            return;
+        }
 
-        for (const auto e : pendingUpdateChildrenWorldTransforms) {
+        auto& childWorldTransform = registry.Get<WorldTransform>(inChild);
+        const auto& childLocalTransform = registry.Get<LocalTransform>(inChild);
+        const auto& parentWorldTransform = registry.Get<WorldTransform>(inParent);
+        childWorldTransform.localToWorld = parentWorldTransform.localToWorld * childLocalTransform.localToParent;
+        registry.NotifyUpdated<WorldTransform>(inChild);
+    }
+
+    void TransformSystem::PropagateRecursively(const Common::FrameVector<Entity>& inChildrenDirtyRoots, const Common::FrameVector<Entity>& inSelfDirtyRoots)
+    {
+        for (const auto e : inChildrenDirtyRoots) {
             HierarchyOps::TraverseChildrenRecursively(registry, e, [&](Entity child, Entity parent) -> void {
-                updateWorldByLocal(child, parent);
+                UpdateWorldByLocal(child, parent);
             });
         }
-        for (const auto e : pendingUpdateSelfAndChildrenWorldTransforms) {
-            const auto& hierarchy = registry.Get<Hierarchy>(e);
-            updateWorldByLocal(e, hierarchy.parent);
+        for (const auto e : inSelfDirtyRoots) {
+            const auto& hierarchy = std::as_const(registry).Get<Hierarchy>(e);
+            UpdateWorldByLocal(e, hierarchy.parent);
 
             HierarchyOps::TraverseChildrenRecursively(registry, e, [&](Entity child, Entity parent) -> void {
-                updateWorldByLocal(child, parent);
+                UpdateWorldByLocal(child, parent);
             });
         }
+    }
 
-        worldTransformUpdatedObserver.Clear();
+    void TransformSystem::PropagateLevelOrdered(const Common::FrameVector<Entity>& inChildrenDirtyRoots, const Common::FrameVector<Entity>& inSelfDirtyRoots)
+    {
+        auto* arena = Core::ThreadContext::CurrentFrameArena();
+
+        Common::FrameUnorderedSet<Entity> dirtyRoots(arena);
+        Common::FrameUnorderedSet<Entity> selfDirtyRoots(arena);
+        dirtyRoots.reserve(inChildrenDirtyRoots.size() + inSelfDirtyRoots.size());
+        dirtyRoots.insert(inChildrenDirtyRoots.begin(), inChildrenDirtyRoots.end());
+        dirtyRoots.insert(inSelfDirtyRoots.begin(), inSelfDirtyRoots.end());
+        selfDirtyRoots.insert(inSelfDirtyRoots.begin(), inSelfDirtyRoots.end());
+
+        // a root below another dirty root is recomputed by the walk of that ancestor anyway, its world transform is
+        // consistent with its local transform at this point so recomputing it from the parent changes nothing, the walk
+        // stops at entities without a world transform though, so a root below one of them stays a root
+        const auto coveredByAncestor = [&](Entity inRoot) -> bool {
+            for (auto parent = std::as_const(registry).Get<Hierarchy>(inRoot).parent; parent != entityNull; parent = std::as_const(registry).Get<Hierarchy>(parent).parent) {
+                if (dirtyRoots.contains(parent)) {
+                    return true;
+                }
+                if (!registry.Has<WorldTransform>(parent)) {
+                    return false;
+                }
+            }
+            return false;
+        };
+
+        Common::FrameVector<Internal::TransformPropagationItem> items(arena);
+        items.reserve(dirtyRoots.size());
+        for (const auto root : dirtyRoots) {
+            if (coveredByAncestor(root)) {
+                continue;
+            }
+
+            Internal::TransformPropagationItem& item = items.emplace_back();
+            item.entity = root;
+            item.parentIndex = Internal::transformPropagationRootIndex;
+            item.world = &registry.Get<WorldTransform>(root);
+            if (selfDirtyRoots.contains(root)) {
+                item.parentWorld = registry.Find<WorldTransform>(std::as_const(registry).Get<Hierarchy>(root).parent);
+                item.local = item.parentWorld != nullptr ? registry.Find<LocalTransform>(root) : nullptr;
+            }
+        }
+
+        // breadth first, so the items of one depth level are contiguous and only depend on the level before them
+        Common::FrameVector<size_t> levelOffsets(arena);
+        levelOffsets.emplace_back(0);
+        for (size_t levelBegin = 0, levelEnd = items.size(); levelBegin < levelEnd; levelBegin = levelEnd, levelEnd = items.size()) {
+            levelOffsets.emplace_back(levelEnd);
+            for (size_t i = levelBegin; i < levelEnd; i++) {
+                for (auto child = std::as_const(registry).Get<Hierarchy>(items[i].entity).firstChild; child != entityNull; child = std::as_const(registry).Get<Hierarchy>(child).nextBro) {
+                    // without a world transform there is nothing to propagate into the subtree
+                    auto* childWorld = registry.Find<WorldTransform>(child);
+                    if (childWorld == nullptr) {
+                        continue;
+                    }
+
+                    Internal::TransformPropagationItem& item = items.emplace_back();
+                    item.entity = child;
+                    item.parentIndex = i;
+                    item.world = childWorld;
+                    item.local = registry.Find<LocalTransform>(child);
+                }
+            }
+        }
+
+        // the parent world transform of a level is final once the level before it is done
+        for (size_t level = 0; level + 1 < levelOffsets.size(); level++) {
+            Internal::ParallelForRange(levelOffsets[level], levelOffsets[level + 1], [&](size_t inBegin, size_t inEnd) -> void {
+                for (size_t i = inBegin; i < inEnd; i++) {
+                    const auto& item = items[i];
+                    if (!item.Updates()) {
+                        continue;
+                    }
+
+                    const auto& parentLocalToWorld = item.parentIndex != Internal::transformPropagationRootIndex
+                        ? items[item.parentIndex].world->localToWorld
+                        : item.parentWorld->localToWorld;
+                    item.world->localToWorld = parentLocalToWorld * item.local->localToParent;
+                }
+            });
+        }
+
+        // observers are not thread safe, notify after all levels are done
+        for (const auto& item : items) {
+            if (item.Updates()) {
+                registry.NotifyUpdated<WorldTransform>(item.entity);
+            }
+        }
     }
 }
@@ -14,15 +14,13 @@ namespace Runtime {
         static SystemGraph graph = []() -> SystemGraph {
             SystemGraph systemGraph;
 
-            auto& preTransformGroup = systemGraph.AddGroup("PreTransformConcurrent", SystemExecuteStrategy::concurrent);
-            preTransformGroup.EmplaceSystem<PlayerSystem>();
-
-            auto& transformGroup = systemGraph.AddGroup("Transform", SystemExecuteStrategy::sequential);
-            transformGroup.EmplaceSystem<TransformSystem>();
-
-            auto& sceneRenderingGroup = systemGraph.AddGroup("SceneRendering", SystemExecuteStrategy::sequential);
-            sceneRenderingGroup.EmplaceSystem<SceneSystem>();
-            sceneRenderingGroup.EmplaceSystem<RenderSystem>();
+            // ordering comes from the accesses declared on each system class, the scene system writes SceneHolder so
+            // the scene proxy updates it queues to the render thread land before the frame the render system queues
+            auto& mainGroup = systemGraph.AddGroup("Main", SystemExecuteStrategy::automatic);
+            mainGroup.EmplaceSystem<PlayerSystem>();
+            mainGroup.EmplaceSystem<TransformSystem>();
+            mainGroup.EmplaceSystem<SceneSystem>();
+            mainGroup.EmplaceSystem<RenderSystem>();
 
             return systemGraph;
         }();
@@ -6,6 +6,7 @@
 #include <optional>
 #include <vector>
 
+#include <Render/RenderCache.h>
 #include <Runtime/Window.h>
 
 namespace Runtime::Internal {
@@ -105,6 +106,10 @@ namespace Runtime {
 
     void Window::ReleaseSwapChainResources()
     {
+        // the textures of a recreated swap chain may reuse the addresses of the old ones
+        for (auto* texture : swapChainTextures) {
+            Render::ResourceViewCache::Get(device).Invalidate(texture);
+        }
         swapChainTextureViews.clear();
         swapChain.Reset();
         swapChainTextures.clear();
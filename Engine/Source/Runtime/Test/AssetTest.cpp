@@ -65,6 +65,29 @@ TEST(AssetTest, SaveLoadTest)
     ASSERT_EQ(restore->b, "hello");
 }
 
+TEST(AssetTest, BlobLoadedAsMappedViewTest)
+{
+    static Core::Uri uri("asset://Engine/Test/Generated/Runtime/AssetTest.BlobLoadedAsMappedViewTest");
+
+    AssetPtr<TestAsset> asset = MakeShared<TestAsset>(uri, 1, "hello");
+    asset->c = std::vector<uint32_t>(1024, 2);
+    AssetManager::Get().Save(asset);
+
+    AssetPtr<TestAsset> restore = AssetManager::Get().SyncLoad<TestAsset>(uri, TestAsset::GetStaticClass());
+    ASSERT_TRUE(restore->c.IsView());
+    ASSERT_EQ(restore->c, asset->c);
+
+    // saving over the file does not touch the bytes a loaded blob still maps
+    const Blob<uint32_t> mapped = restore->c;
+    restore.Reset();
+    asset->c = std::vector<uint32_t>(16, 3);
+    AssetManager::Get().Save(asset);
+    ASSERT_EQ(mapped, Blob<uint32_t>(std::vector<uint32_t>(1024, 2)));
+
+    AssetPtr<TestAsset> restoreAgain = AssetManager::Get().SyncLoad<TestAsset>(uri, TestAsset::GetStaticClass());
+    ASSERT_EQ(restoreAgain->c, asset->c);
+}
+
 TEST(AssetTest, AsyncLoadTest)
 {
     static Core::Uri uri("asset://Engine/Test/Generated/Runtime/AssetTest.SaveLoadTest");
@@ -92,3 +115,33 @@ TEST(AssetTest, PolySaveLoadTest)
     ASSERT_EQ(result->a, 1);
     ASSERT_EQ(result->b, "hello");
 }
+
+TEST(AssetTest, ConvertToSchemaFileTest)
+{
+    static Core::Uri uri("asset://Engine/Test/Generated/Runtime/AssetTest.ConvertToSchemaFileTest");
+    const Common::Path path = Core::AssetUriParser(uri).Parse().Absolute();
+
+    // an asset file of the plain format written before schema files
+    TestAsset asset(uri, 1, "hello");
+    asset.c = std::vector<uint32_t>(16, 2);
+    {
+        BinaryFileSerializeStream stream(path.String());
+        Mirror::Any(std::ref(asset)).Serialize(stream);
+    }
+    {
+        BinaryFileDeserializeStream stream(path.String());
+        ASSERT_FALSE(Mirror::SchemaFile::Is(stream));
+    }
+
+    ASSERT_TRUE(AssetManager::Get().ConvertToSchemaFile(uri));
+    ASSERT_FALSE(AssetManager::Get().ConvertToSchemaFile(uri));
+    {
+        BinaryFileDeserializeStream stream(path.String());
+        ASSERT_TRUE(Mirror::SchemaFile::Is(stream));
+    }
+
+    AssetPtr<TestAsset> restore = AssetManager::Get().SyncLoad<TestAsset>(uri, TestAsset::GetStaticClass());
+    ASSERT_EQ(restore->a, 1);
+    ASSERT_EQ(restore->b, "hello");
+    ASSERT_EQ(restore->c, asset.c);
+}
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <Common/Blob.h>
 #include <Runtime/Meta.h>
 #include <Runtime/Asset/Asset.h>
 using namespace Common;
@@ -31,4 +32,7 @@ struct EClass() TestAsset : public Asset {
 
     EProperty()
     std::string b;
+
+    EProperty()
+    Common::Blob<uint32_t> c;
 };
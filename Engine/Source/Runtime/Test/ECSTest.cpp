@@ -4,8 +4,11 @@
 
 #include <ECSTest.h>
 #include <Test/Test.h>
+#include <Common/Concurrent.h>
 
+#include <atomic>
 #include <utility>
+#include <vector>
 
 uint32_t LifetimeComp::instanceCount = 0;
 
@@ -270,6 +273,100 @@ TEST(ECSTest, ViewArchetypeGrowthTest)
     ASSERT_EQ(runtimeSum, 2080);
 }
 
+TEST(ECSTest, ChunkedArchetypeStorageTest)
+{
+    const auto baselineInstanceCount = LifetimeComp::instanceCount;
+    {
+        ECRegistry registry(ArchetypeStorage::chunked);
+        ASSERT_EQ(registry.GetArchetypeStorage(), ArchetypeStorage::chunked);
+
+        const auto firstEntity = registry.Create();
+        registry.Emplace<CompA>(firstEntity, 0);
+        const CompA* firstComp = &registry.Get<CompA>(firstEntity);
+
+        std::vector<Entity> entities { firstEntity };
+        for (int32_t value = 1; value < 10000; value++) {
+            const auto entity = registry.Create();
+            registry.Emplace<CompA>(entity, value);
+            entities.emplace_back(entity);
+        }
+        ASSERT_EQ(&registry.Get<CompA>(firstEntity), firstComp);
+
+        int64_t sum = 0;
+        registry.View<CompA>().Each([&](Entity, const CompA& comp) -> void { sum += comp.value; });
+        ASSERT_EQ(sum, 49995000);
+
+        int64_t runtimeSum = 0;
+        registry.RuntimeView(RuntimeFilter().Include<CompA>()).Each([&](Entity, const CompA& comp) -> void { runtimeSum += comp.value; });
+        ASSERT_EQ(runtimeSum, 49995000);
+
+        for (size_t i = 0; i < entities.size(); i += 2) {
+            registry.Destroy(entities[i]);
+        }
+        for (size_t i = 1; i < entities.size(); i += 2) {
+            ASSERT_EQ(registry.Get<CompA>(entities[i]).value, static_cast<int32_t>(i));
+            registry.Emplace<LifetimeComp>(entities[i], "chunked component value that does not use the small string optimization");
+        }
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 5000);
+        ASSERT_EQ((registry.View<CompA, LifetimeComp>().Count()), 5000);
+
+        const ECRegistry copied = registry;
+        ASSERT_EQ(copied.GetArchetypeStorage(), ArchetypeStorage::chunked);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 10000);
+        ASSERT_EQ(copied.Get<CompA>(entities[9999]).value, 9999);
+        ASSERT_EQ(copied.Get<LifetimeComp>(entities[1]).value, registry.Get<LifetimeComp>(entities[1]).value);
+    }
+    ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount);
+}
+
+TEST(ECSTest, ParallelViewTest)
+{
+    ECRegistry registry(ArchetypeStorage::chunked);
+    for (int32_t value = 0; value < 10000; value++) {
+        const auto entity = registry.Create();
+        registry.Emplace<CompA>(entity, value);
+        if (value % 2 == 0) {
+            registry.Emplace<CompB>(entity, 1.0f);
+        }
+    }
+
+    size_t chunkRows = 0;
+    registry.View<CompA>().EachChunk([&](size_t inCount, const Entity* inEntities, CompA* inComps) -> void {
+        for (size_t i = 0; i < inCount; i++) {
+            ASSERT_EQ(&registry.Get<CompA>(inEntities[i]), inComps + i);
+        }
+        chunkRows += inCount;
+    });
+    ASSERT_EQ(chunkRows, 10000);
+
+    Common::ThreadPool pool("ECSTest", 4);
+    std::atomic<int64_t> sum = 0;
+    registry.View<CompA>().ParallelEach(pool, [&](Entity, CompA& comp) -> void {
+        comp.value++;
+        sum += comp.value;
+    }, 100);
+    ASSERT_EQ(sum, 50005000);
+
+    std::atomic<size_t> rows = 0;
+    registry.View<const CompA, const CompB>().ParallelEachChunk(pool, [&](size_t inCount, const Entity*, const CompA* inCompAs, const CompB*) -> void {
+        for (size_t i = 0; i < inCount; i++) {
+            ASSERT_EQ(inCompAs[i].value % 2, 1);
+        }
+        rows += inCount;
+    }, 64);
+    ASSERT_EQ(rows, 5000);
+
+    std::atomic<int64_t> runtimeSum = 0;
+    registry.RuntimeView(RuntimeFilter().Include<CompA>().Exclude<CompB>()).ParallelEach(pool, [&](Entity, const CompA& comp) -> void {
+        runtimeSum += comp.value;
+    }, 100);
+    ASSERT_EQ(runtimeSum, 25005000);
+
+    std::atomic<size_t> serialRows = 0;
+    registry.View<CompA>().ParallelEach([&](Entity) -> void { serialRows++; });
+    ASSERT_EQ(serialRows, 10000);
+}
+
 TEST(ECSTest, ComponentLifetimeTest)
 {
     const auto baselineInstanceCount = LifetimeComp::instanceCount;
@@ -300,6 +397,167 @@ TEST(ECSTest, ComponentLifetimeTest)
     ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount);
 }
 
+TEST(ECSTest, BatchTest)
+{
+    const auto baselineInstanceCount = LifetimeComp::instanceCount;
+    const std::string value = "batch component value that does not use the small string optimization";
+    {
+        ECRegistry registry(ArchetypeStorage::chunked);
+        const auto single = registry.Create();
+        registry.Emplace<CompA>(single, 1);
+
+        EventCounts counts;
+        const auto constructedCallback = registry.Events<CompB>().onConstructed.BindLambda([&](ECRegistry&, Entity) -> void { counts.onConstructed++; });
+
+        const auto entities = registry.CreateBatch(3000, CompA(2), LifetimeComp(value));
+        ASSERT_EQ(entities.size(), 3000);
+        ASSERT_EQ(registry.Count(), 3001);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 3000);
+        for (const auto entity : entities) {
+            ASSERT_EQ(registry.Get<CompA>(entity).value, 2);
+            ASSERT_EQ(registry.Get<LifetimeComp>(entity).value, value);
+        }
+
+        std::vector<Entity> targets(entities.begin(), entities.begin() + 1000);
+        targets.emplace_back(single);
+        registry.EmplaceBatch<CompB>(targets, 3.0f);
+        ASSERT_EQ(counts.onConstructed, 1001);
+        ASSERT_EQ((registry.View<CompA, CompB>().Count()), 1001);
+        ASSERT_EQ((registry.View<CompA, CompB, LifetimeComp>().Count()), 1000);
+        for (const auto entity : targets) {
+            ASSERT_EQ(registry.Get<CompB>(entity).value, 3.0f);
+        }
+        ASSERT_EQ(registry.Get<CompA>(single).value, 1);
+        ASSERT_EQ(registry.Get<LifetimeComp>(entities[0]).value, value);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 3000);
+
+        const auto empties = registry.CreateBatch(10);
+        ASSERT_EQ(empties.size(), 10);
+        ASSERT_EQ(registry.CompCount(empties[0]), 0);
+        registry.Events<CompB>().onConstructed.Unbind(constructedCallback);
+    }
+    ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount);
+}
+
+TEST(ECSTest, CommandBufferTest)
+{
+    const auto baselineInstanceCount = LifetimeComp::instanceCount;
+    const std::string value = "command buffer component value that does not use the small string optimization";
+    {
+        ECRegistry registry;
+        const auto entity0 = registry.Create();
+        const auto entity1 = registry.Create();
+        registry.Emplace<CompA>(entity0, 1);
+        registry.Emplace<CompA>(entity1, 2);
+        registry.Emplace<CompB>(entity1, 2.0f);
+
+        ECCommandBuffer buffer;
+        const auto pending0 = buffer.Create();
+        const auto pending1 = buffer.Create();
+        ASSERT_TRUE(ECCommandBuffer::IsPending(pending0));
+        buffer.Emplace<CompA>(pending0, 3);
+        buffer.Emplace<LifetimeComp>(pending0, std::string(value));
+        buffer.AddTag<TestTag>(pending0);
+        buffer.Emplace<CompA>(pending1, 4);
+        buffer.Emplace<CompA>(pending1, 5);
+        buffer.Emplace<CompA>(entity0, 6);
+        buffer.Emplace<CompB>(entity0, 6.0f);
+        buffer.Remove<CompB>(entity1);
+        buffer.Emplace<LifetimeComp>(entity1, std::string(value));
+        buffer.Destroy(entity1);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 2);
+        ASSERT_EQ(registry.Count(), 2);
+
+        const auto created = buffer.Apply(registry);
+        ASSERT_TRUE(buffer.Empty());
+        ASSERT_EQ(created.size(), 2);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 1);
+        ASSERT_EQ(registry.Count(), 3);
+        ASSERT_FALSE(registry.Valid(entity1));
+
+        ASSERT_EQ(registry.Get<CompA>(created[0]).value, 3);
+        ASSERT_EQ(registry.Get<LifetimeComp>(created[0]).value, value);
+        ASSERT_TRUE(registry.HasTag<TestTag>(created[0]));
+        ASSERT_EQ(registry.Get<CompA>(created[1]).value, 5);
+        ASSERT_FALSE(registry.Has<LifetimeComp>(created[1]));
+        ASSERT_EQ(registry.Get<CompA>(entity0).value, 6);
+        ASSERT_EQ(registry.Get<CompB>(entity0).value, 6.0f);
+
+        buffer.Emplace<LifetimeComp>(entity0, std::string(value));
+        buffer.Clear();
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount + 1);
+
+        buffer.Remove<LifetimeComp>(created[0]);
+        buffer.RemoveTag<TestTag>(created[0]);
+        buffer.Apply(registry);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount);
+        ASSERT_FALSE(registry.HasTag<TestTag>(created[0]));
+        ASSERT_EQ(registry.Get<CompA>(created[0]).value, 3);
+
+        registry.Emplace<LifetimeComp>(entity0, std::string(value));
+        buffer.Emplace<LifetimeComp>(entity0, std::string(value));
+        buffer.Remove<LifetimeComp>(entity0);
+        buffer.Emplace<CompB>(created[1], 7.0f);
+        buffer.Remove<CompB>(created[1]);
+        buffer.Apply(registry);
+        ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount);
+        ASSERT_FALSE(registry.Has<LifetimeComp>(entity0));
+        ASSERT_FALSE(registry.Has<CompB>(created[1]));
+        ASSERT_EQ(registry.Get<CompB>(entity0).value, 6.0f);
+    }
+    ASSERT_EQ(LifetimeComp::instanceCount, baselineInstanceCount);
+}
+
+TEST(ECSTest, ThreadCommandBufferTest)
+{
+    ECRegistry registry(ArchetypeStorage::chunked);
+    std::vector<Entity> entities;
+    for (int32_t value = 0; value < 1000; value++) {
+        entities.emplace_back(registry.Create());
+        registry.Emplace<CompA>(entities.back(), value);
+    }
+
+    Common::ThreadPool pool("ECSTest", 4);
+    pool.ExecuteTasks(entities.size(), [&](size_t inIndex) -> void {
+        auto& buffer = registry.ThreadCommandBuffer();
+        const auto entity = entities[inIndex];
+        if (inIndex % 2 == 0) {
+            buffer.Emplace<CompB>(entity, static_cast<float>(inIndex));
+        } else {
+            buffer.Emplace<CompA>(buffer.Create(), static_cast<int32_t>(inIndex));
+        }
+    });
+    ASSERT_EQ(registry.Count(), 1000);
+    registry.FlushCommandBuffers();
+
+    ASSERT_EQ(registry.Count(), 1500);
+    ASSERT_EQ((registry.View<CompA, CompB>().Count()), 500);
+    registry.View<const CompA, const CompB>().Each([](Entity, const CompA& inCompA, const CompB& inCompB) -> void {
+        ASSERT_EQ(static_cast<float>(inCompA.value), inCompB.value);
+    });
+}
+
+TEST(ECSTest, ThreadCommandBufferMoveTest)
+{
+    ECRegistry registry(ArchetypeStorage::chunked);
+    const Entity entity = registry.Create();
+    registry.ThreadCommandBuffer().Emplace<CompA>(entity, 1);
+
+    ECRegistry moved(std::move(registry));
+    moved.ThreadCommandBuffer().Emplace<CompB>(entity, 2.0f);
+    moved.FlushCommandBuffers();
+    ASSERT_EQ(moved.Get<CompA>(entity).value, 1);
+    ASSERT_EQ(moved.Get<CompB>(entity).value, 2.0f);
+
+    ECRegistry assigned(ArchetypeStorage::chunked);
+    assigned.ThreadCommandBuffer().Create();
+    assigned = std::move(moved);
+    assigned.ThreadCommandBuffer().Remove<CompB>(entity);
+    assigned.FlushCommandBuffers();
+    ASSERT_EQ(assigned.Count(), 1);
+    ASSERT_FALSE(assigned.Has<CompB>(entity));
+}
+
 TEST(ECSTest, ComponentDynamicTest)
 {
     CompClass compAClass = &Mirror::Class::Get<CompA>();
@@ -790,3 +1048,37 @@ TEST(ECSTest, ECSRegistrySaveLoadTest)
         ASSERT_EQ(registry.GCompCount(), 2);
     }
 }
+
+TEST(ECSTest, SystemAccessTest)
+{
+    SystemAccess undeclared;
+    SystemAccess readA;
+    readA.Read<CompA>();
+    SystemAccess readA2;
+    readA2.Read<CompA>().GRead<GCompA>();
+    SystemAccess writeA;
+    writeA.Write<CompA>();
+    SystemAccess writeB;
+    writeB.Write<CompB>().GRead<GCompA>();
+    SystemAccess gWriteA;
+    gWriteA.GWrite<GCompA>();
+    SystemAccess structural;
+    structural.Structural();
+
+    ASSERT_FALSE(undeclared.Declared());
+    ASSERT_TRUE(undeclared.ConflictsWith(readA));
+    ASSERT_FALSE(readA.ConflictsWith(readA2));
+    ASSERT_TRUE(readA.ConflictsWith(writeA));
+    ASSERT_TRUE(writeA.ConflictsWith(readA));
+    ASSERT_FALSE(writeA.ConflictsWith(writeB));
+    ASSERT_FALSE(readA2.ConflictsWith(writeB));
+    ASSERT_TRUE(readA2.ConflictsWith(gWriteA));
+    ASSERT_TRUE(gWriteA.ConflictsWith(writeB));
+    ASSERT_TRUE(structural.ConflictsWith(readA));
+
+    ASSERT_TRUE(writeA.CanRead(Internal::GetClass<CompA>()));
+    ASSERT_FALSE(readA.CanWrite(Internal::GetClass<CompA>()));
+    ASSERT_TRUE(structural.CanWrite(Internal::GetClass<CompB>()));
+    ASSERT_TRUE(writeB.GCanRead(Internal::GetClass<GCompA>()));
+    ASSERT_FALSE(writeB.GCanWrite(Internal::GetClass<GCompA>()));
+}
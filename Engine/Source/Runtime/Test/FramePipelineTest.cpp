@@ -0,0 +1,79 @@
+//
+// Created by johnk on 2026/10/17.
+//
+
+#include <atomic>
+#include <vector>
+
+#include <Test/Test.h>
+#include <Runtime/Engine.h>
+#include <Runtime/FramePipeline.h>
+using namespace Runtime;
+
+struct FramePipelineTest : testing::Test {
+    void SetUp() override
+    {
+        EngineInitParams engineInitParams {};
+        engineInitParams.rhiType = RHI::GetAbbrStringByType(RHI::RHIType::dummy);
+
+        EngineHolder::Load("RuntimeTest", engineInitParams);
+        renderThread = &EngineHolder::Get().GetRenderModule().GetRenderThread();
+    }
+
+    void TearDown() override
+    {
+        EngineHolder::Unload();
+    }
+
+    Render::RenderThread* renderThread;
+};
+
+TEST_F(FramePipelineTest, CommandOrderTest)
+{
+    FramePipeline pipeline(2);
+    ASSERT_EQ(pipeline.FramesInFlight(), 2);
+
+    std::vector<uint32_t> executed;
+    for (auto frame = 0u; frame < 8; frame++) {
+        pipeline.BeginFrame();
+        ASSERT_EQ(pipeline.GameFrameNumber(), frame);
+
+        auto* values = pipeline.AllocateArray<uint32_t>(2);
+        values[0] = frame * 2;
+        values[1] = frame * 2 + 1;
+        pipeline.EnqueueRenderCommand([&executed, values]() -> void { executed.emplace_back(values[0]); });
+
+        std::vector<Common::TaskFunction> commands;
+        commands.emplace_back([&executed, values]() -> void { executed.emplace_back(values[1]); });
+        pipeline.EnqueueRenderCommands(commands);
+        ASSERT_TRUE(commands.empty());
+
+        pipeline.EndFrame(*renderThread);
+    }
+    pipeline.Flush(*renderThread);
+
+    ASSERT_EQ(executed.size(), 16);
+    for (auto i = 0u; i < executed.size(); i++) {
+        ASSERT_EQ(executed[i], i);
+    }
+    ASSERT_EQ(pipeline.LastRetiredFrameStats().frameNumber, 8);
+    ASSERT_GE(pipeline.LastRetiredFrameStats().latencyMs, pipeline.LastRetiredFrameStats().renderTimeMs);
+}
+
+TEST_F(FramePipelineTest, FramesInFlightTest)
+{
+    FramePipeline pipeline(2);
+
+    // the render thread is held on the first frame, so the game thread can end two frames before it has to stall
+    std::atomic<bool> release = false;
+    pipeline.EnqueueRenderCommand([&release]() -> void { release.wait(false); });
+    pipeline.EndFrame(*renderThread);
+    pipeline.EndFrame(*renderThread);
+    ASSERT_EQ(pipeline.StalledFrameNum(), 0);
+
+    release = true;
+    release.notify_one();
+    pipeline.EndFrame(*renderThread);
+    pipeline.Flush(*renderThread);
+    ASSERT_LE(pipeline.StalledFrameNum(), 1);
+}
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <unordered_set>
+#include <vector>
 
 #include <Test/Test.h>
 #include <Runtime/Component/Transform.h>
@@ -46,3 +48,202 @@ TEST(TransformSystemTest, PublishesResolvedWorldTransformChanges)
     EXPECT_FLOAT_EQ(registry.Get<Runtime::WorldTransform>(child).localToWorld.translation.x, 9.0f);
     EXPECT_EQ(resolvedWorldTransforms.All(), (std::vector<Runtime::Entity> { child }));
 }
+
+namespace {
+    struct TransformTree {
+        explicit TransformTree(Runtime::ECRegistry& inRegistry)
+            : registry(inRegistry)
+        {
+        }
+
+        Runtime::Entity Add(Runtime::Entity inParent, float inTranslationX)
+        {
+            const Runtime::Entity entity = registry.Create();
+            Common::FTransform localTransform;
+            localTransform.translation = Common::FVec3(inTranslationX, 0.0f, 0.0f);
+            Common::FTransform worldTransform = localTransform;
+            if (inParent != Runtime::entityNull) {
+                worldTransform.translation.x += registry.Get<Runtime::WorldTransform>(inParent).localToWorld.translation.x;
+            }
+            registry.Emplace<Runtime::Hierarchy>(entity);
+            registry.Emplace<Runtime::WorldTransform>(entity, worldTransform);
+            if (inParent != Runtime::entityNull) {
+                registry.Emplace<Runtime::LocalTransform>(entity, localTransform);
+                Runtime::HierarchyOps::AttachToParent(registry, entity, inParent);
+            }
+            entities.emplace_back(entity);
+            return entity;
+        }
+
+        std::vector<float> WorldTranslations() const
+        {
+            std::vector<float> result;
+            result.reserve(entities.size());
+            for (const auto entity : entities) {
+                result.emplace_back(registry.Get<Runtime::WorldTransform>(entity).localToWorld.translation.x);
+            }
+            return result;
+        }
+
+        Runtime::ECRegistry& registry;
+        std::vector<Runtime::Entity> entities;
+    };
+
+    // one root with a wide first level, every first level node carries a chain, the dirty set mixes a root world
+    // change with local changes below it and in a chain that is also covered by the root
+    std::vector<float> PropagateMixedDirtyTree(Runtime::TransformPropagation inPropagation)
+    {
+        Runtime::ECRegistry registry;
+        TransformTree tree(registry);
+        const auto root = tree.Add(Runtime::entityNull, 0.0f);
+        std::vector<Runtime::Entity> chainNodes;
+        for (auto i = 0; i < 8; i++) {
+            auto parent = tree.Add(root, static_cast<float>(i));
+            for (auto depth = 0; depth < 6; depth++) {
+                parent = tree.Add(parent, 1.0f);
+                chainNodes.emplace_back(parent);
+            }
+        }
+
+        Runtime::SystemSetupContext setupContext;
+        Runtime::TransformSystem transformSystem(registry, setupContext);
+        transformSystem.SetPropagation(inPropagation);
+        transformSystem.Tick(1.0f / 60.0f);
+
+        registry.Update<Runtime::WorldTransform>(root, [](Runtime::WorldTransform& transform) -> void {
+            transform.localToWorld.translation.x = 10.0f;
+        });
+        registry.Update<Runtime::LocalTransform>(chainNodes[2], [](Runtime::LocalTransform& transform) -> void {
+            transform.localToParent.translation.x = 3.0f;
+        });
+        registry.Update<Runtime::LocalTransform>(chainNodes[4], [](Runtime::LocalTransform& transform) -> void {
+            transform.localToParent.translation.x = 5.0f;
+        });
+        registry.Update<Runtime::LocalTransform>(chainNodes[20], [](Runtime::LocalTransform& transform) -> void {
+            transform.localToParent.translation.x = -2.0f;
+        });
+        transformSystem.Tick(1.0f / 60.0f);
+        return tree.WorldTranslations();
+    }
+}
+
+TEST(TransformSystemTest, LevelOrderedPropagationMatchesRecursive)
+{
+    const auto recursive = PropagateMixedDirtyTree(Runtime::TransformPropagation::recursive);
+    const auto levelOrdered = PropagateMixedDirtyTree(Runtime::TransformPropagation::levelOrdered);
+    ASSERT_EQ(recursive.size(), levelOrdered.size());
+    for (size_t i = 0; i < recursive.size(); i++) {
+        EXPECT_FLOAT_EQ(recursive[i], levelOrdered[i]);
+    }
+
+    // root, then 8 chains of 7 nodes, chain 0 is 10 + 0, then 1, 1, 3, 1, 5, 1 accumulated
+    EXPECT_FLOAT_EQ(levelOrdered[0], 10.0f);
+    EXPECT_FLOAT_EQ(levelOrdered[1], 10.0f);
+    EXPECT_FLOAT_EQ(levelOrdered[3], 12.0f);
+    EXPECT_FLOAT_EQ(levelOrdered[4], 15.0f);
+    EXPECT_FLOAT_EQ(levelOrdered[6], 21.0f);
+    EXPECT_FLOAT_EQ(levelOrdered[7], 22.0f);
+}
+
+TEST(TransformSystemTest, LevelOrderedPropagationNotifiesEachEntityOnce)
+{
+    Runtime::ECRegistry registry;
+    TransformTree tree(registry);
+    const auto root = tree.Add(Runtime::entityNull, 0.0f);
+    const auto child = tree.Add(root, 1.0f);
+    const auto grandChild = tree.Add(child, 1.0f);
+
+    Runtime::SystemSetupContext setupContext;
+    Runtime::TransformSystem transformSystem(registry, setupContext);
+    ASSERT_EQ(transformSystem.GetPropagation(), Runtime::TransformPropagation::levelOrdered);
+    transformSystem.Tick(1.0f / 60.0f);
+
+    auto resolvedWorldTransforms = registry.Observer();
+    resolvedWorldTransforms.ObUpdated<Runtime::WorldTransform>();
+    registry.Update<Runtime::LocalTransform>(child, [](Runtime::LocalTransform& transform) -> void {
+        transform.localToParent.translation.x = 2.0f;
+    });
+    registry.Update<Runtime::LocalTransform>(grandChild, [](Runtime::LocalTransform& transform) -> void {
+        transform.localToParent.translation.x = 3.0f;
+    });
+    resolvedWorldTransforms.Clear();
+    transformSystem.Tick(1.0f / 60.0f);
+
+    EXPECT_FLOAT_EQ(registry.Get<Runtime::WorldTransform>(grandChild).localToWorld.translation.x, 5.0f);
+    auto changed = resolvedWorldTransforms.All();
+    std::ranges::sort(changed);
+    auto expected = std::vector<Runtime::Entity> { child, grandChild };
+    std::ranges::sort(expected);
+    EXPECT_EQ(changed, expected);
+}
+
+TEST(TransformSystemTest, PropagatesBelowEntitiesWithoutWorldTransform)
+{
+    for (const auto propagation : { Runtime::TransformPropagation::recursive, Runtime::TransformPropagation::levelOrdered }) {
+        Runtime::ECRegistry registry;
+        TransformTree tree(registry);
+        const auto root = tree.Add(Runtime::entityNull, 0.0f);
+
+        // the group only carries a hierarchy, the world transform of the root does not reach below it
+        const auto group = registry.Create();
+        registry.Emplace<Runtime::Hierarchy>(group);
+        Runtime::HierarchyOps::AttachToParent(registry, group, root);
+        const auto subRoot = registry.Create();
+        registry.Emplace<Runtime::Hierarchy>(subRoot);
+        registry.Emplace<Runtime::WorldTransform>(subRoot);
+        Runtime::HierarchyOps::AttachToParent(registry, subRoot, group);
+        const auto leaf = tree.Add(subRoot, 1.0f);
+
+        Runtime::SystemSetupContext setupContext;
+        Runtime::TransformSystem transformSystem(registry, setupContext);
+        transformSystem.SetPropagation(propagation);
+        transformSystem.Tick(1.0f / 60.0f);
+
+        registry.Update<Runtime::WorldTransform>(root, [](Runtime::WorldTransform& transform) -> void {
+            transform.localToWorld.translation.x = 10.0f;
+        });
+        registry.Update<Runtime::WorldTransform>(subRoot, [](Runtime::WorldTransform& transform) -> void {
+            transform.localToWorld.translation.x = 4.0f;
+        });
+        transformSystem.Tick(1.0f / 60.0f);
+
+        EXPECT_FLOAT_EQ(registry.Get<Runtime::WorldTransform>(leaf).localToWorld.translation.x, 5.0f);
+    }
+}
+
+TEST(TransformSystemTest, PropagatesParentRotation)
+{
+    for (const auto propagation : { Runtime::TransformPropagation::recursive, Runtime::TransformPropagation::levelOrdered }) {
+        Runtime::ECRegistry registry;
+        TransformTree tree(registry);
+        const auto root = tree.Add(Runtime::entityNull, 0.0f);
+        const auto child = tree.Add(root, 1.0f);
+
+        Runtime::SystemSetupContext setupContext;
+        Runtime::TransformSystem transformSystem(registry, setupContext);
+        transformSystem.SetPropagation(propagation);
+        transformSystem.Tick(1.0f / 60.0f);
+
+        const Common::FTransform rootTransform(Common::FVec3(2.0f, 2.0f, 2.0f), Common::FQuat(Common::FVec3Consts::unitZ, 90.0f), Common::FVec3(0.0f, 0.0f, 1.0f));
+        registry.Update<Runtime::WorldTransform>(root, [&](Runtime::WorldTransform& transform) -> void {
+            transform.localToWorld = rootTransform;
+        });
+        transformSystem.Tick(1.0f / 60.0f);
+
+        const auto& childWorld = registry.Get<Runtime::WorldTransform>(child).localToWorld;
+        EXPECT_TRUE(Common::AlmostEqual(childWorld.translation, rootTransform.TransformPosition(Common::FVec3(1.0f, 0.0f, 0.0f)), 1.0e-5f));
+        EXPECT_TRUE(Common::AlmostEqual(childWorld.rotation.GetRotationMatrix(), rootTransform.rotation.GetRotationMatrix(), 1.0e-5f));
+        EXPECT_TRUE(Common::AlmostEqual(childWorld.scale, rootTransform.scale, 1.0e-5f));
+
+        // editing the child world transform resolves back to the local transform that reproduces it
+        Common::FTransform childTarget = childWorld;
+        childTarget.translation = Common::FVec3(3.0f, 4.0f, 5.0f);
+        registry.Update<Runtime::WorldTransform>(child, [&](Runtime::WorldTransform& transform) -> void {
+            transform.localToWorld = childTarget;
+        });
+        transformSystem.Tick(1.0f / 60.0f);
+
+        const auto& childLocal = registry.Get<Runtime::LocalTransform>(child).localToParent;
+        EXPECT_TRUE(Common::AlmostEqual((rootTransform * childLocal).translation, childTarget.translation, 1.0e-5f));
+    }
+}
@@ -2,6 +2,8 @@
 // Created by johnk on 2024/12/25.
 //
 
+#include <utility>
+
 #include <WorldTest.h>
 #include <Test/Test.h>
 #include <Runtime/World.h>
@@ -197,3 +199,66 @@ TEST_F(WorldTest, ConcurrentTest)
     }
     world.Stop();
 }
+
+AutomaticTest_ProducerSystem::AutomaticTest_ProducerSystem(Runtime::ECRegistry& inRegistry, const Runtime::SystemSetupContext& inContext)
+    : System(inRegistry, inContext)
+{
+}
+
+AutomaticTest_ProducerSystem::~AutomaticTest_ProducerSystem() = default;
+
+void AutomaticTest_ProducerSystem::Tick(float inDeltaTimeSeconds)
+{
+    registry.GGet<GAutomaticTest_Value>().value = 1;
+}
+
+AutomaticTest_ConsumerSystem::AutomaticTest_ConsumerSystem(Runtime::ECRegistry& inRegistry, const Runtime::SystemSetupContext& inContext)
+    : System(inRegistry, inContext)
+{
+}
+
+AutomaticTest_ConsumerSystem::~AutomaticTest_ConsumerSystem() = default;
+
+void AutomaticTest_ConsumerSystem::Tick(float inDeltaTimeSeconds)
+{
+    registry.GGet<GAutomaticTest_Result>().sum += std::as_const(registry).GGet<GAutomaticTest_Value>().value;
+}
+
+AutomaticTest_VerifySystem::AutomaticTest_VerifySystem(Runtime::ECRegistry& inRegistry, const Runtime::SystemSetupContext& inContext)
+    : System(inRegistry, inContext)
+{
+    registry.GEmplace<GAutomaticTest_Value>().value = 0;
+    auto& result = registry.GEmplace<GAutomaticTest_Result>();
+    result.sum = 0;
+    result.tickCount = 0;
+}
+
+AutomaticTest_VerifySystem::~AutomaticTest_VerifySystem() = default;
+
+void AutomaticTest_VerifySystem::Tick(float inDeltaTimeSeconds)
+{
+    auto& result = registry.GGet<GAutomaticTest_Result>();
+    result.tickCount++;
+    registry.GGet<GAutomaticTest_Value>().value = 0;
+    ASSERT_EQ(result.sum, result.tickCount);
+}
+
+TEST_F(WorldTest, AutomaticScheduleTest)
+{
+    SystemGraph systemGraph;
+    auto& automaticGroup = systemGraph.AddGroup("AutomaticGroup", SystemExecuteStrategy::automatic);
+    automaticGroup.EmplaceSystem<AutomaticTest_ProducerSystem>();
+    automaticGroup.EmplaceSystem<AutomaticTest_ConsumerSystem>().GetAccess()
+        .GRead<GAutomaticTest_Value>()
+        .GWrite<GAutomaticTest_Result>();
+    auto& verifyGroup = systemGraph.AddGroup("VerifyGroup", SystemExecuteStrategy::sequential);
+    verifyGroup.EmplaceSystem<AutomaticTest_VerifySystem>();
+
+    World world("TestWorld", nullptr, PlayType::game);
+    world.SetSystemGraph(systemGraph);
+    world.Play();
+    for (auto i = 0; i < 5; i++) {
+        engine->Tick(0.0167f);
+    }
+    world.Stop();
+}
@@ -84,3 +84,43 @@ struct EClass() ConcurrentTest_VerifySystem : public Runtime::System {
 
     void Tick(float inDeltaTimeSeconds) override;
 };
+
+struct EClass(globalComp) GAutomaticTest_Value {
+    EClassBody(GAutomaticTest_Value)
+
+    uint32_t value;
+};
+
+struct EClass(globalComp) GAutomaticTest_Result {
+    EClassBody(GAutomaticTest_Result)
+
+    uint32_t sum;
+    uint32_t tickCount;
+};
+
+struct EClass(globalWrites=GAutomaticTest_Value) AutomaticTest_ProducerSystem : public Runtime::System {
+    EPolyDerivedClassBody(AutomaticTest_ProducerSystem)
+
+    explicit AutomaticTest_ProducerSystem(Runtime::ECRegistry& inRegistry, const Runtime::SystemSetupContext& inContext);
+    ~AutomaticTest_ProducerSystem() override;
+
+    void Tick(float inDeltaTimeSeconds) override;
+};
+
+struct EClass() AutomaticTest_ConsumerSystem : public Runtime::System {
+    EPolyDerivedClassBody(AutomaticTest_ConsumerSystem)
+
+    explicit AutomaticTest_ConsumerSystem(Runtime::ECRegistry& inRegistry, const Runtime::SystemSetupContext& inContext);
+    ~AutomaticTest_ConsumerSystem() override;
+
+    void Tick(float inDeltaTimeSeconds) override;
+};
+
+struct EClass() AutomaticTest_VerifySystem : public Runtime::System {
+    EPolyDerivedClassBody(AutomaticTest_VerifySystem)
+
+    explicit AutomaticTest_VerifySystem(Runtime::ECRegistry& inRegistry, const Runtime::SystemSetupContext& inContext);
+    ~AutomaticTest_VerifySystem() override;
+
+    void Tick(float inDeltaTimeSeconds) override;
+};
@@ -110,7 +110,7 @@ void BaseTexApp::OnCreate()
     CreateDevice();
     CreateSurface();
 
-    RenderThread::Get().EmplaceTask([this]() -> void {
+    RenderThread::Get().Spawn([this]() -> void {
         FetchShaderInstances();
         CreateSwapChain();
         CreateVertexAndIndexBuffer();
@@ -121,7 +121,7 @@ void BaseTexApp::OnCreate()
 
 void BaseTexApp::OnDrawFrame()
 {
-    RenderThread::Get().EmplaceTask([this]() -> void {
+    RenderThread::Get().Spawn([this]() -> void {
         frameFence->Reset();
         const auto backTextureIndex = swapChain->AcquireBackTexture(imageReadySemaphore.Get());
 
@@ -207,7 +207,7 @@ void BaseTexApp::OnDrawFrame()
 
 void BaseTexApp::OnDestroy()
 {
-    RenderThread::Get().EmplaceTask([this]() -> void {
+    RenderThread::Get().Spawn([this]() -> void {
         const UniquePtr<Fence> fence = device->CreateFence(false);
         device->GetQueue(QueueType::graphics, 0)->Flush(fence.Get());
         fence->Wait();
@@ -240,8 +240,7 @@ void BaseTexApp::CompileAllShaders() const
     options.includeDirectories = {"../Test/Sample/ShaderInclude", "../Test/Sample/Rendering-BaseTexture"};
     options.byteCodeType = GetRHIType() == RHI::RHIType::directX12 ? ShaderByteCodeType::dxil : ShaderByteCodeType::spirv;
     options.withDebugInfo = false;
-    auto result = ShaderTypeCompiler::Get().CompileAll(options);
-    const auto& [success, errorInfo] = result.get();
+    const auto [success, errorInfo] = Common::SyncWait(ShaderTypeCompiler::Get().CompileAll(options));
     Assert(success);
 }
 
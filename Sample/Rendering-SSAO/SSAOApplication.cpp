@@ -143,7 +143,7 @@ protected:
         CreateDevice();
         CreateSurface();
 
-        RenderThread::Get().EmplaceTask([this]() -> void {
+        RenderThread::Get().Spawn([this]() -> void {
             FetchShaderInstances();
             CreateSwapChain();
             CreateVertexAndIndexBuffer();
@@ -163,7 +163,7 @@ protected:
     {
         uboSceneParams.view = GetCamera().GetViewMatrix();
 
-        RenderThread::Get().EmplaceTask([this]() -> void {
+        RenderThread::Get().Spawn([this]() -> void {
             frameFence->Reset();
             const auto backTextureIndex = swapChain->AcquireBackTexture(imageReadySemaphore.Get());
 
@@ -427,7 +427,7 @@ protected:
 
     void OnDestroy() override
     {
-        RenderThread::Get().EmplaceTask([this]() -> void {
+        RenderThread::Get().Spawn([this]() -> void {
             const UniquePtr<Fence> fence = device->CreateFence(false);
             device->GetQueue(QueueType::graphics, 0)->Flush(fence.Get());
             fence->Wait();
@@ -519,8 +519,7 @@ private:
         options.includeDirectories = {"../Test/Sample/ShaderInclude", "../Test/Sample/Rendering-SSAO/Shader"};
         options.byteCodeType = GetRHIType() == RHI::RHIType::directX12 ? ShaderByteCodeType::dxil : ShaderByteCodeType::spirv;
         options.withDebugInfo = false;
-        auto result = ShaderTypeCompiler::Get().CompileAll(options);
-        const auto& [success, errorInfo] = result.get();
+        const auto [success, errorInfo] = Common::SyncWait(ShaderTypeCompiler::Get().CompileAll(options));
         Assert(success);
     }
 
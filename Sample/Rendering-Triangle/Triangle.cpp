@@ -102,7 +102,7 @@ void TriangleApplication::OnCreate()
     CreateDevice();
     CreateSurface();
 
-    RenderThread::Get().EmplaceTask([this]() -> void {
+    RenderThread::Get().Spawn([this]() -> void {
         FetchShaderInstances();
         CreateSwapChain();
         CreateTriangleVertexBuffer();
@@ -112,7 +112,7 @@ void TriangleApplication::OnCreate()
 
 void TriangleApplication::OnDrawFrame()
 {
-    RenderThread::Get().EmplaceTask([this]() -> void {
+    RenderThread::Get().Spawn([this]() -> void {
         frameFence->Reset();
         const auto backTextureIndex = swapChain->AcquireBackTexture(imageReadySemaphore.Get());
 
@@ -192,7 +192,7 @@ void TriangleApplication::OnDrawFrame()
 
 void TriangleApplication::OnDestroy()
 {
-    RenderThread::Get().EmplaceTask([this]() -> void {
+    RenderThread::Get().Spawn([this]() -> void {
         const UniquePtr<Fence> fence = device->CreateFence(false);
         device->GetQueue(QueueType::graphics, 0)->Flush(fence.Get());
         fence->Wait();
@@ -220,8 +220,7 @@ void TriangleApplication::CompileAllShaders() const
     options.includeDirectories = {"../Test/Sample/ShaderInclude", "../Test/Sample/Rendering-Triangle"};
     options.byteCodeType = GetRHIType() == RHI::RHIType::directX12 ? ShaderByteCodeType::dxil : ShaderByteCodeType::spirv;
     options.withDebugInfo = false;
-    auto result = ShaderTypeCompiler::Get().CompileAll(options);
-    const auto& [success, errorInfo] = result.get();
+    const auto [success, errorInfo] = Common::SyncWait(ShaderTypeCompiler::Get().CompileAll(options));
     Assert(success);
 }
 